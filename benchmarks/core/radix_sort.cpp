@@ -0,0 +1,85 @@
+#include <ink/core/radix_sort.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+using namespace ink;
+
+namespace {
+
+/// @brief
+///   Number of keys used by sort benchmarks. Large enough to be split across threads.
+constexpr std::size_t SortSize = 1 << 20;
+
+template <typename Key>
+auto makeKeys(std::uint32_t significantBits) -> std::vector<Key> {
+    std::mt19937_64  random(42);
+    std::vector<Key> keys(SortSize);
+    for (auto &key : keys)
+        key = static_cast<Key>(random() >> (64 - significantBits));
+    return keys;
+}
+
+} // namespace
+
+TEST_CASE("Radix sort 32-bit keys", "[RadixSort]") {
+    const std::vector<std::uint32_t> keys = makeKeys<std::uint32_t>(30);
+
+    std::vector<std::uint32_t> sorted(SortSize);
+    std::vector<std::uint32_t> indices(SortSize);
+    std::vector<std::uint32_t> keyScratch(SortSize);
+    std::vector<std::uint32_t> indexScratch(SortSize);
+
+    BENCHMARK("std::sort keys x1M") {
+        sorted = keys;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted.back();
+    };
+
+    BENCHMARK("radixSort keys x1M") {
+        sorted = keys;
+        radixSort(sorted.data(), SortSize);
+        return sorted.back();
+    };
+
+    BENCHMARK("std::sort indices by key x1M") {
+        std::iota(indices.begin(), indices.end(), 0U);
+        std::sort(indices.begin(), indices.end(),
+                  [&keys](std::uint32_t a, std::uint32_t b) { return keys[a] < keys[b]; });
+        return indices.back();
+    };
+
+    BENCHMARK("radixSort indices by key x1M") {
+        sorted = keys;
+        std::iota(indices.begin(), indices.end(), 0U);
+        radixSort(sorted.data(), indices.data(), SortSize, keyScratch.data(), indexScratch.data());
+        return indices.back();
+    };
+}
+
+TEST_CASE("Radix sort 64-bit keys", "[RadixSort]") {
+    const std::vector<std::uint64_t> keys = makeKeys<std::uint64_t>(63);
+
+    std::vector<std::uint64_t> sorted(SortSize);
+    std::vector<std::uint32_t> indices(SortSize);
+
+    BENCHMARK("std::sort 64-bit keys x1M") {
+        sorted = keys;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted.back();
+    };
+
+    BENCHMARK("radixSort 64-bit keys x1M") {
+        sorted = keys;
+        radixSort(sorted.data(), SortSize);
+        return sorted.back();
+    };
+
+    BENCHMARK("radixSort 64-bit indices by key x1M") {
+        sorted = keys;
+        std::iota(indices.begin(), indices.end(), 0U);
+        radixSort(sorted.data(), indices.data(), SortSize);
+        return indices.back();
+    };
+}
@@ -0,0 +1,57 @@
+#include "data.hpp"
+
+#include <ink/math/animation.hpp>
+
+using namespace ink;
+using bench::ArraySize;
+
+// Each benchmark samples ArraySize joints, so bones sampled per second is 1024 / mean time.
+TEST_CASE("Animation sampling", "[Animation]") {
+    constexpr std::size_t KeyCount = 60;
+
+    const std::vector<Vector3>    vectors   = bench::makeVectors(KeyCount + ArraySize);
+    const std::vector<Quaternion> rotations = bench::makeQuaternions(KeyCount + ArraySize);
+
+    std::vector<float> times(KeyCount);
+    for (std::size_t i = 0; i < KeyCount; ++i)
+        times[i] = static_cast<float>(i) / 30.0f;
+
+    AnimationClip clip(ArraySize);
+    for (std::uint32_t joint = 0; joint < ArraySize; ++joint) {
+        clip.setTranslation(joint, times.data(), vectors.data() + joint, KeyCount);
+        clip.setRotation(joint, times.data(), rotations.data() + joint, KeyCount);
+        clip.setScale(joint, times.data(), vectors.data() + joint, KeyCount);
+    }
+
+    AnimationCursor        cursor(clip);
+    std::vector<Transform> pose(ArraySize);
+    float                  time = 0.0f;
+
+    BENCHMARK("Sample with cursor x1024") {
+        time += 1.0f / 60.0f;
+        if (time >= clip.duration())
+            time = 0.0f;
+        clip.sample(time, cursor, pose.data());
+        return pose.back();
+    };
+
+    BENCHMARK("Sample with binary search x1024") {
+        time += 1.0f / 60.0f;
+        if (time >= clip.duration())
+            time = 0.0f;
+        clip.sample(time, pose.data());
+        return pose.back();
+    };
+
+    std::vector<Transform> other(ArraySize);
+    clip.sample(1.0f, other.data());
+
+    const Transform *poses[]   = {pose.data(), other.data()};
+    const float      weights[] = {0.3f, 0.7f};
+
+    std::vector<Transform> out(ArraySize);
+    BENCHMARK("Blend 2 poses x1024") {
+        blendPoses(poses, weights, 2, out.data(), ArraySize);
+        return out.back();
+    };
+}
@@ -0,0 +1,81 @@
+#include "gltf.hpp"
+
+#include <ink/math/bvh.hpp>
+
+using namespace ink;
+
+namespace {
+
+/// @brief
+///   Generate deterministic rays from a sphere of the specified radius towards the center.
+auto makeRays(std::size_t count, float radius) -> std::vector<Ray> {
+    std::vector<Ray> rays;
+    rays.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float   f = static_cast<float>(i);
+        const Vector3 origin(std::sin(f * 0.13f) * radius, std::cos(f * 0.29f) * radius,
+                             std::sin(f * 0.71f + 2.0f) * radius);
+        const Vector3 target(std::sin(f * 1.1f) * radius * 0.3f, std::cos(f * 1.7f) * radius * 0.3f,
+                             std::sin(f * 2.3f) * radius * 0.3f);
+        rays.emplace_back(origin, (target - origin).normalized());
+    }
+    return rays;
+}
+
+} // namespace
+
+TEST_CASE("Bvh", "[Bvh]") {
+    const std::vector<bench::Mesh> meshes =
+        bench::loadMeshes(INK_BENCHMARK_ASSET_DIR "/DamagedHelmet.glb");
+    REQUIRE(!meshes.empty());
+
+    // Merge all primitives into one mesh.
+    std::vector<Vector3>       positions;
+    std::vector<std::uint32_t> indices;
+    for (const bench::Mesh &mesh : meshes) {
+        const auto base = static_cast<std::uint32_t>(positions.size());
+        positions.insert(positions.end(), mesh.positions.begin(), mesh.positions.end());
+        for (const std::uint32_t index : mesh.indices)
+            indices.push_back(base + index);
+    }
+
+    const std::size_t triangleCount = indices.size() / 3;
+    REQUIRE(triangleCount > 0);
+
+    BENCHMARK("Build") {
+        return MeshBvh(positions.data(), indices.data(), triangleCount);
+    };
+
+    BENCHMARK("Build single thread") {
+        return MeshBvh(positions.data(), indices.data(), triangleCount, 1);
+    };
+
+    MeshBvh mesh(positions.data(), indices.data(), triangleCount);
+    BENCHMARK("Refit") {
+        mesh.refit(positions.data());
+        return mesh.bvh().bounds();
+    };
+
+    const AABB  bounds = mesh.bvh().bounds();
+    const float radius = (bounds.max - bounds.min).length();
+
+    std::vector<Ray> rays = makeRays(65536, radius);
+    for (Ray &ray : rays)
+        ray.origin += bounds.center();
+
+    BENCHMARK("Closest hit x65536") {
+        std::size_t hitCount = 0;
+        for (const Ray &ray : rays) {
+            RayHit hit;
+            hitCount += mesh.intersect(ray, hit) ? 1 : 0;
+        }
+        return hitCount;
+    };
+
+    BENCHMARK("Any hit x65536") {
+        std::size_t hitCount = 0;
+        for (const Ray &ray : rays)
+            hitCount += mesh.occluded(ray, radius * 2.0f) ? 1 : 0;
+        return hitCount;
+    };
+}
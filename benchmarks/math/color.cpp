@@ -0,0 +1,82 @@
+#include "data.hpp"
+
+#include <ink/math/color.hpp>
+
+using namespace ink;
+using bench::ArraySize;
+
+TEST_CASE("sRGB conversion", "[Color]") {
+    std::vector<Color> colors(ArraySize);
+    for (std::size_t i = 0; i < ArraySize; ++i) {
+        const float t = static_cast<float>(i) / static_cast<float>(ArraySize);
+        colors[i]     = Color(t, 1.0f - t, t * t, 1.0f);
+    }
+
+    std::vector<Color>    out(ArraySize);
+    std::vector<UNorm8x4> packed(ArraySize);
+
+    BENCHMARK("linearToSrgb x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = linearToSrgb(colors[i]);
+        return out.back();
+    };
+
+    BENCHMARK("linearToSrgbFast x1024") {
+        linearToSrgbFast(colors.data(), out.data(), ArraySize);
+        return out.back();
+    };
+
+    BENCHMARK("UNorm8x4(linearToSrgb) x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            packed[i] = UNorm8x4(linearToSrgb(colors[i]).toVector4());
+        return packed.back().bits;
+    };
+
+    BENCHMARK("linearToSrgb 8-bit table x1024") {
+        linearToSrgb(colors.data(), packed.data(), ArraySize);
+        return packed.back().bits;
+    };
+
+    BENCHMARK("srgbToLinear 8-bit table x1024") {
+        srgbToLinear(packed.data(), out.data(), ArraySize);
+        return out.back();
+    };
+}
+
+TEST_CASE("4K image conversion", "[Color]") {
+    // Whole 3840x2160 images do not fit in cache and are split across threads.
+    constexpr std::size_t Count = 3840 * 2160;
+
+    // Opaque pixels so that repeated premultiplication does not produce denormals.
+    std::vector<UNorm8x4> image(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+        image[i].bits = static_cast<std::uint32_t>(i * 2654435761u) | 0xFF000000U;
+
+    std::vector<Color> linear(Count);
+    std::vector<float> lum(Count);
+
+    BENCHMARK("srgbToLinear 4K") {
+        srgbToLinear(image.data(), linear.data(), Count);
+        return linear.back();
+    };
+
+    BENCHMARK("premultiplyAlpha 4K") {
+        premultiplyAlpha(linear.data(), Count);
+        return linear.back();
+    };
+
+    BENCHMARK("luminance 4K") {
+        luminance(linear.data(), lum.data(), Count);
+        return lum.back();
+    };
+
+    BENCHMARK("linearToSrgb 4K") {
+        linearToSrgb(linear.data(), image.data(), Count);
+        return image.back().bits;
+    };
+
+    BENCHMARK("premultiplyAlpha 8-bit 4K") {
+        premultiplyAlpha(image.data(), Count);
+        return image.back().bits;
+    };
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <ink/math/matrix.hpp>
+#include <ink/math/quaternion.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace bench {
+
+/// @brief
+///   Number of elements used by array throughput benchmarks. Arrays of this size fit in L1 cache
+///   for all math types, so the benchmarks measure computation rather than memory bandwidth.
+inline constexpr std::size_t ArraySize = 1024;
+
+/// @brief
+///   Generate deterministic non-zero vectors. Values are computed at runtime so that the compiler
+///   cannot fold the benchmarked expressions.
+inline auto makeVectors(std::size_t count) noexcept -> std::vector<ink::Vector3> {
+    std::vector<ink::Vector3> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float f = static_cast<float>(i) + 1.0f;
+        result.emplace_back(std::sin(f) * 3.0f + 4.0f, std::cos(f * 0.7f) * 2.0f, f * 0.01f);
+    }
+    return result;
+}
+
+/// @brief
+///   Generate deterministic unit quaternions.
+inline auto makeQuaternions(std::size_t count) noexcept -> std::vector<ink::Quaternion> {
+    const std::vector<ink::Vector3> axes = makeVectors(count);
+
+    std::vector<ink::Quaternion> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        result.emplace_back(axes[i].normalized(), static_cast<float>(i) * 0.37f);
+    return result;
+}
+
+/// @brief
+///   Generate deterministic invertible affine transforms.
+inline auto makeMatrices(std::size_t count) noexcept -> std::vector<ink::Matrix4> {
+    const std::vector<ink::Vector3>    offsets   = makeVectors(count);
+    const std::vector<ink::Quaternion> rotations = makeQuaternions(count);
+
+    std::vector<ink::Matrix4> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        result.push_back(ink::Matrix4(1.0f)
+                             .scaled(ink::Vector3(2.0f, 0.5f, 1.5f))
+                             .rotated(rotations[i])
+                             .translated(offsets[i]));
+    }
+    return result;
+}
+
+} // namespace bench
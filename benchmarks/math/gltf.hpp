@@ -0,0 +1,86 @@
+#pragma once
+
+#include <ink/math/vector.hpp>
+
+#include <tiny_gltf.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/// @brief
+///   Indexed triangle mesh loaded from a glTF primitive.
+struct Mesh {
+    std::vector<ink::Vector3>  positions;
+    std::vector<std::uint32_t> indices;
+};
+
+/// @brief
+///   Load positions and indices of all indexed triangle primitives in the specified glTF binary
+///   file. Each primitive becomes a separate mesh. Node transforms are ignored.
+///
+/// @param path
+///   Path to the .glb file.
+///
+/// @return
+///   Meshes of the file. The result is empty if failed to load the file.
+inline auto loadMeshes(const std::string &path) -> std::vector<Mesh> {
+    tinygltf::TinyGLTF loader;
+    tinygltf::Model    model;
+    std::string        error;
+    std::string        warning;
+    if (!loader.LoadBinaryFromFile(&model, &error, &warning, path))
+        return {};
+
+    std::vector<Mesh> result;
+    for (const auto &gltfMesh : model.meshes) {
+        for (const auto &primitive : gltfMesh.primitives) {
+            if (primitive.indices < 0 || primitive.mode != TINYGLTF_MODE_TRIANGLES)
+                continue;
+
+            Mesh mesh;
+
+            const auto &positionAccessor = model.accessors[primitive.attributes.at("POSITION")];
+            const auto &positionView     = model.bufferViews[positionAccessor.bufferView];
+            const auto *positionData     = model.buffers[positionView.buffer].data.data() +
+                                       positionView.byteOffset + positionAccessor.byteOffset;
+            const auto positionStride =
+                static_cast<std::size_t>(positionAccessor.ByteStride(positionView));
+
+            mesh.positions.resize(positionAccessor.count);
+            for (std::size_t i = 0; i < positionAccessor.count; ++i) {
+                float xyz[3];
+                std::memcpy(xyz, positionData + i * positionStride, sizeof(xyz));
+                mesh.positions[i] = ink::Vector3(xyz[0], xyz[1], xyz[2]);
+            }
+
+            const auto &indexAccessor = model.accessors[primitive.indices];
+            const auto &indexView     = model.bufferViews[indexAccessor.bufferView];
+            const auto *indexData     = model.buffers[indexView.buffer].data.data() +
+                                    indexView.byteOffset + indexAccessor.byteOffset;
+
+            mesh.indices.resize(indexAccessor.count);
+            for (std::size_t i = 0; i < indexAccessor.count; ++i) {
+                if (indexAccessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT) {
+                    std::memcpy(&mesh.indices[i], indexData + i * sizeof(std::uint32_t),
+                                sizeof(std::uint32_t));
+                } else if (indexAccessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) {
+                    mesh.indices[i] = indexData[i];
+                } else {
+                    std::uint16_t index;
+                    std::memcpy(&index, indexData + i * sizeof(index), sizeof(index));
+                    mesh.indices[i] = index;
+                }
+            }
+
+            result.push_back(std::move(mesh));
+        }
+    }
+
+    return result;
+}
+
+} // namespace bench
@@ -0,0 +1,37 @@
+#include "data.hpp"
+
+#include <ink/math/hierarchy.hpp>
+
+using namespace ink;
+using bench::ArraySize;
+
+TEST_CASE("Transform hierarchy", "[Hierarchy]") {
+    const std::vector<Vector3>    offsets   = bench::makeVectors(ArraySize);
+    const std::vector<Quaternion> rotations = bench::makeQuaternions(ArraySize);
+
+    // Each node has up to 4 children.
+    TransformHierarchy hierarchy;
+    for (std::size_t i = 0; i < ArraySize; ++i) {
+        const auto parent = (i == 0) ? TransformHierarchy::NoParent
+                                     : static_cast<std::uint32_t>((i - 1) / 4);
+        hierarchy.addNode(parent, Transform(offsets[i], rotations[i], Vector3(1.0f)));
+    }
+    hierarchy.update();
+
+    BENCHMARK("Static update x1024") {
+        hierarchy.update();
+        return hierarchy.world(ArraySize - 1);
+    };
+
+    BENCHMARK("Update leaf x1024") {
+        hierarchy.setLocal(ArraySize - 1, Transform(offsets[0], rotations[0], Vector3(1.0f)));
+        hierarchy.update();
+        return hierarchy.world(ArraySize - 1);
+    };
+
+    BENCHMARK("Update all x1024") {
+        hierarchy.setLocal(0, Transform(offsets[1], rotations[1], Vector3(1.0f)));
+        hierarchy.update();
+        return hierarchy.world(ArraySize - 1);
+    };
+}
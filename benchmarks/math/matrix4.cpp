@@ -0,0 +1,117 @@
+#include "data.hpp"
+
+#include <ink/math/batch.hpp>
+#include <ink/math/numbers.hpp>
+#include <ink/math/transform.hpp>
+
+using namespace ink;
+using bench::ArraySize;
+
+TEST_CASE("Matrix4 multiply", "[Matrix4]") {
+    const std::vector<Matrix4> lhs = bench::makeMatrices(ArraySize);
+    const std::vector<Matrix4> rhs = bench::makeMatrices(ArraySize + 1);
+    std::vector<Matrix4>       out(ArraySize);
+
+    BENCHMARK("Multiply") { return lhs[0] * rhs[1]; };
+
+    BENCHMARK("Multiply x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = lhs[i] * rhs[i + 1];
+        return out.back();
+    };
+
+    BENCHMARK("Multiply Matrix4x8 x1024") {
+        for (std::size_t i = 0; i < ArraySize; i += 8) {
+            const Matrix4x8 result = Matrix4x8(lhs.data() + i) * Matrix4x8(rhs.data() + i + 1);
+            result.store(out.data() + i);
+        }
+        return out.back();
+    };
+}
+
+TEST_CASE("Matrix4 inverse", "[Matrix4]") {
+    const std::vector<Matrix4> matrices = bench::makeMatrices(ArraySize);
+    std::vector<Matrix4>       out(ArraySize);
+    std::vector<float>         determinants(ArraySize);
+
+    BENCHMARK("Inverse") { return matrices[0].inversed(); };
+
+    BENCHMARK("Inverse x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = matrices[i].inversed();
+        return out.back();
+    };
+
+    // Specialized inverse paths. Input matrices are affine.
+    const Matrix4 view =
+        lookAt(Vector3(3.0f, 4.0f, -5.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+
+    BENCHMARK("Affine inverse") { return matrices[0].inversedAffine(); };
+    BENCHMARK("Rigid inverse") { return view.inversedRigid(); };
+    BENCHMARK("Inverse transpose 3x3") { return matrices[0].inverseTransposed3x3(); };
+
+    BENCHMARK("Affine inverse x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = matrices[i].inversedAffine();
+        return out.back();
+    };
+
+    BENCHMARK("Determinant") { return matrices[0].determinant(); };
+
+    BENCHMARK("Determinant x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            determinants[i] = matrices[i].determinant();
+        return determinants.back();
+    };
+}
+
+TEST_CASE("Matrix4 decompose", "[Matrix4]") {
+    const std::vector<Matrix4> matrices = bench::makeMatrices(ArraySize);
+    std::vector<Vector3>       translations(ArraySize);
+    std::vector<Quaternion>    rotations(ArraySize);
+    std::vector<Vector3>       scales(ArraySize);
+
+    BENCHMARK("Decompose") { return Transform(matrices[0]); };
+
+    BENCHMARK("Decompose x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            decompose(matrices[i], translations[i], rotations[i], scales[i]);
+        return rotations.back();
+    };
+
+    BENCHMARK("Decompose batch x1024") {
+        decompose(matrices.data(), translations.data(), rotations.data(), scales.data(),
+                  ArraySize);
+        return rotations.back();
+    };
+}
+
+TEST_CASE("Matrix4 camera", "[Matrix4]") {
+    const std::vector<Vector3> eyes = bench::makeVectors(ArraySize);
+    const Vector3              target(0.0f, 1.0f, 0.0f);
+    const Vector3              up(0.0f, 1.0f, 0.0f);
+
+    std::vector<float> fovs(ArraySize);
+    for (std::size_t i = 0; i < ArraySize; ++i) {
+        const float t = static_cast<float>(i) / static_cast<float>(ArraySize);
+        fovs[i]       = Pi<float> * (0.25f + 0.25f * t);
+    }
+
+    std::vector<Matrix4> out(ArraySize);
+
+    BENCHMARK("LookAt") { return lookAt(eyes[0], target, up); };
+
+    BENCHMARK("LookAt x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = lookAt(eyes[i], target, up);
+        return out.back();
+    };
+
+    BENCHMARK("Perspective") { return perspective(fovs[0], 16.0f / 9.0f, 0.1f, 1000.0f); };
+
+    BENCHMARK("Perspective x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = perspective(fovs[i], 16.0f / 9.0f, 0.1f, 1000.0f);
+        return out.back();
+    };
+}
@@ -0,0 +1,53 @@
+#include "data.hpp"
+
+#include <ink/math/matrix_chain.hpp>
+
+using namespace ink;
+using bench::ArraySize;
+
+TEST_CASE("Matrix4 chain", "[MatrixChain]") {
+    const std::vector<Matrix4> models = bench::makeMatrices(ArraySize);
+    const std::vector<Vector3> eyes   = bench::makeVectors(ArraySize);
+    const Matrix4              view   = lookAt(eyes[0], Vector3(0.0f), Vector3(0.0f, 1.0f, 0.0f));
+    const Matrix4              projection = perspective(1.0f, 1.5f, 0.1f, 100.0f);
+
+    std::vector<Vector4> vectors(ArraySize);
+    for (std::size_t i = 0; i < ArraySize; ++i)
+        vectors[i] = Vector4(eyes[i], 1.0f);
+
+    std::vector<Vector4> out(ArraySize);
+
+    // Each object transforms a single vector. The combined transform is built once per object:
+    // 128 multiplications for the product and 16 for the vector.
+    BENCHMARK("Eager v * (model * view * projection) x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i) {
+            const Matrix4 transform = models[i] * view * projection;
+            out[i]                  = vectors[i] * transform;
+        }
+        return out.back();
+    };
+
+    // 48 multiplications per vector.
+    BENCHMARK("Lazy v * (model * view * projection) x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i) {
+            const auto transform = lazy(models[i]) * view * projection;
+            out[i]               = vectors[i] * transform;
+        }
+        return out.back();
+    };
+
+    // Hand-written vector first order, which also takes 48 multiplications per vector.
+    BENCHMARK("Eager v * model * view * projection x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = vectors[i] * models[i] * view * projection;
+        return out.back();
+    };
+
+    // A single object transforms all vectors. The chain is evaluated once and then takes 16
+    // multiplications per vector.
+    BENCHMARK("Batch transform with chain x1024") {
+        transformVectors(lazy(models[0]) * view * projection, vectors.data(), out.data(),
+                         ArraySize);
+        return out.back();
+    };
+}
@@ -0,0 +1,43 @@
+#include "gltf.hpp"
+
+#include <ink/math/mesh_optimizer.hpp>
+
+using namespace ink;
+
+TEST_CASE("Mesh optimizer", "[MeshOptimizer]") {
+    const std::vector<bench::Mesh> meshes =
+        bench::loadMeshes(INK_BENCHMARK_ASSET_DIR "/DamagedHelmet.glb");
+    REQUIRE(!meshes.empty());
+
+    for (const bench::Mesh &mesh : meshes) {
+        const std::vector<Vector3>       &positions = mesh.positions;
+        const std::vector<std::uint32_t> &indices   = mesh.indices;
+
+        const auto before = analyzeVertexCache(indices.data(), indices.size(), positions.size());
+
+        std::vector<std::uint32_t> optimized = indices;
+        std::vector<std::uint32_t> remap(positions.size());
+        BENCHMARK("Optimize mesh") {
+            optimized = indices;
+            return optimizeMesh(optimized.data(), optimized.size(), positions.data(),
+                                positions.size(), sizeof(Vector3), remap.data());
+        };
+
+        BENCHMARK("Optimize vertex cache") {
+            optimized = indices;
+            optimizeVertexCache(optimized.data(), optimized.size(), positions.size());
+            return optimized[0];
+        };
+
+        const auto cache =
+            analyzeVertexCache(optimized.data(), optimized.size(), positions.size());
+        REQUIRE(cache.acmr < before.acmr);
+        REQUIRE(cache.atvr < before.atvr);
+
+        // The overdraw pass keeps ACMR within its default threshold.
+        optimizeOverdraw(optimized.data(), optimized.size(), positions.data(), positions.size());
+        const auto after = analyzeVertexCache(optimized.data(), optimized.size(), positions.size());
+        REQUIRE(after.acmr <= cache.acmr * 1.05f);
+        REQUIRE(after.acmr < before.acmr);
+    }
+}
@@ -0,0 +1,62 @@
+#include "data.hpp"
+
+#include <ink/core/radix_sort.hpp>
+#include <ink/math/morton.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+using namespace ink;
+using bench::ArraySize;
+
+TEST_CASE("Morton code", "[Morton]") {
+    const std::vector<Vector3> points = bench::makeVectors(ArraySize);
+    const AABB                 bounds(points.data(), points.size());
+
+    std::vector<std::uint32_t> codes(ArraySize);
+
+    BENCHMARK("encodeMorton3 point x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            codes[i] = encodeMorton3(points[i], bounds);
+        return codes.back();
+    };
+
+    BENCHMARK("encodeMorton3 batch x1024") {
+        encodeMorton3(points.data(), bounds, codes.data(), ArraySize);
+        return codes.back();
+    };
+
+    BENCHMARK("decodeMorton3 x1024") {
+        std::uint32_t sum = 0;
+        for (const std::uint32_t code : codes) {
+            std::uint32_t x, y, z;
+            decodeMorton3(code, x, y, z);
+            sum += x + y + z;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("Morton order", "[Morton]") {
+    // Sort points along the Z-order curve, e.g. to build a linear BVH.
+    const std::vector<Vector3> points = bench::makeVectors(ArraySize);
+    const AABB                 bounds(points.data(), points.size());
+
+    std::vector<std::uint32_t> codes(ArraySize);
+    std::vector<std::uint32_t> indices(ArraySize);
+
+    BENCHMARK("Morton encode + std::sort x1024") {
+        encodeMorton3(points.data(), bounds, codes.data(), ArraySize);
+        std::iota(indices.begin(), indices.end(), 0U);
+        std::sort(indices.begin(), indices.end(),
+                  [&codes](std::uint32_t a, std::uint32_t b) { return codes[a] < codes[b]; });
+        return indices.back();
+    };
+
+    BENCHMARK("Morton encode + radixSort x1024") {
+        encodeMorton3(points.data(), bounds, codes.data(), ArraySize);
+        std::iota(indices.begin(), indices.end(), 0U);
+        radixSort(codes.data(), indices.data(), ArraySize);
+        return indices.back();
+    };
+}
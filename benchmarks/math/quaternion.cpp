@@ -0,0 +1,63 @@
+#include "data.hpp"
+
+#include <ink/math/wide.hpp>
+
+using namespace ink;
+using bench::ArraySize;
+
+TEST_CASE("Quaternion to matrix", "[Quaternion]") {
+    const std::vector<Quaternion> quats = bench::makeQuaternions(ArraySize);
+    std::vector<Matrix4>          out(ArraySize);
+
+    BENCHMARK("ToMatrix") { return quats[0].toMatrix(); };
+
+    BENCHMARK("ToMatrix x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = quats[i].toMatrix();
+        return out.back();
+    };
+}
+
+TEST_CASE("Quaternion interpolation", "[Quaternion]") {
+    const std::vector<Quaternion> start = bench::makeQuaternions(ArraySize);
+    const std::vector<Quaternion> end   = bench::makeQuaternions(ArraySize + 1);
+    std::vector<Quaternion>       out(ArraySize);
+
+    std::vector<float> factors(ArraySize);
+    for (std::size_t i = 0; i < ArraySize; ++i)
+        factors[i] = static_cast<float>(i) / static_cast<float>(ArraySize);
+
+    BENCHMARK("Slerp") { return slerp(start[0], end[1], factors[1]); };
+
+    BENCHMARK("Slerp x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = slerp(start[i], end[i + 1], factors[i]);
+        return out.back();
+    };
+
+    BENCHMARK("Slerp Quaternionx8 x1024") {
+        for (std::size_t i = 0; i < ArraySize; i += 8) {
+            const Quaternionx8 from(start.data() + i);
+            const Quaternionx8 to(end.data() + i + 1);
+            slerp(from, to, Float8(factors.data() + i)).store(out.data() + i);
+        }
+        return out.back();
+    };
+
+    BENCHMARK("Nlerp") { return nlerp(start[0], end[1], factors[1]); };
+
+    BENCHMARK("Nlerp x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = nlerp(start[i], end[i + 1], factors[i]);
+        return out.back();
+    };
+
+    BENCHMARK("Nlerp Quaternionx8 x1024") {
+        for (std::size_t i = 0; i < ArraySize; i += 8) {
+            const Quaternionx8 from(start.data() + i);
+            const Quaternionx8 to(end.data() + i + 1);
+            nlerp(from, to, Float8(factors.data() + i)).store(out.data() + i);
+        }
+        return out.back();
+    };
+}
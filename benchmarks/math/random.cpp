@@ -0,0 +1,70 @@
+#include "data.hpp"
+
+#include <ink/math/random.hpp>
+#include <ink/math/sampling.hpp>
+
+#include <random>
+
+using namespace ink;
+using bench::ArraySize;
+
+TEST_CASE("Random number generators", "[Random]") {
+    std::vector<float> out(ArraySize);
+
+    std::mt19937                          mt(42);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    BENCHMARK("std::mt19937 float x1024") {
+        for (auto &f : out)
+            f = dist(mt);
+        return out.back();
+    };
+
+    PCG32 pcg(42);
+    BENCHMARK("PCG32 float x1024") {
+        for (auto &f : out)
+            f = pcg.nextFloat();
+        return out.back();
+    };
+
+    Xoshiro256 xoshiro(42);
+    BENCHMARK("Xoshiro256 float x1024") {
+        for (auto &f : out)
+            f = xoshiro.nextFloat();
+        return out.back();
+    };
+
+    Xoshiro256x8 wide(42);
+    BENCHMARK("Xoshiro256x8 float x1024") {
+        for (std::size_t i = 0; i < ArraySize; i += 8)
+            wide.nextFloat().store(out.data() + i);
+        return out.back();
+    };
+}
+
+TEST_CASE("Sample sequences", "[Random]") {
+    std::vector<Vector3> out(ArraySize);
+
+    BENCHMARK("Halton3 x1024") {
+        for (std::uint32_t i = 0; i < ArraySize; ++i)
+            out[i] = halton3(i);
+        return out.back();
+    };
+
+    BENCHMARK("Sobol2 cosine hemisphere x1024") {
+        for (std::uint32_t i = 0; i < ArraySize; ++i)
+            out[i] = sampleCosineHemisphere(sobol2(i));
+        return out.back();
+    };
+
+    BENCHMARK("R2 uniform sphere x1024") {
+        for (std::uint32_t i = 0; i < ArraySize; ++i)
+            out[i] = sampleUniformSphere(r2(i));
+        return out.back();
+    };
+
+    BENCHMARK("R2 GGX x1024") {
+        for (std::uint32_t i = 0; i < ArraySize; ++i)
+            out[i] = sampleGGX(r2(i), 0.5f);
+        return out.back();
+    };
+}
@@ -0,0 +1,47 @@
+#include "data.hpp"
+
+#include <ink/math/spherical_harmonics.hpp>
+
+using namespace ink;
+using bench::ArraySize;
+
+TEST_CASE("Spherical harmonics projection", "[SphericalHarmonics]") {
+    std::vector<Vector3> directions = bench::makeVectors(ArraySize);
+    for (auto &d : directions)
+        d.normalize();
+    const std::vector<Vector3> colors = bench::makeVectors(ArraySize + 1);
+
+    BENCHMARK("Project SH9RGB x1024") {
+        SH9RGB sh;
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            sh.addSample(directions[i], colors[i]);
+        return sh;
+    };
+
+    BENCHMARK("Project SH9RGB batch x1024") {
+        return projectSamples<9>(directions.data(), colors.data(), ArraySize);
+    };
+}
+
+TEST_CASE("Spherical harmonics evaluation", "[SphericalHarmonics]") {
+    std::vector<Vector3> directions = bench::makeVectors(ArraySize);
+    for (auto &d : directions)
+        d.normalize();
+    const SH9RGB sh = projectSamples<9>(directions.data(), directions.data(), ArraySize);
+
+    std::vector<Vector3> out(ArraySize);
+
+    BENCHMARK("Evaluate SH9RGB x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = sh.evaluate(directions[i]);
+        return out.back();
+    };
+
+    BENCHMARK("Evaluate SH9RGB batch x1024") {
+        evaluate(sh, directions.data(), out.data(), ArraySize);
+        return out.back();
+    };
+
+    const Quaternion rotation(Vector3(1.0f, 2.0f, 3.0f).normalized(), 0.7f);
+    BENCHMARK("Rotate SH9RGB") { return sh.rotated(rotation); };
+}
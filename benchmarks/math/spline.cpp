@@ -0,0 +1,57 @@
+#include "data.hpp"
+
+#include <ink/math/spline.hpp>
+
+using namespace ink;
+using bench::ArraySize;
+
+TEST_CASE("Spline evaluation", "[Spline]") {
+    const std::vector<Vector3> points = bench::makeVectors(16);
+
+    std::vector<float> t(ArraySize);
+    for (std::size_t i = 0; i < ArraySize; ++i)
+        t[i] = static_cast<float>(i) / static_cast<float>(ArraySize);
+
+    std::vector<Vector3> out(ArraySize);
+
+    BENCHMARK("Catmull-Rom x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = catmullRom(points[0], points[1], points[2], points[3], t[i]);
+        return out.back();
+    };
+
+    BENCHMARK("Catmull-Rom batch x1024") {
+        catmullRom(points[0], points[1], points[2], points[3], t.data(), out.data(), ArraySize);
+        return out.back();
+    };
+
+    BENCHMARK("Catmull-Rom path x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = catmullRomPath(points.data(), points.size(), t[i]);
+        return out.back();
+    };
+
+    BENCHMARK("Catmull-Rom path batch x1024") {
+        catmullRomPath(points.data(), points.size(), t.data(), out.data(), ArraySize);
+        return out.back();
+    };
+
+    const ArcLengthTable table(
+        [&](float u) { return catmullRomPath(points.data(), points.size(), u); }, 256);
+
+    std::vector<float> distances(ArraySize);
+    std::vector<float> parameters(ArraySize);
+    for (std::size_t i = 0; i < ArraySize; ++i)
+        distances[i] = t[i] * table.length();
+
+    BENCHMARK("Arc length parameter x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            parameters[i] = table.parameter(distances[i]);
+        return parameters.back();
+    };
+
+    BENCHMARK("Arc length parameters batch x1024") {
+        table.parameters(distances.data(), parameters.data(), ArraySize);
+        return parameters.back();
+    };
+}
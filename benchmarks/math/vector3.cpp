@@ -0,0 +1,48 @@
+#include "data.hpp"
+
+#include <ink/math/wide.hpp>
+
+using namespace ink;
+using bench::ArraySize;
+
+TEST_CASE("Vector3 normalize", "[Vector3]") {
+    const std::vector<Vector3> vectors = bench::makeVectors(ArraySize);
+    std::vector<Vector3>       out(ArraySize);
+
+    BENCHMARK("Normalize") { return vectors[0].normalized(); };
+
+    BENCHMARK("Normalize x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = vectors[i].normalized();
+        return out.back();
+    };
+
+    BENCHMARK("Normalize Vector3x8 x1024") {
+        for (std::size_t i = 0; i < ArraySize; i += 8)
+            Vector3x8(vectors.data() + i).normalized().store(out.data() + i);
+        return out.back();
+    };
+}
+
+TEST_CASE("Vector3 cross", "[Vector3]") {
+    const std::vector<Vector3> lhs = bench::makeVectors(ArraySize);
+    const std::vector<Vector3> rhs = bench::makeVectors(ArraySize + 1);
+    std::vector<Vector3>       out(ArraySize);
+
+    BENCHMARK("Cross") { return cross(lhs[0], rhs[1]); };
+
+    BENCHMARK("Cross x1024") {
+        for (std::size_t i = 0; i < ArraySize; ++i)
+            out[i] = cross(lhs[i], rhs[i + 1]);
+        return out.back();
+    };
+
+    BENCHMARK("Cross Vector3x8 x1024") {
+        for (std::size_t i = 0; i < ArraySize; i += 8) {
+            const Vector3x8 result =
+                cross(Vector3x8(lhs.data() + i), Vector3x8(rhs.data() + i + 1));
+            result.store(out.data() + i);
+        }
+        return out.back();
+    };
+}
@@ -2,8 +2,8 @@
                 "DescriptorTable(CBV(b0, numDescriptors = 3))"
 
 struct Transform {
-    float4x4 model;
-    float4x4 modelInvTranspose;
+    row_major float3x4 model;
+    row_major float3x4 modelInvTranspose;
     float4x4 view;
     float4x4 projection;
     float3   cameraPos;
@@ -25,9 +25,9 @@ struct VertexOutput {
 [RootSignature(rootsig)]
 VertexOutput vertex_main(VertexInput input) {
     VertexOutput output;
-    float3 worldPos = mul(float4(input.position, 1.0f), transform.model).xyz;
+    float3 worldPos = mul(transform.model, float4(input.position, 1.0f));
     output.worldPos = worldPos;
-    output.normal   = mul(float4(input.normal, 0.0f), transform.modelInvTranspose).xyz;
+    output.normal   = mul(transform.modelInvTranspose, float4(input.normal, 0.0f));
     output.position = mul(mul(float4(worldPos, 1.0f), transform.view), transform.projection);
     return output;
 }
@@ -1,6 +1,7 @@
 #include "ink/camera.hpp"
 #include "ink/core/exception.hpp"
 #include "ink/core/window.hpp"
+#include "ink/math/affine.hpp"
 #include "ink/math/numbers.hpp"
 #include "ink/model.hpp"
 #include "ink/render/device.hpp"
@@ -11,8 +12,8 @@ using namespace ink;
 namespace {
 
 struct Transform {
-    Matrix4 model;
-    Matrix4 modelInvTranspose;
+    Matrix3x4 model;
+    Matrix3x4 modelInvTranspose;
     Matrix4 view;
     Matrix4 projection;
     Vector3 cameraPos;
@@ -389,8 +390,8 @@ auto Application::update(float deltaTime) -> void {
         m_commandBuffer.setIndexBuffer(mesh.index.buffer, mesh.index.count, mesh.index.stride);
 
         Transform transform{
-            /* model             = */ modelTransform,
-            /* modelInvTranspose = */ modelTransform.inversed().transposed(),
+            /* model             = */ Matrix3x4(modelTransform),
+            /* modelInvTranspose = */ Matrix3x4(modelTransform.inverseTransposed3x3()),
             /* view              = */ m_camera.viewMatrix(),
             /* projection        = */ m_camera.projectionMatrix(),
             /* cameraPos         = */ m_camera.position(),
@@ -420,8 +421,8 @@ auto Application::update(float deltaTime) -> void {
         m_commandBuffer.setIndexBuffer(mesh.index.buffer, mesh.index.count, mesh.index.stride);
 
         Transform transform{
-            /* model             = */ modelTransform,
-            /* modelInvTranspose = */ modelTransform.inversed().transposed(),
+            /* model             = */ Matrix3x4(modelTransform),
+            /* modelInvTranspose = */ Matrix3x4(modelTransform.inverseTransposed3x3()),
             /* view              = */ m_camera.viewMatrix(),
             /* projection        = */ m_camera.projectionMatrix(),
             /* cameraPos         = */ m_camera.position(),
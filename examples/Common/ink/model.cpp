@@ -1,10 +1,14 @@
 #include "model.hpp"
 #include "ink/core/exception.hpp"
+#include "ink/math/mesh_optimizer.hpp"
 #include "ink/render/device.hpp"
 
 #include <tiny_gltf.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <queue>
 
 using namespace ink;
 
@@ -16,10 +20,151 @@ namespace {
     return !std::string_view::traits_type::compare(str.data(), match.data(), match.size());
 }
 
+/// @brief
+///   Get pointer to the first element of the specified accessor.
+[[nodiscard]] auto accessorData(tinygltf::Model &model, const tinygltf::Accessor &accessor) noexcept
+    -> std::uint8_t * {
+    const auto &view = model.bufferViews[accessor.bufferView];
+    return model.buffers[view.buffer].data.data() + view.byteOffset + accessor.byteOffset;
+}
+
+/// @brief
+///   Optimize indexed triangle primitives of a GLTF model in place before they are uploaded.
+///   Indices are always reordered. Vertices are reordered only if the index, attribute and morph
+///   target accessors are not shared with other primitives, since all users of a vertex buffer
+///   must agree on the new vertex order.
+auto optimizeGltfMeshes(tinygltf::Model &model) -> void {
+    std::vector<std::uint32_t> references(model.accessors.size(), 0);
+    for (const auto &mesh : model.meshes) {
+        for (const auto &primitive : mesh.primitives) {
+            if (primitive.indices >= 0)
+                ++references[primitive.indices];
+            for (const auto &[name, index] : primitive.attributes)
+                ++references[index];
+            for (const auto &target : primitive.targets) {
+                for (const auto &[name, index] : target)
+                    ++references[index];
+            }
+        }
+    }
+
+    std::vector<std::uint32_t> indices;
+    std::vector<std::uint32_t> remap;
+    std::vector<std::uint32_t> inverse;
+    for (const auto &mesh : model.meshes) {
+        for (const auto &primitive : mesh.primitives) {
+            if (primitive.indices < 0 || primitive.mode != TINYGLTF_MODE_TRIANGLES)
+                continue;
+
+            const auto position = primitive.attributes.find("POSITION");
+            if (position == primitive.attributes.end())
+                continue;
+
+            const auto &indexAccessor    = model.accessors[primitive.indices];
+            const auto &positionAccessor = model.accessors[position->second];
+            if (indexAccessor.bufferView < 0 || indexAccessor.sparse.isSparse ||
+                positionAccessor.bufferView < 0 || positionAccessor.sparse.isSparse ||
+                positionAccessor.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT ||
+                positionAccessor.type != TINYGLTF_TYPE_VEC3)
+                continue;
+
+            const bool is32Bit =
+                (indexAccessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT);
+            if (!is32Bit && indexAccessor.componentType != TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT)
+                continue;
+
+            // Load indices as 32-bit integers.
+            std::uint8_t *indexData = accessorData(model, indexAccessor);
+            indices.resize(indexAccessor.count);
+            for (std::size_t i = 0; i < indices.size(); ++i) {
+                if (is32Bit) {
+                    std::memcpy(&indices[i], indexData + i * 4, 4);
+                } else {
+                    std::uint16_t index;
+                    std::memcpy(&index, indexData + i * 2, 2);
+                    indices[i] = index;
+                }
+            }
+
+            // The optimizer indexes per-vertex tables with these indices. Leave malformed
+            // primitives as they are.
+            const std::size_t vertexCount = positionAccessor.count;
+            if (indices.size() % 3 != 0 ||
+                std::any_of(indices.begin(), indices.end(),
+                            [vertexCount](std::uint32_t index) { return index >= vertexCount; }))
+                continue;
+
+            const auto *positions =
+                reinterpret_cast<const Vector3 *>(accessorData(model, positionAccessor));
+            const auto positionStride = static_cast<std::size_t>(
+                positionAccessor.ByteStride(model.bufferViews[positionAccessor.bufferView]));
+
+            // Morph target deltas are stored per vertex as well, so they must follow the same
+            // vertex order as the base attributes.
+            const auto isRemappable = [&](const std::map<std::string, int> &attributes) -> bool {
+                for (const auto &[name, index] : attributes) {
+                    const auto &accessor = model.accessors[index];
+                    if (references[index] != 1 || accessor.count != vertexCount ||
+                        accessor.bufferView < 0 || accessor.sparse.isSparse)
+                        return false;
+                }
+                return true;
+            };
+
+            bool canRemap =
+                (references[primitive.indices] == 1) && isRemappable(primitive.attributes);
+            for (const auto &target : primitive.targets)
+                canRemap = canRemap && isRemappable(target);
+
+            remap.resize(vertexCount);
+            optimizeMesh(indices.data(), indices.size(), positions, vertexCount, positionStride,
+                         remap.data());
+
+            if (canRemap) {
+                // Every attribute and morph target stream is reordered with the same remap table.
+                const auto remapAttributes = [&](const std::map<std::string, int> &attributes) {
+                    for (const auto &[name, index] : attributes) {
+                        const auto &accessor = model.accessors[index];
+                        const auto  stride   = static_cast<std::size_t>(
+                            accessor.ByteStride(model.bufferViews[accessor.bufferView]));
+                        const auto size = static_cast<std::size_t>(
+                            tinygltf::GetComponentSizeInBytes(accessor.componentType) *
+                            tinygltf::GetNumComponentsInType(accessor.type));
+                        remapVertices(accessorData(model, accessor), vertexCount, size, stride,
+                                      remap.data());
+                    }
+                };
+
+                remapAttributes(primitive.attributes);
+                for (const auto &target : primitive.targets)
+                    remapAttributes(target);
+            } else {
+                // Vertex buffers are shared with other primitives. Restore the original order.
+                inverse.resize(vertexCount);
+                for (std::size_t v = 0; v < vertexCount; ++v)
+                    inverse[remap[v]] = static_cast<std::uint32_t>(v);
+                remapIndices(indices.data(), indices.size(), inverse.data());
+            }
+
+            for (std::size_t i = 0; i < indices.size(); ++i) {
+                if (is32Bit) {
+                    std::memcpy(indexData + i * 4, &indices[i], 4);
+                } else {
+                    const auto index = static_cast<std::uint16_t>(indices[i]);
+                    std::memcpy(indexData + i * 2, &index, 2);
+                }
+            }
+        }
+    }
+}
+
 } // namespace
 
-ink::Model::Model(RenderDevice &renderDevice, std::string_view path, bool isBinary)
-    : m_buffers(), m_textures(), m_materials(), m_nodes() {
+ink::Model::Model(RenderDevice    &renderDevice,
+                  std::string_view path,
+                  bool             isBinary,
+                  bool             optimizeMeshes)
+    : m_buffers(), m_textures(), m_materials(), m_meshes(), m_hierarchy() {
     tinygltf::TinyGLTF gltfLoader;
     tinygltf::Model    gltfModel;
 
@@ -38,6 +183,9 @@ ink::Model::Model(RenderDevice &renderDevice, std::string_view path, bool isBina
             throw Exception("Failed to load GLTF model: " + error);
     }
 
+    if (optimizeMeshes)
+        optimizeGltfMeshes(gltfModel);
+
     CommandBuffer cmdBuffer{renderDevice.newCommandBuffer()};
 
     // Upload buffers.
@@ -124,14 +272,11 @@ ink::Model::Model(RenderDevice &renderDevice, std::string_view path, bool isBina
     { // Load nodes via BFS.
         const auto &scene =
             gltfModel.scenes[gltfModel.defaultScene == -1 ? 0 : gltfModel.defaultScene];
-        std::queue<std::pair<const tinygltf::Node *, Node *>> nodeQueue;
+        std::queue<std::pair<const tinygltf::Node *, std::uint32_t>> nodeQueue;
 
         auto convertNode = [this, &gltfModel](const tinygltf::Node &gltfNode) -> Node {
             Node node{
-                /* parent      = */ nullptr,
-                /* children    = */ {},
                 /* mesh        = */ {},
-                /* transform   = */ Matrix4{1.0f},
                 /* translation = */ {},
                 /* scale       = */ Vector3{1.0f},
                 /* rotation    = */ Quaternion{1.0f},
@@ -157,22 +302,14 @@ ink::Model::Model(RenderDevice &renderDevice, std::string_view path, bool isBina
             }
 
             if (gltfNode.matrix.size() == 16) {
-                node.transform[0][0] = static_cast<float>(gltfNode.matrix[0]);
-                node.transform[0][1] = static_cast<float>(gltfNode.matrix[1]);
-                node.transform[0][2] = static_cast<float>(gltfNode.matrix[2]);
-                node.transform[0][3] = static_cast<float>(gltfNode.matrix[3]);
-                node.transform[1][0] = static_cast<float>(gltfNode.matrix[4]);
-                node.transform[1][1] = static_cast<float>(gltfNode.matrix[5]);
-                node.transform[1][2] = static_cast<float>(gltfNode.matrix[6]);
-                node.transform[1][3] = static_cast<float>(gltfNode.matrix[7]);
-                node.transform[2][0] = static_cast<float>(gltfNode.matrix[8]);
-                node.transform[2][1] = static_cast<float>(gltfNode.matrix[9]);
-                node.transform[2][2] = static_cast<float>(gltfNode.matrix[10]);
-                node.transform[2][3] = static_cast<float>(gltfNode.matrix[11]);
-                node.transform[3][0] = static_cast<float>(gltfNode.matrix[12]);
-                node.transform[3][1] = static_cast<float>(gltfNode.matrix[13]);
-                node.transform[3][2] = static_cast<float>(gltfNode.matrix[14]);
-                node.transform[3][3] = static_cast<float>(gltfNode.matrix[15]);
+                // GLTF matrices are column-major and transform column vectors, so element j of
+                // GLTF column i is element i of our column j.
+                Matrix4 matrix;
+                for (std::size_t i = 0; i < 4; ++i) {
+                    for (std::size_t j = 0; j < 4; ++j)
+                        matrix[j][i] = static_cast<float>(gltfNode.matrix[i * 4 + j]);
+                }
+                decompose(matrix, node.translation, node.rotation, node.scale);
             }
 
             if (gltfNode.mesh == -1)
@@ -218,6 +355,16 @@ ink::Model::Model(RenderDevice &renderDevice, std::string_view path, bool isBina
                         mesh.position.buffer = m_buffers[bufferID].gpuAddress() + bufferOffset;
                         mesh.position.count  = count;
                         mesh.position.stride = stride;
+
+                        // glTF requires min and max values for POSITION accessors.
+                        if (accessor.minValues.size() == 3 && accessor.maxValues.size() == 3) {
+                            mesh.bounds.min = Vector3{static_cast<float>(accessor.minValues[0]),
+                                                      static_cast<float>(accessor.minValues[1]),
+                                                      static_cast<float>(accessor.minValues[2])};
+                            mesh.bounds.max = Vector3{static_cast<float>(accessor.maxValues[0]),
+                                                      static_cast<float>(accessor.maxValues[1]),
+                                                      static_cast<float>(accessor.maxValues[2])};
+                        }
                     } else if (key == "NORMAL") {
                         mesh.normal.buffer = m_buffers[bufferID].gpuAddress() + bufferOffset;
                         mesh.normal.count  = count;
@@ -262,28 +409,30 @@ ink::Model::Model(RenderDevice &renderDevice, std::string_view path, bool isBina
             return node;
         };
 
-        for (auto i : scene.nodes) {
-            const auto &gltfNode = gltfModel.nodes[i];
-            nodeQueue.emplace(&gltfNode, &m_nodes.emplace_back(convertNode(gltfNode)));
-        }
+        // BFS order keeps parents before their children, which is required by the hierarchy.
+        for (auto i : scene.nodes)
+            nodeQueue.emplace(&gltfModel.nodes[i], TransformHierarchy::NoParent);
 
         while (!nodeQueue.empty()) {
-            auto [gltfNode, node] = nodeQueue.front();
+            auto [gltfNode, parent] = nodeQueue.front();
             nodeQueue.pop();
 
-            for (auto i : gltfNode->children) {
-                const auto &gltfChild = gltfModel.nodes[i];
-                auto        child     = &node->children.emplace_back(convertNode(gltfChild));
-                child->parent         = node;
-                nodeQueue.emplace(&gltfChild, child);
-            }
+            Node       node  = convertNode(*gltfNode);
+            const auto index = m_hierarchy.addNode(
+                parent, Transform(node.translation, node.rotation, node.scale));
+            m_meshes.push_back(std::move(node.meshes));
+
+            for (auto i : gltfNode->children)
+                nodeQueue.emplace(&gltfModel.nodes[i], index);
         }
+
+        m_hierarchy.update();
     }
 }
 
 ink::Model::Model(
     RenderDevice &renderDevice, float width, float height, float depth, const Material &material)
-    : m_buffers(), m_textures(), m_materials(), m_nodes() {
+    : m_buffers(), m_textures(), m_materials(), m_meshes(), m_hierarchy() {
     const std::vector<Vector3> vertexData{
         // Position data in counter clockwise order.
         Vector3{-width / 2, -height / 2, -depth / 2},
@@ -341,10 +490,7 @@ ink::Model::Model(
 
     { // Create node.
         Node node{
-            /* parent      = */ nullptr,
-            /* children    = */ {},
             /* mesh        = */ {},
-            /* transform   = */ Matrix4{1.0f},
             /* translation = */ {},
             /* scale       = */ Vector3{1.0f},
             /* rotation    = */ Quaternion{1.0f},
@@ -364,9 +510,14 @@ ink::Model::Model(
         mesh.normal.stride = sizeof(Vector3);
 
         mesh.material = &m_materials[0];
+        mesh.bounds   = AABB(Vector3{-width / 2, -height / 2, -depth / 2},
+                             Vector3{width / 2, height / 2, depth / 2});
 
         node.meshes.push_back(mesh);
-        m_nodes.push_back(node);
+        m_hierarchy.addNode(TransformHierarchy::NoParent,
+                            Transform(node.translation, node.rotation, node.scale));
+        m_meshes.push_back(std::move(node.meshes));
+        m_hierarchy.update();
     }
 }
 
@@ -1,10 +1,9 @@
 #pragma once
 
-#include "ink/math/quaternion.hpp"
+#include "ink/math/frustum.hpp"
+#include "ink/math/hierarchy.hpp"
 #include "ink/render/resource.hpp"
 
-#include <list>
-#include <queue>
 #include <string_view>
 #include <vector>
 
@@ -88,15 +87,13 @@ struct Mesh {
     } weight[16];
 
     Material *material; // Material of this mesh.
+    AABB      bounds;   // Bounding box in mesh space. Empty if unknown.
 };
 
 class Model {
 private:
     struct Node {
-        Node             *parent;
-        std::list<Node>   children;
         std::vector<Mesh> meshes;
-        Matrix4           transform;
         Vector3           translation;
         Vector3           scale;
         Quaternion        rotation;
@@ -112,12 +109,18 @@ public:
     ///   Path to the GLTF file.
     /// @param isBinary
     ///   Whether the GLTF file is binary.
+    /// @param optimizeMeshes
+    ///   Whether to reorder indices and vertices of each mesh for vertex cache, overdraw and vertex
+    ///   fetch efficiency before uploading. Assets that are cooked offline do not need this.
     ///
     /// @throw Exception
     ///   Thrown if failed to load GLTF model.
     /// @throw RenderAPIException
     ///   Thrown if failed to create GPU buffers.
-    Model(RenderDevice &renderDevice, std::string_view path, bool isBinary);
+    Model(RenderDevice    &renderDevice,
+          std::string_view path,
+          bool             isBinary,
+          bool             optimizeMeshes = false);
 
     /// @brief
     ///   Create a new box model.
@@ -158,33 +161,59 @@ public:
               typename = std::enable_if_t<
                   std::is_invocable_r_v<void, Func, const Mesh &, const Matrix4 &>>>
     auto render(Func &&func) const -> void {
-        std::queue<std::pair<const Node *, Matrix4>> bfsQueue;
-        for (const auto &node : m_nodes)
-            bfsQueue.emplace(&node, node.transform.scaled(node.scale)
-                                        .rotated(node.rotation)
-                                        .translated(node.translation));
-
-        while (!bfsQueue.empty()) {
-            auto [node, transform] = bfsQueue.front();
-            bfsQueue.pop();
-
-            transform *= node->transform.scaled(node->scale)
-                             .rotated(node->rotation)
-                             .translated(node->translation);
-
-            for (const auto &submesh : node->meshes)
-                func(submesh, transform);
+        // World matrices are computed once when the model is loaded since nodes never move.
+        const std::vector<Matrix4> &worlds = m_hierarchy.worlds();
+        for (std::size_t i = 0; i < m_meshes.size(); ++i) {
+            for (const auto &submesh : m_meshes[i])
+                func(submesh, worlds[i]);
+        }
+    }
 
-            for (const auto &child : node->children)
-                bfsQueue.emplace(&child, transform);
+    /// @brief
+    ///   Render meshes of this model that are visible in the specified frustum. Bounding boxes of
+    ///   all meshes are culled in batch before the functor is called. Meshes without bounds are
+    ///   never culled.
+    ///
+    /// @tparam Func
+    ///   The type of the functor. Should accept two parameters: const Mesh &mesh and const Matrix4
+    ///   &parent.
+    ///
+    /// @param frustum
+    ///   The frustum that is used to cull meshes. Should be in the same space as the model
+    ///   transform.
+    /// @param func
+    ///   The functor that is used to render the model.
+    template <typename Func,
+              typename = std::enable_if_t<
+                  std::is_invocable_r_v<void, Func, const Mesh &, const Matrix4 &>>>
+    auto render(const Frustum &frustum, Func &&func) const -> void {
+        std::vector<std::pair<const Mesh *, Matrix4>> meshes;
+        std::vector<AABB>                             bounds;
+
+        render([&](const Mesh &mesh, const Matrix4 &transform) {
+            if (mesh.bounds.isEmpty()) {
+                func(mesh, transform);
+                return;
+            }
+
+            meshes.emplace_back(&mesh, transform);
+            bounds.push_back(mesh.bounds.transformed(transform));
+        });
+
+        std::vector<std::uint32_t> visible(bounds.size());
+        const std::size_t count = frustum.cullIndices(bounds.data(), bounds.size(), visible.data());
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto &[mesh, transform] = meshes[visible[i]];
+            func(*mesh, transform);
         }
     }
 
 private:
-    std::vector<GpuBuffer> m_buffers;
-    std::vector<Texture2D> m_textures;
-    std::vector<Material>  m_materials;
-    std::list<Node>        m_nodes;
+    std::vector<GpuBuffer>         m_buffers;
+    std::vector<Texture2D>         m_textures;
+    std::vector<Material>          m_materials;
+    std::vector<std::vector<Mesh>> m_meshes;
+    TransformHierarchy             m_hierarchy;
 };
 
 } // namespace ink
@@ -143,10 +143,30 @@ struct Lights {
     uint   numLights;
     float4 lightPositions[16];
     float4 lightColors[16];
+    float4 ambient[9];
 };
 
 ConstantBuffer<Lights> lights : register(b2);
 
+/// @brief
+///   Evaluate diffuse ambient lighting from 3 bands of spherical harmonics. The coefficients are
+///   already convolved with the clamped cosine lobe and divided by pi.
+///
+/// @param n
+///   Normal of the surface. Should be normalized.
+float3 EvaluateAmbient(float3 n) {
+    float3 result = lights.ambient[0].rgb * 0.282094792f;
+    result += lights.ambient[1].rgb * (0.488602512f * n.y);
+    result += lights.ambient[2].rgb * (0.488602512f * n.z);
+    result += lights.ambient[3].rgb * (0.488602512f * n.x);
+    result += lights.ambient[4].rgb * (1.092548431f * n.x * n.y);
+    result += lights.ambient[5].rgb * (1.092548431f * n.y * n.z);
+    result += lights.ambient[6].rgb * (0.315391565f * (3.0f * n.z * n.z - 1.0f));
+    result += lights.ambient[7].rgb * (1.092548431f * n.x * n.z);
+    result += lights.ambient[8].rgb * (0.546274215f * (n.x * n.x - n.y * n.y));
+    return max(result, float3(0.0f, 0.0f, 0.0f));
+}
+
 Texture2D baseColorMap         : register(t0);
 Texture2D metallicRoughnessMap : register(t1);
 Texture2D normalMap            : register(t2);
@@ -171,6 +191,7 @@ float4 pixel_main(VertexOutput input) : SV_TARGET {
         color += lights.lightColors[i].rgb * CookTorrance(metallicRoughness.g, F0, normal, viewDir, lightDir);
     }
 
+    color += (1.0f - metallicRoughness.r) * baseColor * EvaluateAmbient(normalize(normal));
     color += emissive;
 
     // Gamma correction
@@ -2,6 +2,7 @@
 #include "ink/core/exception.hpp"
 #include "ink/core/window.hpp"
 #include "ink/math/numbers.hpp"
+#include "ink/math/spherical_harmonics.hpp"
 #include "ink/model.hpp"
 #include "ink/render/device.hpp"
 
@@ -26,6 +27,7 @@ struct Lights {
     std::uint32_t numLights;
     Vector4       lightPositions[16];
     Vector4       lightColors[16];
+    Vector4       ambient[9];
 };
 
 struct Material {
@@ -33,6 +35,33 @@ struct Material {
     Vector4 baseColor;
 };
 
+/// @brief
+///   Project a simple sky into spherical harmonics and convolve it into outgoing radiance of a
+///   white Lambertian surface.
+auto makeAmbient() -> SH9RGB {
+    constexpr std::size_t SampleCount = 4096;
+    constexpr Vector3     Sky(0.30f, 0.40f, 0.55f);
+    constexpr Vector3     Ground(0.12f, 0.10f, 0.08f);
+
+    // Fibonacci sphere gives almost uniformly distributed directions.
+    constexpr float GoldenAngle = 2.39996322972865332f;
+
+    std::vector<Vector3> directions(SampleCount);
+    std::vector<Vector3> radiance(SampleCount);
+    for (std::size_t i = 0; i < SampleCount; ++i) {
+        const float t   = (static_cast<float>(i) + 0.5f) / static_cast<float>(SampleCount);
+        const float y   = 1.0f - 2.0f * t;
+        const float r   = std::sqrt(1.0f - y * y);
+        const float phi = GoldenAngle * static_cast<float>(i);
+
+        directions[i] = Vector3(r * std::cos(phi), y, r * std::sin(phi));
+        radiance[i]   = lerp(Ground, Sky, y * 0.5f + 0.5f);
+    }
+
+    return projectSamples<9>(directions.data(), radiance.data(), SampleCount).convolved() *
+           InvPi<float>;
+}
+
 class Application {
 public:
     Application();
@@ -55,6 +84,7 @@ private:
     Camera  m_camera;
     Model   m_model;
     Sampler m_linearSampler;
+    SH9RGB  m_ambient;
 
     std::int32_t m_cursorLastX;
     std::int32_t m_cursorLastY;
@@ -104,6 +134,7 @@ Application::Application()
       m_model(m_renderDevice, "asset/DamagedHelmet.glb", true),
       m_linearSampler(m_renderDevice.newSampler(D3D12_FILTER_MIN_MAG_POINT_MIP_LINEAR,
                                                 D3D12_TEXTURE_ADDRESS_MODE_WRAP)),
+      m_ambient(makeAmbient()),
       m_cursorLastX(0),
       m_cursorLastY(0),
       m_cursorX(0),
@@ -273,6 +304,9 @@ auto Application::update(float deltaTime) -> void {
     lights.lightColors[2]    = {1.0f, 1.0f, 1.0f, 1.0f};
     lights.lightColors[3]    = {1.0f, 1.0f, 1.0f, 1.0f};
 
+    for (std::size_t i = 0; i < SH9RGB::Size; ++i)
+        lights.ambient[i] = {m_ambient[i].x, m_ambient[i].y, m_ambient[i].z, 0.0f};
+
     m_model.render([this, &renderPass, &lights](const Mesh &mesh, const Matrix4 &modelTransform) {
         m_commandBuffer.beginRenderPass(renderPass);
         m_commandBuffer.setVertexBuffer(0, mesh.position.buffer, mesh.position.count,
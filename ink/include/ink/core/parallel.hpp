@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ink {
+namespace detail {
+
+/// @brief
+///   Get number of tasks to split @p count elements into. Returns 1 if @p count is less than
+///   @p threshold, otherwise the number of hardware threads clamped to [1, @p maxTasks].
+[[nodiscard]] inline auto parallelTaskCount(
+    std::size_t count,
+    std::size_t threshold,
+    std::size_t maxTasks = std::numeric_limits<std::size_t>::max()) noexcept -> std::size_t {
+    // Querying hardware concurrency is a system call on some platforms. Check size first.
+    if (count < threshold)
+        return 1;
+    return std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, maxTasks);
+}
+
+/// @brief
+///   Call `func(task, taskCount)` for each task in [0, taskCount) with up to @p maxTasks tasks.
+///   Task 0 is executed on the calling thread and other tasks are executed on new threads. If
+///   failed to create a thread, less tasks are used, so @p func must split its work by the
+///   @p taskCount it receives rather than by @p maxTasks.
+/// @note
+///   No task starts before all threads are created. Tasks could therefore synchronize with each
+///   other, e.g. with @p Barrier, without being blocked by a task that never runs.
+///
+/// @param maxTasks
+///   Maximum number of tasks. Threads are only created if this is greater than 1.
+/// @param func
+///   The function to be called by each task.
+template <typename Func>
+inline auto parallelTasks(std::size_t maxTasks, Func &&func) noexcept -> void {
+    if (maxTasks <= 1) {
+        func(std::size_t(0), std::size_t(1));
+        return;
+    }
+
+    std::mutex               mutex;
+    std::condition_variable  started;
+    std::size_t              taskCount = 0;
+    std::vector<std::thread> workers;
+
+    const auto run = [&](std::size_t task) {
+        std::size_t count;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            started.wait(lock, [&taskCount] { return taskCount != 0; });
+            count = taskCount;
+        }
+        func(task, count);
+    };
+
+    try {
+        workers.reserve(maxTasks - 1);
+        for (std::size_t task = 1; task < maxTasks; ++task)
+            workers.emplace_back(run, task);
+    } catch (const std::exception &) {
+        // Failed to create more threads. Use the threads that are already running.
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        taskCount = workers.size() + 1;
+    }
+    started.notify_all();
+
+    func(std::size_t(0), workers.size() + 1);
+    for (auto &worker : workers)
+        worker.join();
+}
+
+/// @brief
+///   Reusable thread barrier. @p wait() blocks until the specified number of threads have called
+///   it, then all of them continue and the barrier is reset for the next phase.
+class Barrier {
+public:
+    /// @brief
+    ///   Create a barrier.
+    Barrier() noexcept : m_mutex(), m_condition(), m_waiting(0), m_phase(0) {}
+
+    /// @brief
+    ///   Block until @p count threads have reached this barrier. All threads of the same phase
+    ///   must pass the same @p count, which is usually the task count of @p parallelTasks().
+    ///
+    /// @param count
+    ///   Number of threads that wait for this barrier.
+    auto wait(std::size_t count) noexcept -> void {
+        if (count <= 1)
+            return;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        const std::size_t            phase = m_phase;
+        if (++m_waiting == count) {
+            m_waiting = 0;
+            m_phase += 1;
+            m_condition.notify_all();
+            return;
+        }
+
+        m_condition.wait(lock, [this, phase] { return m_phase != phase; });
+    }
+
+private:
+    std::mutex              m_mutex;
+    std::condition_variable m_condition;
+    std::size_t             m_waiting;
+    std::size_t             m_phase;
+};
+
+} // namespace detail
+} // namespace ink
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace ink {
+namespace detail {
+
+/// @brief
+///   Minimum number of keys to split a radix sort pass across threads.
+inline constexpr std::size_t ParallelRadixSortThreshold = 65536;
+
+/// @brief
+///   Number of buckets of each radix sort pass. Keys are sorted 8 bits per pass.
+inline constexpr std::size_t RadixBucketCount = 256;
+
+/// @brief
+///   Maximum number of threads used by radix sort. Bucket offsets of all threads are stored on
+///   stack, so single threaded sorting does not allocate memory.
+inline constexpr std::size_t MaxRadixSortChunkCount = 16;
+
+/// @brief
+///   Stable LSD radix sort. Keys and values are sorted in place, and the scratch buffers are used
+///   as the ping-pong buffers. @p values and @p valueScratch could be null if there is no payload.
+/// @note
+///   Large arrays are split into chunks, one per thread. Threads are created once per sort and
+///   synchronize with a barrier between the counting, prefix sum and scatter phases of each pass.
+template <typename Key>
+inline auto radixSort(Key           *keys,
+                      std::uint32_t *values,
+                      std::size_t    count,
+                      Key           *keyScratch,
+                      std::uint32_t *valueScratch) noexcept -> void {
+    if (count <= 1)
+        return;
+
+    // Offsets of each bucket in each chunk.
+    std::size_t offsets[MaxRadixSortChunkCount][RadixBucketCount];
+
+    // Written by chunk 0 after the counting barrier, and read by all chunks after the prefix sum
+    // barrier. Chunk 0 cannot write it again before all chunks pass the next counting barrier.
+    bool    skipPass = false;
+    Barrier barrier;
+
+    const auto sortChunk = [&](std::size_t c, std::size_t chunkCount) {
+        const std::size_t chunk = (count + chunkCount - 1) / chunkCount;
+        const std::size_t first = std::min(c * chunk, count);
+        const std::size_t last  = std::min(first + chunk, count);
+
+        Key           *srcKeys   = keys;
+        Key           *dstKeys   = keyScratch;
+        std::uint32_t *srcValues = values;
+        std::uint32_t *dstValues = valueScratch;
+
+        for (std::uint32_t shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+            std::size_t *bucket = offsets[c];
+            std::fill(bucket, bucket + RadixBucketCount, std::size_t(0));
+            for (std::size_t i = first; i < last; ++i)
+                ++bucket[(srcKeys[i] >> shift) & 0xFFU];
+
+            barrier.wait(chunkCount);
+
+            if (c == 0) {
+                // All keys are in the same bucket. This digit is already sorted.
+                const std::size_t firstBucket = (srcKeys[0] >> shift) & 0xFFU;
+                std::size_t       firstSize   = 0;
+                for (std::size_t k = 0; k < chunkCount; ++k)
+                    firstSize += offsets[k][firstBucket];
+                skipPass = (firstSize == count);
+
+                // Bucket-major, chunk-minor exclusive prefix sum keeps the sort stable.
+                std::size_t sum = 0;
+                for (std::size_t b = 0; b < RadixBucketCount && !skipPass; ++b) {
+                    for (std::size_t k = 0; k < chunkCount; ++k) {
+                        const std::size_t size = offsets[k][b];
+                        offsets[k][b]          = sum;
+                        sum += size;
+                    }
+                }
+            }
+
+            barrier.wait(chunkCount);
+            if (skipPass)
+                continue;
+
+            for (std::size_t i = first; i < last; ++i) {
+                const std::size_t index = bucket[(srcKeys[i] >> shift) & 0xFFU]++;
+                dstKeys[index]          = srcKeys[i];
+                if (srcValues != nullptr)
+                    dstValues[index] = srcValues[i];
+            }
+
+            // The next pass reads keys scattered by other chunks.
+            barrier.wait(chunkCount);
+
+            std::swap(srcKeys, dstKeys);
+            std::swap(srcValues, dstValues);
+        }
+
+        if (srcKeys != keys) {
+            std::copy(srcKeys + first, srcKeys + last, keys + first);
+            if (values != nullptr)
+                std::copy(srcValues + first, srcValues + last, values + first);
+        }
+    };
+
+    parallelTasks(parallelTaskCount(count, ParallelRadixSortThreshold, MaxRadixSortChunkCount),
+                  sortChunk);
+}
+
+} // namespace detail
+
+/// @brief
+///   Sort unsigned integer keys in ascending order with payload values. This is a stable LSD radix
+///   sort, which is much faster than @p std::sort() for large arrays. Passes where all keys have
+///   the same digit are skipped, so keys with few significant bits, e.g. Morton codes, are sorted
+///   with less passes.
+/// @note
+///   Large arrays are split across threads. This overload does not allocate scratch buffers for
+///   the keys, which is useful when sorting every frame. Small arrays are sorted on the calling
+///   thread without allocating memory, while splitting across threads allocates the threads.
+///
+/// @tparam Key
+///   Type of the keys. Must be either @p std::uint32_t or @p std::uint64_t.
+/// @param[in, out] keys
+///   Pointer to the keys to be sorted.
+/// @param[in, out] values
+///   Pointer to the payload values of the keys. Usually these are indices of the sorted elements.
+///   Values are permuted along with the keys.
+/// @param count
+///   Number of keys to be sorted.
+/// @param keyScratch
+///   Scratch buffer for the keys. Must have at least @p count elements.
+/// @param valueScratch
+///   Scratch buffer for the values. Must have at least @p count elements.
+template <typename Key,
+          typename = std::enable_if_t<std::is_same<Key, std::uint32_t>::value ||
+                                      std::is_same<Key, std::uint64_t>::value>>
+inline auto radixSort(Key           *keys,
+                      std::uint32_t *values,
+                      std::size_t    count,
+                      Key           *keyScratch,
+                      std::uint32_t *valueScratch) noexcept -> void {
+    detail::radixSort(keys, values, count, keyScratch, valueScratch);
+}
+
+/// @brief
+///   Sort unsigned integer keys in ascending order with payload values. Scratch buffers are
+///   allocated on each call. See the overload with scratch buffers for details.
+/// @remark
+///   To sort elements by keys, fill @p values with 0, 1, 2, ... before sorting. The sorted values
+///   are indices of the elements in sorted order.
+///
+/// @tparam Key
+///   Type of the keys. Must be either @p std::uint32_t or @p std::uint64_t.
+/// @param[in, out] keys
+///   Pointer to the keys to be sorted.
+/// @param[in, out] values
+///   Pointer to the payload values of the keys. Values are permuted along with the keys.
+/// @param count
+///   Number of keys to be sorted.
+///
+/// @throw std::bad_alloc
+///   Thrown if failed to allocate scratch buffers.
+template <typename Key,
+          typename = std::enable_if_t<std::is_same<Key, std::uint32_t>::value ||
+                                      std::is_same<Key, std::uint64_t>::value>>
+inline auto radixSort(Key *keys, std::uint32_t *values, std::size_t count) -> void {
+    std::vector<Key>           keyScratch(count);
+    std::vector<std::uint32_t> valueScratch(count);
+    detail::radixSort(keys, values, count, keyScratch.data(), valueScratch.data());
+}
+
+/// @brief
+///   Sort unsigned integer keys in ascending order. Scratch buffer is allocated on each call.
+///
+/// @tparam Key
+///   Type of the keys. Must be either @p std::uint32_t or @p std::uint64_t.
+/// @param[in, out] keys
+///   Pointer to the keys to be sorted.
+/// @param count
+///   Number of keys to be sorted.
+///
+/// @throw std::bad_alloc
+///   Thrown if failed to allocate scratch buffer.
+template <typename Key,
+          typename = std::enable_if_t<std::is_same<Key, std::uint32_t>::value ||
+                                      std::is_same<Key, std::uint64_t>::value>>
+inline auto radixSort(Key *keys, std::size_t count) -> void {
+    std::vector<Key> keyScratch(count);
+    detail::radixSort<Key>(keys, nullptr, count, keyScratch.data(), nullptr);
+}
+
+} // namespace ink
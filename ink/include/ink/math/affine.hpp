@@ -0,0 +1,207 @@
+#pragma once
+
+#include "matrix.hpp"
+
+namespace ink {
+
+/// @brief
+///   Row major 3x4 affine transform matrix. This is the compact form of a 3D affine transform
+///   @p Matrix4 whose last column is (0, 0, 0, 1). Each row of this matrix is the same as the
+///   corresponding column of the @p Matrix4, so converting between them is simply copying.
+/// @note
+///   Memory layout of this matrix is the same as a HLSL `row_major float3x4`, which takes 3
+///   registers instead of 4 for a `float4x4`. Use `mul(m, float4(position, 1.0f))` in shaders to
+///   transform points. This is also the same as a HLSL `column_major float4x3` used as
+///   `mul(float4(position, 1.0f), m)`.
+struct alignas(16) Matrix3x4 {
+    Vector4 row[3];
+
+    /// @brief
+    ///   Create a zero matrix.
+    constexpr Matrix3x4() noexcept : row() {}
+
+    /// @brief
+    ///   Create a diagonal matrix.
+    ///
+    /// @param v
+    ///   Value of the diagonal elements.
+    explicit constexpr Matrix3x4(float v) noexcept
+        : row{Vector4(v, 0.0f, 0.0f, 0.0f), Vector4(0.0f, v, 0.0f, 0.0f),
+              Vector4(0.0f, 0.0f, v, 0.0f)} {}
+
+    /// @brief
+    ///   Create a matrix with the specified rows.
+    ///
+    /// @param r0
+    ///   Row 0 of this matrix.
+    /// @param r1
+    ///   Row 1 of this matrix.
+    /// @param r2
+    ///   Row 2 of this matrix.
+    constexpr Matrix3x4(Vector4 r0, Vector4 r1, Vector4 r2) noexcept : row{r0, r1, r2} {}
+
+    /// @brief
+    ///   Create a 3x4 matrix from an affine transform @p Matrix4.
+    /// @note
+    ///   The last column of @p m is assumed to be (0, 0, 0, 1) and is simply dropped.
+    ///
+    /// @param m
+    ///   The affine transform matrix to be converted.
+    explicit constexpr Matrix3x4(const Matrix4 &m) noexcept : row{m[0], m[1], m[2]} {}
+
+    /// @brief
+    ///   Random access rows of this matrix.
+    /// @note
+    ///   No boundary check performed.
+    ///
+    /// @param i
+    ///   Index of the row to be accessed.
+    ///
+    /// @return
+    ///   Reference to the specified row.
+    constexpr auto operator[](std::size_t i) noexcept -> Vector4 & { return row[i]; }
+
+    /// @brief
+    ///   Random access rows of this matrix.
+    /// @note
+    ///   No boundary check performed.
+    ///
+    /// @param i
+    ///   Index of the row to be accessed.
+    ///
+    /// @return
+    ///   Reference to the specified row.
+    constexpr auto operator[](std::size_t i) const noexcept -> const Vector4 & { return row[i]; }
+
+    /// @brief
+    ///   Convert this matrix to a 4x4 affine transform matrix.
+    ///
+    /// @return
+    ///   A @p Matrix4 that represents the same transform.
+    [[nodiscard]] constexpr auto toMatrix4() const noexcept -> Matrix4 {
+        return {row[0], row[1], row[2], Vector4(0.0f, 0.0f, 0.0f, 1.0f)};
+    }
+
+    /// @brief
+    ///   Get translation of this transform.
+    [[nodiscard]] constexpr auto translation() const noexcept -> Vector3 {
+        return {row[0][3], row[1][3], row[2][3]};
+    }
+
+    /// @brief
+    ///   Transform a point with this matrix. Translation is applied.
+    ///
+    /// @param point
+    ///   The point to be transformed.
+    ///
+    /// @return
+    ///   The transformed point.
+    [[nodiscard]] constexpr auto transformPoint(Vector3 point) const noexcept -> Vector3 {
+        return {
+            row[0][0] * point[0] + row[0][1] * point[1] + row[0][2] * point[2] + row[0][3],
+            row[1][0] * point[0] + row[1][1] * point[1] + row[1][2] * point[2] + row[1][3],
+            row[2][0] * point[0] + row[2][1] * point[1] + row[2][2] * point[2] + row[2][3],
+        };
+    }
+
+    /// @brief
+    ///   Transform a direction with this matrix. Translation is not applied.
+    ///
+    /// @param direction
+    ///   The direction to be transformed.
+    ///
+    /// @return
+    ///   The transformed direction. The result is not normalized.
+    [[nodiscard]] constexpr auto transformDirection(Vector3 direction) const noexcept -> Vector3 {
+        return {
+            row[0][0] * direction[0] + row[0][1] * direction[1] + row[0][2] * direction[2],
+            row[1][0] * direction[0] + row[1][1] * direction[1] + row[1][2] * direction[2],
+            row[2][0] * direction[0] + row[2][1] * direction[1] + row[2][2] * direction[2],
+        };
+    }
+
+    /// @brief
+    ///   Inverse this matrix.
+    /// @remark
+    ///   To get inversed matrix without modifying this matrix, use @p inversed() instead.
+    ///
+    /// @return
+    ///   Reference to this matrix.
+    constexpr auto inverse() noexcept -> Matrix3x4 & {
+        *this = inversed();
+        return *this;
+    }
+
+    /// @brief
+    ///   Get inversed matrix of this one.
+    /// @remark
+    ///   To inverse this matrix, use @p inverse() instead.
+    ///
+    /// @return
+    ///   A new matrix that represents the inversed matrix.
+    [[nodiscard]] constexpr auto inversed() const noexcept -> Matrix3x4 {
+        return Matrix3x4(toMatrix4().inversedAffine());
+    }
+
+    /// @brief
+    ///   Get inverse transpose of the 3x3 linear part of this matrix. This is usually used to
+    ///   transform normals. Translation of the result is 0.
+    [[nodiscard]] constexpr auto inverseTransposed3x3() const noexcept -> Matrix3x4 {
+        return Matrix3x4(toMatrix4().inverseTransposed3x3());
+    }
+
+    constexpr auto operator*=(const Matrix3x4 &rhs) noexcept -> Matrix3x4 &;
+};
+
+/// @brief
+///   Alias of @p Matrix3x4 to make intents clear.
+using AffineTransform = Matrix3x4;
+
+constexpr auto operator==(const Matrix3x4 &lhs, const Matrix3x4 &rhs) noexcept -> bool {
+    return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2];
+}
+
+constexpr auto operator!=(const Matrix3x4 &lhs, const Matrix3x4 &rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+/// @brief
+///   Compose 2 affine transforms. Just like @p Matrix4, transform of @p lhs is applied first, so
+///   `Matrix3x4(a) * Matrix3x4(b)` is the same as `Matrix3x4(a * b)`.
+/// @note
+///   This takes 36 multiplications instead of 64 for @p Matrix4.
+constexpr auto operator*(const Matrix3x4 &lhs, const Matrix3x4 &rhs) noexcept -> Matrix3x4 {
+#if defined(INK_SIMD)
+    if (!INK_IS_CONSTANT_EVALUATED()) {
+        Matrix3x4 result;
+        simd::multiplyMatrix3x4(&lhs[0][0], &rhs[0][0], &result[0][0]);
+        return result;
+    }
+#endif
+    return {
+        lhs[0] * rhs[0][0] + lhs[1] * rhs[0][1] + lhs[2] * rhs[0][2] +
+            Vector4(0.0f, 0.0f, 0.0f, rhs[0][3]),
+        lhs[0] * rhs[1][0] + lhs[1] * rhs[1][1] + lhs[2] * rhs[1][2] +
+            Vector4(0.0f, 0.0f, 0.0f, rhs[1][3]),
+        lhs[0] * rhs[2][0] + lhs[1] * rhs[2][1] + lhs[2] * rhs[2][2] +
+            Vector4(0.0f, 0.0f, 0.0f, rhs[2][3]),
+    };
+}
+
+constexpr auto Matrix3x4::operator*=(const Matrix3x4 &rhs) noexcept -> Matrix3x4 & {
+    *this = (*this * rhs);
+    return *this;
+}
+
+/// @brief
+///   Transform a row vector with the specified matrix. This is the same as `lhs * rhs.toMatrix4()`.
+constexpr auto operator*(Vector4 lhs, const Matrix3x4 &rhs) noexcept -> Vector4 {
+    return {dot(lhs, rhs[0]), dot(lhs, rhs[1]), dot(lhs, rhs[2]), lhs[3]};
+}
+
+constexpr auto operator*=(Vector4 &lhs, const Matrix3x4 &rhs) noexcept -> Vector4 & {
+    lhs = (lhs * rhs);
+    return lhs;
+}
+
+} // namespace ink
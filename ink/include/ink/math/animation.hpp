@@ -0,0 +1,538 @@
+#pragma once
+
+#include "transform.hpp"
+#include "wide.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace ink {
+
+/// @brief
+///   Interpolation mode of an animation channel.
+enum class AnimationInterpolation : std::uint8_t {
+    Step,
+    Linear,
+};
+
+class AnimationCursor;
+
+namespace detail {
+
+/// @brief
+///   Key state of 8 channels that are sampled together.
+struct AnimationLanes {
+    std::uint32_t first[8];  // Index of the keyframe before the sample time.
+    std::uint32_t second[8]; // Index of the keyframe after the sample time.
+    float         factor[8]; // Interpolation factor between the 2 keyframes.
+};
+
+/// @brief
+///   Load 8 values from @p base at the specified indices.
+[[nodiscard]] inline auto gather(const float *base, const std::uint32_t (&indices)[8]) noexcept
+    -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    Float8 result;
+    result.value = _mm256_i32gather_ps(
+        base, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices)), 4);
+    return result;
+#else
+    float lanes[8];
+    for (std::size_t i = 0; i < 8; ++i)
+        lanes[i] = base[indices[i]];
+    return Float8(lanes);
+#endif
+}
+
+} // namespace detail
+
+/// @brief
+///   Animation clip that animates translation, rotation and scale of a fixed number of joints.
+///   Keyframe times and values of all channels are stored in SoA arrays so that channels of 8
+///   joints are interpolated together with wide math types.
+/// @note
+///   Use @p AnimationCursor to play a clip forward. The cursor remembers the current keyframe of
+///   each channel, so that sampling does not require binary search.
+class AnimationClip {
+public:
+    /// @brief
+    ///   Create an empty clip that does not animate any joint.
+    AnimationClip() noexcept = default;
+
+    /// @brief
+    ///   Create a clip for the specified number of joints. Joints are not animated until channels
+    ///   are set.
+    ///
+    /// @param jointCount
+    ///   Number of joints of this clip.
+    ///
+    /// @throw std::bad_alloc
+    ///   Thrown if failed to allocate memory.
+    explicit AnimationClip(std::size_t jointCount)
+        : m_jointCount(jointCount), m_channels(jointCount * 3), m_duration(0.0f) {}
+
+    /// @brief
+    ///   Get number of joints of this clip.
+    [[nodiscard]] auto jointCount() const noexcept -> std::size_t { return m_jointCount; }
+
+    /// @brief
+    ///   Get time of the last keyframe of all channels.
+    [[nodiscard]] auto duration() const noexcept -> float { return m_duration; }
+
+    /// @brief
+    ///   Set translation channel of the specified joint.
+    ///
+    /// @param joint
+    ///   Index of the joint. Must be less than @p jointCount().
+    /// @param times
+    ///   Time of each keyframe in seconds. Must be in ascending order.
+    /// @param values
+    ///   Translation of each keyframe.
+    /// @param count
+    ///   Number of keyframes. 0 removes the channel.
+    /// @param interpolation
+    ///   Interpolation mode between keyframes.
+    ///
+    /// @throw std::bad_alloc
+    ///   Thrown if failed to allocate memory.
+    auto setTranslation(std::uint32_t          joint,
+                        const float           *times,
+                        const Vector3         *values,
+                        std::size_t            count,
+                        AnimationInterpolation interpolation = AnimationInterpolation::Linear)
+        -> void {
+        Channel &channel = addChannel(0, joint, times, count, interpolation);
+        for (std::size_t i = 0; i < count; ++i)
+            setValue(channel.offset + i, values[i].x, values[i].y, values[i].z, 0.0f);
+    }
+
+    /// @brief
+    ///   Set rotation channel of the specified joint. Rotations are interpolated with @p nlerp()
+    ///   along the shortest path.
+    ///
+    /// @param joint
+    ///   Index of the joint. Must be less than @p jointCount().
+    /// @param times
+    ///   Time of each keyframe in seconds. Must be in ascending order.
+    /// @param values
+    ///   Rotation of each keyframe. Must be normalized.
+    /// @param count
+    ///   Number of keyframes. 0 removes the channel.
+    /// @param interpolation
+    ///   Interpolation mode between keyframes.
+    ///
+    /// @throw std::bad_alloc
+    ///   Thrown if failed to allocate memory.
+    auto setRotation(std::uint32_t          joint,
+                     const float           *times,
+                     const Quaternion      *values,
+                     std::size_t            count,
+                     AnimationInterpolation interpolation = AnimationInterpolation::Linear)
+        -> void {
+        Channel &channel = addChannel(1, joint, times, count, interpolation);
+        for (std::size_t i = 0; i < count; ++i)
+            setValue(channel.offset + i, values[i].x, values[i].y, values[i].z, values[i].w);
+    }
+
+    /// @brief
+    ///   Set scale channel of the specified joint.
+    ///
+    /// @param joint
+    ///   Index of the joint. Must be less than @p jointCount().
+    /// @param times
+    ///   Time of each keyframe in seconds. Must be in ascending order.
+    /// @param values
+    ///   Scale of each keyframe.
+    /// @param count
+    ///   Number of keyframes. 0 removes the channel.
+    /// @param interpolation
+    ///   Interpolation mode between keyframes.
+    ///
+    /// @throw std::bad_alloc
+    ///   Thrown if failed to allocate memory.
+    auto setScale(std::uint32_t          joint,
+                  const float           *times,
+                  const Vector3         *values,
+                  std::size_t            count,
+                  AnimationInterpolation interpolation = AnimationInterpolation::Linear) -> void {
+        Channel &channel = addChannel(2, joint, times, count, interpolation);
+        for (std::size_t i = 0; i < count; ++i)
+            setValue(channel.offset + i, values[i].x, values[i].y, values[i].z, 0.0f);
+    }
+
+    /// @brief
+    ///   Sample this clip at the specified time. Keyframes are found with binary search.
+    /// @remark
+    ///   Use the overload with @p AnimationCursor for playback.
+    ///
+    /// @param time
+    ///   Time to sample in seconds. Time out of the keyframe range is clamped.
+    /// @param[in, out] pose
+    ///   Local transform of each joint. Must contain @p jointCount() transforms. Components that
+    ///   are not animated by this clip are not modified, so this is usually initialized to the
+    ///   rest pose.
+    auto sample(float time, Transform *pose) const noexcept -> void {
+        sampleChannels(time, nullptr, false, pose);
+    }
+
+    /// @brief
+    ///   Sample this clip at the specified time and update the cursor. If @p time is not less than
+    ///   time of the last sample of the cursor, keyframes are found by stepping forward from the
+    ///   keyframes of the last sample.
+    ///
+    /// @param time
+    ///   Time to sample in seconds. Time out of the keyframe range is clamped. To loop the clip,
+    ///   wrap the time to [0, duration()) before sampling.
+    /// @param[in, out] cursor
+    ///   Cursor of an instance that plays this clip. Must be created for this clip.
+    /// @param[in, out] pose
+    ///   Local transform of each joint. Must contain @p jointCount() transforms. Components that
+    ///   are not animated by this clip are not modified.
+    inline auto sample(float time, AnimationCursor &cursor, Transform *pose) const noexcept -> void;
+
+private:
+    struct Channel {
+        std::uint32_t          offset;
+        std::uint32_t          count;
+        AnimationInterpolation interpolation;
+    };
+
+    /// @brief
+    ///   Maximum number of keyframes to step forward before falling back to binary search.
+    static constexpr std::uint32_t MaxForwardSteps = 4;
+
+    /// @brief
+    ///   Replace keyframe times of a channel. Keyframes of the old channel are removed and the new
+    ///   ones are appended. Channels are stored as translation channels of all joints, then
+    ///   rotation and scale channels.
+    auto addChannel(std::size_t            path,
+                    std::uint32_t          joint,
+                    const float           *times,
+                    std::size_t            count,
+                    AnimationInterpolation interpolation) -> Channel & {
+        Channel &channel = m_channels[path * m_jointCount + joint];
+
+        // Reserve first so that nothing is modified if allocation fails.
+        const std::size_t size = m_times.size() - channel.count + count;
+        m_times.reserve(size);
+        m_x.reserve(size);
+        m_y.reserve(size);
+        m_z.reserve(size);
+        m_w.reserve(size);
+
+        if (channel.count != 0) {
+            const auto erase = [&channel](std::vector<float> &keys) {
+                const auto first = keys.begin() + channel.offset;
+                keys.erase(first, first + channel.count);
+            };
+
+            erase(m_times);
+            erase(m_x);
+            erase(m_y);
+            erase(m_z);
+            erase(m_w);
+
+            for (Channel &other : m_channels) {
+                if (other.offset > channel.offset)
+                    other.offset -= channel.count;
+            }
+        }
+
+        m_times.insert(m_times.end(), times, times + count);
+        m_x.resize(size);
+        m_y.resize(size);
+        m_z.resize(size);
+        m_w.resize(size);
+
+        channel.offset        = static_cast<std::uint32_t>(size - count);
+        channel.count         = static_cast<std::uint32_t>(count);
+        channel.interpolation = interpolation;
+
+        m_duration = 0.0f;
+        for (const Channel &other : m_channels) {
+            if (other.count != 0)
+                m_duration = std::max(m_duration, m_times[other.offset + other.count - 1]);
+        }
+
+        return channel;
+    }
+
+    /// @brief
+    ///   Set value of the specified keyframe.
+    auto setValue(std::size_t key, float x, float y, float z, float w) noexcept -> void {
+        m_x[key] = x;
+        m_y[key] = y;
+        m_z[key] = z;
+        m_w[key] = w;
+    }
+
+    /// @brief
+    ///   Find the last keyframe of the channel whose time is not greater than @p time. If @p hint
+    ///   is not null, search forward from it first and store the result in it.
+    [[nodiscard]] auto findKey(const Channel &channel, float time, std::uint32_t *hint)
+        const noexcept -> std::uint32_t {
+        const float *times = m_times.data() + channel.offset;
+        if (hint != nullptr) {
+            std::uint32_t key  = std::min(*hint, channel.count - 1);
+            std::uint32_t step = 0;
+            while (key + 1 < channel.count && times[key + 1] <= time && step < MaxForwardSteps) {
+                ++key;
+                ++step;
+            }
+
+            if (key + 1 == channel.count || times[key + 1] > time) {
+                *hint = key;
+                return key;
+            }
+        }
+
+        const float         *next = std::upper_bound(times, times + channel.count, time);
+        const std::ptrdiff_t key  = std::max<std::ptrdiff_t>(next - times, 1) - 1;
+        if (hint != nullptr)
+            *hint = static_cast<std::uint32_t>(key);
+        return static_cast<std::uint32_t>(key);
+    }
+
+    /// @brief
+    ///   Sample all channels. Channels are processed 8 at a time: keyframes are found per channel,
+    ///   and then values are gathered and interpolated in wide registers.
+    auto sampleChannels(float time, std::uint32_t *keys, bool forward, Transform *pose)
+        const noexcept -> void {
+        if (m_times.empty())
+            return;
+
+        for (std::size_t path = 0; path < 3; ++path) {
+            for (std::size_t joint = 0; joint < m_jointCount; joint += 8) {
+                const std::size_t count = std::min<std::size_t>(8, m_jointCount - joint);
+                const std::size_t base  = path * m_jointCount + joint;
+
+                detail::AnimationLanes lanes{};
+                std::uint32_t          animated = 0;
+                for (std::size_t i = 0; i < count; ++i) {
+                    const Channel &channel = m_channels[base + i];
+                    if (channel.count == 0)
+                        continue;
+
+                    // Cursor keys are searched from the first keyframe if time goes backward.
+                    std::uint32_t *hint = (keys != nullptr) ? keys + base + i : nullptr;
+                    if (hint != nullptr && !forward)
+                        *hint = 0;
+
+                    const std::uint32_t key  = findKey(channel, time, hint);
+                    const std::uint32_t next = std::min(key + 1, channel.count - 1);
+                    const float         t0   = m_times[channel.offset + key];
+                    const float         t1   = m_times[channel.offset + next];
+
+                    float factor = 0.0f;
+                    if (channel.interpolation == AnimationInterpolation::Linear && t1 > t0)
+                        factor = std::clamp((time - t0) / (t1 - t0), 0.0f, 1.0f);
+
+                    lanes.first[i]  = channel.offset + key;
+                    lanes.second[i] = channel.offset + next;
+                    lanes.factor[i] = factor;
+                    animated |= 1U << i;
+                }
+
+                if (animated != 0)
+                    interpolate(path, lanes, animated, pose + joint);
+            }
+        }
+    }
+
+    /// @brief
+    ///   Interpolate 8 channels of the same path and store the animated lanes to the pose.
+    auto interpolate(std::size_t                   path,
+                     const detail::AnimationLanes &lanes,
+                     std::uint32_t                 animated,
+                     Transform                    *pose) const noexcept -> void {
+        const Float8 factor(lanes.factor);
+
+        float xs[8], ys[8], zs[8], ws[8];
+        if (path == 1) {
+            const Quaternionx8 start(detail::gather(m_w.data(), lanes.first),
+                                     detail::gather(m_x.data(), lanes.first),
+                                     detail::gather(m_y.data(), lanes.first),
+                                     detail::gather(m_z.data(), lanes.first));
+            Quaternionx8       end(detail::gather(m_w.data(), lanes.second),
+                                   detail::gather(m_x.data(), lanes.second),
+                                   detail::gather(m_y.data(), lanes.second),
+                                   detail::gather(m_z.data(), lanes.second));
+
+            // Interpolate the shortest path.
+            end = select(dot(start, end) < 0.0f, -end, end);
+
+            const Quaternionx8 result = nlerp(start, end, factor);
+            result.x.store(xs);
+            result.y.store(ys);
+            result.z.store(zs);
+            result.w.store(ws);
+
+            for (std::size_t i = 0; i < 8; ++i) {
+                if ((animated >> i) & 1U)
+                    pose[i].rotation = Quaternion(ws[i], xs[i], ys[i], zs[i]);
+            }
+            return;
+        }
+
+        const Vector3x8 start(detail::gather(m_x.data(), lanes.first),
+                              detail::gather(m_y.data(), lanes.first),
+                              detail::gather(m_z.data(), lanes.first));
+        const Vector3x8 end(detail::gather(m_x.data(), lanes.second),
+                            detail::gather(m_y.data(), lanes.second),
+                            detail::gather(m_z.data(), lanes.second));
+
+        const Vector3x8 result = lerp(start, end, factor);
+        result.x.store(xs);
+        result.y.store(ys);
+        result.z.store(zs);
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            if ((animated >> i) & 1U) {
+                Vector3 &value = (path == 0) ? pose[i].translation : pose[i].scale;
+                value          = Vector3(xs[i], ys[i], zs[i]);
+            }
+        }
+    }
+
+    friend class AnimationCursor;
+
+private:
+    std::size_t          m_jointCount = 0;
+    std::vector<Channel> m_channels;
+    std::vector<float>   m_times;
+    std::vector<float>   m_x;
+    std::vector<float>   m_y;
+    std::vector<float>   m_z;
+    std::vector<float>   m_w;
+    float                m_duration = 0.0f;
+};
+
+/// @brief
+///   Playback state of an animation clip for a single instance. The cursor caches the current
+///   keyframe of each channel so that sampling forward in time only steps to the next keyframes.
+class AnimationCursor {
+public:
+    /// @brief
+    ///   Create an empty cursor.
+    AnimationCursor() noexcept = default;
+
+    /// @brief
+    ///   Create a cursor for the specified clip.
+    ///
+    /// @param clip
+    ///   The clip to be played with this cursor.
+    ///
+    /// @throw std::bad_alloc
+    ///   Thrown if failed to allocate memory.
+    explicit AnimationCursor(const AnimationClip &clip)
+        : m_keys(clip.m_channels.size()), m_time(-1.0f) {}
+
+    /// @brief
+    ///   Reset this cursor to the beginning of the clip.
+    auto reset() noexcept -> void {
+        std::fill(m_keys.begin(), m_keys.end(), std::uint32_t(0));
+        m_time = -1.0f;
+    }
+
+    /// @brief
+    ///   Get time of the last sample.
+    [[nodiscard]] auto time() const noexcept -> float { return m_time; }
+
+private:
+    friend class AnimationClip;
+
+    std::vector<std::uint32_t> m_keys;
+    float                      m_time = -1.0f;
+};
+
+inline auto AnimationClip::sample(float time, AnimationCursor &cursor, Transform *pose)
+    const noexcept -> void {
+    sampleChannels(time, cursor.m_keys.data(), time >= cursor.m_time, pose);
+    cursor.m_time = time;
+}
+
+/// @brief
+///   Blend poses with the specified weights. Translations and scales are blended linearly.
+///   Rotations are blended linearly in the hemisphere of the first pose and then normalized.
+///   Joints are processed 8 at a time.
+///
+/// @param poses
+///   Pointers to the poses to be blended. Each pose must contain @p jointCount transforms.
+/// @param weights
+///   Weight of each pose. Weights are normalized, so sum of the weights must be positive.
+/// @param poseCount
+///   Number of poses to be blended. Must be at least 1.
+/// @param[out] out
+///   Pointer to the array to store the blended pose. This could be the same as any pose.
+/// @param jointCount
+///   Number of joints of each pose.
+inline auto blendPoses(const Transform *const *poses,
+                       const float            *weights,
+                       std::size_t             poseCount,
+                       Transform              *out,
+                       std::size_t             jointCount) noexcept -> void {
+    float totalWeight = 0.0f;
+    for (std::size_t p = 0; p < poseCount; ++p)
+        totalWeight += weights[p];
+    const float normalize = 1.0f / totalWeight;
+
+    for (std::size_t joint = 0; joint < jointCount; joint += 8) {
+        const std::size_t count = std::min<std::size_t>(8, jointCount - joint);
+
+        Vector3x8    translation;
+        Vector3x8    scale;
+        Quaternionx8 rotation;
+        Quaternionx8 reference;
+        for (std::size_t p = 0; p < poseCount; ++p) {
+            const Transform *pose = poses[p] + joint;
+
+            float tx[8] = {}, ty[8] = {}, tz[8] = {};
+            float sx[8] = {}, sy[8] = {}, sz[8] = {};
+            float rw[8] = {}, rx[8] = {}, ry[8] = {}, rz[8] = {};
+            for (std::size_t i = 0; i < count; ++i) {
+                tx[i] = pose[i].translation.x;
+                ty[i] = pose[i].translation.y;
+                tz[i] = pose[i].translation.z;
+                sx[i] = pose[i].scale.x;
+                sy[i] = pose[i].scale.y;
+                sz[i] = pose[i].scale.z;
+                rw[i] = pose[i].rotation.w;
+                rx[i] = pose[i].rotation.x;
+                ry[i] = pose[i].rotation.y;
+                rz[i] = pose[i].rotation.z;
+            }
+
+            const Float8       weight = weights[p] * normalize;
+            const Quaternionx8 r{Float8(rw), Float8(rx), Float8(ry), Float8(rz)};
+            if (p == 0)
+                reference = r;
+
+            translation += Vector3x8{Float8(tx), Float8(ty), Float8(tz)} * weight;
+            scale += Vector3x8{Float8(sx), Float8(sy), Float8(sz)} * weight;
+            rotation += select(dot(r, reference) < 0.0f, -r, r) * weight;
+        }
+
+        rotation = rotation.normalized();
+
+        float tx[8], ty[8], tz[8], sx[8], sy[8], sz[8], rw[8], rx[8], ry[8], rz[8];
+        translation.x.store(tx);
+        translation.y.store(ty);
+        translation.z.store(tz);
+        scale.x.store(sx);
+        scale.y.store(sy);
+        scale.z.store(sz);
+        rotation.w.store(rw);
+        rotation.x.store(rx);
+        rotation.y.store(ry);
+        rotation.z.store(rz);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            out[joint + i].translation = Vector3(tx[i], ty[i], tz[i]);
+            out[joint + i].rotation    = Quaternion(rw[i], rx[i], ry[i], rz[i]);
+            out[joint + i].scale       = Vector3(sx[i], sy[i], sz[i]);
+        }
+    }
+}
+
+} // namespace ink
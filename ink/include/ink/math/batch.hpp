@@ -0,0 +1,204 @@
+#pragma once
+
+#include "../core/parallel.hpp"
+#include "wide.hpp"
+
+#include <algorithm>
+
+namespace ink {
+namespace detail {
+
+/// @brief
+///   Minimum number of elements to split a batch transform across threads. Smaller batches are
+///   processed on the calling thread since thread startup costs more than the transform itself.
+inline constexpr std::size_t ParallelBatchThreshold = 65536;
+
+/// @brief
+///   Split [0, count) into ranges and call @p func on each range, possibly in parallel. Range
+///   boundaries are always multiples of 8 so that each worker could process full wide lanes.
+template <typename Func>
+inline auto parallelBatch(std::size_t count, Func &&func) noexcept -> void {
+    const std::size_t maxTasks = parallelTaskCount(count, ParallelBatchThreshold);
+    if (maxTasks <= 1) {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    parallelTasks(maxTasks, [count, &func](std::size_t task, std::size_t taskCount) {
+        const std::size_t chunk = ((count + taskCount - 1) / taskCount + 7) & ~std::size_t(7);
+        const std::size_t first = std::min(task * chunk, count);
+        const std::size_t last  = std::min(first + chunk, count);
+        if (first < last)
+            func(first, last);
+    });
+}
+
+/// @brief
+///   Transform 3D vectors in [first, last) with the specified matrix. W elements of the input
+///   vectors are considered as 1 if @p IsPoint is true, otherwise 0.
+template <bool IsPoint>
+inline auto transformVector3Range(const Matrix4 &matrix,
+                                  const Vector3 *in,
+                                  Vector3       *out,
+                                  std::size_t    first,
+                                  std::size_t    last) noexcept -> void {
+    const Float8 m00(matrix[0][0]), m01(matrix[0][1]), m02(matrix[0][2]), m03(matrix[0][3]);
+    const Float8 m10(matrix[1][0]), m11(matrix[1][1]), m12(matrix[1][2]), m13(matrix[1][3]);
+    const Float8 m20(matrix[2][0]), m21(matrix[2][1]), m22(matrix[2][2]), m23(matrix[2][3]);
+
+    for (std::size_t i = first; i < last; i += 8) {
+        const std::size_t count = std::min<std::size_t>(8, last - i);
+        const Vector3x8   v(in + i, count);
+
+        Vector3x8 result{
+            v.x * m00 + v.y * m01 + v.z * m02,
+            v.x * m10 + v.y * m11 + v.z * m12,
+            v.x * m20 + v.y * m21 + v.z * m22,
+        };
+
+        if constexpr (IsPoint)
+            result += Vector3x8(m03, m13, m23);
+
+        result.store(out + i, count);
+    }
+}
+
+/// @brief
+///   Transform 4D vectors in [first, last) with the specified matrix.
+inline auto transformVector4Range(const Matrix4 &matrix,
+                                  const Vector4 *in,
+                                  Vector4       *out,
+                                  std::size_t    first,
+                                  std::size_t    last) noexcept -> void {
+    for (std::size_t i = first; i < last; i += 8) {
+        const std::size_t count = std::min<std::size_t>(8, last - i);
+        (Vector4x8(in + i, count) * matrix).store(out + i, count);
+    }
+}
+
+/// @brief
+///   Decompose matrices in [first, last) into translations, rotations and scales.
+inline auto decomposeRange(const Matrix4 *matrices,
+                           Vector3       *translations,
+                           Quaternion    *rotations,
+                           Vector3       *scales,
+                           std::size_t    first,
+                           std::size_t    last) noexcept -> void {
+    for (std::size_t i = first; i < last; i += 8) {
+        const std::size_t count = std::min<std::size_t>(8, last - i);
+
+        Vector3x8    translation;
+        Quaternionx8 rotation;
+        Vector3x8    scale;
+        decompose(Matrix4x8(matrices + i, count), translation, rotation, scale);
+
+        translation.store(translations + i, count);
+        rotation.store(rotations + i, count);
+        scale.store(scales + i, count);
+    }
+}
+
+} // namespace detail
+
+/// @brief
+///   Transform an array of points with the specified matrix. Each point is considered as a row
+///   vector with w = 1, so the result of each element is the same as the X, Y and Z elements of
+///   `Vector4(in[i], 1) * matrix`.
+/// @note
+///   Points are processed 8 at a time in SoA layout. Large arrays are split across threads.
+/// @remark
+///   W element of the result is discarded. This is suitable for affine transforms. To perform
+///   projective transforms, use @p transformVectors() instead.
+///
+/// @param matrix
+///   The transform matrix.
+/// @param[in] in
+///   Pointer to the points to be transformed.
+/// @param[out] out
+///   Pointer to the array to store the transformed points. This could be the same as @p in.
+/// @param count
+///   Number of points to be transformed.
+inline auto transformPoints(const Matrix4 &matrix,
+                            const Vector3 *in,
+                            Vector3       *out,
+                            std::size_t    count) noexcept -> void {
+    detail::parallelBatch(count, [&](std::size_t first, std::size_t last) {
+        detail::transformVector3Range<true>(matrix, in, out, first, last);
+    });
+}
+
+/// @brief
+///   Transform an array of directions with the specified matrix. Each direction is considered as a
+///   row vector with w = 0, so translation of the matrix is not applied.
+/// @note
+///   Directions are processed 8 at a time in SoA layout. Large arrays are split across threads.
+/// @remark
+///   Directions are not normalized after transform.
+///
+/// @param matrix
+///   The transform matrix.
+/// @param[in] in
+///   Pointer to the directions to be transformed.
+/// @param[out] out
+///   Pointer to the array to store the transformed directions. This could be the same as @p in.
+/// @param count
+///   Number of directions to be transformed.
+inline auto transformDirections(const Matrix4 &matrix,
+                                const Vector3 *in,
+                                Vector3       *out,
+                                std::size_t    count) noexcept -> void {
+    detail::parallelBatch(count, [&](std::size_t first, std::size_t last) {
+        detail::transformVector3Range<false>(matrix, in, out, first, last);
+    });
+}
+
+/// @brief
+///   Transform an array of 4D row vectors with the specified matrix. The result of each element is
+///   the same as `in[i] * matrix`.
+/// @note
+///   Vectors are processed 8 at a time in SoA layout. Large arrays are split across threads.
+///
+/// @param matrix
+///   The transform matrix.
+/// @param[in] in
+///   Pointer to the vectors to be transformed.
+/// @param[out] out
+///   Pointer to the array to store the transformed vectors. This could be the same as @p in.
+/// @param count
+///   Number of vectors to be transformed.
+inline auto transformVectors(const Matrix4 &matrix,
+                             const Vector4 *in,
+                             Vector4       *out,
+                             std::size_t    count) noexcept -> void {
+    detail::parallelBatch(count, [&](std::size_t first, std::size_t last) {
+        detail::transformVector4Range(matrix, in, out, first, last);
+    });
+}
+
+/// @brief
+///   Decompose an array of affine matrices into translations, rotations and scales. The result of
+///   each element is the same as @p decompose() for a single matrix.
+/// @note
+///   Matrices are processed 8 at a time in SoA layout. Large arrays are split across threads.
+///
+/// @param[in] matrices
+///   Pointer to the matrices to be decomposed.
+/// @param[out] translations
+///   Pointer to the array to store translations of the matrices.
+/// @param[out] rotations
+///   Pointer to the array to store rotations of the matrices.
+/// @param[out] scales
+///   Pointer to the array to store scales of the matrices.
+/// @param count
+///   Number of matrices to be decomposed.
+inline auto decompose(const Matrix4 *matrices,
+                      Vector3       *translations,
+                      Quaternion    *rotations,
+                      Vector3       *scales,
+                      std::size_t    count) noexcept -> void {
+    detail::parallelBatch(count, [&](std::size_t first, std::size_t last) {
+        detail::decomposeRange(matrices, translations, rotations, scales, first, last);
+    });
+}
+
+} // namespace ink
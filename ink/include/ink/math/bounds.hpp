@@ -0,0 +1,968 @@
+#pragma once
+
+#include "wide.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace ink {
+
+struct AABB;
+struct BoundingSphere;
+struct OBB;
+
+namespace detail {
+
+/// @brief
+///   Transform a point with the specified matrix. The matrix is assumed to be affine.
+[[nodiscard]] constexpr auto transformPoint(const Matrix4 &m, Vector3 point) noexcept -> Vector3 {
+    const Vector4 p(point, 1.0f);
+    return {dot(p, m[0]), dot(p, m[1]), dot(p, m[2])};
+}
+
+/// @brief
+///   Transform a direction with the specified matrix. Translation is not applied.
+[[nodiscard]] constexpr auto transformDirection(const Matrix4 &m, Vector3 direction) noexcept
+    -> Vector3 {
+    const Vector4 d(direction, 0.0f);
+    return {dot(d, m[0]), dot(d, m[1]), dot(d, m[2])};
+}
+
+} // namespace detail
+
+/// @brief
+///   Relationship between a plane and a bounding volume.
+enum class PlaneSide {
+    Front,        // The volume is completely on the positive side of the plane.
+    Back,         // The volume is completely on the negative side of the plane.
+    Intersecting, // The volume intersects with the plane.
+};
+
+/// @brief
+///   Plane in 3D space. A point p is on the plane if `dot(normal, p) + distance == 0`.
+struct Plane {
+    Vector3 normal;
+    float   distance;
+
+    /// @brief
+    ///   Create a zero plane. The zero plane is not a valid plane.
+    constexpr Plane() noexcept : normal(), distance() {}
+
+    /// @brief
+    ///   Create a plane with the specified normal and distance.
+    ///
+    /// @param normal
+    ///   Normal of this plane.
+    /// @param distance
+    ///   Signed distance from the origin to this plane along the negative normal direction.
+    constexpr Plane(Vector3 normal, float distance) noexcept : normal(normal), distance(distance) {}
+
+    /// @brief
+    ///   Create a plane that passes through the specified point.
+    ///
+    /// @param normal
+    ///   Normal of this plane.
+    /// @param point
+    ///   A point on this plane.
+    constexpr Plane(Vector3 normal, Vector3 point) noexcept
+        : normal(normal), distance(-dot(normal, point)) {}
+
+    /// @brief
+    ///   Create a plane that passes through 3 points. The plane normal is
+    ///   `cross(b - a, c - a).normalized()`, so the normal points to the side where the points
+    ///   appear counter-clockwise in a right-handed coordinate system.
+    ///
+    /// @param a
+    ///   The first point on this plane.
+    /// @param b
+    ///   The second point on this plane.
+    /// @param c
+    ///   The third point on this plane.
+    Plane(Vector3 a, Vector3 b, Vector3 c) noexcept
+        : normal(cross(b - a, c - a).normalized()), distance(-dot(normal, a)) {}
+
+    /// @brief
+    ///   Create a plane from the plane equation `(a, b, c, d)`.
+    ///
+    /// @param equation
+    ///   The plane equation.
+    explicit constexpr Plane(Vector4 equation) noexcept
+        : normal(equation[0], equation[1], equation[2]), distance(equation[3]) {}
+
+    /// @brief
+    ///   Get the plane equation `(a, b, c, d)` of this plane.
+    [[nodiscard]] constexpr auto toVector4() const noexcept -> Vector4 {
+        return {normal, distance};
+    }
+
+    /// @brief
+    ///   Normalize this plane so that the normal is a unit vector.
+    ///
+    /// @return
+    ///   Reference to this plane.
+    auto normalize() noexcept -> Plane & {
+        *this = normalized();
+        return *this;
+    }
+
+    /// @brief
+    ///   Get normalized plane of this one. The normal of the result is a unit vector.
+    [[nodiscard]] auto normalized() const noexcept -> Plane {
+        const float invLen = 1.0f / normal.length();
+        return {normal * invLen, distance * invLen};
+    }
+
+    /// @brief
+    ///   Get signed distance from the specified point to this plane. The result is scaled by length
+    ///   of the normal if this plane is not normalized.
+    [[nodiscard]] constexpr auto signedDistance(Vector3 point) const noexcept -> float {
+        return dot(normal, point) + distance;
+    }
+
+    /// @brief
+    ///   Transform this plane with the specified matrix.
+    /// @note
+    ///   Planes are transformed with inverse transpose of the matrix. Use @p
+    ///   transformedByInverse() if inverse of the matrix is already known.
+    ///
+    /// @param m
+    ///   The matrix that transforms points.
+    ///
+    /// @return
+    ///   The transformed plane. The result is not normalized.
+    [[nodiscard]] auto transformed(const Matrix4 &m) const noexcept -> Plane {
+        return transformedByInverse(m.inversed());
+    }
+
+    /// @brief
+    ///   Transform this plane with inverse of the transform matrix.
+    ///
+    /// @param inverse
+    ///   Inverse of the matrix that transforms points.
+    ///
+    /// @return
+    ///   The transformed plane. The result is not normalized.
+    [[nodiscard]] constexpr auto transformedByInverse(const Matrix4 &inverse) const noexcept
+        -> Plane {
+        // Points are row vectors, so the plane equation is transformed as a column vector.
+        Vector4 equation;
+        for (std::size_t i = 0; i < 4; ++i) {
+            equation[i] = inverse[0][i] * normal[0] + inverse[1][i] * normal[1] +
+                          inverse[2][i] * normal[2] + inverse[3][i] * distance;
+        }
+        return Plane(equation);
+    }
+
+    /// @brief
+    ///   Classify the specified point against this plane.
+    [[nodiscard]] constexpr auto classify(Vector3 point) const noexcept -> PlaneSide {
+        const float d = signedDistance(point);
+        return d > 0 ? PlaneSide::Front : (d < 0 ? PlaneSide::Back : PlaneSide::Intersecting);
+    }
+
+    [[nodiscard]] constexpr auto classify(const AABB &box) const noexcept -> PlaneSide;
+    [[nodiscard]] constexpr auto classify(const BoundingSphere &sphere) const noexcept -> PlaneSide;
+    [[nodiscard]] constexpr auto classify(const OBB &box) const noexcept -> PlaneSide;
+};
+
+constexpr auto operator==(const Plane &lhs, const Plane &rhs) noexcept -> bool {
+    return lhs.normal == rhs.normal && lhs.distance == rhs.distance;
+}
+
+constexpr auto operator!=(const Plane &lhs, const Plane &rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+/// @brief
+///   Axis aligned bounding box.
+struct AABB {
+    Vector3 min;
+    Vector3 max;
+
+    /// @brief
+    ///   Create an empty bounding box. Merging anything into an empty box results in the merged
+    ///   volume itself.
+    constexpr AABB() noexcept
+        : min(std::numeric_limits<float>::infinity()),
+          max(-std::numeric_limits<float>::infinity()) {}
+
+    /// @brief
+    ///   Create a bounding box with the specified corners.
+    ///
+    /// @param min
+    ///   The minimum corner of this box.
+    /// @param max
+    ///   The maximum corner of this box.
+    constexpr AABB(Vector3 min, Vector3 max) noexcept : min(min), max(max) {}
+
+    /// @brief
+    ///   Create the smallest bounding box that contains all of the specified points.
+    ///
+    /// @param points
+    ///   Pointer to the points to be bounded.
+    /// @param count
+    ///   Number of points.
+    constexpr AABB(const Vector3 *points, std::size_t count) noexcept : AABB() {
+        for (std::size_t i = 0; i < count; ++i)
+            merge(points[i]);
+    }
+
+    /// @brief
+    ///   Checks if this box is empty.
+    [[nodiscard]] constexpr auto isEmpty() const noexcept -> bool {
+        return min[0] > max[0] || min[1] > max[1] || min[2] > max[2];
+    }
+
+    /// @brief
+    ///   Get center of this box.
+    [[nodiscard]] constexpr auto center() const noexcept -> Vector3 { return (min + max) * 0.5f; }
+
+    /// @brief
+    ///   Get half size of this box.
+    [[nodiscard]] constexpr auto extent() const noexcept -> Vector3 { return (max - min) * 0.5f; }
+
+    /// @brief
+    ///   Expand this box to contain the specified point.
+    ///
+    /// @return
+    ///   Reference to this box.
+    constexpr auto merge(Vector3 point) noexcept -> AABB & {
+        min = ink::min(min, point);
+        max = ink::max(max, point);
+        return *this;
+    }
+
+    /// @brief
+    ///   Expand this box to contain the specified box.
+    ///
+    /// @return
+    ///   Reference to this box.
+    constexpr auto merge(const AABB &box) noexcept -> AABB & {
+        min = ink::min(min, box.min);
+        max = ink::max(max, box.max);
+        return *this;
+    }
+
+    /// @brief
+    ///   Transform this box with the specified matrix and get the axis aligned bounding box of the
+    ///   result. This is Arvo's method, which only takes 9 multiplies per corner axis instead of
+    ///   transforming all of the 8 corners.
+    /// @note
+    ///   The matrix is assumed to be affine.
+    ///
+    /// @param m
+    ///   The matrix that transforms this box.
+    ///
+    /// @return
+    ///   The transformed bounding box.
+    [[nodiscard]] constexpr auto transformed(const Matrix4 &m) const noexcept -> AABB {
+        if (isEmpty())
+            return {};
+
+        AABB result(Vector3(m[0][3], m[1][3], m[2][3]), Vector3(m[0][3], m[1][3], m[2][3]));
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                const float a = m[i][j] * min[j];
+                const float b = m[i][j] * max[j];
+                result.min[i] += a < b ? a : b;
+                result.max[i] += a < b ? b : a;
+            }
+        }
+        return result;
+    }
+
+    /// @brief
+    ///   Checks if this box contains the specified point. Points on the boundary are contained.
+    [[nodiscard]] constexpr auto contains(Vector3 point) const noexcept -> bool {
+        return min[0] <= point[0] && point[0] <= max[0] && min[1] <= point[1] &&
+               point[1] <= max[1] && min[2] <= point[2] && point[2] <= max[2];
+    }
+
+    /// @brief
+    ///   Checks if this box completely contains the specified box.
+    [[nodiscard]] constexpr auto contains(const AABB &box) const noexcept -> bool {
+        return min[0] <= box.min[0] && box.max[0] <= max[0] && min[1] <= box.min[1] &&
+               box.max[1] <= max[1] && min[2] <= box.min[2] && box.max[2] <= max[2];
+    }
+
+    /// @brief
+    ///   Checks if this box intersects with the specified box. Touching boxes intersect.
+    [[nodiscard]] constexpr auto intersects(const AABB &box) const noexcept -> bool {
+        return min[0] <= box.max[0] && box.min[0] <= max[0] && min[1] <= box.max[1] &&
+               box.min[1] <= max[1] && min[2] <= box.max[2] && box.min[2] <= max[2];
+    }
+
+    [[nodiscard]] constexpr auto intersects(const BoundingSphere &sphere) const noexcept -> bool;
+};
+
+constexpr auto operator==(const AABB &lhs, const AABB &rhs) noexcept -> bool {
+    return lhs.min == rhs.min && lhs.max == rhs.max;
+}
+
+constexpr auto operator!=(const AABB &lhs, const AABB &rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+/// @brief
+///   Bounding sphere.
+struct BoundingSphere {
+    Vector3 center;
+    float   radius;
+
+    /// @brief
+    ///   Create an empty bounding sphere. Empty spheres have negative radius.
+    constexpr BoundingSphere() noexcept : center(), radius(-1.0f) {}
+
+    /// @brief
+    ///   Create a bounding sphere with the specified center and radius.
+    ///
+    /// @param center
+    ///   Center of this sphere.
+    /// @param radius
+    ///   Radius of this sphere.
+    constexpr BoundingSphere(Vector3 center, float radius) noexcept
+        : center(center), radius(radius) {}
+
+    /// @brief
+    ///   Create the bounding sphere of the specified box.
+    ///
+    /// @param box
+    ///   The box to be bounded.
+    explicit BoundingSphere(const AABB &box) noexcept
+        : center(box.center()), radius(box.isEmpty() ? -1.0f : box.extent().length()) {}
+
+    /// @brief
+    ///   Create a bounding sphere that contains all of the specified points with Ritter's
+    ///   algorithm. The result is not the minimal bounding sphere but is usually close to it.
+    ///
+    /// @param points
+    ///   Pointer to the points to be bounded.
+    /// @param count
+    ///   Number of points.
+    BoundingSphere(const Vector3 *points, std::size_t count) noexcept : BoundingSphere() {
+        if (count == 0)
+            return;
+
+        // Find the most separated pair of extreme points along the principal axes.
+        std::size_t minIndex[3] = {};
+        std::size_t maxIndex[3] = {};
+        for (std::size_t i = 1; i < count; ++i) {
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                if (points[i][axis] < points[minIndex[axis]][axis])
+                    minIndex[axis] = i;
+                if (points[i][axis] > points[maxIndex[axis]][axis])
+                    maxIndex[axis] = i;
+            }
+        }
+
+        Vector3 a(points[minIndex[0]]);
+        Vector3 b(points[maxIndex[0]]);
+        for (std::size_t axis = 1; axis < 3; ++axis) {
+            const Vector3 lower = points[minIndex[axis]];
+            const Vector3 upper = points[maxIndex[axis]];
+            if (dot(upper - lower, upper - lower) > dot(b - a, b - a)) {
+                a = lower;
+                b = upper;
+            }
+        }
+
+        center = (a + b) * 0.5f;
+        radius = (b - a).length() * 0.5f;
+        for (std::size_t i = 0; i < count; ++i)
+            merge(points[i]);
+    }
+
+    /// @brief
+    ///   Checks if this sphere is empty.
+    [[nodiscard]] constexpr auto isEmpty() const noexcept -> bool { return radius < 0; }
+
+    /// @brief
+    ///   Expand this sphere to contain the specified point.
+    ///
+    /// @return
+    ///   Reference to this sphere.
+    auto merge(Vector3 point) noexcept -> BoundingSphere & {
+        if (isEmpty()) {
+            center = point;
+            radius = 0;
+            return *this;
+        }
+
+        const Vector3 d    = point - center;
+        const float   dist = d.length();
+        if (dist > radius) {
+            const float newRadius = (radius + dist) * 0.5f;
+            center += d * ((newRadius - radius) / dist);
+            radius = newRadius;
+        }
+
+        return *this;
+    }
+
+    /// @brief
+    ///   Expand this sphere to contain the specified sphere.
+    ///
+    /// @return
+    ///   Reference to this sphere.
+    auto merge(const BoundingSphere &sphere) noexcept -> BoundingSphere & {
+        if (sphere.isEmpty())
+            return *this;
+
+        const Vector3 d    = sphere.center - center;
+        const float   dist = d.length();
+        if (isEmpty() || dist + radius <= sphere.radius) {
+            *this = sphere;
+            return *this;
+        }
+
+        if (dist + sphere.radius <= radius)
+            return *this;
+
+        const float newRadius = (dist + radius + sphere.radius) * 0.5f;
+        center += d * ((newRadius - radius) / dist);
+        radius = newRadius;
+        return *this;
+    }
+
+    /// @brief
+    ///   Transform this sphere with the specified matrix. Radius is scaled by the maximum scale of
+    ///   the matrix so that the result always contains the transformed volume.
+    /// @note
+    ///   The matrix is assumed to be affine.
+    ///
+    /// @param m
+    ///   The matrix that transforms this sphere.
+    ///
+    /// @return
+    ///   The transformed bounding sphere.
+    [[nodiscard]] auto transformed(const Matrix4 &m) const noexcept -> BoundingSphere {
+        if (isEmpty())
+            return {};
+
+        float maxScale = 0;
+        for (std::size_t j = 0; j < 3; ++j) {
+            const float s = m[0][j] * m[0][j] + m[1][j] * m[1][j] + m[2][j] * m[2][j];
+            maxScale      = std::max(maxScale, s);
+        }
+
+        return {detail::transformPoint(m, center), radius * std::sqrt(maxScale)};
+    }
+
+    /// @brief
+    ///   Checks if this sphere contains the specified point. Points on the boundary are contained.
+    [[nodiscard]] constexpr auto contains(Vector3 point) const noexcept -> bool {
+        const Vector3 d = point - center;
+        return dot(d, d) <= radius * radius && !isEmpty();
+    }
+
+    /// @brief
+    ///   Checks if this sphere completely contains the specified sphere.
+    [[nodiscard]] auto contains(const BoundingSphere &sphere) const noexcept -> bool {
+        return (sphere.center - center).length() + sphere.radius <= radius && !sphere.isEmpty();
+    }
+
+    /// @brief
+    ///   Checks if this sphere intersects with the specified sphere. Touching spheres intersect.
+    [[nodiscard]] constexpr auto intersects(const BoundingSphere &sphere) const noexcept -> bool {
+        const Vector3 d = sphere.center - center;
+        const float   r = radius + sphere.radius;
+        return dot(d, d) <= r * r && !isEmpty() && !sphere.isEmpty();
+    }
+
+    /// @brief
+    ///   Checks if this sphere intersects with the specified box.
+    [[nodiscard]] constexpr auto intersects(const AABB &box) const noexcept -> bool {
+        const Vector3 closest = clamp(center, box.min, box.max);
+        const Vector3 d       = closest - center;
+        return dot(d, d) <= radius * radius && !isEmpty() && !box.isEmpty();
+    }
+};
+
+constexpr auto operator==(const BoundingSphere &lhs, const BoundingSphere &rhs) noexcept -> bool {
+    return lhs.center == rhs.center && lhs.radius == rhs.radius;
+}
+
+constexpr auto operator!=(const BoundingSphere &lhs, const BoundingSphere &rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+constexpr auto AABB::intersects(const BoundingSphere &sphere) const noexcept -> bool {
+    return sphere.intersects(*this);
+}
+
+/// @brief
+///   Oriented bounding box.
+struct OBB {
+    Vector3 center;
+    Vector3 extent;  // Half size along each axis.
+    Vector3 axis[3]; // Orthonormal local axes.
+
+    /// @brief
+    ///   Create an OBB at the origin with zero size and identity orientation.
+    constexpr OBB() noexcept
+        : center(),
+          extent(),
+          axis{Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)} {}
+
+    /// @brief
+    ///   Create an OBB with the specified orientation.
+    ///
+    /// @param center
+    ///   Center of this box.
+    /// @param extent
+    ///   Half size of this box along each local axis.
+    /// @param rotation
+    ///   The unit quaternion that rotates the local axes.
+    constexpr OBB(Vector3 center, Vector3 extent, Quaternion rotation) noexcept
+        : center(center),
+          extent(extent),
+          axis{rotate(rotation, Vector3(1.0f, 0.0f, 0.0f)),
+               rotate(rotation, Vector3(0.0f, 1.0f, 0.0f)),
+               rotate(rotation, Vector3(0.0f, 0.0f, 1.0f))} {}
+
+    /// @brief
+    ///   Create an OBB from the specified axis aligned bounding box.
+    ///
+    /// @param box
+    ///   The axis aligned bounding box. Must not be empty.
+    explicit constexpr OBB(const AABB &box) noexcept
+        : center(box.center()),
+          extent(box.extent()),
+          axis{Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)} {}
+
+    /// @brief
+    ///   Transform this box with the specified matrix.
+    /// @note
+    ///   The matrix is assumed to be affine. Shear is dropped since it cannot be represented.
+    ///
+    /// @param m
+    ///   The matrix that transforms this box.
+    ///
+    /// @return
+    ///   The transformed box.
+    [[nodiscard]] auto transformed(const Matrix4 &m) const noexcept -> OBB {
+        OBB result;
+        result.center = detail::transformPoint(m, center);
+        for (std::size_t i = 0; i < 3; ++i) {
+            const Vector3 a   = detail::transformDirection(m, axis[i]);
+            const float   len = a.length();
+
+            result.extent[i] = extent[i] * len;
+            result.axis[i]   = a / len;
+        }
+        return result;
+    }
+
+    /// @brief
+    ///   Get the axis aligned bounding box of this box.
+    [[nodiscard]] constexpr auto toAABB() const noexcept -> AABB {
+        const Vector3 e = abs(axis[0]) * extent[0] + abs(axis[1]) * extent[1] +
+                          abs(axis[2]) * extent[2];
+        return {center - e, center + e};
+    }
+
+    /// @brief
+    ///   Checks if this box contains the specified point. Points on the boundary are contained.
+    [[nodiscard]] constexpr auto contains(Vector3 point) const noexcept -> bool {
+        const Vector3 d = point - center;
+        for (std::size_t i = 0; i < 3; ++i) {
+            const float t = dot(d, axis[i]);
+            if (t > extent[i] || t < -extent[i])
+                return false;
+        }
+        return true;
+    }
+
+    /// @brief
+    ///   Checks if this box intersects with the specified box with the separating axis test.
+    [[nodiscard]] constexpr auto intersects(const OBB &box) const noexcept -> bool {
+        // Small value added to the absolute rotation to handle nearly parallel edges.
+        constexpr float Epsilon = 1e-6f;
+
+        float r[3][3]    = {};
+        float absR[3][3] = {};
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                r[i][j]    = dot(axis[i], box.axis[j]);
+                absR[i][j] = (r[i][j] < 0 ? -r[i][j] : r[i][j]) + Epsilon;
+            }
+        }
+
+        const Vector3 d    = box.center - center;
+        const float   t[3] = {dot(d, axis[0]), dot(d, axis[1]), dot(d, axis[2])};
+
+        const auto separated = [](float distance, float ra, float rb) noexcept -> bool {
+            return (distance < 0 ? -distance : distance) > ra + rb;
+        };
+
+        // Axes of this box.
+        for (std::size_t i = 0; i < 3; ++i) {
+            const float rb = box.extent[0] * absR[i][0] + box.extent[1] * absR[i][1] +
+                             box.extent[2] * absR[i][2];
+            if (separated(t[i], extent[i], rb))
+                return false;
+        }
+
+        // Axes of the other box.
+        for (std::size_t j = 0; j < 3; ++j) {
+            const float ra =
+                extent[0] * absR[0][j] + extent[1] * absR[1][j] + extent[2] * absR[2][j];
+            const float dist = t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j];
+            if (separated(dist, ra, box.extent[j]))
+                return false;
+        }
+
+        // Cross products of the axes.
+        for (std::size_t i = 0; i < 3; ++i) {
+            const std::size_t i1 = (i + 1) % 3;
+            const std::size_t i2 = (i + 2) % 3;
+            for (std::size_t j = 0; j < 3; ++j) {
+                const std::size_t j1 = (j + 1) % 3;
+                const std::size_t j2 = (j + 2) % 3;
+
+                const float ra   = extent[i1] * absR[i2][j] + extent[i2] * absR[i1][j];
+                const float rb   = box.extent[j1] * absR[i][j2] + box.extent[j2] * absR[i][j1];
+                const float dist = t[i2] * r[i1][j] - t[i1] * r[i2][j];
+                if (separated(dist, ra, rb))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// @brief
+    ///   Checks if this box intersects with the specified axis aligned box.
+    [[nodiscard]] constexpr auto intersects(const AABB &box) const noexcept -> bool {
+        return !box.isEmpty() && intersects(OBB(box));
+    }
+
+    /// @brief
+    ///   Checks if this box intersects with the specified sphere.
+    [[nodiscard]] constexpr auto intersects(const BoundingSphere &sphere) const noexcept -> bool {
+        const Vector3 d       = sphere.center - center;
+        Vector3       closest = center;
+        for (std::size_t i = 0; i < 3; ++i) {
+            float t = dot(d, axis[i]);
+            t       = t > extent[i] ? extent[i] : (t < -extent[i] ? -extent[i] : t);
+            closest += axis[i] * t;
+        }
+
+        const Vector3 v = closest - sphere.center;
+        return dot(v, v) <= sphere.radius * sphere.radius && !sphere.isEmpty();
+    }
+};
+
+constexpr auto Plane::classify(const AABB &box) const noexcept -> PlaneSide {
+    const Vector3 e = box.extent();
+    const float   r = dot(e, abs(normal));
+    const float   d = signedDistance(box.center());
+    return d > r ? PlaneSide::Front : (d < -r ? PlaneSide::Back : PlaneSide::Intersecting);
+}
+
+constexpr auto Plane::classify(const BoundingSphere &sphere) const noexcept -> PlaneSide {
+    const float d = signedDistance(sphere.center);
+    return d > sphere.radius ? PlaneSide::Front
+                             : (d < -sphere.radius ? PlaneSide::Back : PlaneSide::Intersecting);
+}
+
+constexpr auto Plane::classify(const OBB &box) const noexcept -> PlaneSide {
+    const Vector3 n(dot(normal, box.axis[0]), dot(normal, box.axis[1]), dot(normal, box.axis[2]));
+    const float   r = dot(box.extent, abs(n));
+    const float   d = signedDistance(box.center);
+    return d > r ? PlaneSide::Front : (d < -r ? PlaneSide::Back : PlaneSide::Intersecting);
+}
+
+namespace detail {
+
+/// @brief
+///   Load up to 8 bounding boxes in SoA layout.
+inline auto loadAABBx8(const AABB  *boxes,
+                       std::size_t  count,
+                       Vector3x8   &boxMin,
+                       Vector3x8   &boxMax) noexcept -> void {
+    Vector3 lower[8];
+    Vector3 upper[8];
+    for (std::size_t i = 0; i < count; ++i) {
+        lower[i] = boxes[i].min;
+        upper[i] = boxes[i].max;
+    }
+
+    boxMin = Vector3x8(lower, count);
+    boxMax = Vector3x8(upper, count);
+}
+
+/// @brief
+///   Load up to 8 bounding spheres in SoA layout.
+inline auto loadBoundingSpherex8(const BoundingSphere *spheres,
+                                 std::size_t           count,
+                                 Vector3x8            &center,
+                                 Float8               &radius) noexcept -> void {
+    Vector3           centers[8];
+    alignas(32) float radii[8] = {};
+    for (std::size_t i = 0; i < count; ++i) {
+        centers[i] = spheres[i].center;
+        radii[i]   = spheres[i].radius;
+    }
+
+    center = Vector3x8(centers, count);
+    radius = Float8(radii);
+}
+
+/// @brief
+///   Store the first @p count bits of a lane mask to a bool array.
+inline auto storeMask(Float8 mask, bool *results, std::size_t count) noexcept -> void {
+    const std::uint32_t bits = maskBits(mask);
+    for (std::size_t i = 0; i < count; ++i)
+        results[i] = ((bits >> i) & 1U) != 0;
+}
+
+/// @brief
+///   Store the first @p count classification results.
+inline auto storePlaneSide(Float8      front,
+                           Float8      back,
+                           PlaneSide  *results,
+                           std::size_t count) noexcept -> void {
+    const std::uint32_t frontBits = maskBits(front);
+    const std::uint32_t backBits  = maskBits(back);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (((frontBits >> i) & 1U) != 0)
+            results[i] = PlaneSide::Front;
+        else if (((backBits >> i) & 1U) != 0)
+            results[i] = PlaneSide::Back;
+        else
+            results[i] = PlaneSide::Intersecting;
+    }
+}
+
+} // namespace detail
+
+/// @brief
+///   Test a bounding box against an array of bounding boxes. Boxes are processed 8 at a time in
+///   SoA layout.
+///
+/// @param box
+///   The box to be tested against.
+/// @param boxes
+///   Pointer to the boxes to be tested.
+/// @param count
+///   Number of boxes to be tested.
+/// @param[out] results
+///   Pointer to the array to store the results. Result i is the same as
+///   `box.intersects(boxes[i])`.
+inline auto intersects(const AABB  &box,
+                       const AABB  *boxes,
+                       std::size_t  count,
+                       bool        *results) noexcept -> void {
+    const Vector3x8 queryMin(box.min);
+    const Vector3x8 queryMax(box.max);
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(8, count - i);
+
+        Vector3x8 boxMin;
+        Vector3x8 boxMax;
+        detail::loadAABBx8(boxes + i, n, boxMin, boxMax);
+
+        const Float8 x = (queryMin.x <= boxMax.x) & (boxMin.x <= queryMax.x);
+        const Float8 y = (queryMin.y <= boxMax.y) & (boxMin.y <= queryMax.y);
+        const Float8 z = (queryMin.z <= boxMax.z) & (boxMin.z <= queryMax.z);
+        detail::storeMask(x & y & z, results + i, n);
+    }
+}
+
+/// @brief
+///   Test a bounding sphere against an array of bounding spheres. Spheres are processed 8 at a
+///   time in SoA layout.
+///
+/// @param sphere
+///   The sphere to be tested against.
+/// @param spheres
+///   Pointer to the spheres to be tested.
+/// @param count
+///   Number of spheres to be tested.
+/// @param[out] results
+///   Pointer to the array to store the results. Result i is the same as
+///   `sphere.intersects(spheres[i])`.
+inline auto intersects(const BoundingSphere &sphere,
+                       const BoundingSphere *spheres,
+                       std::size_t           count,
+                       bool                 *results) noexcept -> void {
+    const Vector3x8 queryCenter(sphere.center);
+    const Float8    queryRadius(sphere.radius);
+    const Float8    zero(0.0f);
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(8, count - i);
+
+        Vector3x8 center;
+        Float8    radius;
+        detail::loadBoundingSpherex8(spheres + i, n, center, radius);
+
+        const Vector3x8 d = center - queryCenter;
+        const Float8    r = queryRadius + radius;
+
+        const Float8 mask = (dot(d, d) <= r * r) & (zero <= radius) & (zero <= queryRadius);
+        detail::storeMask(mask, results + i, n);
+    }
+}
+
+/// @brief
+///   Test a bounding sphere against an array of bounding boxes. Boxes are processed 8 at a time
+///   in SoA layout.
+///
+/// @param sphere
+///   The sphere to be tested against.
+/// @param boxes
+///   Pointer to the boxes to be tested.
+/// @param count
+///   Number of boxes to be tested.
+/// @param[out] results
+///   Pointer to the array to store the results. Result i is the same as
+///   `sphere.intersects(boxes[i])`.
+inline auto intersects(const BoundingSphere &sphere,
+                       const AABB           *boxes,
+                       std::size_t           count,
+                       bool                 *results) noexcept -> void {
+    const Vector3x8 center(sphere.center);
+    const Float8    radius(sphere.radius);
+    const Float8    zero(0.0f);
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(8, count - i);
+
+        Vector3x8 boxMin;
+        Vector3x8 boxMax;
+        detail::loadAABBx8(boxes + i, n, boxMin, boxMax);
+
+        const Vector3x8 d = clamp(center, boxMin, boxMax) - center;
+
+        const Float8 notEmpty =
+            (boxMin.x <= boxMax.x) & (boxMin.y <= boxMax.y) & (boxMin.z <= boxMax.z);
+        const Float8 mask = (dot(d, d) <= radius * radius) & (zero <= radius) & notEmpty;
+        detail::storeMask(mask, results + i, n);
+    }
+}
+
+/// @brief
+///   Classify an array of bounding boxes against a plane. Boxes are processed 8 at a time in SoA
+///   layout.
+///
+/// @param plane
+///   The plane to be tested against.
+/// @param boxes
+///   Pointer to the boxes to be classified.
+/// @param count
+///   Number of boxes to be classified.
+/// @param[out] results
+///   Pointer to the array to store the results. Result i is the same as
+///   `plane.classify(boxes[i])`.
+inline auto classify(const Plane &plane,
+                     const AABB  *boxes,
+                     std::size_t  count,
+                     PlaneSide   *results) noexcept -> void {
+    const Vector3x8 normal(plane.normal);
+    const Vector3x8 absNormal(abs(plane.normal));
+    const Float8    distance(plane.distance);
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(8, count - i);
+
+        Vector3x8 boxMin;
+        Vector3x8 boxMax;
+        detail::loadAABBx8(boxes + i, n, boxMin, boxMax);
+
+        const Float8 r = dot((boxMax - boxMin) * 0.5f, absNormal);
+        const Float8 d = dot(normal, (boxMin + boxMax) * 0.5f) + distance;
+        detail::storePlaneSide(d > r, d < -r, results + i, n);
+    }
+}
+
+/// @brief
+///   Classify an array of bounding spheres against a plane. Spheres are processed 8 at a time in
+///   SoA layout.
+///
+/// @param plane
+///   The plane to be tested against.
+/// @param spheres
+///   Pointer to the spheres to be classified.
+/// @param count
+///   Number of spheres to be classified.
+/// @param[out] results
+///   Pointer to the array to store the results. Result i is the same as
+///   `plane.classify(spheres[i])`.
+inline auto classify(const Plane          &plane,
+                     const BoundingSphere *spheres,
+                     std::size_t           count,
+                     PlaneSide            *results) noexcept -> void {
+    const Vector3x8 normal(plane.normal);
+    const Float8    distance(plane.distance);
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(8, count - i);
+
+        Vector3x8 center;
+        Float8    radius;
+        detail::loadBoundingSpherex8(spheres + i, n, center, radius);
+
+        const Float8 d = dot(normal, center) + distance;
+        detail::storePlaneSide(d > radius, d < -radius, results + i, n);
+    }
+}
+
+/// @brief
+///   Transform an array of bounding boxes with Arvo's method. Boxes are processed 8 at a time in
+///   SoA layout.
+/// @note
+///   The matrix is assumed to be affine. Empty boxes stay empty.
+///
+/// @param m
+///   The matrix that transforms the boxes.
+/// @param in
+///   Pointer to the boxes to be transformed.
+/// @param[out] out
+///   Pointer to the array to store the transformed boxes. This could be the same as @p in.
+/// @param count
+///   Number of boxes to be transformed.
+inline auto transform(const Matrix4 &m, const AABB *in, AABB *out, std::size_t count) noexcept
+    -> void {
+    const Float8 inf(std::numeric_limits<float>::infinity());
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(8, count - i);
+
+        Vector3x8 boxMin;
+        Vector3x8 boxMax;
+        detail::loadAABBx8(in + i, n, boxMin, boxMax);
+
+        const Float8 empty = (boxMax.x < boxMin.x) | (boxMax.y < boxMin.y) | (boxMax.z < boxMin.z);
+
+        Float8 lower[3];
+        Float8 upper[3];
+        for (std::size_t r = 0; r < 3; ++r) {
+            lower[r] = Float8(m[r][3]);
+            upper[r] = lower[r];
+
+            const Float8 mins[3] = {boxMin.x, boxMin.y, boxMin.z};
+            const Float8 maxs[3] = {boxMax.x, boxMax.y, boxMax.z};
+            for (std::size_t c = 0; c < 3; ++c) {
+                const Float8 a = mins[c] * m[r][c];
+                const Float8 b = maxs[c] * m[r][c];
+                lower[r] += ink::min(a, b);
+                upper[r] += ink::max(a, b);
+            }
+
+            lower[r] = select(empty, inf, lower[r]);
+            upper[r] = select(empty, -inf, upper[r]);
+        }
+
+        Vector3 resultMin[8];
+        Vector3 resultMax[8];
+        Vector3x8(lower[0], lower[1], lower[2]).store(resultMin, n);
+        Vector3x8(upper[0], upper[1], upper[2]).store(resultMax, n);
+        for (std::size_t k = 0; k < n; ++k)
+            out[i + k] = AABB(resultMin[k], resultMax[k]);
+    }
+}
+
+} // namespace ink
@@ -0,0 +1,781 @@
+#pragma once
+
+#include "bounds.hpp"
+
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace ink {
+
+/// @brief
+///   Ray in 3D space. Points on the ray are `origin + direction * t` where t >= 0.
+struct Ray {
+    Vector3 origin;
+    Vector3 direction;
+
+    /// @brief
+    ///   Create a ray that starts at the origin and points to +Z.
+    constexpr Ray() noexcept : origin(), direction(0.0f, 0.0f, 1.0f) {}
+
+    /// @brief
+    ///   Create a ray with the specified origin and direction.
+    ///
+    /// @param origin
+    ///   Start point of this ray.
+    /// @param direction
+    ///   Direction of this ray. Distances of ray queries are measured in length of this direction,
+    ///   so it is usually normalized.
+    constexpr Ray(Vector3 origin, Vector3 direction) noexcept
+        : origin(origin), direction(direction) {}
+
+    /// @brief
+    ///   Get point on this ray at the specified distance.
+    [[nodiscard]] constexpr auto at(float t) const noexcept -> Vector3 {
+        return origin + direction * t;
+    }
+};
+
+/// @brief
+///   Hit record of a ray triangle intersection.
+struct RayHit {
+    float         distance; // Ray distance to the hit point.
+    float         u;        // Barycentric coordinate of the second vertex of the triangle.
+    float         v;        // Barycentric coordinate of the third vertex of the triangle.
+    std::uint32_t triangle; // Index of the hit triangle.
+};
+
+/// @brief
+///   BVH node. Nodes are stored in depth first order, so the left child of an interior node is
+///   always next to its parent.
+struct alignas(16) BvhNode {
+    Vector3       min;
+    std::uint32_t offset; // Leaf: index of the first primitive. Interior: index of the right child.
+    Vector3       max;
+    std::uint32_t count; // Number of primitives in this leaf. 0 for interior nodes.
+
+    /// @brief
+    ///   Checks if this node is a leaf node.
+    [[nodiscard]] constexpr auto isLeaf() const noexcept -> bool { return count != 0; }
+
+    /// @brief
+    ///   Get bounding box of this node.
+    [[nodiscard]] constexpr auto bounds() const noexcept -> AABB { return {min, max}; }
+};
+
+static_assert(sizeof(BvhNode) == 32);
+
+namespace detail {
+
+/// @brief
+///   Half of surface area of the specified box. Used as the SAH cost metric.
+[[nodiscard]] constexpr auto halfArea(const AABB &box) noexcept -> float {
+    const Vector3 e = box.max - box.min;
+    return e.x * e.y + e.y * e.z + e.z * e.x;
+}
+
+/// @brief
+///   Ray with precomputed reciprocal direction for ray box slab tests.
+class BvhRay {
+public:
+    explicit BvhRay(const Ray &ray) noexcept {
+        const Vector3 inverse = Vector3(1.0f) / ray.direction;
+#if defined(INK_SIMD)
+        m_origin  = simd::set(ray.origin.x, ray.origin.y, ray.origin.z, 0.0f);
+        m_inverse = simd::set(inverse.x, inverse.y, inverse.z, 0.0f);
+        m_xyz     = simd::lessThan(simd::set(0.0f, 0.0f, 0.0f, 1.0f), simd::splat(0.5f));
+#else
+        m_origin  = ray.origin;
+        m_inverse = inverse;
+#endif
+    }
+
+    /// @brief
+    ///   Slab test against bounding box of the specified node.
+    ///
+    /// @param node
+    ///   The node to be tested.
+    /// @param maxDistance
+    ///   Maximum ray distance.
+    /// @param[out] distance
+    ///   Ray distance where the ray enters the box. Clamped to 0 if the ray starts inside the box.
+    ///
+    /// @return
+    ///   A boolean value that indicates whether the ray hits the box within @p maxDistance.
+    auto intersect(const BvhNode &node, float maxDistance, float &distance) const noexcept -> bool {
+#if defined(INK_SIMD)
+        // The 4th lane is offset or count of the node, which is replaced by the ray range.
+        const simd::Float4 t1 = simd::mul(simd::sub(simd::load(&node.min.x), m_origin), m_inverse);
+        const simd::Float4 t2 = simd::mul(simd::sub(simd::load(&node.max.x), m_origin), m_inverse);
+
+        simd::Float4 tNear = simd::select(m_xyz, simd::min(t1, t2), simd::splat(0.0f));
+        simd::Float4 tFar  = simd::select(m_xyz, simd::max(t1, t2), simd::splat(maxDistance));
+
+        tNear = simd::max(tNear, simd::shuffle<2, 3, 0, 1>(tNear, tNear));
+        tNear = simd::max(tNear, simd::shuffle<1, 0, 3, 2>(tNear, tNear));
+        tFar  = simd::min(tFar, simd::shuffle<2, 3, 0, 1>(tFar, tFar));
+        tFar  = simd::min(tFar, simd::shuffle<1, 0, 3, 2>(tFar, tFar));
+
+        distance = simd::first(tNear);
+        return distance <= simd::first(tFar);
+#else
+        float tNear = 0.0f;
+        float tFar  = maxDistance;
+        for (std::size_t i = 0; i < 3; ++i) {
+            const float t1 = (node.min[i] - m_origin[i]) * m_inverse[i];
+            const float t2 = (node.max[i] - m_origin[i]) * m_inverse[i];
+            tNear          = std::max(tNear, std::min(t1, t2));
+            tFar           = std::min(tFar, std::max(t1, t2));
+        }
+
+        distance = tNear;
+        return tNear <= tFar;
+#endif
+    }
+
+private:
+#if defined(INK_SIMD)
+    simd::Float4 m_origin;
+    simd::Float4 m_inverse;
+    simd::Float4 m_xyz;
+#else
+    Vector3 m_origin;
+    Vector3 m_inverse;
+#endif
+};
+
+} // namespace detail
+
+/// @brief
+///   Bounding volume hierarchy over a set of primitive bounding boxes. The tree is built with
+///   binned SAH and stored as a flat array of 32 bytes nodes in depth first order.
+class Bvh {
+public:
+    /// @brief
+    ///   Leaves are split until they contain at most this number of primitives, unless the tree
+    ///   reaches @p MaxDepth.
+    static constexpr std::uint32_t MaxLeafSize = 8;
+
+    /// @brief
+    ///   Maximum depth of the tree. This is also the traversal stack size.
+    static constexpr std::uint32_t MaxDepth = 64;
+
+    /// @brief
+    ///   Number of SAH bins per axis.
+    static constexpr std::uint32_t BinCount = 16;
+
+    /// @brief
+    ///   SAH cost of traversing a node relative to intersecting one primitive. Primitives of a
+    ///   leaf are usually tested several at a time, so traversal is relatively expensive.
+    static constexpr float TraversalCost = 4.0f;
+
+    /// @brief
+    ///   Subtrees with less primitives than this are always built in the current thread.
+    static constexpr std::size_t ParallelThreshold = 4096;
+
+    /// @brief
+    ///   Create an empty BVH.
+    Bvh() noexcept = default;
+
+    /// @brief
+    ///   Build a BVH over the specified primitive bounding boxes.
+    /// @note
+    ///   Top levels of the tree are split across threads. Each thread works on a disjoint range of
+    ///   primitives and nodes, so the result does not depend on the number of threads.
+    ///
+    /// @param bounds
+    ///   Bounding boxes of the primitives. Primitive i is referred to by index i in queries.
+    /// @param count
+    ///   Number of primitives.
+    /// @param threadCount
+    ///   Maximum number of threads to be used. 0 means the number of hardware threads.
+    Bvh(const AABB *bounds, std::size_t count, std::size_t threadCount = 0)
+        : m_nodes(), m_indices(count) {
+        if (count == 0)
+            return;
+
+        std::vector<Vector3> centers(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            m_indices[i] = static_cast<std::uint32_t>(i);
+            centers[i]   = bounds[i].center();
+        }
+
+        if (threadCount == 0)
+            threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+
+        std::size_t spawnDepth = 0;
+        while ((std::size_t(1) << spawnDepth) < threadCount)
+            ++spawnDepth;
+
+        // A binary tree with n leaves has 2n - 1 nodes. Subtree of range [begin, end) takes
+        // 2 * (end - begin) - 1 nodes so that each subtree could be built independently.
+        std::vector<BvhNode> nodes(2 * count - 1);
+
+        const BuildContext context{bounds, centers.data(), m_indices.data(), nodes.data(),
+                                   spawnDepth};
+        buildNode(context, 0, 0, static_cast<std::uint32_t>(count), 0);
+
+        // Leaves do not use all of the reserved nodes. Remove the holes.
+        m_nodes.reserve(nodes.size());
+        compact(nodes, 0);
+        m_nodes.shrink_to_fit();
+    }
+
+    /// @brief
+    ///   Update bounding boxes of all nodes without changing the tree structure. This is much
+    ///   faster than rebuilding, but the tree quality degrades if primitives move a lot.
+    ///
+    /// @param bounds
+    ///   New bounding boxes of the primitives. Must contain the same number of primitives as the
+    ///   array used to build this BVH.
+    auto refit(const AABB *bounds) noexcept -> void {
+        // Children are always stored after their parents.
+        for (std::size_t i = m_nodes.size(); i-- > 0;) {
+            BvhNode &node = m_nodes[i];
+
+            AABB box;
+            if (node.isLeaf()) {
+                for (std::uint32_t k = 0; k < node.count; ++k)
+                    box.merge(bounds[m_indices[node.offset + k]]);
+            } else {
+                box = m_nodes[i + 1].bounds();
+                box.merge(m_nodes[node.offset].bounds());
+            }
+
+            node.min = box.min;
+            node.max = box.max;
+        }
+    }
+
+    /// @brief
+    ///   Checks if this BVH is empty.
+    [[nodiscard]] auto empty() const noexcept -> bool { return m_nodes.empty(); }
+
+    /// @brief
+    ///   Get bounding box of all primitives. The box is empty if this BVH is empty.
+    [[nodiscard]] auto bounds() const noexcept -> AABB {
+        return m_nodes.empty() ? AABB() : m_nodes[0].bounds();
+    }
+
+    /// @brief
+    ///   Get nodes of this BVH. The first node is the root node.
+    [[nodiscard]] auto nodes() const noexcept -> const std::vector<BvhNode> & { return m_nodes; }
+
+    /// @brief
+    ///   Get primitive indices referred by leaf nodes. Leaf node n contains primitives
+    ///   `indices()[n.offset]` to `indices()[n.offset + n.count - 1]`.
+    [[nodiscard]] auto indices() const noexcept -> const std::vector<std::uint32_t> & {
+        return m_indices;
+    }
+
+    /// @brief
+    ///   Find all primitives in leaves that overlap the specified box.
+    /// @note
+    ///   Bounding boxes of primitives are not stored, so @p func may be called for primitives that
+    ///   do not overlap @p box.
+    ///
+    /// @tparam Func
+    ///   Type of the functor. Should accept one parameter: std::uint32_t primitive.
+    ///
+    /// @param box
+    ///   The box to be queried.
+    /// @param func
+    ///   The functor to be called for each candidate primitive.
+    template <typename Func>
+    auto query(const AABB &box, Func &&func) const -> void {
+        if (m_nodes.empty())
+            return;
+
+        std::uint32_t stack[MaxDepth];
+        std::uint32_t top = 0;
+
+        stack[top++] = 0;
+        while (top != 0) {
+            const BvhNode &node = m_nodes[stack[--top]];
+            if (!node.bounds().intersects(box))
+                continue;
+
+            if (node.isLeaf()) {
+                for (std::uint32_t k = 0; k < node.count; ++k)
+                    func(m_indices[node.offset + k]);
+            } else {
+                stack[top++] = node.offset;
+                stack[top++] = static_cast<std::uint32_t>(&node - m_nodes.data()) + 1;
+            }
+        }
+    }
+
+    /// @brief
+    ///   Traverse leaves hit by the specified ray in front to back order.
+    ///
+    /// @tparam Func
+    ///   Type of the functor. Should accept two parameters: const BvhNode &leaf and float
+    ///   &maxDistance, and return a boolean value. The functor may shrink @p maxDistance to cull
+    ///   farther nodes, and return true to stop traversal.
+    ///
+    /// @param ray
+    ///   The ray to be traced.
+    /// @param maxDistance
+    ///   Maximum ray distance.
+    /// @param func
+    ///   The functor to be called for each leaf node that is hit by the ray.
+    template <typename Func>
+    auto traverse(const Ray &ray, float maxDistance, Func &&func) const -> void {
+        if (m_nodes.empty())
+            return;
+
+        const detail::BvhRay bvhRay(ray);
+
+        float distance;
+        if (!bvhRay.intersect(m_nodes[0], maxDistance, distance))
+            return;
+
+        std::uint32_t stack[MaxDepth];
+        float         distances[MaxDepth];
+        std::uint32_t top   = 0;
+        std::uint32_t index = 0;
+
+        for (;;) {
+            const BvhNode &node = m_nodes[index];
+            if (node.isLeaf()) {
+                if (func(node, maxDistance))
+                    return;
+            } else {
+                std::uint32_t nearChild = index + 1;
+                std::uint32_t farChild  = node.offset;
+                float         nearDistance;
+                float         farDistance;
+
+                bool nearHit = bvhRay.intersect(m_nodes[nearChild], maxDistance, nearDistance);
+                bool farHit  = bvhRay.intersect(m_nodes[farChild], maxDistance, farDistance);
+                if (nearHit && farHit && farDistance < nearDistance) {
+                    std::swap(nearChild, farChild);
+                    std::swap(nearDistance, farDistance);
+                } else if (!nearHit && farHit) {
+                    nearChild    = farChild;
+                    nearDistance = farDistance;
+                    nearHit      = true;
+                    farHit       = false;
+                }
+
+                if (nearHit) {
+                    if (farHit) {
+                        stack[top]     = farChild;
+                        distances[top] = farDistance;
+                        ++top;
+                    }
+
+                    index = nearChild;
+                    continue;
+                }
+            }
+
+            // Pop the next node that is still in range.
+            while (top != 0 && distances[top - 1] > maxDistance)
+                --top;
+
+            if (top == 0)
+                return;
+
+            index = stack[--top];
+        }
+    }
+
+    /// @brief
+    ///   Find primitives in leaves that are hit by the specified ray in front to back order.
+    ///
+    /// @tparam Func
+    ///   Type of the functor. Should accept two parameters: std::uint32_t primitive and float
+    ///   &maxDistance, and return a boolean value. The functor may shrink @p maxDistance to cull
+    ///   farther nodes, and return true to stop traversal.
+    ///
+    /// @param ray
+    ///   The ray to be traced.
+    /// @param maxDistance
+    ///   Maximum ray distance.
+    /// @param func
+    ///   The functor to be called for each candidate primitive.
+    template <typename Func>
+    auto raycast(const Ray &ray, float maxDistance, Func &&func) const -> void {
+        traverse(ray, maxDistance, [this, &func](const BvhNode &leaf, float &distance) -> bool {
+            for (std::uint32_t k = 0; k < leaf.count; ++k) {
+                if (func(m_indices[leaf.offset + k], distance))
+                    return true;
+            }
+            return false;
+        });
+    }
+
+private:
+    struct BuildContext {
+        const AABB    *bounds;
+        const Vector3 *centers;
+        std::uint32_t *indices;
+        BvhNode       *nodes;
+        std::size_t    spawnDepth;
+    };
+
+    struct Bin {
+        AABB          bounds;
+        std::uint32_t count;
+    };
+
+    /// @brief
+    ///   Build subtree of primitives [begin, end) at the specified node.
+    static auto buildNode(const BuildContext &context,
+                          std::uint32_t       index,
+                          std::uint32_t       begin,
+                          std::uint32_t       end,
+                          std::uint32_t       depth) noexcept -> void {
+        AABB box;
+        AABB centerBox;
+        for (std::uint32_t i = begin; i < end; ++i) {
+            box.merge(context.bounds[context.indices[i]]);
+            centerBox.merge(context.centers[context.indices[i]]);
+        }
+
+        BvhNode &node = context.nodes[index];
+        node.min      = box.min;
+        node.max      = box.max;
+        node.offset   = begin;
+        node.count    = end - begin;
+
+        const std::uint32_t count = end - begin;
+        if (count == 1 || depth + 1 >= MaxDepth)
+            return;
+
+        // Find the best binned SAH split.
+        std::size_t   bestAxis = 0;
+        std::uint32_t bestBin  = BinCount;
+        float         bestCost = std::numeric_limits<float>::infinity();
+
+        const Vector3 centerExtent = centerBox.max - centerBox.min;
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            if (!(centerExtent[axis] > 0))
+                continue;
+
+            Bin bins[BinCount] = {};
+
+            const float scale = static_cast<float>(BinCount) / centerExtent[axis];
+            for (std::uint32_t i = begin; i < end; ++i) {
+                const std::uint32_t primitive = context.indices[i];
+                const std::uint32_t b =
+                    binIndex(context.centers[primitive][axis], centerBox.min[axis], scale);
+                bins[b].bounds.merge(context.bounds[primitive]);
+                bins[b].count += 1;
+            }
+
+            // Cost of the right side of split after bin b is stored in rightCost[b].
+            float         rightCost[BinCount - 1];
+            AABB          accumulated;
+            std::uint32_t accumulatedCount = 0;
+            for (std::uint32_t b = BinCount - 1; b > 0; --b) {
+                accumulated.merge(bins[b].bounds);
+                accumulatedCount += bins[b].count;
+                rightCost[b - 1] =
+                    static_cast<float>(accumulatedCount) * detail::halfArea(accumulated);
+            }
+
+            accumulated      = AABB();
+            accumulatedCount = 0;
+            for (std::uint32_t b = 0; b < BinCount - 1; ++b) {
+                accumulated.merge(bins[b].bounds);
+                accumulatedCount += bins[b].count;
+                if (accumulatedCount == 0 || accumulatedCount == count)
+                    continue;
+
+                const float cost = static_cast<float>(accumulatedCount) *
+                                       detail::halfArea(accumulated) +
+                                   rightCost[b];
+                if (cost < bestCost) {
+                    bestAxis = axis;
+                    bestBin  = b;
+                    bestCost = cost;
+                }
+            }
+        }
+
+        const float area     = detail::halfArea(box);
+        const float leafCost = static_cast<float>(count) * area;
+        if (count <= MaxLeafSize && !(bestCost + TraversalCost * area < leafCost))
+            return;
+
+        std::uint32_t middle;
+        if (bestBin == BinCount) {
+            // All centers are the same. Split in the middle.
+            middle = begin + count / 2;
+        } else {
+            const float scale = static_cast<float>(BinCount) / centerExtent[bestAxis];
+            const float base  = centerBox.min[bestAxis];
+
+            std::uint32_t *split = std::partition(
+                context.indices + begin, context.indices + end, [&](std::uint32_t primitive) {
+                    return binIndex(context.centers[primitive][bestAxis], base, scale) <= bestBin;
+                });
+            middle = static_cast<std::uint32_t>(split - context.indices);
+        }
+
+        const std::uint32_t left  = index + 1;
+        const std::uint32_t right = index + 2 * (middle - begin);
+
+        node.offset = right;
+        node.count  = 0;
+
+        std::thread worker;
+        if (depth < context.spawnDepth && count >= ParallelThreshold) {
+            try {
+                worker = std::thread([&context, left, begin, middle, depth] {
+                    buildNode(context, left, begin, middle, depth + 1);
+                });
+            } catch (const std::system_error &) {
+                // Fall back to building in the current thread.
+            }
+        }
+
+        if (!worker.joinable())
+            buildNode(context, left, begin, middle, depth + 1);
+        buildNode(context, right, middle, end, depth + 1);
+
+        if (worker.joinable())
+            worker.join();
+    }
+
+    [[nodiscard]] static auto binIndex(float center, float base, float scale) noexcept
+        -> std::uint32_t {
+        const auto b = static_cast<std::uint32_t>((center - base) * scale);
+        return std::min(b, BinCount - 1);
+    }
+
+    /// @brief
+    ///   Copy the subtree at the specified node in depth first order without holes.
+    auto compact(const std::vector<BvhNode> &nodes, std::uint32_t index) -> void {
+        const auto current = static_cast<std::uint32_t>(m_nodes.size());
+        m_nodes.push_back(nodes[index]);
+        if (nodes[index].isLeaf())
+            return;
+
+        compact(nodes, index + 1);
+        m_nodes[current].offset = static_cast<std::uint32_t>(m_nodes.size());
+        compact(nodes, nodes[index].offset);
+    }
+
+    std::vector<BvhNode>       m_nodes;
+    std::vector<std::uint32_t> m_indices;
+};
+
+/// @brief
+///   BVH over an indexed triangle mesh. Leaf triangles are intersected 8 at a time.
+class MeshBvh {
+public:
+    /// @brief
+    ///   Create an empty mesh BVH.
+    MeshBvh() noexcept = default;
+
+    /// @brief
+    ///   Build a BVH over the specified triangles.
+    ///
+    /// @param positions
+    ///   Vertex positions of the mesh.
+    /// @param indices
+    ///   Vertex indices of the triangles. Triangle i is made up of vertices `indices[3 * i]`,
+    ///   `indices[3 * i + 1]` and `indices[3 * i + 2]`.
+    /// @param triangleCount
+    ///   Number of triangles.
+    /// @param threadCount
+    ///   Maximum number of threads to be used. 0 means the number of hardware threads.
+    MeshBvh(const Vector3       *positions,
+            const std::uint32_t *indices,
+            std::size_t          triangleCount,
+            std::size_t          threadCount = 0)
+        : m_bvh(), m_indices(indices, indices + triangleCount * 3), m_triangles(), m_stride() {
+        const std::vector<AABB> bounds = triangleBounds(positions);
+        m_bvh = Bvh(bounds.data(), triangleCount, threadCount);
+        updateTriangles(positions);
+    }
+
+    /// @brief
+    ///   Update vertex positions without changing the tree structure. This is meant for animated
+    ///   meshes whose topology does not change.
+    ///
+    /// @param positions
+    ///   New vertex positions of the mesh.
+    auto refit(const Vector3 *positions) -> void {
+        const std::vector<AABB> bounds = triangleBounds(positions);
+        m_bvh.refit(bounds.data());
+        updateTriangles(positions);
+    }
+
+    /// @brief
+    ///   Get the underlying BVH. Primitives of the BVH are triangles.
+    [[nodiscard]] auto bvh() const noexcept -> const Bvh & { return m_bvh; }
+
+    /// @brief
+    ///   Get number of triangles in this mesh.
+    [[nodiscard]] auto triangleCount() const noexcept -> std::size_t {
+        return m_indices.size() / 3;
+    }
+
+    /// @brief
+    ///   Find the closest triangle hit by the specified ray. Triangles are double sided.
+    ///
+    /// @param ray
+    ///   The ray to be traced.
+    /// @param[out] hit
+    ///   Hit record of the closest triangle. Not modified if nothing is hit.
+    /// @param maxDistance
+    ///   Maximum ray distance.
+    ///
+    /// @return
+    ///   A boolean value that indicates whether any triangle is hit.
+    auto intersect(const Ray &ray,
+                   RayHit    &hit,
+                   float maxDistance = std::numeric_limits<float>::infinity()) const -> bool {
+        const Vector3x8 origin(ray.origin);
+        const Vector3x8 direction(ray.direction);
+
+        bool found = false;
+        m_bvh.traverse(ray, maxDistance, [&](const BvhNode &leaf, float &distance) -> bool {
+            found |= intersectLeaf(origin, direction, leaf, distance, &hit);
+            return false;
+        });
+
+        return found;
+    }
+
+    /// @brief
+    ///   Checks if the specified ray hits any triangle. This is faster than @p intersect() since
+    ///   traversal stops at the first hit.
+    ///
+    /// @param ray
+    ///   The ray to be traced.
+    /// @param maxDistance
+    ///   Maximum ray distance.
+    ///
+    /// @return
+    ///   A boolean value that indicates whether any triangle is hit.
+    [[nodiscard]] auto occluded(const Ray &ray, float maxDistance) const -> bool {
+        const Vector3x8 origin(ray.origin);
+        const Vector3x8 direction(ray.direction);
+
+        bool found = false;
+        m_bvh.traverse(ray, maxDistance, [&](const BvhNode &leaf, float &distance) -> bool {
+            found = intersectLeaf(origin, direction, leaf, distance, nullptr);
+            return found;
+        });
+
+        return found;
+    }
+
+private:
+    [[nodiscard]] auto triangleBounds(const Vector3 *positions) const -> std::vector<AABB> {
+        std::vector<AABB> bounds(m_indices.size() / 3);
+        for (std::size_t i = 0; i < bounds.size(); ++i) {
+            bounds[i].merge(positions[m_indices[3 * i]]);
+            bounds[i].merge(positions[m_indices[3 * i + 1]]);
+            bounds[i].merge(positions[m_indices[3 * i + 2]]);
+        }
+        return bounds;
+    }
+
+    /// @brief
+    ///   Store triangles in BVH leaf order and SoA layout so that triangles of a leaf could be
+    ///   loaded into wide registers directly.
+    auto updateTriangles(const Vector3 *positions) -> void {
+        const std::vector<std::uint32_t> &order = m_bvh.indices();
+
+        // Pad each component with zero triangles so that 8 lanes could always be loaded.
+        m_stride = order.size() + 7;
+        m_triangles.assign(9 * m_stride, 0.0f);
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            const std::uint32_t *triangle = m_indices.data() + 3 * order[i];
+
+            const Vector3 vertex = positions[triangle[0]];
+            const Vector3 edge1  = positions[triangle[1]] - vertex;
+            const Vector3 edge2  = positions[triangle[2]] - vertex;
+            for (std::size_t c = 0; c < 3; ++c) {
+                m_triangles[c * m_stride + i]       = vertex[c];
+                m_triangles[(c + 3) * m_stride + i] = edge1[c];
+                m_triangles[(c + 6) * m_stride + i] = edge2[c];
+            }
+        }
+    }
+
+    /// @brief
+    ///   Load 8 consecutive triangle vectors starting from the specified triangle. @p component is
+    ///   0 for vertices, 3 for first edges and 6 for second edges.
+    [[nodiscard]] auto loadTriangles(std::size_t component, std::uint32_t first) const noexcept
+        -> Vector3x8 {
+        const float *data = m_triangles.data() + component * m_stride + first;
+        return {Float8(data), Float8(data + m_stride), Float8(data + 2 * m_stride)};
+    }
+
+    /// @brief
+    ///   Moller-Trumbore intersection against triangles of the specified leaf. Shrinks
+    ///   @p maxDistance to the closest hit. @p hit could be null if hit record is not needed.
+    auto intersectLeaf(const Vector3x8 &origin,
+                       const Vector3x8 &direction,
+                       const BvhNode   &leaf,
+                       float           &maxDistance,
+                       RayHit          *hit) const noexcept -> bool {
+        bool found = false;
+
+        const std::uint32_t end = leaf.offset + leaf.count;
+        for (std::uint32_t first = leaf.offset; first < end; first += 8) {
+            const std::size_t n = std::min<std::size_t>(8, end - first);
+
+            // Lanes after the last triangle of this leaf belong to other leaves.
+            const Vector3x8 vertex = loadTriangles(0, first);
+            const Vector3x8 edge1  = loadTriangles(3, first);
+            const Vector3x8 edge2  = loadTriangles(6, first);
+
+            const Vector3x8 p      = cross(direction, edge2);
+            const Float8    det    = dot(edge1, p);
+            const Float8    invDet = Float8(1.0f) / det;
+
+            const Vector3x8 s = origin - vertex;
+            const Float8    u = dot(s, p) * invDet;
+            const Vector3x8 q = cross(s, edge1);
+            const Float8    v = dot(direction, q) * invDet;
+            const Float8    t = dot(edge2, q) * invDet;
+
+            const Float8 mask = (abs(det) > Float8(0.0f)) & (u >= Float8(0.0f)) &
+                                (v >= Float8(0.0f)) & (u + v <= Float8(1.0f)) &
+                                (t >= Float8(0.0f)) & (t <= Float8(maxDistance));
+
+            std::uint32_t bits = maskBits(mask) & ((1U << n) - 1);
+            if (bits == 0)
+                continue;
+
+            if (hit == nullptr)
+                return true;
+
+            alignas(32) float ts[8];
+            alignas(32) float us[8];
+            alignas(32) float vs[8];
+            t.store(ts);
+            u.store(us);
+            v.store(vs);
+
+            for (std::uint32_t lane = 0; bits != 0; ++lane, bits >>= 1) {
+                if ((bits & 1U) == 0 || ts[lane] > maxDistance)
+                    continue;
+
+                maxDistance   = ts[lane];
+                hit->distance = ts[lane];
+                hit->u        = us[lane];
+                hit->v        = vs[lane];
+                hit->triangle = m_bvh.indices()[first + lane];
+                found         = true;
+            }
+        }
+
+        return found;
+    }
+
+    Bvh                        m_bvh;
+    std::vector<std::uint32_t> m_indices;
+    std::vector<float>         m_triangles;
+    std::size_t                m_stride;
+};
+
+} // namespace ink
@@ -0,0 +1,516 @@
+#pragma once
+
+#include "batch.hpp"
+#include "color_type.hpp"
+#include "packed.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace ink {
+
+/// @brief
+///   Perform linear interpolation between the 2 colors.
+///
+/// @param start
+///   The first color to be interpolated.
+/// @param end
+///   The second color to be interpolated.
+/// @param t
+///   Interpolation factor, must between 0 and 1.
+///
+/// @return
+///   The interpolation result color.
+[[nodiscard]] constexpr auto lerp(const Color &start, const Color &end, float t) noexcept
+    -> Color {
+    return start + (end - start) * t;
+}
+
+/// @brief
+///   Calculate relative luminance of a linear color with Rec. 709 primaries.
+///
+/// @param color
+///   The linear color. Alpha channel is ignored.
+///
+/// @return
+///   Relative luminance of @p color.
+[[nodiscard]] constexpr auto luminance(const Color &color) noexcept -> float {
+    return 0.2126f * color.red + 0.7152f * color.green + 0.0722f * color.blue;
+}
+
+/// @brief
+///   Calculate relative luminance of a linear RGB color with Rec. 709 primaries.
+///
+/// @param color
+///   The linear RGB color.
+///
+/// @return
+///   Relative luminance of @p color.
+[[nodiscard]] constexpr auto luminance(Vector3 color) noexcept -> float {
+    return 0.2126f * color.x + 0.7152f * color.y + 0.0722f * color.z;
+}
+
+/// @brief
+///   Convert an sRGB encoded value to linear value.
+///
+/// @param value
+///   The sRGB encoded value. Should be in [0, 1].
+///
+/// @return
+///   The linear value.
+[[nodiscard]] inline auto srgbToLinear(float value) noexcept -> float {
+    return value <= 0.04045f ? value * (1.0f / 12.92f)
+                             : std::pow((value + 0.055f) * (1.0f / 1.055f), 2.4f);
+}
+
+/// @brief
+///   Convert a linear value to sRGB encoded value.
+///
+/// @param value
+///   The linear value. Should be in [0, 1].
+///
+/// @return
+///   The sRGB encoded value.
+[[nodiscard]] inline auto linearToSrgb(float value) noexcept -> float {
+    return value <= 0.0031308f ? value * 12.92f
+                               : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+/// @brief
+///   Approximately convert an sRGB encoded value to linear value with a cubic polynomial.
+/// @note
+///   Maximum absolute error is about 1.7e-3 in [0, 1], which is less than half a step of 8-bit
+///   colors.
+///
+/// @param value
+///   The sRGB encoded value. Should be in [0, 1].
+///
+/// @return
+///   The linear value.
+[[nodiscard]] constexpr auto srgbToLinearFast(float value) noexcept -> float {
+    return value * (value * (value * 0.305306011f + 0.682171111f) + 0.012522878f);
+}
+
+/// @brief
+///   Approximately convert a linear value to sRGB encoded value with 3 square roots. The linear
+///   segment near 0 is exact.
+/// @note
+///   Maximum absolute error is about 1.6e-3 in [0, 1].
+///
+/// @param value
+///   The linear value. Should be in [0, 1].
+///
+/// @return
+///   The sRGB encoded value.
+[[nodiscard]] constexpr auto linearToSrgbFast(float value) noexcept -> float {
+    const float s1     = ink::sqrt(value);
+    const float s2     = ink::sqrt(s1);
+    const float s3     = ink::sqrt(s2);
+    const float result = 0.585122381f * s1 + 0.783140355f * s2 - 0.368262736f * s3;
+    return value <= 0.0031308f ? (value > 0 ? value * 12.92f : 0.0f) : result;
+}
+
+/// @brief
+///   Convert an sRGB encoded color to linear color. Alpha channel is not changed.
+[[nodiscard]] inline auto srgbToLinear(const Color &color) noexcept -> Color {
+    return {srgbToLinear(color.red), srgbToLinear(color.green), srgbToLinear(color.blue),
+            color.alpha};
+}
+
+/// @brief
+///   Convert a linear color to sRGB encoded color. Alpha channel is not changed.
+[[nodiscard]] inline auto linearToSrgb(const Color &color) noexcept -> Color {
+    return {linearToSrgb(color.red), linearToSrgb(color.green), linearToSrgb(color.blue),
+            color.alpha};
+}
+
+/// @brief
+///   Approximately convert an sRGB encoded color to linear color. Alpha channel is not changed.
+///   See @p srgbToLinearFast() for precision.
+[[nodiscard]] constexpr auto srgbToLinearFast(const Color &color) noexcept -> Color {
+    return {srgbToLinearFast(color.red), srgbToLinearFast(color.green),
+            srgbToLinearFast(color.blue), color.alpha};
+}
+
+/// @brief
+///   Approximately convert a linear color to sRGB encoded color. Alpha channel is not changed.
+///   See @p linearToSrgbFast() for precision.
+[[nodiscard]] constexpr auto linearToSrgbFast(const Color &color) noexcept -> Color {
+    return {linearToSrgbFast(color.red), linearToSrgbFast(color.green),
+            linearToSrgbFast(color.blue), color.alpha};
+}
+
+/// @brief
+///   Convert an sRGB encoded RGBA vector to linear. W element is considered as alpha and is not
+///   changed.
+[[nodiscard]] inline auto srgbToLinear(Vector4 color) noexcept -> Vector4 {
+    return srgbToLinear(Color(color)).toVector4();
+}
+
+/// @brief
+///   Convert a linear RGBA vector to sRGB encoded. W element is considered as alpha and is not
+///   changed.
+[[nodiscard]] inline auto linearToSrgb(Vector4 color) noexcept -> Vector4 {
+    return linearToSrgb(Color(color)).toVector4();
+}
+
+/// @brief
+///   Approximately convert an sRGB encoded RGBA vector to linear. W element is considered as alpha
+///   and is not changed. See @p srgbToLinearFast() for precision.
+[[nodiscard]] constexpr auto srgbToLinearFast(Vector4 color) noexcept -> Vector4 {
+    return srgbToLinearFast(Color(color)).toVector4();
+}
+
+/// @brief
+///   Approximately convert a linear RGBA vector to sRGB encoded. W element is considered as alpha
+///   and is not changed. See @p linearToSrgbFast() for precision.
+[[nodiscard]] constexpr auto linearToSrgbFast(Vector4 color) noexcept -> Vector4 {
+    return linearToSrgbFast(Color(color)).toVector4();
+}
+
+namespace detail {
+
+/// @brief
+///   Linear values of all 8-bit sRGB values.
+[[nodiscard]] inline auto srgb8ToLinearTable() noexcept -> const float * {
+    static const auto table = []() noexcept {
+        struct {
+            float values[256];
+        } result{};
+        for (std::size_t i = 0; i < 256; ++i)
+            result.values[i] = srgbToLinear(static_cast<float>(i) / 255.0f);
+        return result;
+    }();
+    return table.values;
+}
+
+/// @brief
+///   Piecewise linear approximation of linear to 8-bit sRGB conversion. Floats in [2^-13, 1) are
+///   split into 104 buckets by exponent and the top 3 mantissa bits. Upper 16 bits of each entry
+///   are the bias and lower 16 bits are the slope against the next 8 mantissa bits.
+inline constexpr std::uint32_t LinearToSrgb8Table[104] = {
+    0x0070000A, 0x0079000F, 0x0080000A, 0x0084000A, 0x008A000A, 0x0091000A, 0x0097000A,
+    0x009E000A, 0x00A40017, 0x00B10017, 0x00BE0017, 0x00CB0017, 0x00D70017, 0x00E40017,
+    0x00F50018, 0x01000017, 0x010B0030, 0x01250030, 0x013E0030, 0x01580030, 0x01750033,
+    0x018C0030, 0x01A50030, 0x01BF0030, 0x01DD0064, 0x020C0064, 0x02400064, 0x02760069,
+    0x02A70064, 0x02DE0065, 0x030E0064, 0x03410064, 0x037800CB, 0x03DF00CC, 0x044600CD,
+    0x04AD00CD, 0x051100CB, 0x057A00C2, 0x05DD00BB, 0x063C00B3, 0x06980155, 0x0743013F,
+    0x07E30130, 0x087A0121, 0x090C0110, 0x09950103, 0x0A1800F9, 0x0A9600EF, 0x0B1001C8,
+    0x0BF301B1, 0x0CCC0192, 0x0D97017D, 0x0E55016F, 0x0F0E015B, 0x0FBD014D, 0x10630143,
+    0x11080261, 0x1239023D, 0x1358021A, 0x14650204, 0x156601EA, 0x165A01D3, 0x174401BE,
+    0x182501AC, 0x18FE0330, 0x1A9702FB, 0x1C1602CF, 0x1D7D02AD, 0x1ED4028D, 0x201B026D,
+    0x21520256, 0x227C0242, 0x23A00440, 0x25C203FB, 0x27C003C1, 0x29A10392, 0x2B690368,
+    0x2D1E033E, 0x2EBE031D, 0x304D02FF, 0x31D105AD, 0x34A90552, 0x37520509, 0x39D504C2,
+    0x3C37048A, 0x3E7B045A, 0x40A80428, 0x42BD03FE, 0x44C30797, 0x488C071B, 0x4C1D06B3,
+    0x4F76065E, 0x52A5060E, 0x55AC05CA, 0x5892058D, 0x5B580556, 0x5E0B0A26, 0x631C097F,
+    0x67DC08F3, 0x6C55087E, 0x70950815, 0x749F07BA, 0x787C076E, 0x7C340721,
+};
+
+/// @brief
+///   Bits of the smallest value that is handled by @p LinearToSrgb8Table. Smaller values are
+///   always converted to 0.
+inline constexpr std::uint32_t LinearToSrgb8MinBits = (127U - 13U) << 23;
+
+/// @brief
+///   Bits of the largest float that is less than 1.
+inline constexpr std::uint32_t LinearToSrgb8MaxBits = 0x3F7FFFFFU;
+
+/// @brief
+///   Convert clamped float bits with @p LinearToSrgb8Table.
+[[nodiscard]] constexpr auto linearToSrgb8Bits(std::uint32_t bits) noexcept -> std::uint32_t {
+    const std::uint32_t entry = LinearToSrgb8Table[(bits - LinearToSrgb8MinBits) >> 20];
+    const std::uint32_t bias  = (entry >> 16) << 9;
+    const std::uint32_t scale = entry & 0xFFFFU;
+    const std::uint32_t t     = (bits >> 12) & 0xFFU;
+    return (bias + scale * t) >> 16;
+}
+
+} // namespace detail
+
+/// @brief
+///   Convert a linear value to 8-bit sRGB encoded value with a lookup table. This is much faster
+///   than rounding the result of @p linearToSrgb().
+/// @note
+///   The result differs from correctly rounded conversion by at most 1, for about 1% of inputs.
+///
+/// @param value
+///   The linear value. Values out of [0, 1] are clamped. NaN is converted to 0.
+///
+/// @return
+///   The 8-bit sRGB encoded value.
+[[nodiscard]] inline auto linearToSrgb8(float value) noexcept -> std::uint8_t {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    // Negative values and NaN are greater than maximum bits as unsigned integers.
+    if (!(value > 0x1p-13f))
+        bits = detail::LinearToSrgb8MinBits;
+    if (bits > detail::LinearToSrgb8MaxBits)
+        bits = detail::LinearToSrgb8MaxBits;
+    return static_cast<std::uint8_t>(detail::linearToSrgb8Bits(bits));
+}
+
+/// @brief
+///   Convert 8-bit sRGB encoded colors to linear colors. Alpha channels are converted linearly.
+/// @note
+///   Colors are converted with a lookup table. Large arrays are split across threads.
+///
+/// @param[in] in
+///   Pointer to the sRGB encoded colors. Red channel is stored in the lowest byte.
+/// @param[out] out
+///   Pointer to the array to store the linear colors.
+/// @param count
+///   Number of colors to be converted.
+inline auto srgbToLinear(const UNorm8x4 *in, Color *out, std::size_t count) noexcept -> void {
+    const float *table = detail::srgb8ToLinearTable();
+    detail::parallelBatch(count, [=](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            const std::uint32_t bits = in[i].bits;
+            out[i]                   = Color(table[bits & 0xFFU], table[(bits >> 8) & 0xFFU],
+                                             table[(bits >> 16) & 0xFFU],
+                                             static_cast<float>(bits >> 24) / 255.0f);
+        }
+    });
+}
+
+/// @brief
+///   Convert linear colors to 8-bit sRGB encoded colors. Alpha channels are converted linearly.
+/// @note
+///   Colors are converted with the same lookup table as @p linearToSrgb8(). Table entries are
+///   gathered with AVX2 instructions if available. Large arrays are split across threads.
+///
+/// @param[in] in
+///   Pointer to the linear colors.
+/// @param[out] out
+///   Pointer to the array to store the sRGB encoded colors. Red channel is stored in the lowest
+///   byte.
+/// @param count
+///   Number of colors to be converted.
+inline auto linearToSrgb(const Color *in, UNorm8x4 *out, std::size_t count) noexcept -> void {
+    detail::parallelBatch(count, [=](std::size_t first, std::size_t last) {
+        std::size_t i = first;
+#if defined(INK_SIMD_AVX2)
+        // Convert 2 colors at once with gathered table entries.
+        const __m256i minBits  = _mm256_set1_epi32(detail::LinearToSrgb8MinBits);
+        const __m256i maxBits  = _mm256_set1_epi32(detail::LinearToSrgb8MaxBits);
+        const __m256  minValue = _mm256_castsi256_ps(minBits);
+        const __m256  maxValue = _mm256_castsi256_ps(maxBits);
+        const __m256  zero     = _mm256_setzero_ps();
+        const __m256  one      = _mm256_set1_ps(1.0f);
+        const __m256  scale255 = _mm256_set1_ps(255.0f);
+        const __m256i lowMask  = _mm256_set1_epi32(0xFFFF);
+        const __m256i byteMask = _mm256_set1_epi32(0xFF);
+        const auto   *table    = reinterpret_cast<const int *>(detail::LinearToSrgb8Table);
+
+        const std::size_t pairLast = first + ((last - first) & ~std::size_t(1));
+        for (; i < pairLast; i += 2) {
+            const __m256 color = _mm256_loadu_ps(&in[i].red);
+
+            // maxps returns the second operand for NaN.
+            const __m256  clamped = _mm256_min_ps(_mm256_max_ps(color, minValue), maxValue);
+            const __m256i bits    = _mm256_castps_si256(clamped);
+            const __m256i index   = _mm256_srli_epi32(_mm256_sub_epi32(bits, minBits), 20);
+            const __m256i entry   = _mm256_i32gather_epi32(table, index, 4);
+            const __m256i bias    = _mm256_slli_epi32(_mm256_srli_epi32(entry, 16), 9);
+            const __m256i scale   = _mm256_and_si256(entry, lowMask);
+            const __m256i t       = _mm256_and_si256(_mm256_srli_epi32(bits, 12), byteMask);
+            const __m256i rgb =
+                _mm256_srli_epi32(_mm256_add_epi32(bias, _mm256_mullo_epi32(scale, t)), 16);
+
+            const __m256  unorm = _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(color, zero), one),
+                                                scale255);
+            const __m256i alpha = _mm256_cvtps_epi32(unorm);
+
+            __m256i result = _mm256_blend_epi32(rgb, alpha, 0x88);
+            result         = _mm256_packus_epi32(result, result);
+            result         = _mm256_packus_epi16(result, result);
+
+            out[i].bits     = static_cast<std::uint32_t>(
+                _mm_cvtsi128_si32(_mm256_castsi256_si128(result)));
+            out[i + 1].bits = static_cast<std::uint32_t>(
+                _mm_cvtsi128_si32(_mm256_extracti128_si256(result, 1)));
+        }
+#endif
+        for (; i < last; ++i) {
+            const float alpha = std::clamp(in[i].alpha, 0.0f, 1.0f) * 255.0f;
+            out[i]            = UNorm8x4(linearToSrgb8(in[i].red), linearToSrgb8(in[i].green),
+                                         linearToSrgb8(in[i].blue),
+                                         static_cast<std::uint8_t>(detail::roundToInt(alpha)));
+        }
+    });
+}
+
+/// @brief
+///   Approximately convert sRGB encoded colors to linear colors. Alpha channels are not changed.
+///   See @p srgbToLinearFast() for precision.
+/// @note
+///   Each color is converted with SIMD instructions. Large arrays are split across threads. It is
+///   safe to convert colors in place.
+///
+/// @param[in] in
+///   Pointer to the sRGB encoded colors.
+/// @param[out] out
+///   Pointer to the array to store the linear colors.
+/// @param count
+///   Number of colors to be converted.
+inline auto srgbToLinearFast(const Color *in, Color *out, std::size_t count) noexcept -> void {
+    detail::parallelBatch(count, [=](std::size_t first, std::size_t last) {
+#if defined(INK_SIMD)
+        const simd::Float4 c0  = simd::splat(0.012522878f);
+        const simd::Float4 c1  = simd::splat(0.682171111f);
+        const simd::Float4 c2  = simd::splat(0.305306011f);
+        const simd::Float4 rgb = simd::lessThan(simd::set(0, 0, 0, 1), simd::splat(0.5f));
+        for (std::size_t i = first; i < last; ++i) {
+            const simd::Float4 x = simd::loadUnaligned(&in[i].red);
+
+            simd::Float4 y = simd::add(simd::mul(x, c2), c1);
+            y              = simd::add(simd::mul(x, y), c0);
+            y              = simd::mul(x, y);
+            simd::storeUnaligned(&out[i].red, simd::select(rgb, y, x));
+        }
+#else
+        for (std::size_t i = first; i < last; ++i)
+            out[i] = srgbToLinearFast(in[i]);
+#endif
+    });
+}
+
+/// @brief
+///   Approximately convert linear colors to sRGB encoded colors. Alpha channels are not changed.
+///   See @p linearToSrgbFast() for precision.
+/// @note
+///   Each color is converted with SIMD instructions. Large arrays are split across threads. It is
+///   safe to convert colors in place.
+///
+/// @param[in] in
+///   Pointer to the linear colors.
+/// @param[out] out
+///   Pointer to the array to store the sRGB encoded colors.
+/// @param count
+///   Number of colors to be converted.
+inline auto linearToSrgbFast(const Color *in, Color *out, std::size_t count) noexcept -> void {
+    detail::parallelBatch(count, [=](std::size_t first, std::size_t last) {
+#if defined(INK_SIMD)
+        const simd::Float4 c1    = simd::splat(0.585122381f);
+        const simd::Float4 c2    = simd::splat(0.783140355f);
+        const simd::Float4 c3    = simd::splat(0.368262736f);
+        const simd::Float4 zero  = simd::splat(0.0f);
+        const simd::Float4 toe   = simd::splat(0.0031308f);
+        const simd::Float4 slope = simd::splat(12.92f);
+        const simd::Float4 rgb   = simd::lessThan(simd::set(0, 0, 0, 1), simd::splat(0.5f));
+        for (std::size_t i = first; i < last; ++i) {
+            const simd::Float4 x  = simd::loadUnaligned(&in[i].red);
+            const simd::Float4 s1 = simd::sqrt(simd::max(x, zero));
+            const simd::Float4 s2 = simd::sqrt(s1);
+            const simd::Float4 s3 = simd::sqrt(s2);
+
+            // Values near 0 are converted with the exact linear segment.
+            const simd::Float4 isToe = simd::lessEqual(x, toe);
+
+            simd::Float4 y = simd::add(simd::mul(s1, c1), simd::mul(s2, c2));
+            y              = simd::sub(y, simd::mul(s3, c3));
+            y              = simd::select(isToe, simd::mul(simd::max(x, zero), slope), y);
+            simd::storeUnaligned(&out[i].red, simd::select(rgb, y, x));
+        }
+#else
+        for (std::size_t i = first; i < last; ++i)
+            out[i] = linearToSrgbFast(in[i]);
+#endif
+    });
+}
+
+/// @brief
+///   Multiply red, green and blue channels of the colors by their alpha channels in place.
+///
+/// @param[in, out] colors
+///   Pointer to the colors to be premultiplied.
+/// @param count
+///   Number of colors to be premultiplied.
+inline auto premultiplyAlpha(Color *colors, std::size_t count) noexcept -> void {
+    detail::parallelBatch(count, [=](std::size_t first, std::size_t last) {
+#if defined(INK_SIMD)
+        const simd::Float4 one = simd::splat(1.0f);
+        const simd::Float4 rgb = simd::lessThan(simd::set(0, 0, 0, 1), simd::splat(0.5f));
+        for (std::size_t i = first; i < last; ++i) {
+            const simd::Float4 c = simd::loadUnaligned(&colors[i].red);
+            const simd::Float4 a = simd::select(rgb, simd::broadcast<3>(c), one);
+            simd::storeUnaligned(&colors[i].red, simd::mul(c, a));
+        }
+#else
+        for (std::size_t i = first; i < last; ++i)
+            colors[i] = colors[i].premultiplied();
+#endif
+    });
+}
+
+/// @brief
+///   Multiply red, green and blue channels of the 8-bit colors by their alpha channels in place.
+///   Results are rounded to the nearest integer.
+/// @note
+///   Premultiplication should be applied to linear colors. Premultiplying sRGB encoded colors is
+///   only an approximation.
+///
+/// @param[in, out] colors
+///   Pointer to the colors to be premultiplied.
+/// @param count
+///   Number of colors to be premultiplied.
+inline auto premultiplyAlpha(UNorm8x4 *colors, std::size_t count) noexcept -> void {
+    detail::parallelBatch(count, [=](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            const std::uint32_t bits = colors[i].bits;
+            const std::uint32_t a    = bits >> 24;
+
+            // Multiply 2 channels at once. x / 255 is rounded as (t + (t >> 8)) >> 8 where
+            // t = x + 128, which is exact for x in [0, 255 * 255].
+            std::uint32_t rb = (bits & 0x00FF00FFU) * a + 0x00800080U;
+            std::uint32_t g  = ((bits >> 8) & 0xFFU) * a + 0x80U;
+            rb               = ((rb + ((rb >> 8) & 0x00FF00FFU)) >> 8) & 0x00FF00FFU;
+            g                = ((g + (g >> 8)) >> 8) & 0xFFU;
+
+            colors[i].bits = rb | (g << 8) | (a << 24);
+        }
+    });
+}
+
+/// @brief
+///   Calculate relative luminance of the linear colors with Rec. 709 primaries.
+///
+/// @param[in] colors
+///   Pointer to the linear colors.
+/// @param[out] out
+///   Pointer to the array to store luminance of the colors.
+/// @param count
+///   Number of colors.
+inline auto luminance(const Color *colors, float *out, std::size_t count) noexcept -> void {
+    detail::parallelBatch(count, [=](std::size_t first, std::size_t last) {
+#if defined(INK_SIMD)
+        // Transpose 4 colors at once and calculate 4 luminance values.
+        const simd::Float4 wr = simd::splat(0.2126f);
+        const simd::Float4 wg = simd::splat(0.7152f);
+        const simd::Float4 wb = simd::splat(0.0722f);
+
+        const std::size_t vectorLast = first + ((last - first) & ~std::size_t(3));
+
+        std::size_t i = first;
+        for (; i < vectorLast; i += 4) {
+            simd::Float4 r = simd::loadUnaligned(&colors[i].red);
+            simd::Float4 g = simd::loadUnaligned(&colors[i + 1].red);
+            simd::Float4 b = simd::loadUnaligned(&colors[i + 2].red);
+            simd::Float4 a = simd::loadUnaligned(&colors[i + 3].red);
+            simd::transpose(r, g, b, a);
+
+            const simd::Float4 y = simd::add(simd::add(simd::mul(r, wr), simd::mul(g, wg)),
+                                             simd::mul(b, wb));
+            simd::storeUnaligned(out + i, y);
+        }
+
+        for (; i < last; ++i)
+            out[i] = luminance(colors[i]);
+#else
+        for (std::size_t i = first; i < last; ++i)
+            out[i] = luminance(colors[i]);
+#endif
+    });
+}
+
+} // namespace ink
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "vector.hpp"
+
+namespace ink {
+
+struct Color {
+    float red   = 0;
+    float green = 0;
+    float blue  = 0;
+    float alpha = 0;
+
+    /// @brief
+    ///   Create a transparent black color. All elements are initialized to 0.
+    constexpr Color() noexcept = default;
+
+    /// @brief
+    ///   Create a color with the given color values.
+    ///
+    /// @param r
+    ///   Red intensity of this color. For non-HDR images, this value should be less than or equal
+    ///   to 1.
+    /// @param g
+    ///   Green intensity of this color. For non-HDR images, this value should be less than or equal
+    ///   to 1.
+    /// @param b
+    ///   Blue intensity of this color. For non-HDR images, this value should be less than or equal
+    ///   to 1.
+    /// @param a
+    ///   Opacity of this color.
+    constexpr Color(float r, float g, float b, float a) noexcept
+        : red(r), green(g), blue(b), alpha(a) {}
+
+    /// @brief
+    ///   Create a color from a 4D vector. X, Y, Z and W elements are red, green, blue and alpha.
+    ///
+    /// @param vec
+    ///   The vector to be converted.
+    explicit constexpr Color(Vector4 vec) noexcept
+        : red(vec[0]), green(vec[1]), blue(vec[2]), alpha(vec[3]) {}
+
+    /// @brief
+    ///   Convert this color to a 4D vector. X, Y, Z and W elements are red, green, blue and alpha.
+    [[nodiscard]] constexpr auto toVector4() const noexcept -> Vector4 {
+        return {red, green, blue, alpha};
+    }
+
+    /// @brief
+    ///   Get a copy of this color whose red, green and blue channels are multiplied by alpha.
+    [[nodiscard]] constexpr auto premultiplied() const noexcept -> Color {
+        return {red * alpha, green * alpha, blue * alpha, alpha};
+    }
+
+    constexpr auto operator+=(const Color &rhs) noexcept -> Color & {
+        red += rhs.red;
+        green += rhs.green;
+        blue += rhs.blue;
+        alpha += rhs.alpha;
+        return *this;
+    }
+
+    constexpr auto operator-=(const Color &rhs) noexcept -> Color & {
+        red -= rhs.red;
+        green -= rhs.green;
+        blue -= rhs.blue;
+        alpha -= rhs.alpha;
+        return *this;
+    }
+
+    constexpr auto operator*=(const Color &rhs) noexcept -> Color & {
+        red *= rhs.red;
+        green *= rhs.green;
+        blue *= rhs.blue;
+        alpha *= rhs.alpha;
+        return *this;
+    }
+
+    constexpr auto operator*=(float rhs) noexcept -> Color & {
+        red *= rhs;
+        green *= rhs;
+        blue *= rhs;
+        alpha *= rhs;
+        return *this;
+    }
+};
+
+constexpr auto operator+(Color lhs, const Color &rhs) noexcept -> Color {
+    return (lhs += rhs);
+}
+
+constexpr auto operator-(Color lhs, const Color &rhs) noexcept -> Color {
+    return (lhs -= rhs);
+}
+
+constexpr auto operator*(Color lhs, const Color &rhs) noexcept -> Color {
+    return (lhs *= rhs);
+}
+
+constexpr auto operator*(Color lhs, float rhs) noexcept -> Color {
+    return (lhs *= rhs);
+}
+
+constexpr auto operator*(float lhs, Color rhs) noexcept -> Color {
+    return (rhs *= lhs);
+}
+
+constexpr auto operator==(const Color &lhs, const Color &rhs) noexcept -> bool {
+    return lhs.red == rhs.red && lhs.green == rhs.green && lhs.blue == rhs.blue &&
+           lhs.alpha == rhs.alpha;
+}
+
+constexpr auto operator!=(const Color &lhs, const Color &rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+namespace colors {
+
+inline constexpr Color Transparent{0.0f, 0.0f, 0.0f, 0.0f};
+inline constexpr Color Black{0.0f, 0.0f, 0.0f, 1.0f};
+inline constexpr Color White{1.0f, 1.0f, 1.0f, 1.0f};
+inline constexpr Color Red{1.0f, 0.0f, 0.0f, 1.0f};
+inline constexpr Color Green{0.0f, 1.0f, 0.0f, 1.0f};
+inline constexpr Color Blue{0.0f, 0.0f, 1.0f, 1.0f};
+
+} // namespace colors
+
+} // namespace ink
@@ -0,0 +1,302 @@
+#pragma once
+
+#include "affine.hpp"
+#include "wide.hpp"
+
+namespace ink {
+
+/// @brief
+///   Unit dual quaternion that represents a rigid transform, which is a rotation followed by a
+///   translation. This is usually used for skinning since blending dual quaternions does not
+///   suffer from the candy-wrapper artifact of linear blend skinning, and a dual quaternion takes
+///   half the size of a 4x4 matrix.
+struct alignas(16) DualQuaternion {
+    Quaternion real; // Rotation part.
+    Quaternion dual; // Translation part.
+
+    /// @brief
+    ///   Create an identity dual quaternion.
+    constexpr DualQuaternion() noexcept : real(1.0f), dual() {}
+
+    /// @brief
+    ///   Create a dual quaternion with the specified real and dual parts.
+    ///
+    /// @param real
+    ///   Real part of this dual quaternion.
+    /// @param dual
+    ///   Dual part of this dual quaternion.
+    constexpr DualQuaternion(Quaternion real, Quaternion dual) noexcept : real(real), dual(dual) {}
+
+    /// @brief
+    ///   Create a dual quaternion that rotates first and then translates.
+    ///
+    /// @param rotation
+    ///   The unit quaternion that represents the rotation.
+    /// @param translation
+    ///   The translation to be applied after rotation.
+    constexpr DualQuaternion(Quaternion rotation, Vector3 translation) noexcept
+        : real(rotation),
+          dual(Quaternion(0.0f, translation[0], translation[1], translation[2]) * rotation *
+               0.5f) {}
+
+    /// @brief
+    ///   Get rotation of this dual quaternion.
+    [[nodiscard]] constexpr auto rotation() const noexcept -> Quaternion { return real; }
+
+    /// @brief
+    ///   Get translation of this dual quaternion.
+    /// @note
+    ///   This dual quaternion is assumed to be normalized.
+    [[nodiscard]] constexpr auto translation() const noexcept -> Vector3 {
+        const Quaternion t = dual * real.conjugated() * 2.0f;
+        return {t.x, t.y, t.z};
+    }
+
+    /// @brief
+    ///   Normalize this dual quaternion. The dual part is also made orthogonal to the real part so
+    ///   that this is a valid rigid transform.
+    ///
+    /// @return
+    ///   Reference to this dual quaternion.
+    auto normalize() noexcept -> DualQuaternion & {
+        *this = normalized();
+        return *this;
+    }
+
+    /// @brief
+    ///   Get normalized dual quaternion of this one. The dual part is also made orthogonal to the
+    ///   real part so that the result is a valid rigid transform.
+    ///
+    /// @return
+    ///   A new dual quaternion that represents the normalized dual quaternion.
+    [[nodiscard]] auto normalized() const noexcept -> DualQuaternion {
+        const float      invLen = 1.0f / std::sqrt(dot(real, real));
+        const Quaternion r      = real * invLen;
+        const Quaternion d      = dual * invLen;
+        return {r, d - r * dot(r, d)};
+    }
+
+    /// @brief
+    ///   Get conjugate of this dual quaternion. For unit dual quaternions, this is the inverse
+    ///   transform.
+    [[nodiscard]] constexpr auto conjugated() const noexcept -> DualQuaternion {
+        return {real.conjugated(), dual.conjugated()};
+    }
+
+    /// @brief
+    ///   Transform a point with this dual quaternion.
+    /// @note
+    ///   This dual quaternion is assumed to be normalized.
+    [[nodiscard]] constexpr auto transformPoint(Vector3 point) const noexcept -> Vector3 {
+        return rotate(real, point) + translation();
+    }
+
+    /// @brief
+    ///   Transform a direction with this dual quaternion. Translation is not applied.
+    /// @note
+    ///   This dual quaternion is assumed to be normalized.
+    [[nodiscard]] constexpr auto transformDirection(Vector3 direction) const noexcept -> Vector3 {
+        return rotate(real, direction);
+    }
+
+    /// @brief
+    ///   Convert this dual quaternion to a 3x4 affine transform matrix.
+    /// @note
+    ///   This dual quaternion is assumed to be normalized.
+    [[nodiscard]] constexpr auto toMatrix3x4() const noexcept -> Matrix3x4 {
+        const Matrix4 r = real.toMatrix();
+        const Vector3 t = translation();
+        return {
+            Vector4(r[0][0], r[0][1], r[0][2], t[0]),
+            Vector4(r[1][0], r[1][1], r[1][2], t[1]),
+            Vector4(r[2][0], r[2][1], r[2][2], t[2]),
+        };
+    }
+
+    /// @brief
+    ///   Convert this dual quaternion to a 4x4 affine transform matrix.
+    /// @note
+    ///   This dual quaternion is assumed to be normalized.
+    [[nodiscard]] constexpr auto toMatrix4() const noexcept -> Matrix4 {
+        return toMatrix3x4().toMatrix4();
+    }
+
+    constexpr auto operator*=(const DualQuaternion &rhs) noexcept -> DualQuaternion &;
+};
+
+/// @brief
+///   Compose 2 rigid transforms. Just like @p Matrix4, @p lhs is applied first.
+constexpr auto operator*(const DualQuaternion &lhs, const DualQuaternion &rhs) noexcept
+    -> DualQuaternion {
+    return {rhs.real * lhs.real, rhs.real * lhs.dual + rhs.dual * lhs.real};
+}
+
+constexpr auto DualQuaternion::operator*=(const DualQuaternion &rhs) noexcept
+    -> DualQuaternion & {
+    *this = (*this * rhs);
+    return *this;
+}
+
+constexpr auto operator==(const DualQuaternion &lhs, const DualQuaternion &rhs) noexcept -> bool {
+    return lhs.real == rhs.real && lhs.dual == rhs.dual;
+}
+
+constexpr auto operator!=(const DualQuaternion &lhs, const DualQuaternion &rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+/// @brief
+///   Blend dual quaternions with the specified weights. This is the dual quaternion linear
+///   blending used by skinning.
+/// @note
+///   Dual quaternions on the opposite hemisphere of the first one are negated before blending so
+///   that the shortest path is always used.
+///
+/// @param dualQuats
+///   Pointer to the dual quaternions to be blended.
+/// @param weights
+///   Pointer to weights of each dual quaternion.
+/// @param count
+///   Number of dual quaternions to be blended. Must be greater than 0.
+///
+/// @return
+///   The normalized blend result.
+[[nodiscard]] inline auto blend(const DualQuaternion *dualQuats,
+                                const float          *weights,
+                                std::size_t           count) noexcept -> DualQuaternion {
+    DualQuaternion result(Quaternion(0.0f), Quaternion(0.0f));
+    for (std::size_t i = 0; i < count; ++i) {
+        const float w = dot(dualQuats[i].real, dualQuats[0].real) < 0 ? -weights[i] : weights[i];
+        result.real += dualQuats[i].real * w;
+        result.dual += dualQuats[i].dual * w;
+    }
+    return result.normalized();
+}
+
+namespace detail {
+
+/// @brief
+///   8 dual quaternions in SoA layout.
+struct DualQuaternionx8 {
+    Quaternionx8 real;
+    Quaternionx8 dual;
+
+    DualQuaternionx8() noexcept = default;
+
+    explicit DualQuaternionx8(const DualQuaternion *dualQuats, std::size_t count) noexcept {
+        Quaternion reals[8];
+        Quaternion duals[8];
+        for (std::size_t i = 0; i < count; ++i) {
+            reals[i] = dualQuats[i].real;
+            duals[i] = dualQuats[i].dual;
+        }
+
+        real = Quaternionx8(reals, count);
+        dual = Quaternionx8(duals, count);
+    }
+
+    auto store(DualQuaternion *dualQuats, std::size_t count) const noexcept -> void {
+        Quaternion reals[8];
+        Quaternion duals[8];
+        real.store(reals, count);
+        dual.store(duals, count);
+        for (std::size_t i = 0; i < count; ++i)
+            dualQuats[i] = DualQuaternion(reals[i], duals[i]);
+    }
+};
+
+} // namespace detail
+
+/// @brief
+///   Compute skinning palette for joints. Each palette entry is the inverse bind pose of the joint
+///   followed by the current transform of the joint: `palette[i] = inverseBindPoses[i] *
+///   jointTransforms[i]`.
+/// @note
+///   Joints are processed 8 at a time in SoA layout. Results are not re-normalized since product
+///   of unit dual quaternions is still a unit dual quaternion.
+///
+/// @param inverseBindPoses
+///   Pointer to inverse bind poses of the joints.
+/// @param jointTransforms
+///   Pointer to current model space transforms of the joints.
+/// @param[out] palette
+///   Pointer to the array to store the skinning palette. This could be the same as any of the
+///   input arrays.
+/// @param count
+///   Number of joints.
+inline auto computeSkinningPalette(const DualQuaternion *inverseBindPoses,
+                                   const DualQuaternion *jointTransforms,
+                                   DualQuaternion       *palette,
+                                   std::size_t           count) noexcept -> void {
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(8, count - i);
+
+        const detail::DualQuaternionx8 lhs(inverseBindPoses + i, n);
+        const detail::DualQuaternionx8 rhs(jointTransforms + i, n);
+
+        detail::DualQuaternionx8 result;
+        result.real = rhs.real * lhs.real;
+        result.dual = rhs.real * lhs.dual + rhs.dual * lhs.real;
+        result.store(palette + i, n);
+    }
+}
+
+/// @brief
+///   Blend 4 joints for each vertex with dual quaternion linear blending. This is the CPU fallback
+///   of dual quaternion skinning.
+/// @note
+///   Vertices are processed 8 at a time in SoA layout.
+///
+/// @param palette
+///   The skinning palette computed by @p computeSkinningPalette().
+/// @param joints
+///   Pointer to joint indices of the vertices. Each vertex has 4 joint indices.
+/// @param weights
+///   Pointer to joint weights of the vertices. Each vertex has 4 weights.
+/// @param[out] out
+///   Pointer to the array to store the normalized blend results.
+/// @param count
+///   Number of vertices.
+inline auto blendSkinningPalette(const DualQuaternion *palette,
+                                 const std::uint16_t  *joints,
+                                 const float          *weights,
+                                 DualQuaternion       *out,
+                                 std::size_t           count) noexcept -> void {
+    DualQuaternion gathered[8];
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(8, count - i);
+
+        // The first joint decides the hemisphere of each vertex.
+        for (std::size_t v = 0; v < n; ++v)
+            gathered[v] = palette[joints[(i + v) * 4]];
+
+        const detail::DualQuaternionx8 first(gathered, n);
+        detail::DualQuaternionx8       result;
+
+        for (std::size_t k = 0; k < 4; ++k) {
+            alignas(32) float w[8] = {};
+            for (std::size_t v = 0; v < n; ++v) {
+                gathered[v] = palette[joints[(i + v) * 4 + k]];
+                w[v]        = weights[(i + v) * 4 + k];
+            }
+
+            const detail::DualQuaternionx8 joint(gathered, n);
+
+            Float8 weight(w);
+            weight = select(dot(joint.real, first.real) < 0.0f, -weight, weight);
+
+            result.real += joint.real * weight;
+            result.dual += joint.dual * weight;
+        }
+
+        // Normalize and make the dual part orthogonal to the real part.
+        const Float8 invLen = 1.0f / result.real.length();
+        result.real *= invLen;
+        result.dual *= invLen;
+        result.dual -= result.real * dot(result.real, result.dual);
+
+        result.store(out + i, n);
+    }
+}
+
+} // namespace ink
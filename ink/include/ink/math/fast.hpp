@@ -0,0 +1,107 @@
+#pragma once
+
+#include "quaternion.hpp"
+
+#include <limits>
+
+namespace ink {
+
+/// @brief
+///   Calculate sine and cosine of the specified angle at the same time with minimax polynomials.
+///   This is much faster than calling @p std::sin() and @p std::cos() separately and is suitable
+///   for animation and particle code where ULP-exact results are not needed.
+/// @note
+///   The angle is reduced to [-pi/4, pi/4] with a 3-part Cody-Waite reduction. Absolute error of
+///   the results is less than 2e-7 for |radian| <= 8192. Precision drops for larger angles.
+///   Supported range is |radian| <= 2^24. Both results are NaN for NaN, infinite or larger angles.
+///
+/// @param radian
+///   The angle in radians.
+/// @param[out] sine
+///   Sine of the angle.
+/// @param[out] cosine
+///   Cosine of the angle.
+constexpr auto sincos(float radian, float &sine, float &cosine) noexcept -> void {
+    constexpr float InvHalfPi = 0.636619772367581343076f;
+    constexpr float MaxRadian = 16777216.0f;
+
+    // Out of range angles cannot be converted to quadrant index. Also rejects NaN.
+    if (!(radian >= -MaxRadian && radian <= MaxRadian)) {
+        sine   = std::numeric_limits<float>::quiet_NaN();
+        cosine = std::numeric_limits<float>::quiet_NaN();
+        return;
+    }
+
+    // Round to the nearest quadrant.
+    const float scaled = radian * InvHalfPi;
+    const int   q      = static_cast<int>(scaled + (scaled >= 0 ? 0.5f : -0.5f));
+    const float k      = static_cast<float>(q);
+
+    // pi/2 split into 3 parts so that the first 2 products are exact.
+    float r = radian - k * 1.5703125f;
+    r       = r - k * 4.837512969970703125e-4f;
+    r       = r - k * 7.54978995489188216e-8f;
+
+    const float r2 = r * r;
+    const float sp = (-1.9515295891e-4f * r2 + 8.3321608736e-3f) * r2 - 1.6666654611e-1f;
+    const float cp = (2.443315711809948e-5f * r2 - 1.388731625493765e-3f) * r2 +
+                     4.166664568298827e-2f;
+    const float s  = sp * r2 * r + r;
+    const float c  = cp * r2 * r2 - 0.5f * r2 + 1.0f;
+
+    switch (q & 3) {
+    case 0:
+        sine   = s;
+        cosine = c;
+        break;
+    case 1:
+        sine   = c;
+        cosine = -s;
+        break;
+    case 2:
+        sine   = -s;
+        cosine = -c;
+        break;
+    default:
+        sine   = -c;
+        cosine = s;
+        break;
+    }
+}
+
+/// @brief
+///   Perform approximate spherical linear interpolation between the 2 quaternions without any
+///   trigonometric function. The interpolation factor is corrected with a polynomial fitted to
+///   the slerp curve and the quaternions are then interpolated with nlerp.
+/// @note
+///   Rotation angle error of the result against @p slerp() is less than 2e-3 radians (about 0.1
+///   degrees). Quaternions are interpolated along the shortest path.
+///
+/// @param start
+///   The first quaternions to be interpolated.
+/// @param end
+///   The second quaternions to be interpolated.
+/// @param t
+///   Interpolation factor, must between 0 and 1. Passing 0 will return @p start and passing 1 will
+///   return @p end.
+///
+/// @return
+///   The interpolation result quaternions.
+[[nodiscard]] inline auto slerpFast(Quaternion start, Quaternion end, float t) noexcept
+    -> Quaternion {
+    const float c = dot(start, end);
+    const float d = std::abs(c);
+
+    // Polynomial fit of the correction factor by cosine of the half angle.
+    const float a  = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+    const float b  = 0.848013f + d * (-1.06021f + d * 0.215638f);
+    const float h  = t - 0.5f;
+    const float k  = a * h * h + b;
+    const float ot = t + t * h * (t - 1.0f) * k;
+
+    const float t0 = 1.0f - ot;
+    const float t1 = c < 0 ? -ot : ot;
+    return (start * t0 + end * t1).normalizedFast();
+}
+
+} // namespace ink
@@ -0,0 +1,277 @@
+#pragma once
+
+#include "bounds.hpp"
+
+namespace ink {
+
+/// @brief
+///   View frustum that is made up of 6 planes. Normals of the planes point to inside of the
+///   frustum.
+/// @note
+///   Culling is conservative: volumes that are outside of the frustum but not completely behind
+///   any single plane are treated as visible. This could only happen near edges and corners of the
+///   frustum.
+struct Frustum {
+    enum PlaneIndex {
+        Left   = 0,
+        Right  = 1,
+        Bottom = 2,
+        Top    = 3,
+        Near   = 4,
+        Far    = 5,
+    };
+
+    Plane planes[6];
+
+    /// @brief
+    ///   Create a frustum with zero planes. The zero frustum does not reject anything.
+    constexpr Frustum() noexcept = default;
+
+    /// @brief
+    ///   Extract frustum planes from the specified view projection matrix. This works for any
+    ///   matrix that is a combination of @p lookAt(), @p lookTo(), @p perspective() and @p
+    ///   orthographic(). The resulting frustum is in world space.
+    /// @note
+    ///   Depth of the projection matrix is assumed to be in range [0, 1].
+    ///
+    /// @param viewProjection
+    ///   The view projection matrix. Points are transformed with `point * viewProjection`.
+    explicit Frustum(const Matrix4 &viewProjection) noexcept {
+        // Clip space coordinate i of a point is dot(point, column i).
+        const Vector4 &x = viewProjection[0];
+        const Vector4 &y = viewProjection[1];
+        const Vector4 &z = viewProjection[2];
+        const Vector4 &w = viewProjection[3];
+
+        planes[Left]   = Plane(w + x).normalized();
+        planes[Right]  = Plane(w - x).normalized();
+        planes[Bottom] = Plane(w + y).normalized();
+        planes[Top]    = Plane(w - y).normalized();
+        planes[Near]   = Plane(z).normalized();
+        planes[Far]    = Plane(w - z).normalized();
+    }
+
+    /// @brief
+    ///   Checks if the specified point is inside this frustum.
+    [[nodiscard]] constexpr auto contains(Vector3 point) const noexcept -> bool {
+        for (const Plane &plane : planes) {
+            if (plane.signedDistance(point) < 0)
+                return false;
+        }
+        return true;
+    }
+
+    /// @brief
+    ///   Checks if the specified box is visible in this frustum.
+    [[nodiscard]] constexpr auto intersects(const AABB &box) const noexcept -> bool {
+        if (box.isEmpty())
+            return false;
+
+        for (const Plane &plane : planes) {
+            if (plane.classify(box) == PlaneSide::Back)
+                return false;
+        }
+        return true;
+    }
+
+    /// @brief
+    ///   Checks if the specified sphere is visible in this frustum.
+    [[nodiscard]] constexpr auto intersects(const BoundingSphere &sphere) const noexcept -> bool {
+        if (sphere.isEmpty())
+            return false;
+
+        for (const Plane &plane : planes) {
+            if (plane.classify(sphere) == PlaneSide::Back)
+                return false;
+        }
+        return true;
+    }
+
+    /// @brief
+    ///   Checks if the specified box is visible in this frustum.
+    [[nodiscard]] constexpr auto intersects(const OBB &box) const noexcept -> bool {
+        for (const Plane &plane : planes) {
+            if (plane.classify(box) == PlaneSide::Back)
+                return false;
+        }
+        return true;
+    }
+
+    /// @brief
+    ///   Cull an array of boxes against this frustum and write visibility to a bitmask. Boxes are
+    ///   tested 8 at a time in SoA layout.
+    ///
+    /// @param boxes
+    ///   Pointer to the boxes to be culled.
+    /// @param count
+    ///   Number of boxes to be culled.
+    /// @param[out] visibility
+    ///   Pointer to the bitmask. Bit `i % 32` of `visibility[i / 32]` is set if box i is visible.
+    ///   The bitmask must contain at least `(count + 31) / 32` elements. Unused bits of the last
+    ///   element are cleared.
+    auto cullMask(const AABB *boxes, std::size_t count, std::uint32_t *visibility) const noexcept
+        -> void {
+        cull(boxes, count, [visibility](std::size_t i, std::uint32_t bits) noexcept {
+            storeVisibility(visibility, i, bits);
+        });
+    }
+
+    /// @brief
+    ///   Cull an array of spheres against this frustum and write visibility to a bitmask. Spheres
+    ///   are tested 8 at a time in SoA layout.
+    ///
+    /// @param spheres
+    ///   Pointer to the spheres to be culled.
+    /// @param count
+    ///   Number of spheres to be culled.
+    /// @param[out] visibility
+    ///   Pointer to the bitmask. Bit `i % 32` of `visibility[i / 32]` is set if sphere i is
+    ///   visible. The bitmask must contain at least `(count + 31) / 32` elements. Unused bits of
+    ///   the last element are cleared.
+    auto cullMask(const BoundingSphere *spheres,
+                  std::size_t           count,
+                  std::uint32_t        *visibility) const noexcept -> void {
+        cull(spheres, count, [visibility](std::size_t i, std::uint32_t bits) noexcept {
+            storeVisibility(visibility, i, bits);
+        });
+    }
+
+    /// @brief
+    ///   Cull an array of boxes against this frustum and write indices of the visible boxes.
+    ///   Boxes are tested 8 at a time in SoA layout.
+    ///
+    /// @param boxes
+    ///   Pointer to the boxes to be culled.
+    /// @param count
+    ///   Number of boxes to be culled.
+    /// @param[out] indices
+    ///   Pointer to the array to store indices of the visible boxes in ascending order. The array
+    ///   must be able to hold @p count elements.
+    ///
+    /// @return
+    ///   Number of visible boxes.
+    auto cullIndices(const AABB *boxes, std::size_t count, std::uint32_t *indices) const noexcept
+        -> std::size_t {
+        std::size_t visibleCount = 0;
+        cull(boxes, count, [indices, &visibleCount](std::size_t i, std::uint32_t bits) noexcept {
+            storeIndices(indices, visibleCount, i, bits);
+        });
+        return visibleCount;
+    }
+
+    /// @brief
+    ///   Cull an array of spheres against this frustum and write indices of the visible spheres.
+    ///   Spheres are tested 8 at a time in SoA layout.
+    ///
+    /// @param spheres
+    ///   Pointer to the spheres to be culled.
+    /// @param count
+    ///   Number of spheres to be culled.
+    /// @param[out] indices
+    ///   Pointer to the array to store indices of the visible spheres in ascending order. The
+    ///   array must be able to hold @p count elements.
+    ///
+    /// @return
+    ///   Number of visible spheres.
+    auto cullIndices(const BoundingSphere *spheres,
+                     std::size_t           count,
+                     std::uint32_t        *indices) const noexcept -> std::size_t {
+        std::size_t visibleCount = 0;
+        cull(spheres, count, [indices, &visibleCount](std::size_t i, std::uint32_t bits) noexcept {
+            storeIndices(indices, visibleCount, i, bits);
+        });
+        return visibleCount;
+    }
+
+private:
+    /// @brief
+    ///   Cull boxes 8 at a time. @p func is called with index of the first box and visibility bits
+    ///   of the 8 boxes.
+    template <typename Func>
+    auto cull(const AABB *boxes, std::size_t count, Func &&func) const noexcept -> void {
+        Vector3x8 normal[6];
+        Vector3x8 absNormal[6];
+        Float8    distance[6];
+        for (std::size_t p = 0; p < 6; ++p) {
+            normal[p]    = Vector3x8(planes[p].normal);
+            absNormal[p] = Vector3x8(abs(planes[p].normal));
+            distance[p]  = Float8(planes[p].distance);
+        }
+
+        for (std::size_t i = 0; i < count; i += 8) {
+            const std::size_t n = std::min<std::size_t>(8, count - i);
+
+            Vector3x8 boxMin;
+            Vector3x8 boxMax;
+            detail::loadAABBx8(boxes + i, n, boxMin, boxMax);
+
+            const Vector3x8 center = (boxMin + boxMax) * 0.5f;
+            const Vector3x8 extent = (boxMax - boxMin) * 0.5f;
+
+            // Empty boxes are never visible.
+            Float8 culled = (boxMax.x < boxMin.x) | (boxMax.y < boxMin.y) | (boxMax.z < boxMin.z);
+            for (std::size_t p = 0; p < 6; ++p) {
+                const Float8 r = dot(extent, absNormal[p]);
+                const Float8 d = dot(normal[p], center) + distance[p];
+                culled         = culled | (d < -r);
+            }
+
+            const std::uint32_t laneBits = (1U << n) - 1;
+            func(i, ~maskBits(culled) & laneBits);
+        }
+    }
+
+    /// @brief
+    ///   Cull spheres 8 at a time. @p func is called with index of the first sphere and visibility
+    ///   bits of the 8 spheres.
+    template <typename Func>
+    auto cull(const BoundingSphere *spheres, std::size_t count, Func &&func) const noexcept
+        -> void {
+        Vector3x8 normal[6];
+        Float8    distance[6];
+        for (std::size_t p = 0; p < 6; ++p) {
+            normal[p]   = Vector3x8(planes[p].normal);
+            distance[p] = Float8(planes[p].distance);
+        }
+
+        for (std::size_t i = 0; i < count; i += 8) {
+            const std::size_t n = std::min<std::size_t>(8, count - i);
+
+            Vector3x8 center;
+            Float8    radius;
+            detail::loadBoundingSpherex8(spheres + i, n, center, radius);
+
+            // Empty spheres are never visible.
+            Float8 culled = radius < 0.0f;
+            for (std::size_t p = 0; p < 6; ++p) {
+                const Float8 d = dot(normal[p], center) + distance[p];
+                culled         = culled | (d < -radius);
+            }
+
+            const std::uint32_t laneBits = (1U << n) - 1;
+            func(i, ~maskBits(culled) & laneBits);
+        }
+    }
+
+    static auto
+    storeVisibility(std::uint32_t *visibility, std::size_t i, std::uint32_t bits) noexcept -> void {
+        // 8 always divides 32, so the 8 bits never cross element boundary.
+        const std::size_t shift = i % 32;
+        if (shift == 0)
+            visibility[i / 32] = bits;
+        else
+            visibility[i / 32] |= bits << shift;
+    }
+
+    static auto storeIndices(std::uint32_t *indices,
+                             std::size_t   &visibleCount,
+                             std::size_t    i,
+                             std::uint32_t  bits) noexcept -> void {
+        for (std::uint32_t lane = 0; bits != 0; ++lane, bits >>= 1) {
+            if ((bits & 1U) != 0)
+                indices[visibleCount++] = static_cast<std::uint32_t>(i + lane);
+        }
+    }
+};
+
+} // namespace ink
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "numbers.hpp"
+#include "simd.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace ink {
+namespace detail {
+
+/// @brief
+///   Floating point type used to evaluate constexpr math functions. Float arguments are evaluated
+///   in double precision so that the results are as accurate as the runtime functions.
+template <typename T>
+using MathReal = std::conditional_t<std::is_same<T, float>::value, double, T>;
+
+/// @brief
+///   Constexpr square root with Newton's iteration.
+template <typename T>
+constexpr auto constexprSqrt(T value) noexcept -> T {
+    using Real = MathReal<T>;
+
+    if (value != value || value < 0)
+        return std::numeric_limits<T>::quiet_NaN();
+    if (value == 0 || value == std::numeric_limits<T>::infinity())
+        return value;
+
+    // Scale value into [1, 4) by powers of 4 so that the initial guess is good enough.
+    Real x     = static_cast<Real>(value);
+    Real scale = 1;
+    while (x >= Real(0x1p64)) {
+        x *= Real(0x1p-64);
+        scale *= Real(0x1p32);
+    }
+    while (x < Real(0x1p-64)) {
+        x *= Real(0x1p64);
+        scale *= Real(0x1p-32);
+    }
+    while (x >= 4) {
+        x *= Real(0.25);
+        scale *= 2;
+    }
+    while (x < 1) {
+        x *= 4;
+        scale *= Real(0.5);
+    }
+
+    // Error of the initial guess is less than 0.25. Each iteration doubles the number of correct
+    // bits.
+    Real root = (x + 1) * Real(0.5);
+    for (int i = 0; i < 6; ++i)
+        root = (root + x / root) * Real(0.5);
+
+    return static_cast<T>(root * scale);
+}
+
+/// @brief
+///   Constexpr sine and cosine. The argument is reduced to [-pi/4, pi/4] by multiples of pi/2 and
+///   then evaluated with Taylor series.
+/// @note
+///   Argument reduction loses precision for very large arguments, e.g. greater than 1e9. NaN is
+///   returned for NaN, infinity and arguments whose magnitude is not less than 2^52 * pi / 2
+///   (about 7.07e15), since the quadrant index could not be represented exactly.
+template <typename Real>
+constexpr auto constexprSinCos(Real x, Real &sine, Real &cosine) noexcept -> void {
+    // Comparisons are false for NaN, so NaN is also rejected here.
+    const Real q = x * (2 / Pi<Real>);
+    if (!(q > Real(-0x1p52) && q < Real(0x1p52))) {
+        sine   = std::numeric_limits<Real>::quiet_NaN();
+        cosine = std::numeric_limits<Real>::quiet_NaN();
+        return;
+    }
+
+    // Cody-Waite reduction. The high part of pi/2 has trailing zero bits so that k * high is exact.
+    constexpr Real HalfPiHigh = static_cast<Real>(1.57079632673412561417e+00);
+    constexpr Real HalfPiLow  = static_cast<Real>(6.07710050650619224932e-11);
+
+    const long long k  = static_cast<long long>(q < 0 ? q - Real(0.5) : q + Real(0.5));
+    const Real      kf = static_cast<Real>(k);
+    const Real      r  = (x - kf * HalfPiHigh) - kf * HalfPiLow;
+    const Real      r2 = r * r;
+
+    // Taylor series. The 11th terms are less than 1e-22 in [-pi/4, pi/4].
+    Real s     = r;
+    Real c     = 1;
+    Real sTerm = r;
+    Real cTerm = 1;
+    for (int n = 1; n <= 10; ++n) {
+        sTerm *= -r2 / static_cast<Real>((2 * n) * (2 * n + 1));
+        cTerm *= -r2 / static_cast<Real>((2 * n - 1) * (2 * n));
+        s += sTerm;
+        c += cTerm;
+    }
+
+    switch (k & 3) {
+    case 0:
+        sine   = s;
+        cosine = c;
+        break;
+    case 1:
+        sine   = c;
+        cosine = -s;
+        break;
+    case 2:
+        sine   = -s;
+        cosine = -c;
+        break;
+    default:
+        sine   = -c;
+        cosine = s;
+        break;
+    }
+}
+
+} // namespace detail
+
+/// @brief
+///   Calculate square root of the specified value. This function could be evaluated at compile
+///   time, and calls @p std::sqrt() at run time.
+///
+/// @param value
+///   The value to calculate square root of. NaN is returned for negative values.
+///
+/// @return
+///   Square root of @p value.
+template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value, T>>
+[[nodiscard]] constexpr auto sqrt(T value) noexcept -> T {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+    if (!INK_IS_CONSTANT_EVALUATED())
+        return std::sqrt(value);
+#endif
+    return detail::constexprSqrt(value);
+}
+
+/// @brief
+///   Calculate sine of the specified radian. This function could be evaluated at compile time, and
+///   calls @p std::sin() at run time.
+/// @note
+///   Compile time evaluation loses precision for very large arguments, e.g. greater than 1e9, and
+///   returns NaN if magnitude of @p radian is not less than 2^52 * pi / 2 (about 7.07e15). The
+///   compile time path is also used at run time if the compiler cannot detect constant evaluation.
+///
+/// @param radian
+///   The angle in radian.
+///
+/// @return
+///   Sine of @p radian.
+template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value, T>>
+[[nodiscard]] constexpr auto sin(T radian) noexcept -> T {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+    if (!INK_IS_CONSTANT_EVALUATED())
+        return std::sin(radian);
+#endif
+    detail::MathReal<T> s = 0;
+    detail::MathReal<T> c = 0;
+    detail::constexprSinCos(static_cast<detail::MathReal<T>>(radian), s, c);
+    return static_cast<T>(s);
+}
+
+/// @brief
+///   Calculate cosine of the specified radian. This function could be evaluated at compile time,
+///   and calls @p std::cos() at run time.
+/// @note
+///   Compile time evaluation loses precision for very large arguments, e.g. greater than 1e9, and
+///   returns NaN if magnitude of @p radian is not less than 2^52 * pi / 2 (about 7.07e15). The
+///   compile time path is also used at run time if the compiler cannot detect constant evaluation.
+///
+/// @param radian
+///   The angle in radian.
+///
+/// @return
+///   Cosine of @p radian.
+template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value, T>>
+[[nodiscard]] constexpr auto cos(T radian) noexcept -> T {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+    if (!INK_IS_CONSTANT_EVALUATED())
+        return std::cos(radian);
+#endif
+    detail::MathReal<T> s = 0;
+    detail::MathReal<T> c = 0;
+    detail::constexprSinCos(static_cast<detail::MathReal<T>>(radian), s, c);
+    return static_cast<T>(c);
+}
+
+/// @brief
+///   Calculate tangent of the specified radian. This function could be evaluated at compile time,
+///   and calls @p std::tan() at run time.
+/// @note
+///   Compile time evaluation loses precision for very large arguments, e.g. greater than 1e9, and
+///   returns NaN if magnitude of @p radian is not less than 2^52 * pi / 2 (about 7.07e15). The
+///   compile time path is also used at run time if the compiler cannot detect constant evaluation.
+///
+/// @param radian
+///   The angle in radian.
+///
+/// @return
+///   Tangent of @p radian.
+template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value, T>>
+[[nodiscard]] constexpr auto tan(T radian) noexcept -> T {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+    if (!INK_IS_CONSTANT_EVALUATED())
+        return std::tan(radian);
+#endif
+    detail::MathReal<T> s = 0;
+    detail::MathReal<T> c = 0;
+    detail::constexprSinCos(static_cast<detail::MathReal<T>>(radian), s, c);
+    return static_cast<T>(s / c);
+}
+
+} // namespace ink
@@ -0,0 +1,906 @@
+#pragma once
+
+#include "matrix.hpp"
+
+#include <type_traits>
+
+namespace ink {
+
+template <typename T, std::size_t N>
+struct BasicVector;
+
+template <typename T, std::size_t R, std::size_t C>
+struct BasicMatrix;
+
+namespace detail {
+
+/// @brief
+///   Element storage of generic vectors. Vectors with 2 to 4 elements could also be accessed by
+///   name. Named members are the active union members so that they could be read in constant
+///   expressions.
+template <typename T, std::size_t N>
+struct VectorStorage {
+    constexpr VectorStorage() noexcept : m_arr{} {}
+    T m_arr[N];
+};
+
+#if defined(__clang__)
+#    pragma clang diagnostic push
+#    pragma clang diagnostic ignored "-Wgnu-anonymous-struct"
+#    pragma clang diagnostic ignored "-Wnested-anon-types"
+#elif defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wpedantic"
+#elif defined(_MSC_VER)
+#    pragma warning(push)
+#    pragma warning(disable : 4201)
+#endif
+
+template <typename T>
+struct VectorStorage<T, 2> {
+    constexpr VectorStorage() noexcept : x(), y() {}
+    union {
+        T m_arr[2];
+        struct {
+            T x;
+            T y;
+        };
+    };
+};
+
+template <typename T>
+struct VectorStorage<T, 3> {
+    constexpr VectorStorage() noexcept : x(), y(), z() {}
+    union {
+        T m_arr[3];
+        struct {
+            T x;
+            T y;
+            T z;
+        };
+    };
+};
+
+template <typename T>
+struct VectorStorage<T, 4> {
+    constexpr VectorStorage() noexcept : x(), y(), z(), w() {}
+    union {
+        T m_arr[4];
+        struct {
+            T x;
+            T y;
+            T z;
+            T w;
+        };
+    };
+};
+
+#if defined(__clang__)
+#    pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#    pragma warning(pop)
+#endif
+
+/// @brief
+///   Maps element type and size to the vector type. Float vectors with 2 to 4 elements map to the
+///   hand-written SIMD friendly types.
+template <typename T, std::size_t N>
+struct VectorSelector {
+    using Type = BasicVector<T, N>;
+};
+
+template <>
+struct VectorSelector<float, 2> {
+    using Type = Vector2;
+};
+
+template <>
+struct VectorSelector<float, 3> {
+    using Type = Vector3;
+};
+
+template <>
+struct VectorSelector<float, 4> {
+    using Type = Vector4;
+};
+
+/// @brief
+///   Maps element type and size to the matrix type. Float square matrices with 2 to 4 rows map to
+///   the hand-written SIMD friendly types.
+template <typename T, std::size_t R, std::size_t C>
+struct MatrixSelector {
+    using Type = BasicMatrix<T, R, C>;
+};
+
+template <>
+struct MatrixSelector<float, 2, 2> {
+    using Type = Matrix2;
+};
+
+template <>
+struct MatrixSelector<float, 3, 3> {
+    using Type = Matrix3;
+};
+
+template <>
+struct MatrixSelector<float, 4, 4> {
+    using Type = Matrix4;
+};
+
+/// @brief
+///   Element type and size of vector types.
+template <typename V>
+struct VectorTraits;
+
+template <typename T, std::size_t N>
+struct VectorTraits<BasicVector<T, N>> {
+    using ValueType                   = T;
+    static constexpr std::size_t Size = N;
+};
+
+template <>
+struct VectorTraits<Vector2> {
+    using ValueType                   = float;
+    static constexpr std::size_t Size = 2;
+};
+
+template <>
+struct VectorTraits<Vector3> {
+    using ValueType                   = float;
+    static constexpr std::size_t Size = 3;
+};
+
+template <>
+struct VectorTraits<Vector4> {
+    using ValueType                   = float;
+    static constexpr std::size_t Size = 4;
+};
+
+/// @brief
+///   Element type and size of matrix types.
+template <typename M>
+struct MatrixTraits;
+
+template <typename T, std::size_t R, std::size_t C>
+struct MatrixTraits<BasicMatrix<T, R, C>> {
+    using ValueType                      = T;
+    static constexpr std::size_t Rows    = R;
+    static constexpr std::size_t Columns = C;
+};
+
+template <>
+struct MatrixTraits<Matrix2> {
+    using ValueType                      = float;
+    static constexpr std::size_t Rows    = 2;
+    static constexpr std::size_t Columns = 2;
+};
+
+template <>
+struct MatrixTraits<Matrix3> {
+    using ValueType                      = float;
+    static constexpr std::size_t Rows    = 3;
+    static constexpr std::size_t Columns = 3;
+};
+
+template <>
+struct MatrixTraits<Matrix4> {
+    using ValueType                      = float;
+    static constexpr std::size_t Rows    = 4;
+    static constexpr std::size_t Columns = 4;
+};
+
+} // namespace detail
+
+/// @brief
+///   N-dimensional vector of type T. Vectors with 2 to 4 elements have named members x, y, z and
+///   w.
+/// @note
+///   Use @p Vector<T, N> instead of this type directly, which maps float vectors to the optimized
+///   @p Vector2, @p Vector3 and @p Vector4.
+///
+/// @tparam T
+///   Element type. Must be an arithmetic type.
+/// @tparam N
+///   Number of elements.
+template <typename T, std::size_t N>
+struct BasicVector : detail::VectorStorage<T, N> {
+    static_assert(std::is_arithmetic_v<T>, "Element type of vectors must be arithmetic.");
+    static_assert(N > 0, "Vectors must have at least 1 element.");
+
+    using ValueType                   = T;
+    static constexpr std::size_t Size = N;
+
+    /// @brief
+    ///   Create a zero vector.
+    constexpr BasicVector() noexcept = default;
+
+    /// @brief
+    ///   Create a vector and set all elements to the specified value.
+    ///
+    /// @param value
+    ///   Value of all elements.
+    explicit constexpr BasicVector(T value) noexcept {
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = value;
+    }
+
+    /// @brief
+    ///   Create a vector and initialize elements. Values are converted to @p T.
+    ///
+    /// @param values
+    ///   Values of the elements. Number of values must be the same as number of elements.
+    template <typename... Args,
+              typename = std::enable_if_t<(N > 1) && sizeof...(Args) == N &&
+                                          (std::is_arithmetic_v<Args> && ...)>>
+    constexpr BasicVector(Args... values) noexcept {
+        const T arr[N] = {static_cast<T>(values)...};
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = arr[i];
+    }
+
+    /// @brief
+    ///   Convert a vector of another element type.
+    ///
+    /// @param other
+    ///   The vector to be converted.
+    template <typename U, typename = std::enable_if_t<!std::is_same_v<T, U>>>
+    explicit constexpr BasicVector(const BasicVector<U, N> &other) noexcept {
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = static_cast<T>(other[i]);
+    }
+
+    /// @brief
+    ///   Random access elements in this vector by index.
+    /// @note
+    ///   No boundary check performed.
+    constexpr auto operator[](std::size_t i) noexcept -> T & {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+        if constexpr (N >= 2 && N <= 4) {
+            if (INK_IS_CONSTANT_EVALUATED()) {
+                if constexpr (N == 2)
+                    return i == 0 ? this->x : this->y;
+                else if constexpr (N == 3)
+                    return i == 0 ? this->x : (i == 1 ? this->y : this->z);
+                else
+                    return i == 0 ? this->x : (i == 1 ? this->y : (i == 2 ? this->z : this->w));
+            }
+        }
+#endif
+        return this->m_arr[i];
+    }
+
+    /// @brief
+    ///   Random access elements in this vector by index.
+    /// @note
+    ///   No boundary check performed.
+    constexpr auto operator[](std::size_t i) const noexcept -> const T & {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+        if constexpr (N >= 2 && N <= 4) {
+            if (INK_IS_CONSTANT_EVALUATED()) {
+                if constexpr (N == 2)
+                    return i == 0 ? this->x : this->y;
+                else if constexpr (N == 3)
+                    return i == 0 ? this->x : (i == 1 ? this->y : this->z);
+                else
+                    return i == 0 ? this->x : (i == 1 ? this->y : (i == 2 ? this->z : this->w));
+            }
+        }
+#endif
+        return this->m_arr[i];
+    }
+
+    /// @brief
+    ///   Calculate length of this vector. Only available for floating point vectors.
+    template <typename U = T, typename = std::enable_if_t<std::is_floating_point_v<U>>>
+    [[nodiscard]] constexpr auto length() const noexcept -> T {
+        T sum = 0;
+        for (std::size_t i = 0; i < N; ++i)
+            sum += (*this)[i] * (*this)[i];
+        return sqrt(sum);
+    }
+
+    /// @brief
+    ///   Normalize this vector. Only available for floating point vectors.
+    ///
+    /// @return
+    ///   Reference to this vector.
+    template <typename U = T, typename = std::enable_if_t<std::is_floating_point_v<U>>>
+    constexpr auto normalize() noexcept -> BasicVector & {
+        const T invLength = T(1) / length();
+        return (*this) *= invLength;
+    }
+
+    /// @brief
+    ///   Get normalized copy of this vector. Only available for floating point vectors.
+    template <typename U = T, typename = std::enable_if_t<std::is_floating_point_v<U>>>
+    [[nodiscard]] constexpr auto normalized() const noexcept -> BasicVector {
+        BasicVector result(*this);
+        return result.normalize();
+    }
+
+    constexpr auto operator+=(BasicVector rhs) noexcept -> BasicVector & {
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = static_cast<T>((*this)[i] + rhs[i]);
+        return *this;
+    }
+
+    constexpr auto operator-=(BasicVector rhs) noexcept -> BasicVector & {
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = static_cast<T>((*this)[i] - rhs[i]);
+        return *this;
+    }
+
+    constexpr auto operator*=(BasicVector rhs) noexcept -> BasicVector & {
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = static_cast<T>((*this)[i] * rhs[i]);
+        return *this;
+    }
+
+    constexpr auto operator*=(T rhs) noexcept -> BasicVector & {
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = static_cast<T>((*this)[i] * rhs);
+        return *this;
+    }
+
+    constexpr auto operator/=(BasicVector rhs) noexcept -> BasicVector & {
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = static_cast<T>((*this)[i] / rhs[i]);
+        return *this;
+    }
+
+    constexpr auto operator/=(T rhs) noexcept -> BasicVector & {
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = static_cast<T>((*this)[i] / rhs);
+        return *this;
+    }
+
+    /// @brief
+    ///   Element-wise remainder. Only available for integer vectors.
+    template <typename U = T, typename = std::enable_if_t<std::is_integral_v<U>>>
+    constexpr auto operator%=(BasicVector rhs) noexcept -> BasicVector & {
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = static_cast<T>((*this)[i] % rhs[i]);
+        return *this;
+    }
+
+    /// @brief
+    ///   Element-wise remainder. Only available for integer vectors.
+    template <typename U = T, typename = std::enable_if_t<std::is_integral_v<U>>>
+    constexpr auto operator%=(T rhs) noexcept -> BasicVector & {
+        for (std::size_t i = 0; i < N; ++i)
+            (*this)[i] = static_cast<T>((*this)[i] % rhs);
+        return *this;
+    }
+};
+
+template <typename T, std::size_t N>
+constexpr auto operator+(BasicVector<T, N> vec) noexcept -> BasicVector<T, N> {
+    return vec;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator-(BasicVector<T, N> vec) noexcept -> BasicVector<T, N> {
+    for (std::size_t i = 0; i < N; ++i)
+        vec[i] = static_cast<T>(-vec[i]);
+    return vec;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator+(BasicVector<T, N> lhs, BasicVector<T, N> rhs) noexcept
+    -> BasicVector<T, N> {
+    return lhs += rhs;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator-(BasicVector<T, N> lhs, BasicVector<T, N> rhs) noexcept
+    -> BasicVector<T, N> {
+    return lhs -= rhs;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator*(BasicVector<T, N> lhs, BasicVector<T, N> rhs) noexcept
+    -> BasicVector<T, N> {
+    return lhs *= rhs;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator*(BasicVector<T, N> lhs, T rhs) noexcept -> BasicVector<T, N> {
+    return lhs *= rhs;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator*(T lhs, BasicVector<T, N> rhs) noexcept -> BasicVector<T, N> {
+    return rhs *= lhs;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator/(BasicVector<T, N> lhs, BasicVector<T, N> rhs) noexcept
+    -> BasicVector<T, N> {
+    return lhs /= rhs;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator/(BasicVector<T, N> lhs, T rhs) noexcept -> BasicVector<T, N> {
+    return lhs /= rhs;
+}
+
+template <typename T, std::size_t N, typename = std::enable_if_t<std::is_integral_v<T>>>
+constexpr auto operator%(BasicVector<T, N> lhs, BasicVector<T, N> rhs) noexcept
+    -> BasicVector<T, N> {
+    return lhs %= rhs;
+}
+
+template <typename T, std::size_t N, typename = std::enable_if_t<std::is_integral_v<T>>>
+constexpr auto operator%(BasicVector<T, N> lhs, T rhs) noexcept -> BasicVector<T, N> {
+    return lhs %= rhs;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator==(BasicVector<T, N> lhs, BasicVector<T, N> rhs) noexcept -> bool {
+    for (std::size_t i = 0; i < N; ++i) {
+        if (lhs[i] != rhs[i])
+            return false;
+    }
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator!=(BasicVector<T, N> lhs, BasicVector<T, N> rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+/// @brief
+///   Calculate dot product of 2 vectors.
+template <typename T, std::size_t N>
+[[nodiscard]] constexpr auto dot(BasicVector<T, N> lhs, BasicVector<T, N> rhs) noexcept -> T {
+    T result = 0;
+    for (std::size_t i = 0; i < N; ++i)
+        result = static_cast<T>(result + lhs[i] * rhs[i]);
+    return result;
+}
+
+/// @brief
+///   Calculate cross product of 2 3D vectors.
+template <typename T>
+[[nodiscard]] constexpr auto cross(BasicVector<T, 3> lhs, BasicVector<T, 3> rhs) noexcept
+    -> BasicVector<T, 3> {
+    return BasicVector<T, 3>{
+        lhs.y * rhs.z - lhs.z * rhs.y,
+        lhs.z * rhs.x - lhs.x * rhs.z,
+        lhs.x * rhs.y - lhs.y * rhs.x,
+    };
+}
+
+/// @brief
+///   Get element-wise minimum element of the specified vectors.
+template <typename T, std::size_t N>
+[[nodiscard]] constexpr auto min(BasicVector<T, N> lhs, BasicVector<T, N> rhs) noexcept
+    -> BasicVector<T, N> {
+    for (std::size_t i = 0; i < N; ++i)
+        lhs[i] = rhs[i] < lhs[i] ? rhs[i] : lhs[i];
+    return lhs;
+}
+
+/// @brief
+///   Get element-wise maximum element of the specified vectors.
+template <typename T, std::size_t N>
+[[nodiscard]] constexpr auto max(BasicVector<T, N> lhs, BasicVector<T, N> rhs) noexcept
+    -> BasicVector<T, N> {
+    for (std::size_t i = 0; i < N; ++i)
+        lhs[i] = lhs[i] < rhs[i] ? rhs[i] : lhs[i];
+    return lhs;
+}
+
+/// @brief
+///   Clamp each element of the specified vector into the specified range.
+template <typename T, std::size_t N>
+[[nodiscard]] constexpr auto
+clamp(BasicVector<T, N> vec, BasicVector<T, N> floor, BasicVector<T, N> ceil) noexcept
+    -> BasicVector<T, N> {
+    return max(floor, min(vec, ceil));
+}
+
+/// @brief
+///   Get element-wise absolute value of the specified vector. Only available for signed vectors.
+template <typename T, std::size_t N, typename = std::enable_if_t<std::is_signed_v<T>>>
+[[nodiscard]] constexpr auto abs(BasicVector<T, N> vec) noexcept -> BasicVector<T, N> {
+    for (std::size_t i = 0; i < N; ++i)
+        vec[i] = vec[i] < 0 ? static_cast<T>(-vec[i]) : vec[i];
+    return vec;
+}
+
+/// @brief
+///   Linear interpolation between 2 vectors. Only available for floating point vectors.
+template <typename T, std::size_t N, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+[[nodiscard]] constexpr auto lerp(BasicVector<T, N> start, BasicVector<T, N> end, T t) noexcept
+    -> BasicVector<T, N> {
+    return start + (end - start) * t;
+}
+
+/// @brief
+///   Matrix of type T with R rows and C columns. Elements are stored in columns, and the same
+///   row-vector convention as @p Matrix4 is used: `(v * m)[i] == dot(v, m[i])`.
+/// @note
+///   Use @p Matrix<T, R, C> instead of this type directly, which maps float square matrices to
+///   the optimized @p Matrix2, @p Matrix3 and @p Matrix4.
+///
+/// @tparam T
+///   Element type. Must be an arithmetic type.
+/// @tparam R
+///   Number of rows.
+/// @tparam C
+///   Number of columns.
+template <typename T, std::size_t R, std::size_t C>
+struct BasicMatrix {
+    using ValueType                      = T;
+    using ColumnType                     = BasicVector<T, R>;
+    static constexpr std::size_t Rows    = R;
+    static constexpr std::size_t Columns = C;
+
+    ColumnType column[C];
+
+    /// @brief
+    ///   Create a zero matrix.
+    constexpr BasicMatrix() noexcept : column() {}
+
+    /// @brief
+    ///   Create a diagonal matrix and set all diagonal elements to the specified value.
+    ///
+    /// @param v
+    ///   Value of the diagonal elements. Use 1 to create an identity matrix.
+    explicit constexpr BasicMatrix(T v) noexcept : column() {
+        for (std::size_t i = 0; i < R && i < C; ++i)
+            column[i][i] = v;
+    }
+
+    /// @brief
+    ///   Create a matrix with the specified columns.
+    ///
+    /// @param columns
+    ///   Columns of the matrix. Number of columns must be the same as @p C.
+    template <typename... Args,
+              typename = std::enable_if_t<sizeof...(Args) == C &&
+                                          (std::is_same_v<Args, ColumnType> && ...)>>
+    constexpr BasicMatrix(const Args &...columns) noexcept : column{columns...} {}
+
+    /// @brief
+    ///   Convert a matrix of another element type.
+    ///
+    /// @param other
+    ///   The matrix to be converted.
+    template <typename U, typename = std::enable_if_t<!std::is_same_v<T, U>>>
+    explicit constexpr BasicMatrix(const BasicMatrix<U, R, C> &other) noexcept : column() {
+        for (std::size_t i = 0; i < C; ++i)
+            column[i] = ColumnType(other[i]);
+    }
+
+    /// @brief
+    ///   Random access columns in this matrix by index.
+    /// @note
+    ///   No boundary check performed.
+    constexpr auto operator[](std::size_t i) noexcept -> ColumnType & { return column[i]; }
+
+    /// @brief
+    ///   Random access columns in this matrix by index.
+    /// @note
+    ///   No boundary check performed.
+    constexpr auto operator[](std::size_t i) const noexcept -> const ColumnType & {
+        return column[i];
+    }
+
+    /// @brief
+    ///   Get transposed copy of this matrix.
+    [[nodiscard]] constexpr auto transposed() const noexcept -> BasicMatrix<T, C, R> {
+        BasicMatrix<T, C, R> result;
+        for (std::size_t i = 0; i < C; ++i) {
+            for (std::size_t j = 0; j < R; ++j)
+                result[j][i] = column[i][j];
+        }
+        return result;
+    }
+
+    /// @brief
+    ///   Calculate determinant of this matrix with Gaussian elimination. Only available for
+    ///   floating point square matrices.
+    template <typename U = T,
+              typename   = std::enable_if_t<std::is_floating_point_v<U> && R == C>>
+    [[nodiscard]] constexpr auto determinant() const noexcept -> T {
+        BasicMatrix m(*this);
+        T           result = 1;
+        for (std::size_t k = 0; k < C; ++k) {
+            const std::size_t pivot = m.findPivot(k);
+            if (m[pivot][k] == 0)
+                return 0;
+
+            if (pivot != k) {
+                m.swapRows(pivot, k);
+                result = -result;
+            }
+
+            result *= m[k][k];
+            for (std::size_t i = k + 1; i < C; ++i) {
+                const T factor = m[k][i] / m[k][k];
+                for (std::size_t j = k; j < C; ++j)
+                    m[j][i] -= factor * m[j][k];
+            }
+        }
+        return result;
+    }
+
+    /// @brief
+    ///   Get inverse of this matrix with Gauss-Jordan elimination. Only available for floating
+    ///   point square matrices.
+    /// @note
+    ///   The result is undefined if this matrix is singular.
+    template <typename U = T,
+              typename   = std::enable_if_t<std::is_floating_point_v<U> && R == C>>
+    [[nodiscard]] constexpr auto inversed() const noexcept -> BasicMatrix {
+        BasicMatrix m(*this);
+        BasicMatrix result(T(1));
+        for (std::size_t k = 0; k < C; ++k) {
+            const std::size_t pivot = m.findPivot(k);
+            m.swapRows(pivot, k);
+            result.swapRows(pivot, k);
+
+            const T invPivot = T(1) / m[k][k];
+            for (std::size_t j = 0; j < C; ++j) {
+                m[j][k] *= invPivot;
+                result[j][k] *= invPivot;
+            }
+
+            for (std::size_t i = 0; i < C; ++i) {
+                if (i == k)
+                    continue;
+
+                const T factor = m[k][i];
+                for (std::size_t j = 0; j < C; ++j) {
+                    m[j][i] -= factor * m[j][k];
+                    result[j][i] -= factor * result[j][k];
+                }
+            }
+        }
+        return result;
+    }
+
+    constexpr auto operator+=(const BasicMatrix &rhs) noexcept -> BasicMatrix & {
+        for (std::size_t i = 0; i < C; ++i)
+            column[i] += rhs[i];
+        return *this;
+    }
+
+    constexpr auto operator-=(const BasicMatrix &rhs) noexcept -> BasicMatrix & {
+        for (std::size_t i = 0; i < C; ++i)
+            column[i] -= rhs[i];
+        return *this;
+    }
+
+    constexpr auto operator*=(T rhs) noexcept -> BasicMatrix & {
+        for (std::size_t i = 0; i < C; ++i)
+            column[i] *= rhs;
+        return *this;
+    }
+
+private:
+    /// @brief
+    ///   Find row with the largest absolute value in column @p k, starting from row @p k.
+    [[nodiscard]] constexpr auto findPivot(std::size_t k) const noexcept -> std::size_t {
+        std::size_t pivot = k;
+        for (std::size_t i = k + 1; i < R; ++i) {
+            const T a = column[k][i] < 0 ? -column[k][i] : column[k][i];
+            const T b = column[k][pivot] < 0 ? -column[k][pivot] : column[k][pivot];
+            if (a > b)
+                pivot = i;
+        }
+        return pivot;
+    }
+
+    constexpr auto swapRows(std::size_t a, std::size_t b) noexcept -> void {
+        for (std::size_t j = 0; j < C; ++j) {
+            const T temp = column[j][a];
+            column[j][a] = column[j][b];
+            column[j][b] = temp;
+        }
+    }
+};
+
+template <typename T, std::size_t R, std::size_t C>
+constexpr auto operator+(BasicMatrix<T, R, C> lhs, const BasicMatrix<T, R, C> &rhs) noexcept
+    -> BasicMatrix<T, R, C> {
+    return lhs += rhs;
+}
+
+template <typename T, std::size_t R, std::size_t C>
+constexpr auto operator-(BasicMatrix<T, R, C> lhs, const BasicMatrix<T, R, C> &rhs) noexcept
+    -> BasicMatrix<T, R, C> {
+    return lhs -= rhs;
+}
+
+template <typename T, std::size_t R, std::size_t C>
+constexpr auto operator*(BasicMatrix<T, R, C> lhs, T rhs) noexcept -> BasicMatrix<T, R, C> {
+    return lhs *= rhs;
+}
+
+template <typename T, std::size_t R, std::size_t C>
+constexpr auto operator*(T lhs, BasicMatrix<T, R, C> rhs) noexcept -> BasicMatrix<T, R, C> {
+    return rhs *= lhs;
+}
+
+/// @brief
+///   Matrix multiplication. The result applies @p lhs first and then @p rhs to row vectors.
+template <typename T, std::size_t R, std::size_t K, std::size_t C>
+constexpr auto operator*(const BasicMatrix<T, R, K> &lhs, const BasicMatrix<T, K, C> &rhs) noexcept
+    -> BasicMatrix<T, R, C> {
+    BasicMatrix<T, R, C> result;
+    for (std::size_t i = 0; i < C; ++i) {
+        for (std::size_t k = 0; k < K; ++k)
+            result[i] += lhs[k] * rhs[i][k];
+    }
+    return result;
+}
+
+/// @brief
+///   Transform a row vector with the specified matrix.
+template <typename T, std::size_t R, std::size_t C>
+constexpr auto operator*(BasicVector<T, R> lhs, const BasicMatrix<T, R, C> &rhs) noexcept
+    -> BasicVector<T, C> {
+    BasicVector<T, C> result;
+    for (std::size_t i = 0; i < C; ++i)
+        result[i] = dot(lhs, rhs[i]);
+    return result;
+}
+
+/// @brief
+///   Transform a column vector with the specified matrix.
+template <typename T, std::size_t R, std::size_t C>
+constexpr auto operator*(const BasicMatrix<T, R, C> &lhs, BasicVector<T, C> rhs) noexcept
+    -> BasicVector<T, R> {
+    BasicVector<T, R> result;
+    for (std::size_t i = 0; i < C; ++i)
+        result += lhs[i] * rhs[i];
+    return result;
+}
+
+template <typename T, std::size_t R, std::size_t C>
+constexpr auto operator==(const BasicMatrix<T, R, C> &lhs, const BasicMatrix<T, R, C> &rhs) noexcept
+    -> bool {
+    for (std::size_t i = 0; i < C; ++i) {
+        if (lhs[i] != rhs[i])
+            return false;
+    }
+    return true;
+}
+
+template <typename T, std::size_t R, std::size_t C>
+constexpr auto operator!=(const BasicMatrix<T, R, C> &lhs, const BasicMatrix<T, R, C> &rhs) noexcept
+    -> bool {
+    return !(lhs == rhs);
+}
+
+/// @brief
+///   N-dimensional vector of type T. Float vectors with 2 to 4 elements are the hand-written @p
+///   Vector2, @p Vector3 and @p Vector4, and all other combinations are @p BasicVector<T, N>.
+template <typename T, std::size_t N>
+using Vector = typename detail::VectorSelector<T, N>::Type;
+
+/// @brief
+///   R by C matrix of type T. Float square matrices with 2 to 4 rows are the hand-written @p
+///   Matrix2, @p Matrix3 and @p Matrix4, and all other combinations are @p BasicMatrix<T, R, C>.
+template <typename T, std::size_t R, std::size_t C>
+using Matrix = typename detail::MatrixSelector<T, R, C>::Type;
+
+using Vector2d = Vector<double, 2>;
+using Vector3d = Vector<double, 3>;
+using Vector4d = Vector<double, 4>;
+
+using Vector2i = Vector<std::int32_t, 2>;
+using Vector3i = Vector<std::int32_t, 3>;
+using Vector4i = Vector<std::int32_t, 4>;
+
+using Vector2u = Vector<std::uint32_t, 2>;
+using Vector3u = Vector<std::uint32_t, 3>;
+using Vector4u = Vector<std::uint32_t, 4>;
+
+using Matrix2d = Matrix<double, 2, 2>;
+using Matrix3d = Matrix<double, 3, 3>;
+using Matrix4d = Matrix<double, 4, 4>;
+
+/// @brief
+///   Convert between vector types of the same size, including the float vectors. Elements are
+///   converted with `static_cast`.
+///
+/// @tparam To
+///   The vector type to be converted to.
+/// @param from
+///   The vector to be converted.
+template <typename To, typename From>
+[[nodiscard]] constexpr auto vectorCast(const From &from) noexcept -> To {
+    static_assert(detail::VectorTraits<To>::Size == detail::VectorTraits<From>::Size,
+                  "Vectors must have the same number of elements.");
+
+    using ValueType = typename detail::VectorTraits<To>::ValueType;
+
+    To result;
+    for (std::size_t i = 0; i < detail::VectorTraits<To>::Size; ++i)
+        result[i] = static_cast<ValueType>(from[i]);
+    return result;
+}
+
+/// @brief
+///   Convert between matrix types of the same size, including the float matrices. Elements are
+///   converted with `static_cast`.
+///
+/// @tparam To
+///   The matrix type to be converted to.
+/// @param from
+///   The matrix to be converted.
+template <typename To, typename From>
+[[nodiscard]] constexpr auto matrixCast(const From &from) noexcept -> To {
+    using ToTraits   = detail::MatrixTraits<To>;
+    using FromTraits = detail::MatrixTraits<From>;
+    static_assert(ToTraits::Rows == FromTraits::Rows && ToTraits::Columns == FromTraits::Columns,
+                  "Matrices must have the same size.");
+
+    To result;
+    for (std::size_t i = 0; i < ToTraits::Columns; ++i) {
+        for (std::size_t j = 0; j < ToTraits::Rows; ++j)
+            result[i][j] = static_cast<typename ToTraits::ValueType>(from[i][j]);
+    }
+    return result;
+}
+
+/// @brief
+///   Get position relative to the camera in single precision. The difference is calculated in
+///   double precision, so nearby objects keep full float precision however far they are from the
+///   world origin.
+///
+/// @param position
+///   World space position in double precision.
+/// @param camera
+///   World space camera position in double precision.
+///
+/// @return
+///   Offset from @p camera to @p position.
+[[nodiscard]] constexpr auto cameraRelative(Vector3d position, Vector3d camera) noexcept
+    -> Vector3 {
+    return vectorCast<Vector3>(position - camera);
+}
+
+/// @brief
+///   Get affine world transform relative to the camera in single precision. Translation is
+///   subtracted in double precision before conversion, so the result could be combined with a
+///   view matrix whose eye is at the origin.
+///
+/// @param world
+///   Affine world transform matrix in double precision.
+/// @param camera
+///   World space camera position in double precision.
+///
+/// @return
+///   World transform matrix with @p camera moved to the origin.
+[[nodiscard]] constexpr auto cameraRelative(const Matrix4d &world, Vector3d camera) noexcept
+    -> Matrix4 {
+    Matrix4 result = matrixCast<Matrix4>(world);
+    for (std::size_t i = 0; i < 3; ++i)
+        result[i][3] = static_cast<float>(world[i][3] - camera[i]);
+    return result;
+}
+
+/// @brief
+///   Split a double precision vector into 2 float vectors whose sum approximates the original
+///   value with about 48 bits of mantissa. This is useful for GPU side camera-relative rendering:
+///   `(high - cameraHigh) + (low - cameraLow)` keeps precision where plain floats would not.
+///
+/// @param value
+///   The vector to be split.
+/// @param[out] high
+///   The value rounded to float.
+/// @param[out] low
+///   The rounding error of @p high.
+constexpr auto split(Vector3d value, Vector3 &high, Vector3 &low) noexcept -> void {
+    high = vectorCast<Vector3>(value);
+    low  = vectorCast<Vector3>(value - vectorCast<Vector3d>(high));
+}
+
+} // namespace ink
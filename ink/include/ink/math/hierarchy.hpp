@@ -0,0 +1,264 @@
+#pragma once
+
+#include "batch.hpp"
+#include "transform.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ink {
+
+/// @brief
+///   Flat transform hierarchy. Nodes are stored in arrays of local transforms and world matrices
+///   where a parent always comes before its children. World matrices are only recomputed for
+///   nodes whose local transform or any ancestor has changed since the last @p update(), so a
+///   static hierarchy costs nothing per frame.
+/// @note
+///   World matrix of a node is `local.toMatrix4() * parentWorld`, so the local transform is applied
+///   first, just like @p Matrix4.
+class TransformHierarchy {
+public:
+    /// @brief
+    ///   Parent index of root nodes.
+    static constexpr std::uint32_t NoParent = std::numeric_limits<std::uint32_t>::max();
+
+    /// @brief
+    ///   Create an empty hierarchy.
+    TransformHierarchy() noexcept = default;
+
+    /// @brief
+    ///   Reserve memory for the specified number of nodes.
+    ///
+    /// @param count
+    ///   Number of nodes to reserve memory for.
+    ///
+    /// @throw std::bad_alloc
+    ///   Thrown if failed to allocate memory.
+    auto reserve(std::size_t count) -> void {
+        m_parents.reserve(count);
+        m_depths.reserve(count);
+        m_dirty.reserve(count);
+        m_locals.reserve(count);
+        m_worlds.reserve(count);
+    }
+
+    /// @brief
+    ///   Add a new node to this hierarchy. The node is marked as dirty, and its world matrix is
+    ///   valid after the next @p update().
+    ///
+    /// @param parent
+    ///   Index of the parent node. Must be either @p NoParent or index of an existing node, so
+    ///   that parents always come before their children.
+    /// @param local
+    ///   Local transform of the new node relative to its parent.
+    ///
+    /// @return
+    ///   Index of the new node.
+    /// @throw std::bad_alloc
+    ///   Thrown if failed to allocate memory.
+    auto addNode(std::uint32_t parent, const Transform &local) -> std::uint32_t {
+        const auto          index = static_cast<std::uint32_t>(m_parents.size());
+        const std::uint32_t depth = (parent == NoParent) ? 0 : m_depths[parent] + 1;
+
+        m_parents.push_back(parent);
+        m_depths.push_back(depth);
+        m_dirty.push_back(1);
+        m_locals.push_back(local);
+        m_worlds.emplace_back(1.0f);
+
+        m_levelsOutdated = true;
+        m_minDirtyDepth  = std::min(m_minDirtyDepth, depth);
+        return index;
+    }
+
+    /// @brief
+    ///   Remove all nodes from this hierarchy.
+    auto clear() noexcept -> void {
+        m_parents.clear();
+        m_depths.clear();
+        m_dirty.clear();
+        m_locals.clear();
+        m_worlds.clear();
+        m_order.clear();
+        m_levelOffsets.clear();
+        m_levelsOutdated = false;
+        m_minDirtyDepth  = NoParent;
+    }
+
+    /// @brief
+    ///   Get number of nodes in this hierarchy.
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_parents.size(); }
+
+    /// @brief
+    ///   Get parent index of the specified node.
+    ///
+    /// @param node
+    ///   Index of the node.
+    ///
+    /// @return
+    ///   Index of the parent node, or @p NoParent if @p node is a root node.
+    [[nodiscard]] auto parent(std::uint32_t node) const noexcept -> std::uint32_t {
+        return m_parents[node];
+    }
+
+    /// @brief
+    ///   Get local transform of the specified node.
+    ///
+    /// @param node
+    ///   Index of the node.
+    ///
+    /// @return
+    ///   Local transform of the node relative to its parent.
+    [[nodiscard]] auto local(std::uint32_t node) const noexcept -> const Transform & {
+        return m_locals[node];
+    }
+
+    /// @brief
+    ///   Set local transform of the specified node. World matrices of the node and all of its
+    ///   descendants are recomputed in the next @p update().
+    ///
+    /// @param node
+    ///   Index of the node.
+    /// @param local
+    ///   New local transform of the node relative to its parent.
+    auto setLocal(std::uint32_t node, const Transform &local) noexcept -> void {
+        m_locals[node]  = local;
+        m_dirty[node]   = 1;
+        m_minDirtyDepth = std::min(m_minDirtyDepth, m_depths[node]);
+    }
+
+    /// @brief
+    ///   Get world matrix of the specified node.
+    /// @note
+    ///   The result is outdated if the hierarchy is modified after the last @p update().
+    ///
+    /// @param node
+    ///   Index of the node.
+    ///
+    /// @return
+    ///   World matrix of the node.
+    [[nodiscard]] auto world(std::uint32_t node) const noexcept -> const Matrix4 & {
+        return m_worlds[node];
+    }
+
+    /// @brief
+    ///   Get world matrices of all nodes. The matrices are indexed by node index.
+    [[nodiscard]] auto worlds() const noexcept -> const std::vector<Matrix4> & { return m_worlds; }
+
+    /// @brief
+    ///   Checks if any node has been modified since the last @p update().
+    [[nodiscard]] auto dirty() const noexcept -> bool { return m_minDirtyDepth != NoParent; }
+
+    /// @brief
+    ///   Recompute world matrices of modified nodes and their descendants. Nothing is done if no
+    ///   node has been modified.
+    /// @note
+    ///   Nodes are updated level by level. Nodes of the same depth do not depend on each other, so
+    ///   large levels are split across threads. Levels above the shallowest modified node are
+    ///   skipped.
+    ///
+    /// @throw std::bad_alloc
+    ///   Thrown if failed to allocate memory for the level order after nodes are added.
+    auto update() -> void {
+        if (!dirty())
+            return;
+
+        if (m_levelsOutdated)
+            buildLevels();
+
+        for (std::size_t depth = m_minDirtyDepth; depth + 1 < m_levelOffsets.size(); ++depth) {
+            const std::uint32_t *order = m_order.data() + m_levelOffsets[depth];
+            const std::size_t    count = m_levelOffsets[depth + 1] - m_levelOffsets[depth];
+
+            detail::parallelBatch(count, [this, order](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i)
+                    updateNode(order[i]);
+            });
+        }
+
+        std::fill(m_dirty.begin(), m_dirty.end(), std::uint8_t(0));
+        m_minDirtyDepth = NoParent;
+    }
+
+private:
+    /// @brief
+    ///   Recompute world matrix of the specified node if it or its parent is dirty. The node is
+    ///   marked as dirty so that its children are updated in the next level.
+    auto updateNode(std::uint32_t node) noexcept -> void {
+        const std::uint32_t parent = m_parents[node];
+        if (parent == NoParent) {
+            if (m_dirty[node] != 0)
+                m_worlds[node] = m_locals[node].toMatrix4();
+            return;
+        }
+
+        if (m_dirty[node] == 0 && m_dirty[parent] == 0)
+            return;
+
+        m_dirty[node]  = 1;
+        m_worlds[node] = m_locals[node].toMatrix4() * m_worlds[parent];
+    }
+
+    /// @brief
+    ///   Sort node indices by depth with counting sort. Nodes of each depth keep their relative
+    ///   order so that memory access stays mostly sequential.
+    auto buildLevels() -> void {
+        std::uint32_t levelCount = 0;
+        for (const std::uint32_t depth : m_depths)
+            levelCount = std::max(levelCount, depth + 1);
+
+        m_levelOffsets.assign(std::size_t(levelCount) + 1, 0);
+        for (const std::uint32_t depth : m_depths)
+            ++m_levelOffsets[depth + 1];
+        for (std::size_t i = 1; i < m_levelOffsets.size(); ++i)
+            m_levelOffsets[i] += m_levelOffsets[i - 1];
+
+        std::vector<std::size_t> cursors(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+        m_order.resize(m_depths.size());
+        for (std::size_t i = 0; i < m_depths.size(); ++i)
+            m_order[cursors[m_depths[i]]++] = static_cast<std::uint32_t>(i);
+
+        m_levelsOutdated = false;
+    }
+
+private:
+    /// @brief
+    ///   Parent index of each node.
+    std::vector<std::uint32_t> m_parents;
+
+    /// @brief
+    ///   Depth of each node. Root nodes have depth 0.
+    std::vector<std::uint32_t> m_depths;
+
+    /// @brief
+    ///   Non-zero if local transform of the node has been modified. Bytes are used instead of
+    ///   @p std::vector<bool> so that nodes could be updated concurrently.
+    std::vector<std::uint8_t> m_dirty;
+
+    /// @brief
+    ///   Local transform of each node.
+    std::vector<Transform> m_locals;
+
+    /// @brief
+    ///   World matrix of each node.
+    std::vector<Matrix4> m_worlds;
+
+    /// @brief
+    ///   Node indices sorted by depth.
+    std::vector<std::uint32_t> m_order;
+
+    /// @brief
+    ///   Nodes of depth i are `m_order[m_levelOffsets[i], m_levelOffsets[i + 1])`.
+    std::vector<std::size_t> m_levelOffsets;
+
+    /// @brief
+    ///   Whether @p m_order should be rebuilt because nodes are added.
+    bool m_levelsOutdated = false;
+
+    /// @brief
+    ///   Depth of the shallowest dirty node, or @p NoParent if no node is dirty.
+    std::uint32_t m_minDirtyDepth = NoParent;
+};
+
+} // namespace ink
@@ -565,9 +565,9 @@ struct Matrix3 {
     ///
     /// @return
     ///   Reference to this matrix.
-    auto rotate(float radian) noexcept -> Matrix3 & {
-        const float s = std::sin(radian);
-        const float c = std::cos(radian);
+    constexpr auto rotate(float radian) noexcept -> Matrix3 & {
+        const float s = sin(radian);
+        const float c = cos(radian);
 
         const Vector3 c0 = column[0] * c - column[1] * s;
         const Vector3 c1 = column[0] * s + column[1] * c;
@@ -590,9 +590,9 @@ struct Matrix3 {
     ///
     /// @return
     ///   Rotated matrix of this one.
-    [[nodiscard]] auto rotated(float radian) const noexcept -> Matrix3 {
-        const float s = std::sin(radian);
-        const float c = std::cos(radian);
+    [[nodiscard]] constexpr auto rotated(float radian) const noexcept -> Matrix3 {
+        const float s = sin(radian);
+        const float c = cos(radian);
 
         return {column[0] * c - column[1] * s, column[0] * s + column[1] * c, column[2]};
     }
@@ -1089,6 +1089,13 @@ struct Matrix4 {
     /// @return
     ///   A new matrix that represents the transposed matrix.
     [[nodiscard]] constexpr auto transposed() const noexcept -> Matrix4 {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            Matrix4 result;
+            simd::transposeMatrix4(&column[0][0], &result[0][0]);
+            return result;
+        }
+#endif
         // clang-format off
         return {
             column[0][0], column[1][0], column[2][0], column[3][0],
@@ -1107,6 +1114,12 @@ struct Matrix4 {
     /// @return
     ///   Reference to this matrix.
     constexpr auto inverse() noexcept -> Matrix4 & {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            simd::inverseMatrix4(&column[0][0], &column[0][0]);
+            return *this;
+        }
+#endif
         const float coef00 = column[2][2] * column[3][3] - column[3][2] * column[2][3];
         const float coef02 = column[1][2] * column[3][3] - column[3][2] * column[1][3];
         const float coef03 = column[1][2] * column[2][3] - column[2][2] * column[1][3];
@@ -1150,7 +1163,7 @@ struct Matrix4 {
         const Vector4 r0(result[0][0], result[1][0], result[2][0], result[3][0]);
         const Vector4 dot0(column[0] * r0);
 
-        const float dot1   = (dot0.x + dot0.y) + (dot0.z + dot0.w);
+        const float dot1   = (dot0[0] + dot0[1]) + (dot0[2] + dot0[3]);
         const float invDet = 1.0f / dot1;
 
         column[0] = result[0] * invDet;
@@ -1169,6 +1182,13 @@ struct Matrix4 {
     /// @return
     ///   A new matrix that represents the transposed matrix.
     [[nodiscard]] constexpr auto inversed() const noexcept -> Matrix4 {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            Matrix4 result;
+            simd::inverseMatrix4(&column[0][0], &result[0][0]);
+            return result;
+        }
+#endif
         const float coef00 = column[2][2] * column[3][3] - column[3][2] * column[2][3];
         const float coef02 = column[1][2] * column[3][3] - column[3][2] * column[1][3];
         const float coef03 = column[1][2] * column[2][3] - column[2][2] * column[1][3];
@@ -1212,12 +1232,138 @@ struct Matrix4 {
         const Vector4 r0(result[0][0], result[1][0], result[2][0], result[3][0]);
         const Vector4 dot0(column[0] * r0);
 
-        const float dot1   = (dot0.x + dot0.y) + (dot0.z + dot0.w);
+        const float dot1   = (dot0[0] + dot0[1]) + (dot0[2] + dot0[3]);
         const float invDet = 1.0f / dot1;
 
         return {result[0] * invDet, result[1] * invDet, result[2] * invDet, result[3] * invDet};
     }
 
+    /// @brief
+    ///   Inverse this matrix as an affine transform matrix. This is much faster than @p inverse().
+    /// @remark
+    ///   To get inversed matrix without modifying this matrix, use @p inversedAffine() instead.
+    /// @note
+    ///   It is assumed that the last column (column[3]) of this matrix is (0, 0, 0, 1), which is
+    ///   true for any combination of translate, rotate and scale transforms.
+    ///
+    /// @return
+    ///   Reference to this matrix.
+    constexpr auto inverseAffine() noexcept -> Matrix4 & {
+        *this = inversedAffine();
+        return *this;
+    }
+
+    /// @brief
+    ///   Get inversed matrix of this one as an affine transform matrix. This is much faster than
+    ///   @p inversed().
+    /// @remark
+    ///   To inverse this matrix, use @p inverseAffine() instead.
+    /// @note
+    ///   It is assumed that the last column (column[3]) of this matrix is (0, 0, 0, 1), which is
+    ///   true for any combination of translate, rotate and scale transforms.
+    ///
+    /// @return
+    ///   A new matrix that represents the inversed matrix.
+    [[nodiscard]] constexpr auto inversedAffine() const noexcept -> Matrix4 {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            Matrix4 result;
+            simd::inverseAffineMatrix4(&column[0][0], &result[0][0]);
+            return result;
+        }
+#endif
+        // Columns of the inversed 3x3 linear part.
+        const Vector4 c0     = cross(column[1], column[2]);
+        const float   invDet = 1.0f / dot(column[0], c0);
+
+        const Vector4 x0 = c0 * invDet;
+        const Vector4 x1 = cross(column[2], column[0]) * invDet;
+        const Vector4 x2 = cross(column[0], column[1]) * invDet;
+        const Vector4 t  = -(x0 * column[0][3] + x1 * column[1][3] + x2 * column[2][3]);
+
+        return {
+            Vector4(x0[0], x1[0], x2[0], t[0]),
+            Vector4(x0[1], x1[1], x2[1], t[1]),
+            Vector4(x0[2], x1[2], x2[2], t[2]),
+            Vector4(0.0f, 0.0f, 0.0f, 1.0f),
+        };
+    }
+
+    /// @brief
+    ///   Inverse this matrix as a rigid transform matrix. This is much faster than @p inverse()
+    ///   and @p inverseAffine().
+    /// @remark
+    ///   To get inversed matrix without modifying this matrix, use @p inversedRigid() instead.
+    /// @note
+    ///   It is assumed that this matrix only contains rotate and translate transforms, such as
+    ///   view matrices created by @p lookAt() and @p lookTo().
+    ///
+    /// @return
+    ///   Reference to this matrix.
+    constexpr auto inverseRigid() noexcept -> Matrix4 & {
+        *this = inversedRigid();
+        return *this;
+    }
+
+    /// @brief
+    ///   Get inversed matrix of this one as a rigid transform matrix. This is much faster than
+    ///   @p inversed() and @p inversedAffine().
+    /// @remark
+    ///   To inverse this matrix, use @p inverseRigid() instead.
+    /// @note
+    ///   It is assumed that this matrix only contains rotate and translate transforms, such as
+    ///   view matrices created by @p lookAt() and @p lookTo().
+    ///
+    /// @return
+    ///   A new matrix that represents the inversed matrix.
+    [[nodiscard]] constexpr auto inversedRigid() const noexcept -> Matrix4 {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            Matrix4 result;
+            simd::inverseRigidMatrix4(&column[0][0], &result[0][0]);
+            return result;
+        }
+#endif
+        // Inverse of the rotation part is its transpose.
+        const Vector4 t =
+            -(column[0] * column[0][3] + column[1] * column[1][3] + column[2] * column[2][3]);
+
+        return {
+            Vector4(column[0][0], column[1][0], column[2][0], t[0]),
+            Vector4(column[0][1], column[1][1], column[2][1], t[1]),
+            Vector4(column[0][2], column[1][2], column[2][2], t[2]),
+            Vector4(0.0f, 0.0f, 0.0f, 1.0f),
+        };
+    }
+
+    /// @brief
+    ///   Get inverse transpose of the upper left 3x3 part of this matrix. This is usually used to
+    ///   transform normals.
+    /// @note
+    ///   Translation is removed and the rest elements are filled with identity, so the result
+    ///   could be used to transform 3D homogeneous coordinate directions directly.
+    ///
+    /// @return
+    ///   A new matrix that represents the normal matrix of this one.
+    [[nodiscard]] constexpr auto inverseTransposed3x3() const noexcept -> Matrix4 {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            Matrix4 result;
+            simd::inverseTransposed3x3Matrix4(&column[0][0], &result[0][0]);
+            return result;
+        }
+#endif
+        const Vector4 c0     = cross(column[1], column[2]);
+        const float   invDet = 1.0f / dot(column[0], c0);
+
+        return {
+            c0 * invDet,
+            cross(column[2], column[0]) * invDet,
+            cross(column[0], column[1]) * invDet,
+            Vector4(0.0f, 0.0f, 0.0f, 1.0f),
+        };
+    }
+
     /// @brief
     ///   Apply a 3D translate transform to this matrix.
     /// @remark
@@ -1366,9 +1512,9 @@ struct Matrix4 {
     ///
     /// @return
     ///   Reference to this matrix.
-    auto rotate(Vector3 axis, float radian) noexcept -> Matrix4 & {
-        const float s = std::sin(radian);
-        const float c = std::cos(radian);
+    constexpr auto rotate(Vector3 axis, float radian) noexcept -> Matrix4 & {
+        const float s = sin(radian);
+        const float c = cos(radian);
 
         axis.normalize();
         const Vector3 temp = (1.0f - c) * axis;
@@ -1408,9 +1554,9 @@ struct Matrix4 {
     ///
     /// @return
     ///   Rotated matrix of this one.
-    [[nodiscard]] auto rotated(Vector3 axis, float radian) const noexcept -> Matrix4 {
-        const float s = std::sin(radian);
-        const float c = std::cos(radian);
+    [[nodiscard]] constexpr auto rotated(Vector3 axis, float radian) const noexcept -> Matrix4 {
+        const float s = sin(radian);
+        const float c = cos(radian);
 
         axis.normalize();
         const Vector3 temp = (1.0f - c) * axis;
@@ -1586,6 +1732,12 @@ struct Matrix4 {
     }
 
     constexpr auto operator*=(const Matrix4 &rhs) noexcept -> Matrix4 & {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            simd::multiplyMatrix4(&column[0][0], &rhs[0][0], &column[0][0]);
+            return *this;
+        }
+#endif
         // clang-format off
         const float v00 = column[0][0] * rhs[0][0] + column[1][0] * rhs[0][1] + column[2][0] * rhs[0][2] + column[3][0] * rhs[0][3];
         const float v01 = column[0][1] * rhs[0][0] + column[1][1] * rhs[0][1] + column[2][1] * rhs[0][2] + column[3][1] * rhs[0][3];
@@ -1660,6 +1812,13 @@ constexpr auto operator-(float lhs, const Matrix4 &rhs) noexcept -> Matrix4 {
 }
 
 constexpr auto operator*(const Matrix4 &lhs, const Matrix4 &rhs) noexcept -> Matrix4 {
+#if defined(INK_SIMD)
+    if (!INK_IS_CONSTANT_EVALUATED()) {
+        Matrix4 result;
+        simd::multiplyMatrix4(&lhs[0][0], &rhs[0][0], &result[0][0]);
+        return result;
+    }
+#endif
     // clang-format off
     return Matrix4{
         lhs[0][0] * rhs[0][0] + lhs[1][0] * rhs[0][1] + lhs[2][0] * rhs[0][2] + lhs[3][0] * rhs[0][3],
@@ -1691,20 +1850,34 @@ constexpr auto operator*(float lhs, const Matrix4 &rhs) noexcept -> Matrix4 {
 }
 
 constexpr auto operator*(const Matrix4 &lhs, Vector4 rhs) noexcept -> Vector4 {
+#if defined(INK_SIMD)
+    if (!INK_IS_CONSTANT_EVALUATED()) {
+        Vector4 result;
+        simd::store(result.m_arr, simd::combine(&lhs[0][0], simd::load(rhs.m_arr)));
+        return result;
+    }
+#endif
     return Vector4{
-        lhs[0][0] * rhs.x + lhs[1][0] * rhs.y + lhs[2][0] * rhs.z + lhs[3][0] * rhs.w,
-        lhs[0][1] * rhs.x + lhs[1][1] * rhs.y + lhs[2][1] * rhs.z + lhs[3][1] * rhs.w,
-        lhs[0][2] * rhs.x + lhs[1][2] * rhs.y + lhs[2][2] * rhs.z + lhs[3][2] * rhs.w,
-        lhs[0][3] * rhs.x + lhs[1][3] * rhs.y + lhs[2][3] * rhs.z + lhs[3][3] * rhs.w,
+        lhs[0][0] * rhs[0] + lhs[1][0] * rhs[1] + lhs[2][0] * rhs[2] + lhs[3][0] * rhs[3],
+        lhs[0][1] * rhs[0] + lhs[1][1] * rhs[1] + lhs[2][1] * rhs[2] + lhs[3][1] * rhs[3],
+        lhs[0][2] * rhs[0] + lhs[1][2] * rhs[1] + lhs[2][2] * rhs[2] + lhs[3][2] * rhs[3],
+        lhs[0][3] * rhs[0] + lhs[1][3] * rhs[1] + lhs[2][3] * rhs[2] + lhs[3][3] * rhs[3],
     };
 }
 
 constexpr auto operator*(Vector4 lhs, const Matrix4 &rhs) noexcept -> Vector4 {
+#if defined(INK_SIMD)
+    if (!INK_IS_CONSTANT_EVALUATED()) {
+        Vector4 result;
+        simd::store(result.m_arr, simd::multiplyVector4Matrix4(simd::load(lhs.m_arr), &rhs[0][0]));
+        return result;
+    }
+#endif
     return Vector4{
-        lhs.x * rhs[0][0] + lhs.y * rhs[0][1] + lhs.z * rhs[0][2] + lhs.w * rhs[0][3],
-        lhs.x * rhs[1][0] + lhs.y * rhs[1][1] + lhs.z * rhs[1][2] + lhs.w * rhs[1][3],
-        lhs.x * rhs[2][0] + lhs.y * rhs[2][1] + lhs.z * rhs[2][2] + lhs.w * rhs[2][3],
-        lhs.x * rhs[3][0] + lhs.y * rhs[3][1] + lhs.z * rhs[3][2] + lhs.w * rhs[3][3],
+        lhs[0] * rhs[0][0] + lhs[1] * rhs[0][1] + lhs[2] * rhs[0][2] + lhs[3] * rhs[0][3],
+        lhs[0] * rhs[1][0] + lhs[1] * rhs[1][1] + lhs[2] * rhs[1][2] + lhs[3] * rhs[1][3],
+        lhs[0] * rhs[2][0] + lhs[1] * rhs[2][1] + lhs[2] * rhs[2][2] + lhs[3] * rhs[2][3],
+        lhs[0] * rhs[3][0] + lhs[1] * rhs[3][1] + lhs[2] * rhs[3][2] + lhs[3] * rhs[3][3],
     };
 }
 
@@ -1746,7 +1919,7 @@ constexpr auto operator/=(Vector4 &lhs, const Matrix4 &rhs) noexcept -> Vector4
 ///
 /// @return
 ///   A 4x4 matrix that represents the look at transform.
-[[nodiscard]] inline auto lookAt(Vector3 eye, Vector3 target, Vector3 up) noexcept -> Matrix4 {
+[[nodiscard]] constexpr auto lookAt(Vector3 eye, Vector3 target, Vector3 up) noexcept -> Matrix4 {
     const Vector3 front = (target - eye).normalized();
     const Vector3 right = cross(up, front).normalized();
     const Vector3 upDir = cross(front, right);
@@ -1771,7 +1944,7 @@ constexpr auto operator/=(Vector4 &lhs, const Matrix4 &rhs) noexcept -> Vector4
 ///
 /// @return
 ///   A 4x4 matrix that represents the look at transform.
-[[nodiscard]] inline auto lookAt(Vector4 eye, Vector4 target, Vector4 up) noexcept -> Matrix4 {
+[[nodiscard]] constexpr auto lookAt(Vector4 eye, Vector4 target, Vector4 up) noexcept -> Matrix4 {
     eye /= eye.w;
     target /= target.w;
 
@@ -1801,7 +1974,8 @@ constexpr auto operator/=(Vector4 &lhs, const Matrix4 &rhs) noexcept -> Vector4
 ///
 /// @return
 ///   A 4x4 matrix that represents the look at transform.
-[[nodiscard]] inline auto lookTo(Vector3 eye, Vector3 direction, Vector3 up) noexcept -> Matrix4 {
+[[nodiscard]] constexpr auto
+lookTo(Vector3 eye, Vector3 direction, Vector3 up) noexcept -> Matrix4 {
     const Vector3 front = direction.normalized();
     const Vector3 right = cross(up, front).normalized();
     const Vector3 upDir = cross(front, right);
@@ -1828,7 +2002,8 @@ constexpr auto operator/=(Vector4 &lhs, const Matrix4 &rhs) noexcept -> Vector4
 ///
 /// @return
 ///   A 4x4 matrix that represents the look at transform.
-[[nodiscard]] inline auto lookTo(Vector4 eye, Vector4 direction, Vector4 up) noexcept -> Matrix4 {
+[[nodiscard]] constexpr auto
+lookTo(Vector4 eye, Vector4 direction, Vector4 up) noexcept -> Matrix4 {
     eye /= eye.w;
     const Vector4 front = direction.normalized();
     const Vector4 right = cross(up, front).normalized();
@@ -1860,9 +2035,9 @@ constexpr auto operator/=(Vector4 &lhs, const Matrix4 &rhs) noexcept -> Vector4
 ///
 /// @return
 ///   A 4x4 matrix that represents the perspective transform.
-[[nodiscard]] inline auto perspective(float fovY, float aspect, float zNear, float zFar) noexcept
+[[nodiscard]] constexpr auto perspective(float fovY, float aspect, float zNear, float zFar) noexcept
     -> Matrix4 {
-    const float t = 1.0f / std::tan(fovY / 2.0f);
+    const float t = 1.0f / tan(fovY / 2.0f);
     const float z = zFar / (zFar - zNear);
 
     return Matrix4{
@@ -1893,10 +2068,10 @@ constexpr auto operator/=(Vector4 &lhs, const Matrix4 &rhs) noexcept -> Vector4
 ///
 /// @return
 ///   A 4x4 matrix that represents the perspective transform.
-[[nodiscard]] inline auto
+[[nodiscard]] constexpr auto
 perspective(float fovY, float width, float height, float zNear, float zFar) noexcept -> Matrix4 {
     const float a = width / height;
-    const float t = 1.0f / std::tan(fovY / 2.0f);
+    const float t = 1.0f / tan(fovY / 2.0f);
     const float z = zFar / (zFar - zNear);
 
     return Matrix4{
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "batch.hpp"
+
+namespace ink {
+
+/// @brief
+///   Lazily evaluated product of @p N 4x4 matrices. Multiplying a chain with another matrix only
+///   records the matrix. The product is evaluated when the chain is applied to a vector or
+///   converted to a @p Matrix4, in the order that takes the least arithmetic operations.
+/// @note
+///   A product of @p N matrices takes (N - 1) * 64 multiplications, while applying each matrix to
+///   a vector takes 16. Row vector code like `v * model * view * projection` is already evaluated
+///   from the vector and takes 48. A chain keeps that cost when the combined transform is built
+///   before the vector is known. `v * (lazy(model) * view * projection)` takes 48
+///   multiplications, while `v * (model * view * projection)` takes 144 since the matrix product
+///   is calculated first.
+/// @remark
+///   Matrices are stored by value, so it is safe to keep a chain of temporary matrices. Building a
+///   chain copies the matrices, so write `v * model * view * projection` directly when the vector
+///   is already known. Use @p lazy() to start a chain.
+///
+/// @tparam N
+///   Number of matrices in this chain.
+template <std::size_t N>
+class Matrix4Chain {
+public:
+    static_assert(N > 0, "Matrix chain must contain at least 1 matrix.");
+
+    /// @brief
+    ///   Create a chain that contains a single matrix.
+    ///
+    /// @param matrix
+    ///   The first matrix of this chain.
+    explicit constexpr Matrix4Chain(const Matrix4 &matrix) noexcept : m_matrices{matrix} {}
+
+    /// @brief
+    ///   Create a chain by concatenating 2 chains.
+    ///
+    /// @tparam M
+    ///   Number of matrices in the first chain.
+    /// @param lhs
+    ///   The first chain.
+    /// @param rhs
+    ///   The second chain.
+    template <std::size_t M, typename = std::enable_if_t<(M > 0 && M < N)>>
+    constexpr Matrix4Chain(const Matrix4Chain<M> &lhs, const Matrix4Chain<N - M> &rhs) noexcept
+        : m_matrices() {
+        for (std::size_t i = 0; i < M; ++i)
+            m_matrices[i] = lhs[i];
+        for (std::size_t i = M; i < N; ++i)
+            m_matrices[i] = rhs[i - M];
+    }
+
+    /// @brief
+    ///   Get the specified matrix in this chain.
+    ///
+    /// @param i
+    ///   Index of the matrix. Must be less than @p N.
+    ///
+    /// @return
+    ///   Reference to the matrix.
+    [[nodiscard]] constexpr auto operator[](std::size_t i) const noexcept -> const Matrix4 & {
+        return m_matrices[i];
+    }
+
+    /// @brief
+    ///   Get number of matrices in this chain.
+    [[nodiscard]] static constexpr auto size() noexcept -> std::size_t { return N; }
+
+    /// @brief
+    ///   Calculate the product of all matrices in this chain. The result is the same as multiplying
+    ///   the matrices eagerly from left to right.
+    ///
+    /// @return
+    ///   Product of all matrices in this chain.
+    [[nodiscard]] constexpr auto evaluate() const noexcept -> Matrix4 {
+        Matrix4 result = m_matrices[0];
+        for (std::size_t i = 1; i < N; ++i)
+            result *= m_matrices[i];
+        return result;
+    }
+
+    /// @brief
+    ///   Calculate the product of all matrices in this chain. This allows a chain to be used
+    ///   wherever a @p Matrix4 is expected.
+    constexpr operator Matrix4() const noexcept { return evaluate(); }
+
+private:
+    Matrix4 m_matrices[N];
+};
+
+/// @brief
+///   Start a lazily evaluated matrix chain. See @p Matrix4Chain for details.
+///
+/// @param matrix
+///   The first matrix of the chain.
+///
+/// @return
+///   A chain that contains @p matrix.
+[[nodiscard]] constexpr auto lazy(const Matrix4 &matrix) noexcept -> Matrix4Chain<1> {
+    return Matrix4Chain<1>(matrix);
+}
+
+template <std::size_t N>
+constexpr auto operator*(const Matrix4Chain<N> &lhs, const Matrix4 &rhs) noexcept
+    -> Matrix4Chain<N + 1> {
+    return {lhs, Matrix4Chain<1>(rhs)};
+}
+
+template <std::size_t N>
+constexpr auto operator*(const Matrix4 &lhs, const Matrix4Chain<N> &rhs) noexcept
+    -> Matrix4Chain<N + 1> {
+    return {Matrix4Chain<1>(lhs), rhs};
+}
+
+template <std::size_t N, std::size_t M>
+constexpr auto operator*(const Matrix4Chain<N> &lhs, const Matrix4Chain<M> &rhs) noexcept
+    -> Matrix4Chain<N + M> {
+    return {lhs, rhs};
+}
+
+/// @brief
+///   Apply a matrix chain to a column vector. Matrices are applied from right to left without
+///   calculating the matrix product. The result is the same as `chain.evaluate() * rhs`.
+template <std::size_t N>
+constexpr auto operator*(const Matrix4Chain<N> &lhs, Vector4 rhs) noexcept -> Vector4 {
+    for (std::size_t i = N; i > 0; --i)
+        rhs = lhs[i - 1] * rhs;
+    return rhs;
+}
+
+/// @brief
+///   Apply a matrix chain to a row vector. Matrices are applied from left to right without
+///   calculating the matrix product. The result is the same as `lhs * chain.evaluate()`.
+template <std::size_t N>
+constexpr auto operator*(Vector4 lhs, const Matrix4Chain<N> &rhs) noexcept -> Vector4 {
+    for (std::size_t i = 0; i < N; ++i)
+        lhs *= rhs[i];
+    return lhs;
+}
+
+template <std::size_t N>
+constexpr auto operator*=(Vector4 &lhs, const Matrix4Chain<N> &rhs) noexcept -> Vector4 & {
+    lhs = (lhs * rhs);
+    return lhs;
+}
+
+/// @brief
+///   Transform an array of 4D row vectors with a matrix chain. The result of each element is the
+///   same as `in[i] * chain`.
+/// @note
+///   Applying the chain to each vector takes N * 16 multiplications per vector, while evaluating
+///   the chain first takes (N - 1) * 64 multiplications once and 16 per vector. The cheaper one is
+///   chosen according to @p count.
+///
+/// @param chain
+///   The matrix chain to be applied.
+/// @param[in] in
+///   Pointer to the vectors to be transformed.
+/// @param[out] out
+///   Pointer to the array to store the transformed vectors. This could be the same as @p in.
+/// @param count
+///   Number of vectors to be transformed.
+template <std::size_t N>
+inline auto transformVectors(const Matrix4Chain<N> &chain,
+                             const Vector4         *in,
+                             Vector4               *out,
+                             std::size_t            count) noexcept -> void {
+    // Evaluating the chain first is cheaper for 4 or more vectors.
+    if (count < 4) {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = in[i] * chain;
+        return;
+    }
+
+    transformVectors(chain.evaluate(), in, out, count);
+}
+
+/// @brief
+///   Transform an array of points with a matrix chain. The result of each element is the same as
+///   @p transformPoints() with `chain.evaluate()`.
+/// @note
+///   See @p transformVectors() for how the evaluation order is chosen.
+///
+/// @param chain
+///   The matrix chain to be applied.
+/// @param[in] in
+///   Pointer to the points to be transformed.
+/// @param[out] out
+///   Pointer to the array to store the transformed points. This could be the same as @p in.
+/// @param count
+///   Number of points to be transformed.
+template <std::size_t N>
+inline auto transformPoints(const Matrix4Chain<N> &chain,
+                            const Vector3         *in,
+                            Vector3               *out,
+                            std::size_t            count) noexcept -> void {
+    if (count < 4) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const Vector4 v = Vector4(in[i], 1.0f) * chain;
+            out[i]          = Vector3(v.x, v.y, v.z);
+        }
+        return;
+    }
+
+    transformPoints(chain.evaluate(), in, out, count);
+}
+
+} // namespace ink
@@ -0,0 +1,603 @@
+#pragma once
+
+#include "vector.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace ink {
+
+/// @brief
+///   Default number of entries of the simulated post-transform vertex cache. Most GPUs behave like
+///   a FIFO cache of 16 to 32 entries, so optimizing for 16 entries works well on all of them.
+inline constexpr std::size_t DefaultVertexCacheSize = 16;
+
+/// @brief
+///   Post-transform vertex cache statistics of an index buffer.
+struct VertexCacheStatistics {
+    /// @brief
+    ///   Number of vertex shader invocations, which is the number of cache misses.
+    std::size_t vertexTransforms;
+
+    /// @brief
+    ///   Average cache miss ratio. This is the number of vertex shader invocations per triangle,
+    ///   which is in range [0.5, 3] for closed meshes. Lower is better.
+    float acmr;
+
+    /// @brief
+    ///   Average transform to vertex ratio. This is the number of vertex shader invocations per
+    ///   referenced vertex, which is at least 1. Lower is better.
+    float atvr;
+};
+
+namespace detail {
+
+/// @brief
+///   Simulated FIFO post-transform vertex cache. A vertex is in the cache if less than @p size
+///   vertices have been transformed since it was transformed, so no entry has to be moved.
+class VertexCacheSimulator {
+public:
+    /// @brief
+    ///   Create a simulator of the specified cache size for the specified number of vertices.
+    VertexCacheSimulator(std::size_t vertexCount, std::size_t size)
+        : m_timestamps(vertexCount, 0), m_time(size + 1), m_size(size) {}
+
+    /// @brief
+    ///   Checks if the specified vertex is in the cache.
+    [[nodiscard]] auto contains(std::uint32_t vertex) const noexcept -> bool {
+        return m_time - m_timestamps[vertex] <= m_size;
+    }
+
+    /// @brief
+    ///   Reference the specified vertex.
+    ///
+    /// @return
+    ///   1 if the vertex has to be transformed, or 0 if it is in the cache.
+    auto access(std::uint32_t vertex) noexcept -> std::uint32_t {
+        if (contains(vertex))
+            return 0;
+        m_timestamps[vertex] = m_time++;
+        return 1;
+    }
+
+    /// @brief
+    ///   Evict all vertices from the cache.
+    auto flush() noexcept -> void { m_time += m_size + 1; }
+
+    /// @brief
+    ///   Get the number of vertices transformed after the specified vertex was transformed. This is
+    ///   meaningful only if the vertex is in the cache.
+    [[nodiscard]] auto age(std::uint32_t vertex) const noexcept -> std::size_t {
+        return m_time - m_timestamps[vertex];
+    }
+
+private:
+    std::vector<std::size_t> m_timestamps;
+    std::size_t              m_time;
+    std::size_t              m_size;
+};
+
+/// @brief
+///   Load vertex position from a strided position array. Positions are copied byte by byte since
+///   strided attributes are not necessarily aligned.
+[[nodiscard]] inline auto loadPosition(const Vector3 *positions,
+                                       std::size_t    stride,
+                                       std::uint32_t  vertex) noexcept -> Vector3 {
+    Vector3 position;
+    std::memcpy(&position, reinterpret_cast<const std::uint8_t *>(positions) + vertex * stride,
+                sizeof(Vector3));
+    return position;
+}
+
+} // namespace detail
+
+/// @brief
+///   Simulate a FIFO post-transform vertex cache over the specified index buffer.
+///
+/// @param[in] indices
+///   Index buffer of a triangle list.
+/// @param indexCount
+///   Number of indices. Must be a multiple of 3.
+/// @param vertexCount
+///   Number of vertices. All indices must be less than @p vertexCount.
+/// @param cacheSize
+///   Number of entries of the simulated vertex cache.
+///
+/// @return
+///   Statistics of the simulated vertex cache.
+/// @throw std::bad_alloc
+///   Thrown if failed to allocate memory.
+[[nodiscard]] inline auto analyzeVertexCache(const std::uint32_t *indices,
+                                             std::size_t          indexCount,
+                                             std::size_t          vertexCount,
+                                             std::size_t cacheSize = DefaultVertexCacheSize)
+    -> VertexCacheStatistics {
+    detail::VertexCacheSimulator cache(vertexCount, cacheSize);
+    std::vector<std::uint8_t>    referenced(vertexCount, 0);
+
+    std::size_t transforms = 0;
+    std::size_t unique     = 0;
+    for (std::size_t i = 0; i < indexCount; ++i) {
+        transforms += cache.access(indices[i]);
+        unique += (referenced[indices[i]] == 0) ? 1 : 0;
+        referenced[indices[i]] = 1;
+    }
+
+    const std::size_t triangleCount = indexCount / 3;
+
+    VertexCacheStatistics result{};
+    result.vertexTransforms = transforms;
+    result.acmr = (triangleCount == 0)
+                      ? 0.0f
+                      : static_cast<float>(transforms) / static_cast<float>(triangleCount);
+    result.atvr =
+        (unique == 0) ? 0.0f : static_cast<float>(transforms) / static_cast<float>(unique);
+    return result;
+}
+
+/// @brief
+///   Reorder triangles for post-transform vertex cache efficiency with the Tipsify algorithm from
+///   "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" by Sander et al. The set
+///   of triangles and the vertex order of each triangle are kept, so winding does not change.
+/// @note
+///   Tipsify runs in linear time. It fans around the most recently used vertex, and jumps to a
+///   vertex that is still in the cache or was recently referenced when the fan is exhausted.
+///
+/// @param[inout] indices
+///   Index buffer of a triangle list to be reordered in place.
+/// @param indexCount
+///   Number of indices. Must be a multiple of 3.
+/// @param vertexCount
+///   Number of vertices. All indices must be less than @p vertexCount.
+/// @param cacheSize
+///   Number of entries of the target vertex cache.
+///
+/// @throw std::bad_alloc
+///   Thrown if failed to allocate memory.
+inline auto optimizeVertexCache(std::uint32_t *indices,
+                                std::size_t    indexCount,
+                                std::size_t    vertexCount,
+                                std::size_t    cacheSize = DefaultVertexCacheSize) -> void {
+    const std::size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0)
+        return;
+
+    // Triangles adjacent to each vertex: triangles of vertex v are
+    // `adjacency[offsets[v], offsets[v + 1])`.
+    std::vector<std::uint32_t> offsets(vertexCount + 1, 0);
+    for (std::size_t i = 0; i < triangleCount * 3; ++i)
+        ++offsets[indices[i] + 1];
+    for (std::size_t v = 0; v < vertexCount; ++v)
+        offsets[v + 1] += offsets[v];
+
+    std::vector<std::uint32_t> adjacency(triangleCount * 3);
+    {
+        std::vector<std::uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+        for (std::size_t i = 0; i < triangleCount * 3; ++i)
+            adjacency[cursors[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+    }
+
+    // Number of triangles that are not emitted yet for each vertex.
+    std::vector<std::uint32_t> liveCounts(vertexCount);
+    for (std::size_t v = 0; v < vertexCount; ++v)
+        liveCounts[v] = offsets[v + 1] - offsets[v];
+
+    detail::VertexCacheSimulator cache(vertexCount, cacheSize);
+    std::vector<std::uint8_t>    emitted(triangleCount, 0);
+    std::vector<std::uint32_t>   deadEnds;
+    std::vector<std::uint32_t>   candidates;
+    std::vector<std::uint32_t>   result;
+
+    deadEnds.reserve(indexCount);
+    result.reserve(indexCount);
+
+    constexpr auto None = std::uint32_t(-1);
+
+    // Next vertex to scan when both the candidates and the dead-end stack are exhausted.
+    std::uint32_t scanCursor = 0;
+    std::uint32_t fanning    = None;
+
+    // Find the first vertex that still has live triangles.
+    const auto skipDeadEnd = [&]() -> std::uint32_t {
+        while (!deadEnds.empty()) {
+            const std::uint32_t vertex = deadEnds.back();
+            deadEnds.pop_back();
+            if (liveCounts[vertex] > 0)
+                return vertex;
+        }
+
+        for (; scanCursor < vertexCount; ++scanCursor) {
+            if (liveCounts[scanCursor] > 0)
+                return scanCursor;
+        }
+
+        return None;
+    };
+
+    fanning = skipDeadEnd();
+    while (fanning != None) {
+        candidates.clear();
+
+        // Emit all live triangles around the fanning vertex.
+        for (std::uint32_t i = offsets[fanning]; i < offsets[fanning + 1]; ++i) {
+            const std::uint32_t triangle = adjacency[i];
+            if (emitted[triangle] != 0)
+                continue;
+
+            for (std::size_t k = 0; k < 3; ++k) {
+                const std::uint32_t vertex = indices[triangle * 3 + k];
+                result.push_back(vertex);
+                deadEnds.push_back(vertex);
+                candidates.push_back(vertex);
+                --liveCounts[vertex];
+                cache.access(vertex);
+            }
+
+            emitted[triangle] = 1;
+        }
+
+        // Prefer the oldest candidate that will still be in the cache after its remaining
+        // triangles are emitted, since it is going to be evicted soonest.
+        std::uint32_t next     = None;
+        std::size_t   priority = 0;
+        for (const std::uint32_t vertex : candidates) {
+            if (liveCounts[vertex] == 0)
+                continue;
+
+            std::size_t p = 1;
+            if (cache.contains(vertex) && cache.age(vertex) + 2 * liveCounts[vertex] <= cacheSize)
+                p = cache.age(vertex) + 1;
+
+            if (p > priority) {
+                priority = p;
+                next     = vertex;
+            }
+        }
+
+        fanning = (next == None) ? skipDeadEnd() : next;
+    }
+
+    std::copy(result.begin(), result.end(), indices);
+}
+
+namespace detail {
+
+/// @brief
+///   Split hard clusters of an index buffer into soft clusters for overdraw optimization. A new
+///   cluster starts with an empty cache, which is acceptable as long as ACMR of the cluster so far
+///   is close to ACMR of the whole hard cluster.
+///
+/// @return
+///   Index of the first triangle of each soft cluster, followed by the number of triangles.
+[[nodiscard]] inline auto splitOverdrawClusters(const std::uint32_t              *indices,
+                                                std::size_t                       vertexCount,
+                                                const std::vector<std::uint32_t> &hardClusters,
+                                                const std::vector<std::uint32_t> &misses,
+                                                float                             threshold,
+                                                std::size_t                       cacheSize)
+    -> std::vector<std::uint32_t> {
+    const std::size_t triangleCount = misses.size();
+
+    std::vector<std::uint32_t>   clusters;
+    detail::VertexCacheSimulator cache(vertexCount, cacheSize);
+    for (std::size_t c = 0; c < hardClusters.size(); ++c) {
+        const std::size_t first = hardClusters[c];
+        const std::size_t last =
+            (c + 1 < hardClusters.size()) ? hardClusters[c + 1] : triangleCount;
+
+        std::size_t hardMisses = 0;
+        for (std::size_t t = first; t < last; ++t)
+            hardMisses += misses[t];
+        const float limit =
+            static_cast<float>(hardMisses) / static_cast<float>(last - first) * threshold;
+
+        cache.flush();
+        clusters.push_back(static_cast<std::uint32_t>(first));
+
+        std::size_t clusterFirst  = first;
+        std::size_t clusterMisses = 0;
+        for (std::size_t t = first; t < last; ++t) {
+            clusterMisses += cache.access(indices[t * 3]) + cache.access(indices[t * 3 + 1]) +
+                             cache.access(indices[t * 3 + 2]);
+
+            if (t + 1 < last && static_cast<float>(clusterMisses) <=
+                                    limit * static_cast<float>(t + 1 - clusterFirst)) {
+                cache.flush();
+                clusters.push_back(static_cast<std::uint32_t>(t + 1));
+                clusterFirst  = t + 1;
+                clusterMisses = 0;
+            }
+        }
+    }
+
+    clusters.push_back(static_cast<std::uint32_t>(triangleCount));
+    return clusters;
+}
+
+/// @brief
+///   Sort clusters of an index buffer so that clusters whose centroid is farther along their
+///   average normal from the mesh center come first.
+///
+/// @param[out] result
+///   Array to store the reordered index buffer. Must not overlap with @p indices.
+inline auto sortOverdrawClusters(const std::uint32_t              *indices,
+                                 const std::vector<std::uint32_t> &clusters,
+                                 const Vector3                    *positions,
+                                 std::size_t                       positionStride,
+                                 std::uint32_t                    *result) -> void {
+    const std::size_t clusterCount = clusters.size() - 1;
+
+    // Area weighted centroid and normal of each cluster.
+    std::vector<Vector3> centroids(clusterCount);
+    std::vector<Vector3> normals(clusterCount);
+    Vector3              meshCentroid;
+    float                meshArea = 0.0f;
+
+    for (std::size_t c = 0; c < clusterCount; ++c) {
+        Vector3 centroid;
+        Vector3 normal;
+        float   area = 0.0f;
+
+        for (std::size_t t = clusters[c]; t < clusters[c + 1]; ++t) {
+            const Vector3 p0 = loadPosition(positions, positionStride, indices[t * 3]);
+            const Vector3 p1 = loadPosition(positions, positionStride, indices[t * 3 + 1]);
+            const Vector3 p2 = loadPosition(positions, positionStride, indices[t * 3 + 2]);
+
+            const Vector3 n = cross(p1 - p0, p2 - p0);
+            const float   a = n.length();
+
+            centroid += (p0 + p1 + p2) * (a / 3.0f);
+            normal += n;
+            area += a;
+        }
+
+        meshCentroid += centroid;
+        meshArea += area;
+
+        centroids[c] = (area > 0.0f) ? centroid / area : centroid;
+        normals[c]   = normal;
+    }
+
+    if (meshArea > 0.0f)
+        meshCentroid /= meshArea;
+
+    std::vector<float> keys(clusterCount);
+    for (std::size_t c = 0; c < clusterCount; ++c) {
+        const float length = normals[c].length();
+        keys[c] = (length > 0.0f) ? dot(centroids[c] - meshCentroid, normals[c]) / length : 0.0f;
+    }
+
+    std::vector<std::uint32_t> order(clusterCount);
+    for (std::size_t c = 0; c < clusterCount; ++c)
+        order[c] = static_cast<std::uint32_t>(c);
+    std::stable_sort(order.begin(), order.end(),
+                     [&keys](std::uint32_t a, std::uint32_t b) { return keys[a] > keys[b]; });
+
+    for (const std::uint32_t c : order) {
+        result = std::copy(indices + std::size_t(clusters[c]) * 3,
+                           indices + std::size_t(clusters[c + 1]) * 3, result);
+    }
+}
+
+} // namespace detail
+
+/// @brief
+///   Reorder clusters of triangles to reduce overdraw, following the second part of Tipsify. The
+///   index buffer is split into clusters at points where the vertex cache efficiency is barely
+///   affected, and clusters that face away from the mesh center are drawn first since they are
+///   more likely to occlude the others. This should be called after @p optimizeVertexCache().
+/// @note
+///   This is a view independent heuristic. Overdraw depends on the view and is not measured here,
+///   so check the result with a GPU profiler for meshes where overdraw matters.
+/// @remark
+///   Each cluster starts with an empty vertex cache, so the clusters are split less aggressively
+///   until ACMR of the result is within @p threshold. The original order is kept if it never is.
+///
+/// @param[inout] indices
+///   Index buffer of a triangle list to be reordered in place.
+/// @param indexCount
+///   Number of indices. Must be a multiple of 3.
+/// @param positions
+///   Pointer to the first vertex position.
+/// @param vertexCount
+///   Number of vertices. All indices must be less than @p vertexCount.
+/// @param positionStride
+///   Number of bytes between 2 consecutive vertex positions.
+/// @param threshold
+///   Maximum ratio of ACMR of the result to ACMR of the original order. Larger values allow more
+///   clusters and therefore better overdraw.
+/// @param cacheSize
+///   Number of entries of the target vertex cache.
+///
+/// @throw std::bad_alloc
+///   Thrown if failed to allocate memory.
+inline auto optimizeOverdraw(std::uint32_t *indices,
+                             std::size_t    indexCount,
+                             const Vector3 *positions,
+                             std::size_t    vertexCount,
+                             std::size_t    positionStride = sizeof(Vector3),
+                             float          threshold      = 1.05f,
+                             std::size_t    cacheSize      = DefaultVertexCacheSize) -> void {
+    const std::size_t triangleCount = indexCount / 3;
+    if (triangleCount < 2)
+        return;
+
+    // Hard boundaries are where all vertices of a triangle miss the cache. Vertex cache
+    // optimization jumps there, so the order of the clusters barely matters for the cache.
+    std::vector<std::uint32_t> hardClusters;
+    std::vector<std::uint32_t> misses(triangleCount);
+    std::size_t                transforms = 0;
+    {
+        detail::VertexCacheSimulator cache(vertexCount, cacheSize);
+        for (std::size_t t = 0; t < triangleCount; ++t) {
+            misses[t] = cache.access(indices[t * 3]) + cache.access(indices[t * 3 + 1]) +
+                        cache.access(indices[t * 3 + 2]);
+            transforms += misses[t];
+            if (t == 0 || misses[t] == 3)
+                hardClusters.push_back(static_cast<std::uint32_t>(t));
+        }
+    }
+
+    constexpr int MaxAttempts = 4;
+
+    std::vector<std::uint32_t> result(triangleCount * 3);
+    float                      clusterThreshold = threshold;
+    for (int attempt = 0; attempt < MaxAttempts; ++attempt) {
+        const std::vector<std::uint32_t> clusters = detail::splitOverdrawClusters(
+            indices, vertexCount, hardClusters, misses, clusterThreshold, cacheSize);
+        if (clusters.size() < 3)
+            return;
+
+        detail::sortOverdrawClusters(indices, clusters, positions, positionStride, result.data());
+
+        const auto stats = analyzeVertexCache(result.data(), result.size(), vertexCount, cacheSize);
+        if (static_cast<float>(stats.vertexTransforms) <=
+            static_cast<float>(transforms) * threshold) {
+            std::copy(result.begin(), result.end(), indices);
+            return;
+        }
+
+        // Fewer soft clusters are closer to the original order.
+        clusterThreshold = 1.0f + (clusterThreshold - 1.0f) * 0.5f;
+    }
+}
+
+/// @brief
+///   Generate a vertex remap table that puts vertices in the order they are first referenced by
+///   the index buffer, so that vertex fetch reads memory sequentially. Vertices that are not
+///   referenced are moved after all referenced vertices in their original order. This should be
+///   called after triangles are reordered.
+///
+/// @param[in] indices
+///   Index buffer of a triangle list.
+/// @param indexCount
+///   Number of indices.
+/// @param vertexCount
+///   Number of vertices. All indices must be less than @p vertexCount.
+/// @param[out] remap
+///   Array of @p vertexCount elements to store the new index of each vertex. This is always a
+///   permutation, so vertex buffers keep their size.
+///
+/// @return
+///   Number of referenced vertices. Vertices at and after this index in the new order could be
+///   dropped if they are not used by other index buffers.
+inline auto optimizeVertexFetchRemap(const std::uint32_t *indices,
+                                     std::size_t          indexCount,
+                                     std::size_t          vertexCount,
+                                     std::uint32_t       *remap) noexcept -> std::size_t {
+    constexpr auto Unused = std::uint32_t(-1);
+    std::fill(remap, remap + vertexCount, Unused);
+
+    std::uint32_t next = 0;
+    for (std::size_t i = 0; i < indexCount; ++i) {
+        if (remap[indices[i]] == Unused)
+            remap[indices[i]] = next++;
+    }
+
+    const std::size_t referenced = next;
+    for (std::size_t v = 0; v < vertexCount; ++v) {
+        if (remap[v] == Unused)
+            remap[v] = next++;
+    }
+
+    return referenced;
+}
+
+/// @brief
+///   Apply a vertex remap table to an index buffer.
+///
+/// @param[inout] indices
+///   Index buffer to be remapped in place.
+/// @param indexCount
+///   Number of indices.
+/// @param[in] remap
+///   Vertex remap table generated by @p optimizeVertexFetchRemap().
+inline auto remapIndices(std::uint32_t       *indices,
+                         std::size_t          indexCount,
+                         const std::uint32_t *remap) noexcept -> void {
+    for (std::size_t i = 0; i < indexCount; ++i)
+        indices[i] = remap[indices[i]];
+}
+
+/// @brief
+///   Apply a vertex remap table to a vertex attribute stream. Each attribute stream of a mesh
+///   should be remapped with the same table. Interleaved streams are supported since only
+///   @p elementSize bytes of each vertex are moved.
+///
+/// @param[inout] vertices
+///   Pointer to the first element of the attribute stream to be remapped in place.
+/// @param vertexCount
+///   Number of vertices.
+/// @param elementSize
+///   Size in bytes of the attribute of each vertex.
+/// @param stride
+///   Number of bytes between 2 consecutive attributes. Must be at least @p elementSize.
+/// @param[in] remap
+///   Vertex remap table generated by @p optimizeVertexFetchRemap().
+///
+/// @throw std::bad_alloc
+///   Thrown if failed to allocate memory.
+inline auto remapVertices(void                *vertices,
+                          std::size_t          vertexCount,
+                          std::size_t          elementSize,
+                          std::size_t          stride,
+                          const std::uint32_t *remap) -> void {
+    auto *data = static_cast<std::uint8_t *>(vertices);
+
+    std::vector<std::uint8_t> copy(vertexCount * elementSize);
+    for (std::size_t v = 0; v < vertexCount; ++v)
+        std::memcpy(copy.data() + v * elementSize, data + v * stride, elementSize);
+
+    for (std::size_t v = 0; v < vertexCount; ++v)
+        std::memcpy(data + std::size_t(remap[v]) * stride, copy.data() + v * elementSize,
+                    elementSize);
+}
+
+/// @brief
+///   Run all mesh optimizations on an indexed triangle mesh: vertex cache, overdraw and vertex
+///   fetch. This could be called when loading a mesh or as an offline cook step.
+/// @note
+///   Meshes exported by some tools are already optimized with a different algorithm. The original
+///   triangle order is kept if reordering makes the vertex cache efficiency worse.
+///
+/// @param[inout] indices
+///   Index buffer of a triangle list to be optimized in place.
+/// @param indexCount
+///   Number of indices. Must be a multiple of 3.
+/// @param positions
+///   Pointer to the first vertex position. Used for overdraw optimization only.
+/// @param vertexCount
+///   Number of vertices. All indices must be less than @p vertexCount.
+/// @param positionStride
+///   Number of bytes between 2 consecutive vertex positions.
+/// @param[out] remap
+///   Array of @p vertexCount elements to store the vertex remap table. Apply it to every vertex
+///   attribute stream with @p remapVertices(). The index buffer is already remapped.
+///
+/// @return
+///   Number of referenced vertices.
+/// @throw std::bad_alloc
+///   Thrown if failed to allocate memory.
+inline auto optimizeMesh(std::uint32_t *indices,
+                         std::size_t    indexCount,
+                         const Vector3 *positions,
+                         std::size_t    vertexCount,
+                         std::size_t    positionStride,
+                         std::uint32_t *remap) -> std::size_t {
+    const std::vector<std::uint32_t> original(indices, indices + indexCount);
+    const auto before = analyzeVertexCache(indices, indexCount, vertexCount).vertexTransforms;
+
+    optimizeVertexCache(indices, indexCount, vertexCount);
+    optimizeOverdraw(indices, indexCount, positions, vertexCount, positionStride);
+
+    if (analyzeVertexCache(indices, indexCount, vertexCount).vertexTransforms > before)
+        std::copy(original.begin(), original.end(), indices);
+
+    const auto referenced = optimizeVertexFetchRemap(indices, indexCount, vertexCount, remap);
+    remapIndices(indices, indexCount, remap);
+    return referenced;
+}
+
+} // namespace ink
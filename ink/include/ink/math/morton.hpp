@@ -0,0 +1,449 @@
+#pragma once
+
+#include "batch.hpp"
+#include "bounds.hpp"
+
+#include <cstdint>
+
+#if !defined(INK_NO_SIMD) && defined(INK_IS_CONSTANT_EVALUATED)
+#    if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#        define INK_BMI2 1
+#        include <immintrin.h>
+#    endif
+#endif
+
+namespace ink {
+namespace detail {
+
+/// @brief
+///   Insert a 0 bit after each of the lower 16 bits.
+[[nodiscard]] constexpr auto spreadBits2(std::uint32_t x) noexcept -> std::uint32_t {
+    x &= 0x0000FFFFU;
+    x = (x | (x << 8)) & 0x00FF00FFU;
+    x = (x | (x << 4)) & 0x0F0F0F0FU;
+    x = (x | (x << 2)) & 0x33333333U;
+    x = (x | (x << 1)) & 0x55555555U;
+    return x;
+}
+
+/// @brief
+///   Remove every odd bit. This is the inverse of @p spreadBits2().
+[[nodiscard]] constexpr auto compactBits2(std::uint32_t x) noexcept -> std::uint32_t {
+    x &= 0x55555555U;
+    x = (x ^ (x >> 1)) & 0x33333333U;
+    x = (x ^ (x >> 2)) & 0x0F0F0F0FU;
+    x = (x ^ (x >> 4)) & 0x00FF00FFU;
+    x = (x ^ (x >> 8)) & 0x0000FFFFU;
+    return x;
+}
+
+/// @brief
+///   Insert 2 0 bits after each of the lower 10 bits.
+[[nodiscard]] constexpr auto spreadBits3(std::uint32_t x) noexcept -> std::uint32_t {
+    x &= 0x000003FFU;
+    x = (x | (x << 16)) & 0x030000FFU;
+    x = (x | (x << 8)) & 0x0300F00FU;
+    x = (x | (x << 4)) & 0x030C30C3U;
+    x = (x | (x << 2)) & 0x09249249U;
+    return x;
+}
+
+/// @brief
+///   Keep every third bit. This is the inverse of @p spreadBits3().
+[[nodiscard]] constexpr auto compactBits3(std::uint32_t x) noexcept -> std::uint32_t {
+    x &= 0x09249249U;
+    x = (x ^ (x >> 2)) & 0x030C30C3U;
+    x = (x ^ (x >> 4)) & 0x0300F00FU;
+    x = (x ^ (x >> 8)) & 0xFF0000FFU;
+    x = (x ^ (x >> 16)) & 0x000003FFU;
+    return x;
+}
+
+/// @brief
+///   Insert 2 0 bits after each of the lower 21 bits.
+[[nodiscard]] constexpr auto spreadBits3(std::uint64_t x) noexcept -> std::uint64_t {
+    x &= 0x00000000001FFFFFULL;
+    x = (x | (x << 32)) & 0x001F00000000FFFFULL;
+    x = (x | (x << 16)) & 0x001F0000FF0000FFULL;
+    x = (x | (x << 8)) & 0x100F00F00F00F00FULL;
+    x = (x | (x << 4)) & 0x10C30C30C30C30C3ULL;
+    x = (x | (x << 2)) & 0x1249249249249249ULL;
+    return x;
+}
+
+/// @brief
+///   Keep every third bit. This is the inverse of @p spreadBits3().
+[[nodiscard]] constexpr auto compactBits3(std::uint64_t x) noexcept -> std::uint64_t {
+    x &= 0x1249249249249249ULL;
+    x = (x ^ (x >> 2)) & 0x10C30C30C30C30C3ULL;
+    x = (x ^ (x >> 4)) & 0x100F00F00F00F00FULL;
+    x = (x ^ (x >> 8)) & 0x001F0000FF0000FFULL;
+    x = (x ^ (x >> 16)) & 0x001F00000000FFFFULL;
+    x = (x ^ (x >> 32)) & 0x00000000001FFFFFULL;
+    return x;
+}
+
+} // namespace detail
+
+/// @brief
+///   Interleave bits of 2 coordinates into a 32-bit Morton code. Bits of @p x are stored in even
+///   bits.
+/// @note
+///   BMI2 `pdep` instruction is used if available. `pdep` is slow on AMD processors before Zen 3,
+///   do not enable BMI2 when targeting these processors.
+///
+/// @param x
+///   The first coordinate. Only the lower 16 bits are used.
+/// @param y
+///   The second coordinate. Only the lower 16 bits are used.
+///
+/// @return
+///   The Morton code of the specified coordinates.
+[[nodiscard]] constexpr auto encodeMorton2(std::uint32_t x, std::uint32_t y) noexcept
+    -> std::uint32_t {
+#if defined(INK_BMI2)
+    if (!INK_IS_CONSTANT_EVALUATED())
+        return _pdep_u32(x, 0x55555555U) | _pdep_u32(y, 0xAAAAAAAAU);
+#endif
+    return detail::spreadBits2(x) | (detail::spreadBits2(y) << 1);
+}
+
+/// @brief
+///   Extract coordinates from a 32-bit 2D Morton code. This is the inverse of
+///   @p encodeMorton2().
+///
+/// @param code
+///   The Morton code to be decoded.
+/// @param[out] x
+///   Returns the first coordinate.
+/// @param[out] y
+///   Returns the second coordinate.
+constexpr auto decodeMorton2(std::uint32_t code, std::uint32_t &x, std::uint32_t &y) noexcept
+    -> void {
+#if defined(INK_BMI2)
+    if (!INK_IS_CONSTANT_EVALUATED()) {
+        x = _pext_u32(code, 0x55555555U);
+        y = _pext_u32(code, 0xAAAAAAAAU);
+        return;
+    }
+#endif
+    x = detail::compactBits2(code);
+    y = detail::compactBits2(code >> 1);
+}
+
+/// @brief
+///   Interleave bits of 3 coordinates into a 30-bit Morton code. Bits of @p x are stored in bits
+///   whose index is a multiple of 3.
+/// @note
+///   BMI2 `pdep` instruction is used if available. See @p encodeMorton2() for details.
+///
+/// @param x
+///   The first coordinate. Only the lower 10 bits are used.
+/// @param y
+///   The second coordinate. Only the lower 10 bits are used.
+/// @param z
+///   The third coordinate. Only the lower 10 bits are used.
+///
+/// @return
+///   The Morton code of the specified coordinates.
+[[nodiscard]] constexpr auto
+encodeMorton3(std::uint32_t x, std::uint32_t y, std::uint32_t z) noexcept -> std::uint32_t {
+#if defined(INK_BMI2)
+    if (!INK_IS_CONSTANT_EVALUATED())
+        return _pdep_u32(x, 0x09249249U) | _pdep_u32(y, 0x12492492U) | _pdep_u32(z, 0x24924924U);
+#endif
+    return detail::spreadBits3(x) | (detail::spreadBits3(y) << 1) | (detail::spreadBits3(z) << 2);
+}
+
+/// @brief
+///   Extract coordinates from a 30-bit 3D Morton code. This is the inverse of
+///   @p encodeMorton3().
+///
+/// @param code
+///   The Morton code to be decoded.
+/// @param[out] x
+///   Returns the first coordinate.
+/// @param[out] y
+///   Returns the second coordinate.
+/// @param[out] z
+///   Returns the third coordinate.
+constexpr auto decodeMorton3(std::uint32_t  code,
+                             std::uint32_t &x,
+                             std::uint32_t &y,
+                             std::uint32_t &z) noexcept -> void {
+#if defined(INK_BMI2)
+    if (!INK_IS_CONSTANT_EVALUATED()) {
+        x = _pext_u32(code, 0x09249249U);
+        y = _pext_u32(code, 0x12492492U);
+        z = _pext_u32(code, 0x24924924U);
+        return;
+    }
+#endif
+    x = detail::compactBits3(code);
+    y = detail::compactBits3(code >> 1);
+    z = detail::compactBits3(code >> 2);
+}
+
+/// @brief
+///   Interleave bits of 3 coordinates into a 63-bit Morton code. Bits of @p x are stored in bits
+///   whose index is a multiple of 3.
+/// @note
+///   BMI2 `pdep` instruction is used on 64-bit platforms if available. See @p encodeMorton2() for
+///   details.
+///
+/// @param x
+///   The first coordinate. Only the lower 21 bits are used.
+/// @param y
+///   The second coordinate. Only the lower 21 bits are used.
+/// @param z
+///   The third coordinate. Only the lower 21 bits are used.
+///
+/// @return
+///   The Morton code of the specified coordinates.
+[[nodiscard]] constexpr auto
+encodeMorton64(std::uint64_t x, std::uint64_t y, std::uint64_t z) noexcept -> std::uint64_t {
+#if defined(INK_BMI2) && (defined(__x86_64__) || defined(_M_X64))
+    if (!INK_IS_CONSTANT_EVALUATED()) {
+        return _pdep_u64(x, 0x1249249249249249ULL) | _pdep_u64(y, 0x2492492492492492ULL) |
+               _pdep_u64(z, 0x4924924924924924ULL);
+    }
+#endif
+    return detail::spreadBits3(x) | (detail::spreadBits3(y) << 1) | (detail::spreadBits3(z) << 2);
+}
+
+/// @brief
+///   Extract coordinates from a 63-bit 3D Morton code. This is the inverse of
+///   @p encodeMorton64().
+///
+/// @param code
+///   The Morton code to be decoded.
+/// @param[out] x
+///   Returns the first coordinate.
+/// @param[out] y
+///   Returns the second coordinate.
+/// @param[out] z
+///   Returns the third coordinate.
+constexpr auto decodeMorton64(std::uint64_t  code,
+                              std::uint64_t &x,
+                              std::uint64_t &y,
+                              std::uint64_t &z) noexcept -> void {
+#if defined(INK_BMI2) && (defined(__x86_64__) || defined(_M_X64))
+    if (!INK_IS_CONSTANT_EVALUATED()) {
+        x = _pext_u64(code, 0x1249249249249249ULL);
+        y = _pext_u64(code, 0x2492492492492492ULL);
+        z = _pext_u64(code, 0x4924924924924924ULL);
+        return;
+    }
+#endif
+    x = detail::compactBits3(code);
+    y = detail::compactBits3(code >> 1);
+    z = detail::compactBits3(code >> 2);
+}
+
+namespace detail {
+
+/// @brief
+///   Number of cells along each axis of the grid used by @p encodeMorton3() for points.
+inline constexpr float MortonGridSize = 1024.0f;
+
+/// @brief
+///   Calculate scale that maps @p bounds to the Morton grid. Degenerated axes are mapped to 0.
+[[nodiscard]] inline auto mortonScale(const AABB &bounds) noexcept -> Vector3 {
+    const Vector3 extent = bounds.max - bounds.min;
+    return {
+        extent.x > 0 ? MortonGridSize / extent.x : 0.0f,
+        extent.y > 0 ? MortonGridSize / extent.y : 0.0f,
+        extent.z > 0 ? MortonGridSize / extent.z : 0.0f,
+    };
+}
+
+/// @brief
+///   Quantize a coordinate to the Morton grid. NaN is mapped to 0.
+[[nodiscard]] inline auto quantizeMorton(float value, float min, float scale) noexcept
+    -> std::uint32_t {
+    const float q = (value - min) * scale;
+    if (!(q > 0.0f))
+        return 0;
+    return q < MortonGridSize - 1.0f ? static_cast<std::uint32_t>(q) : 1023U;
+}
+
+#if defined(INK_SIMD_AVX2)
+using U32Lanes                            = __m256i;
+inline constexpr std::size_t U32LaneCount = 8;
+
+inline auto and32(__m256i a, __m256i b) noexcept -> __m256i { return _mm256_and_si256(a, b); }
+inline auto or32(__m256i a, __m256i b) noexcept -> __m256i { return _mm256_or_si256(a, b); }
+inline auto splat32(std::uint32_t a) noexcept -> __m256i {
+    return _mm256_set1_epi32(static_cast<int>(a));
+}
+
+template <int N>
+inline auto shl32(__m256i a) noexcept -> __m256i {
+    return _mm256_slli_epi32(a, N);
+}
+
+inline auto truncateU32(const float *p) noexcept -> __m256i {
+    return _mm256_cvttps_epi32(_mm256_loadu_ps(p));
+}
+
+inline auto storeU32(std::uint32_t *p, __m256i a) noexcept -> void {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), a);
+}
+#elif defined(INK_SIMD_SSE)
+using U32Lanes                            = __m128i;
+inline constexpr std::size_t U32LaneCount = 4;
+
+inline auto and32(__m128i a, __m128i b) noexcept -> __m128i { return _mm_and_si128(a, b); }
+inline auto or32(__m128i a, __m128i b) noexcept -> __m128i { return _mm_or_si128(a, b); }
+inline auto splat32(std::uint32_t a) noexcept -> __m128i {
+    return _mm_set1_epi32(static_cast<int>(a));
+}
+
+template <int N>
+inline auto shl32(__m128i a) noexcept -> __m128i {
+    return _mm_slli_epi32(a, N);
+}
+
+inline auto truncateU32(const float *p) noexcept -> __m128i {
+    return _mm_cvttps_epi32(_mm_loadu_ps(p));
+}
+
+inline auto storeU32(std::uint32_t *p, __m128i a) noexcept -> void {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), a);
+}
+#elif defined(INK_SIMD_NEON)
+using U32Lanes                            = uint32x4_t;
+inline constexpr std::size_t U32LaneCount = 4;
+
+inline auto and32(uint32x4_t a, uint32x4_t b) noexcept -> uint32x4_t { return vandq_u32(a, b); }
+inline auto or32(uint32x4_t a, uint32x4_t b) noexcept -> uint32x4_t { return vorrq_u32(a, b); }
+inline auto splat32(std::uint32_t a) noexcept -> uint32x4_t { return vdupq_n_u32(a); }
+
+template <int N>
+inline auto shl32(uint32x4_t a) noexcept -> uint32x4_t {
+    return vshlq_n_u32(a, N);
+}
+
+inline auto truncateU32(const float *p) noexcept -> uint32x4_t {
+    return vcvtq_u32_f32(vld1q_f32(p));
+}
+
+inline auto storeU32(std::uint32_t *p, uint32x4_t a) noexcept -> void { vst1q_u32(p, a); }
+#else
+using U32Lanes                            = std::uint32_t;
+inline constexpr std::size_t U32LaneCount = 1;
+
+inline auto and32(std::uint32_t a, std::uint32_t b) noexcept -> std::uint32_t { return a & b; }
+inline auto or32(std::uint32_t a, std::uint32_t b) noexcept -> std::uint32_t { return a | b; }
+inline auto splat32(std::uint32_t a) noexcept -> std::uint32_t { return a; }
+
+template <int N>
+inline auto shl32(std::uint32_t a) noexcept -> std::uint32_t {
+    return a << N;
+}
+
+inline auto truncateU32(const float *p) noexcept -> std::uint32_t {
+    return static_cast<std::uint32_t>(*p);
+}
+
+inline auto storeU32(std::uint32_t *p, std::uint32_t a) noexcept -> void { *p = a; }
+#endif
+
+/// @brief
+///   Lane-wise version of @p spreadBits3().
+inline auto spreadBits3Lanes(U32Lanes x) noexcept -> U32Lanes {
+    x = and32(or32(x, shl32<16>(x)), splat32(0x030000FFU));
+    x = and32(or32(x, shl32<8>(x)), splat32(0x0300F00FU));
+    x = and32(or32(x, shl32<4>(x)), splat32(0x030C30C3U));
+    x = and32(or32(x, shl32<2>(x)), splat32(0x09249249U));
+    return x;
+}
+
+/// @brief
+///   Calculate Morton codes of points in [first, last).
+inline auto encodeMorton3Range(const Vector3 *points,
+                               const AABB    &bounds,
+                               std::uint32_t *codes,
+                               std::size_t    first,
+                               std::size_t    last) noexcept -> void {
+    const Vector3   scale = mortonScale(bounds);
+    const Vector3x8 min(bounds.min);
+    const Vector3x8 factor(scale);
+    const Float8    zero(0.0f);
+    const Float8    ceil(MortonGridSize - 1.0f);
+
+    for (std::size_t i = first; i < last; i += 8) {
+        const std::size_t count = std::min<std::size_t>(8, last - i);
+
+        // Values are clamped before truncation. Comparisons with NaN are false, so NaN is
+        // mapped to 0 as in the scalar version.
+        const Vector3x8 q = (Vector3x8(points + i, count) - min) * factor;
+        const Vector3x8 clamped(ink::min(select(q.x > zero, q.x, zero), ceil),
+                                ink::min(select(q.y > zero, q.y, zero), ceil),
+                                ink::min(select(q.z > zero, q.z, zero), ceil));
+
+        alignas(32) float         x[8];
+        alignas(32) float         y[8];
+        alignas(32) float         z[8];
+        alignas(32) std::uint32_t result[8];
+        clamped.x.store(x);
+        clamped.y.store(y);
+        clamped.z.store(z);
+
+        for (std::size_t j = 0; j < 8; j += U32LaneCount) {
+            const U32Lanes sx = spreadBits3Lanes(truncateU32(x + j));
+            const U32Lanes sy = spreadBits3Lanes(truncateU32(y + j));
+            const U32Lanes sz = spreadBits3Lanes(truncateU32(z + j));
+            storeU32(result + j, or32(or32(sx, shl32<1>(sy)), shl32<2>(sz)));
+        }
+
+        std::copy(result, result + count, codes + i);
+    }
+}
+
+} // namespace detail
+
+/// @brief
+///   Calculate 30-bit Morton code of a point. The point is quantized to a 1024x1024x1024 grid that
+///   covers @p bounds. Points outside of @p bounds are clamped to the grid.
+///
+/// @param point
+///   The point to calculate Morton code of.
+/// @param bounds
+///   Bounding box of all points to be encoded.
+///
+/// @return
+///   The Morton code of @p point.
+[[nodiscard]] inline auto encodeMorton3(Vector3 point, const AABB &bounds) noexcept
+    -> std::uint32_t {
+    const Vector3 scale = detail::mortonScale(bounds);
+    return encodeMorton3(detail::quantizeMorton(point.x, bounds.min.x, scale.x),
+                         detail::quantizeMorton(point.y, bounds.min.y, scale.y),
+                         detail::quantizeMorton(point.z, bounds.min.z, scale.z));
+}
+
+/// @brief
+///   Calculate 30-bit Morton codes of points. This is the same as calling
+///   @p encodeMorton3(Vector3, const AABB &) on each point.
+/// @note
+///   Points are quantized and encoded with SIMD instructions. Large arrays are split across
+///   threads. Sort points by the codes with @p radixSort() to improve spatial locality.
+///
+/// @param[in] points
+///   Pointer to the points to calculate Morton codes of.
+/// @param bounds
+///   Bounding box of all points. Usually this is the union of @p points.
+/// @param[out] codes
+///   Pointer to the array to store the Morton codes.
+/// @param count
+///   Number of points.
+inline auto encodeMorton3(const Vector3 *points,
+                          const AABB    &bounds,
+                          std::uint32_t *codes,
+                          std::size_t    count) noexcept -> void {
+    detail::parallelBatch(count, [&](std::size_t first, std::size_t last) {
+        detail::encodeMorton3Range(points, bounds, codes, first, last);
+    });
+}
+
+} // namespace ink
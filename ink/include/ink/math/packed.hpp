@@ -0,0 +1,635 @@
+#pragma once
+
+#include "wide.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+// Half precision conversion instructions. All AVX2 capable CPUs support F16C, and MSVC does not
+// define __F16C__ even if /arch:AVX2 is specified.
+#if defined(INK_SIMD_SSE) && (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#    define INK_SIMD_F16C 1
+#endif
+
+namespace ink {
+namespace detail {
+
+/// @brief
+///   Convert a single precision floating point value to half precision bits. Values are rounded to
+///   the nearest even value, which is the same as F16C and NEON conversion instructions.
+[[nodiscard]] inline auto floatToHalfBits(float value) noexcept -> std::uint16_t {
+    std::uint32_t f;
+    std::memcpy(&f, &value, sizeof(f));
+
+    const auto sign = static_cast<std::uint32_t>((f >> 16) & 0x8000U);
+    f &= 0x7FFFFFFFU;
+
+    std::uint32_t h;
+    if (f >= 0x7F800000U) {
+        // Infinity or NaN. NaN is always converted to quiet NaN.
+        h = 0x7C00U | (f > 0x7F800000U ? (0x0200U | ((f >> 13) & 0x03FFU)) : 0U);
+    } else if (f >= 0x477FF000U) {
+        // Overflow after rounding.
+        h = 0x7C00U;
+    } else if (f >= 0x38800000U) {
+        // Normal half. Carry of rounding goes to exponent naturally.
+        h                       = (f - 0x38000000U) >> 13;
+        const std::uint32_t rem = f & 0x1FFFU;
+        h += (rem > 0x1000U || (rem == 0x1000U && (h & 1U) != 0)) ? 1U : 0U;
+    } else if (f >= 0x33000000U) {
+        // Denormal half.
+        const std::uint32_t shift = 126U - (f >> 23);
+        const std::uint32_t m     = (f & 0x007FFFFFU) | 0x00800000U;
+        const std::uint32_t mid   = 1U << (shift - 1);
+        const std::uint32_t rem   = m & ((1U << shift) - 1);
+
+        h = m >> shift;
+        h += (rem > mid || (rem == mid && (h & 1U) != 0)) ? 1U : 0U;
+    } else {
+        // Underflow to zero.
+        h = 0;
+    }
+
+    return static_cast<std::uint16_t>(sign | h);
+}
+
+/// @brief
+///   Convert half precision bits to a single precision floating point value. The conversion is
+///   exact.
+[[nodiscard]] inline auto halfBitsToFloat(std::uint16_t bits) noexcept -> float {
+    const std::uint32_t sign     = static_cast<std::uint32_t>(bits & 0x8000U) << 16;
+    const std::uint32_t exponent = (bits >> 10) & 0x1FU;
+    const std::uint32_t mantissa = bits & 0x03FFU;
+
+    std::uint32_t f;
+    if (exponent == 0) {
+        // Zero or denormal. Denormal values are exactly representable as float.
+        const float value = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+        std::memcpy(&f, &value, sizeof(f));
+        f |= sign;
+    } else if (exponent == 0x1FU) {
+        // Infinity or NaN. Signaling NaN is quieted, which is the same as F16C.
+        f = sign | 0x7F800000U | (mantissa << 13) | (mantissa != 0 ? 0x00400000U : 0U);
+    } else {
+        f = sign | ((exponent + 112U) << 23) | (mantissa << 13);
+    }
+
+    float value;
+    std::memcpy(&value, &f, sizeof(value));
+    return value;
+}
+
+/// @brief
+///   Round the specified value to the nearest integer. Ties are rounded to even, which is the same
+///   as SIMD conversion instructions.
+[[nodiscard]] inline auto roundToInt(float value) noexcept -> std::int32_t {
+    return static_cast<std::int32_t>(std::nearbyint(value));
+}
+
+/// @brief
+///   Clamp the specified value to [@p low, @p high]. NaN is mapped to 0, which is the same as D3D
+///   normalized integer conversion rules. @p std::clamp() passes NaN through.
+[[nodiscard]] inline auto clampNormalized(float value, float low, float high) noexcept -> float {
+    if (value != value)
+        return 0.0f;
+    return std::clamp(value, low, high);
+}
+
+} // namespace detail
+
+/// @brief
+///   IEEE 754 half precision floating point value. This is the same as `DXGI_FORMAT_R16_FLOAT` and
+///   HLSL `half`/`min16float` storage.
+struct Half {
+    std::uint16_t bits;
+
+    /// @brief
+    ///   Create a zero half value.
+    constexpr Half() noexcept : bits() {}
+
+    /// @brief
+    ///   Convert a floating point value to half. The value is rounded to the nearest even value.
+    ///
+    /// @param value
+    ///   The floating point value to be converted.
+    explicit Half(float value) noexcept : bits(detail::floatToHalfBits(value)) {}
+
+    /// @brief
+    ///   Create a half value from raw bits.
+    ///
+    /// @param bits
+    ///   Raw bits of the half value.
+    ///
+    /// @return
+    ///   The half value.
+    [[nodiscard]] static constexpr auto fromBits(std::uint16_t bits) noexcept -> Half {
+        Half result;
+        result.bits = bits;
+        return result;
+    }
+
+    /// @brief
+    ///   Convert this half value to single precision floating point value. The conversion is exact.
+    [[nodiscard]] auto toFloat() const noexcept -> float { return detail::halfBitsToFloat(bits); }
+};
+
+constexpr auto operator==(Half lhs, Half rhs) noexcept -> bool { return lhs.bits == rhs.bits; }
+constexpr auto operator!=(Half lhs, Half rhs) noexcept -> bool { return lhs.bits != rhs.bits; }
+
+/// @brief
+///   2 half precision floating point values. This is the same as `DXGI_FORMAT_R16G16_FLOAT`.
+struct alignas(4) Half2 {
+    Half x;
+    Half y;
+
+    /// @brief
+    ///   Create a zero vector.
+    constexpr Half2() noexcept = default;
+
+    /// @brief
+    ///   Convert a 2D vector to half precision.
+    ///
+    /// @param vec
+    ///   The vector to be converted.
+    explicit Half2(Vector2 vec) noexcept : x(vec.x), y(vec.y) {}
+
+    /// @brief
+    ///   Convert this value to 2D vector.
+    [[nodiscard]] auto toVector2() const noexcept -> Vector2 { return {x.toFloat(), y.toFloat()}; }
+};
+
+/// @brief
+///   4 half precision floating point values. This is the same as `DXGI_FORMAT_R16G16B16A16_FLOAT`.
+struct alignas(8) Half4 {
+    Half x;
+    Half y;
+    Half z;
+    Half w;
+
+    /// @brief
+    ///   Create a zero vector.
+    constexpr Half4() noexcept = default;
+
+    /// @brief
+    ///   Convert a 4D vector to half precision.
+    ///
+    /// @param vec
+    ///   The vector to be converted.
+    explicit Half4(Vector4 vec) noexcept : x(vec.x), y(vec.y), z(vec.z), w(vec.w) {}
+
+    /// @brief
+    ///   Convert this value to 4D vector.
+    [[nodiscard]] auto toVector4() const noexcept -> Vector4 {
+        return {x.toFloat(), y.toFloat(), z.toFloat(), w.toFloat()};
+    }
+};
+
+/// @brief
+///   4 signed normalized 8-bit integers. This is the same as `DXGI_FORMAT_R8G8B8A8_SNORM`. @p x
+///   is stored in the lowest byte.
+struct SNorm8x4 {
+    std::uint32_t bits;
+
+    /// @brief
+    ///   Create a zero vector.
+    constexpr SNorm8x4() noexcept : bits() {}
+
+    /// @brief
+    ///   Pack a 4D vector. Elements are clamped to [-1, 1] and rounded to the nearest value.
+    ///   NaN elements are packed as 0.
+    ///
+    /// @param vec
+    ///   The vector to be packed.
+    explicit SNorm8x4(Vector4 vec) noexcept : bits() {
+        for (std::size_t i = 0; i < 4; ++i) {
+            const float         v = detail::clampNormalized(vec[i], -1.0f, 1.0f) * 127.0f;
+            const std::uint32_t b = static_cast<std::uint8_t>(detail::roundToInt(v));
+            bits |= b << (i * 8);
+        }
+    }
+
+    /// @brief
+    ///   Unpack this value to 4D vector.
+    [[nodiscard]] auto toVector4() const noexcept -> Vector4 {
+        Vector4 result;
+        for (std::size_t i = 0; i < 4; ++i) {
+            const auto b = static_cast<std::int8_t>((bits >> (i * 8)) & 0xFFU);
+            result[i]    = std::max(static_cast<float>(b) / 127.0f, -1.0f);
+        }
+        return result;
+    }
+};
+
+/// @brief
+///   4 unsigned normalized 8-bit integers. This is the same as `DXGI_FORMAT_R8G8B8A8_UNORM` and
+///   `DXGI_FORMAT_R8G8B8A8_UNORM_SRGB`. @p x is stored in the lowest byte.
+struct UNorm8x4 {
+    std::uint32_t bits;
+
+    /// @brief
+    ///   Create a zero vector.
+    constexpr UNorm8x4() noexcept : bits() {}
+
+    /// @brief
+    ///   Create a packed value from raw 8-bit integers.
+    ///
+    /// @param x
+    ///   The first element, which is usually red channel.
+    /// @param y
+    ///   The second element, which is usually green channel.
+    /// @param z
+    ///   The third element, which is usually blue channel.
+    /// @param w
+    ///   The fourth element, which is usually alpha channel.
+    constexpr UNorm8x4(std::uint8_t x, std::uint8_t y, std::uint8_t z, std::uint8_t w) noexcept
+        : bits(std::uint32_t(x) | (std::uint32_t(y) << 8) | (std::uint32_t(z) << 16) |
+               (std::uint32_t(w) << 24)) {}
+
+    /// @brief
+    ///   Pack a 4D vector. Elements are clamped to [0, 1] and rounded to the nearest value.
+    ///   NaN elements are packed as 0.
+    ///
+    /// @param vec
+    ///   The vector to be packed.
+    explicit UNorm8x4(Vector4 vec) noexcept : bits() {
+        for (std::size_t i = 0; i < 4; ++i) {
+            const float         v = detail::clampNormalized(vec[i], 0.0f, 1.0f) * 255.0f;
+            const std::uint32_t b = static_cast<std::uint8_t>(detail::roundToInt(v));
+            bits |= b << (i * 8);
+        }
+    }
+
+    /// @brief
+    ///   Get the specified 8-bit element.
+    ///
+    /// @param i
+    ///   Index of the element. Must be less than 4.
+    [[nodiscard]] constexpr auto get(std::size_t i) const noexcept -> std::uint8_t {
+        return static_cast<std::uint8_t>((bits >> (i * 8)) & 0xFFU);
+    }
+
+    /// @brief
+    ///   Unpack this value to 4D vector.
+    [[nodiscard]] auto toVector4() const noexcept -> Vector4 {
+        Vector4 result;
+        for (std::size_t i = 0; i < 4; ++i)
+            result[i] = static_cast<float>(get(i)) / 255.0f;
+        return result;
+    }
+};
+
+/// @brief
+///   2 unsigned normalized 16-bit integers. This is the same as `DXGI_FORMAT_R16G16_UNORM`. @p x is
+///   stored in the lower 16 bits.
+struct UNorm16x2 {
+    std::uint32_t bits;
+
+    /// @brief
+    ///   Create a zero vector.
+    constexpr UNorm16x2() noexcept : bits() {}
+
+    /// @brief
+    ///   Pack a 2D vector. Elements are clamped to [0, 1] and rounded to the nearest value.
+    ///   NaN elements are packed as 0.
+    ///
+    /// @param vec
+    ///   The vector to be packed.
+    explicit UNorm16x2(Vector2 vec) noexcept
+        : bits(static_cast<std::uint32_t>(
+                   detail::roundToInt(detail::clampNormalized(vec.x, 0.0f, 1.0f) * 65535.0f)) |
+               static_cast<std::uint32_t>(
+                   detail::roundToInt(detail::clampNormalized(vec.y, 0.0f, 1.0f) * 65535.0f))
+                   << 16) {}
+
+    /// @brief
+    ///   Unpack this value to 2D vector.
+    [[nodiscard]] auto toVector2() const noexcept -> Vector2 {
+        return {static_cast<float>(bits & 0xFFFFU) / 65535.0f,
+                static_cast<float>(bits >> 16) / 65535.0f};
+    }
+};
+
+/// @brief
+///   Unsigned normalized 10-bit x, y, z and 2-bit w. This is the same as
+///   `DXGI_FORMAT_R10G10B10A2_UNORM`. @p x is stored in the lowest 10 bits.
+struct UInt1010102 {
+    std::uint32_t bits;
+
+    /// @brief
+    ///   Create a zero vector.
+    constexpr UInt1010102() noexcept : bits() {}
+
+    /// @brief
+    ///   Pack a 4D vector. Elements are clamped to [0, 1] and rounded to the nearest value.
+    ///   NaN elements are packed as 0.
+    ///
+    /// @param vec
+    ///   The vector to be packed.
+    explicit UInt1010102(Vector4 vec) noexcept : bits() {
+        for (std::size_t i = 0; i < 3; ++i) {
+            const float v = detail::clampNormalized(vec[i], 0.0f, 1.0f) * 1023.0f;
+            bits |= static_cast<std::uint32_t>(detail::roundToInt(v)) << (i * 10);
+        }
+
+        const float w = detail::clampNormalized(vec.w, 0.0f, 1.0f) * 3.0f;
+        bits |= static_cast<std::uint32_t>(detail::roundToInt(w)) << 30;
+    }
+
+    /// @brief
+    ///   Unpack this value to 4D vector.
+    [[nodiscard]] auto toVector4() const noexcept -> Vector4 {
+        return {
+            static_cast<float>(bits & 0x3FFU) / 1023.0f,
+            static_cast<float>((bits >> 10) & 0x3FFU) / 1023.0f,
+            static_cast<float>((bits >> 20) & 0x3FFU) / 1023.0f,
+            static_cast<float>(bits >> 30) / 3.0f,
+        };
+    }
+};
+
+/// @brief
+///   Encode a unit vector with octahedral mapping. The unit sphere is projected onto an octahedron
+///   which is then unfolded to a square, so that a normal only takes 2 components.
+///
+/// @param normal
+///   The unit vector to be encoded.
+///
+/// @return
+///   The encoded value in [-1, 1].
+[[nodiscard]] inline auto encodeOctahedral(Vector3 normal) noexcept -> Vector2 {
+    const float invL1 = 1.0f / (std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z));
+    const float x     = normal.x * invL1;
+    const float y     = normal.y * invL1;
+
+    if (normal.z >= 0)
+        return {x, y};
+
+    // Fold the lower hemisphere over the diagonals.
+    return {
+        (1.0f - std::abs(y)) * (x >= 0 ? 1.0f : -1.0f),
+        (1.0f - std::abs(x)) * (y >= 0 ? 1.0f : -1.0f),
+    };
+}
+
+/// @brief
+///   Decode a unit vector from octahedral mapping.
+///
+/// @param encoded
+///   The value encoded by @p encodeOctahedral().
+///
+/// @return
+///   The decoded unit vector.
+[[nodiscard]] inline auto decodeOctahedral(Vector2 encoded) noexcept -> Vector3 {
+    Vector3 normal(encoded.x, encoded.y, 1.0f - std::abs(encoded.x) - std::abs(encoded.y));
+
+    const float t = std::max(-normal.z, 0.0f);
+    normal.x += normal.x >= 0 ? -t : t;
+    normal.y += normal.y >= 0 ? -t : t;
+
+    return normal.normalized();
+}
+
+/// @brief
+///   Pack 4D vectors to half precision.
+/// @note
+///   F16C or NEON conversion instructions are used if available. Results are exactly the same as
+///   @p Half4 constructor.
+///
+/// @param in
+///   Pointer to the vectors to be packed.
+/// @param[out] out
+///   Pointer to the array to store the packed values.
+/// @param count
+///   Number of vectors to be packed.
+inline auto packHalf(const Vector4 *in, Half4 *out, std::size_t count) noexcept -> void {
+#if defined(INK_SIMD_F16C)
+    for (std::size_t i = 0; i < count; ++i) {
+        const __m128i h = _mm_cvtps_ph(_mm_load_ps(&in[i].x), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + i), h);
+    }
+#elif defined(INK_SIMD_NEON)
+    for (std::size_t i = 0; i < count; ++i) {
+        const float16x4_t h = vcvt_f16_f32(vld1q_f32(&in[i].x));
+        vst1_u16(&out[i].x.bits, vreinterpret_u16_f16(h));
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = Half4(in[i]);
+#endif
+}
+
+/// @brief
+///   Pack 3D vectors to half precision. The w component of each packed value is set to 1 so that
+///   packed positions are still homogeneous points.
+/// @note
+///   F16C or NEON conversion instructions are used if available. Results are exactly the same as
+///   @p Half4 constructor.
+///
+/// @param in
+///   Pointer to the vectors to be packed.
+/// @param[out] out
+///   Pointer to the array to store the packed values.
+/// @param count
+///   Number of vectors to be packed.
+inline auto packHalf(const Vector3 *in, Half4 *out, std::size_t count) noexcept -> void {
+#if defined(INK_SIMD_F16C)
+    for (std::size_t i = 0; i < count; ++i) {
+        const __m128  v = _mm_setr_ps(in[i].x, in[i].y, in[i].z, 1.0f);
+        const __m128i h = _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + i), h);
+    }
+#elif defined(INK_SIMD_NEON)
+    for (std::size_t i = 0; i < count; ++i) {
+        const float       v[4] = {in[i].x, in[i].y, in[i].z, 1.0f};
+        const float16x4_t h    = vcvt_f16_f32(vld1q_f32(v));
+        vst1_u16(&out[i].x.bits, vreinterpret_u16_f16(h));
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = Half4(Vector4(in[i], 1.0f));
+#endif
+}
+
+/// @brief
+///   Unpack half precision values to 4D vectors.
+///
+/// @param in
+///   Pointer to the values to be unpacked.
+/// @param[out] out
+///   Pointer to the array to store the unpacked vectors.
+/// @param count
+///   Number of values to be unpacked.
+inline auto unpackHalf(const Half4 *in, Vector4 *out, std::size_t count) noexcept -> void {
+#if defined(INK_SIMD_F16C)
+    for (std::size_t i = 0; i < count; ++i) {
+        const __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(in + i));
+        _mm_store_ps(&out[i].x, _mm_cvtph_ps(h));
+    }
+#elif defined(INK_SIMD_NEON)
+    for (std::size_t i = 0; i < count; ++i) {
+        const float16x4_t h = vreinterpret_f16_u16(vld1_u16(&in[i].x.bits));
+        vst1q_f32(&out[i].x, vcvt_f32_f16(h));
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = in[i].toVector4();
+#endif
+}
+
+/// @brief
+///   Pack 4D vectors to signed normalized 8-bit integers. This is usually used for tangents.
+/// @note
+///   Results are exactly the same as @p SNorm8x4 constructor.
+///
+/// @param in
+///   Pointer to the vectors to be packed.
+/// @param[out] out
+///   Pointer to the array to store the packed values.
+/// @param count
+///   Number of vectors to be packed.
+inline auto packSNorm8(const Vector4 *in, SNorm8x4 *out, std::size_t count) noexcept -> void {
+#if defined(INK_SIMD_SSE)
+    const __m128 lower = _mm_set1_ps(-1.0f);
+    const __m128 upper = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(127.0f);
+    for (std::size_t i = 0; i < count; ++i) {
+        // Map NaN to 0 before clamping. maxps returns the second operand for NaN.
+        __m128 v = _mm_load_ps(&in[i].x);
+        v        = _mm_and_ps(v, _mm_cmpord_ps(v, v));
+        v        = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, lower), upper), scale);
+
+        __m128i b = _mm_cvtps_epi32(v);
+        b         = _mm_packs_epi32(b, b);
+        b         = _mm_packs_epi16(b, b);
+
+        out[i].bits = static_cast<std::uint32_t>(_mm_cvtsi128_si32(b));
+    }
+#elif defined(INK_SIMD_NEON)
+    const float32x4_t lower = vdupq_n_f32(-1.0f);
+    const float32x4_t upper = vdupq_n_f32(1.0f);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float32x4_t v = vmulq_n_f32(vminq_f32(vmaxq_f32(vld1q_f32(&in[i].x), lower), upper),
+                                          127.0f);
+
+        const int16x4_t h = vmovn_s32(vcvtnq_s32_f32(v));
+        const int8x8_t  b = vmovn_s16(vcombine_s16(h, h));
+        out[i].bits       = vget_lane_u32(vreinterpret_u32_s8(b), 0);
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = SNorm8x4(in[i]);
+#endif
+}
+
+/// @brief
+///   Pack 4D vectors to unsigned normalized 10:10:10:2 integers. This is usually used for normals
+///   and tangents that are remapped to [0, 1], or colors.
+/// @note
+///   Results are exactly the same as @p UInt1010102 constructor.
+///
+/// @param in
+///   Pointer to the vectors to be packed.
+/// @param[out] out
+///   Pointer to the array to store the packed values.
+/// @param count
+///   Number of vectors to be packed.
+inline auto packUInt1010102(const Vector4 *in, UInt1010102 *out, std::size_t count) noexcept
+    -> void {
+#if defined(INK_SIMD_SSE)
+    const __m128  lower = _mm_setzero_ps();
+    const __m128  upper = _mm_set1_ps(1.0f);
+    const __m128  scale = _mm_setr_ps(1023.0f, 1023.0f, 1023.0f, 3.0f);
+    const __m128i shift = _mm_setr_epi16(1, 1024, 1, 1024, 1, 1024, 1, 1024);
+    for (std::size_t i = 0; i < count; ++i) {
+        // Map NaN to 0 before clamping. maxps returns the second operand for NaN.
+        __m128 v = _mm_load_ps(&in[i].x);
+        v        = _mm_and_ps(v, _mm_cmpord_ps(v, v));
+        v        = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, lower), upper), scale);
+
+        // Lane 0 is x | (y << 10) and lane 1 is z | (w << 10) after multiply-add.
+        __m128i b = _mm_cvtps_epi32(v);
+        b         = _mm_packs_epi32(b, b);
+        b         = _mm_madd_epi16(b, shift);
+
+        const auto xy = static_cast<std::uint32_t>(_mm_cvtsi128_si32(b));
+        const auto zw = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(b, 4)));
+        out[i].bits   = xy | (zw << 20);
+    }
+#elif defined(INK_SIMD_NEON)
+    const float        scales[4] = {1023.0f, 1023.0f, 1023.0f, 3.0f};
+    const std::int32_t shifts[4] = {0, 10, 20, 30};
+
+    const float32x4_t lower = vdupq_n_f32(0.0f);
+    const float32x4_t upper = vdupq_n_f32(1.0f);
+    const float32x4_t scale = vld1q_f32(scales);
+    const int32x4_t   shift = vld1q_s32(shifts);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float32x4_t v =
+            vmulq_f32(vminq_f32(vmaxq_f32(vld1q_f32(&in[i].x), lower), upper), scale);
+
+        // Bit fields do not overlap, so horizontal add is the same as horizontal or.
+        const uint32x4_t b = vshlq_u32(vreinterpretq_u32_s32(vcvtnq_s32_f32(v)), shift);
+        out[i].bits        = vaddvq_u32(b);
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = UInt1010102(in[i]);
+#endif
+}
+
+/// @brief
+///   Pack unit vectors to octahedral encoded unsigned normalized 16-bit integers. The encoded
+///   values are remapped from [-1, 1] to [0, 1] before packing. Decode with `n * 2 - 1` followed
+///   by octahedral decoding in shaders.
+/// @note
+///   Unit vectors are encoded 8 at a time with @p Vector3x8. Results are the same as packing
+///   @p encodeOctahedral() results with @p UNorm16x2 constructor. Angle error of the decoded unit
+///   vectors is less than 1e-4 radians.
+///
+/// @param in
+///   Pointer to the unit vectors to be packed.
+/// @param[out] out
+///   Pointer to the array to store the packed values.
+/// @param count
+///   Number of unit vectors to be packed.
+inline auto packOctahedral(const Vector3 *in, UNorm16x2 *out, std::size_t count) noexcept -> void {
+    // Encode 8 unit vectors at a time. The lower hemisphere is folded with lane selection instead
+    // of branches.
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(count - i, 8);
+        const Vector3x8   normal(in + i, n);
+
+        const Float8 invL1 = Float8(1.0f) / (abs(normal.x) + abs(normal.y) + abs(normal.z));
+        const Float8 x     = normal.x * invL1;
+        const Float8 y     = normal.y * invL1;
+
+        const Float8 foldX = (Float8(1.0f) - abs(y)) * select(x >= 0.0f, 1.0f, -1.0f);
+        const Float8 foldY = (Float8(1.0f) - abs(x)) * select(y >= 0.0f, 1.0f, -1.0f);
+        const Float8 upper = normal.z >= 0.0f;
+
+        alignas(32) float xs[8];
+        alignas(32) float ys[8];
+        (select(upper, x, foldX) * 0.5f + 0.5f).store(xs);
+        (select(upper, y, foldY) * 0.5f + 0.5f).store(ys);
+        for (std::size_t j = 0; j < n; ++j)
+            out[i + j] = UNorm16x2(Vector2(xs[j], ys[j]));
+    }
+}
+
+/// @brief
+///   Unpack unit vectors from octahedral encoded unsigned normalized 16-bit integers.
+///
+/// @param in
+///   Pointer to the values packed by @p packOctahedral().
+/// @param[out] out
+///   Pointer to the array to store the unit vectors.
+/// @param count
+///   Number of values to be unpacked.
+inline auto unpackOctahedral(const UNorm16x2 *in, Vector3 *out, std::size_t count) noexcept
+    -> void {
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = decodeOctahedral(in[i].toVector2() * 2.0f - 1.0f);
+}
+
+} // namespace ink
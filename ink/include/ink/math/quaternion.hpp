@@ -46,13 +46,13 @@ struct alignas(16) Quaternion {
     ///   Yaw of the Euler angle in radian.
     /// @param roll
     ///   Roll of the Euler angle in radian.
-    Quaternion(float pitch, float yaw, float roll) noexcept {
-        const float sinPitch = std::sin(pitch * 0.5f);
-        const float cosPitch = std::cos(pitch * 0.5f);
-        const float sinYaw   = std::sin(yaw * 0.5f);
-        const float cosYaw   = std::cos(yaw * 0.5f);
-        const float sinRoll  = std::sin(roll * 0.5f);
-        const float cosRoll  = std::cos(roll * 0.5f);
+    constexpr Quaternion(float pitch, float yaw, float roll) noexcept : w(), x(), y(), z() {
+        const float sinPitch = sin(pitch * 0.5f);
+        const float cosPitch = cos(pitch * 0.5f);
+        const float sinYaw   = sin(yaw * 0.5f);
+        const float cosYaw   = cos(yaw * 0.5f);
+        const float sinRoll  = sin(roll * 0.5f);
+        const float cosRoll  = cos(roll * 0.5f);
 
         w = cosPitch * cosYaw * cosRoll - sinPitch * sinYaw * sinRoll;
         x = sinPitch * cosYaw * cosRoll + cosPitch * sinYaw * sinRoll;
@@ -67,10 +67,10 @@ struct alignas(16) Quaternion {
     ///   The axis to be rotated around.
     /// @param radian
     ///   Radian to rotate.
-    Quaternion(Vector3 axis, float radian) noexcept {
+    constexpr Quaternion(Vector3 axis, float radian) noexcept : w(), x(), y(), z() {
         radian *= 0.5f;
-        const float s = std::sin(radian);
-        const float c = std::cos(radian);
+        const float s = sin(radian);
+        const float c = cos(radian);
 
         axis.normalize();
 
@@ -87,8 +87,8 @@ struct alignas(16) Quaternion {
     ///
     /// @return
     ///   Length of this quaternion.
-    [[nodiscard]] auto length() const noexcept -> float {
-        return std::sqrt(w * w + x * x + y * y + z * z);
+    [[nodiscard]] constexpr auto length() const noexcept -> float {
+        return sqrt(w * w + x * x + y * y + z * z);
     }
 
     /// @brief
@@ -99,7 +99,13 @@ struct alignas(16) Quaternion {
     ///
     /// @return
     ///   Reference to this quaternion.
-    auto normalize() noexcept -> Quaternion & {
+    constexpr auto normalize() noexcept -> Quaternion & {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            simd::store(&w, simd::normalize(simd::load(&w)));
+            return *this;
+        }
+#endif
         const float len    = length();
         const float invLen = 1.0f / len;
 
@@ -119,13 +125,38 @@ struct alignas(16) Quaternion {
     ///
     /// @return
     ///   Normalized version of this quaternion.
-    [[nodiscard]] auto normalized() const noexcept -> Quaternion {
+    [[nodiscard]] constexpr auto normalized() const noexcept -> Quaternion {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            Quaternion result;
+            simd::store(&result.w, simd::normalize(simd::load(&w)));
+            return result;
+        }
+#endif
         const float len    = length();
         const float invLen = 1.0f / len;
 
         return {w * invLen, x * invLen, y * invLen, z * invLen};
     }
 
+    /// @brief
+    ///   Get normalized quaternion of this one with approximate reciprocal square root. This is
+    ///   faster than @p normalized() but relative error of the result is up to about 1e-6.
+    /// @note
+    ///   The exact @p normalized() is used if SIMD is disabled.
+    ///
+    /// @return
+    ///   Approximately normalized version of this quaternion.
+    [[nodiscard]] auto normalizedFast() const noexcept -> Quaternion {
+#if defined(INK_SIMD)
+        Quaternion result;
+        simd::store(&result.w, simd::normalizeFast(simd::load(&w)));
+        return result;
+#else
+        return normalized();
+#endif
+    }
+
     /// @brief
     ///   Convert this quaternion to its conjugate quaternion.
     /// @note
@@ -208,6 +239,44 @@ struct alignas(16) Quaternion {
         };
     }
 
+    /// @brief
+    ///   Create a quaternion from a rotation matrix with Shepperd's method. The largest of the
+    ///   4 components is calculated from the diagonal first, so that the other components are
+    ///   never divided by a small value.
+    /// @note
+    ///   Only the upper 3x3 part of the matrix is used, which must be orthonormal with determinant
+    ///   1. To convert a matrix that contains scale, use @p decompose() instead.
+    ///
+    /// @param matrix
+    ///   The rotation matrix, e.g. created by @p Quaternion::toMatrix().
+    ///
+    /// @return
+    ///   A unit quaternion that represents the same rotation as @p matrix.
+    [[nodiscard]] static constexpr auto fromMatrix(const Matrix4 &matrix) noexcept -> Quaternion {
+        const float m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2];
+        const float m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2];
+        const float m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2];
+
+        const float trace = m00 + m11 + m22;
+        if (trace >= m00 && trace >= m11 && trace >= m22) {
+            const float s = 0.5f / sqrt(1.0f + trace);
+            return {0.25f / s, (m21 - m12) * s, (m02 - m20) * s, (m10 - m01) * s};
+        }
+
+        if (m00 >= m11 && m00 >= m22) {
+            const float s = 0.5f / sqrt(1.0f + m00 - m11 - m22);
+            return {(m21 - m12) * s, 0.25f / s, (m01 + m10) * s, (m02 + m20) * s};
+        }
+
+        if (m11 >= m22) {
+            const float s = 0.5f / sqrt(1.0f - m00 + m11 - m22);
+            return {(m02 - m20) * s, (m01 + m10) * s, 0.25f / s, (m12 + m21) * s};
+        }
+
+        const float s = 0.5f / sqrt(1.0f - m00 - m11 + m22);
+        return {(m10 - m01) * s, (m02 + m20) * s, (m12 + m21) * s, 0.25f / s};
+    }
+
     constexpr auto operator+() const noexcept -> Quaternion { return *this; }
 
     constexpr auto operator-() const noexcept -> Quaternion { return {-w, -x, -y, -z}; }
@@ -247,6 +316,12 @@ struct alignas(16) Quaternion {
     }
 
     constexpr auto operator*=(Quaternion rhs) noexcept -> Quaternion & {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            simd::store(&w, simd::multiplyQuaternion(simd::load(&w), simd::load(&rhs.w)));
+            return *this;
+        }
+#endif
         const float a = w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z;
         const float b = x * rhs.w + w * rhs.x - z * rhs.y + y * rhs.z;
         const float c = y * rhs.w + z * rhs.x + w * rhs.y - x * rhs.z;
@@ -306,6 +381,13 @@ constexpr auto operator-(float lhs, Quaternion rhs) noexcept -> Quaternion {
 }
 
 constexpr auto operator*(Quaternion lhs, Quaternion rhs) noexcept -> Quaternion {
+#if defined(INK_SIMD)
+    if (!INK_IS_CONSTANT_EVALUATED()) {
+        Quaternion result;
+        simd::store(&result.w, simd::multiplyQuaternion(simd::load(&lhs.w), simd::load(&rhs.w)));
+        return result;
+    }
+#endif
     return Quaternion{
         lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z,
         lhs.x * rhs.w + lhs.w * rhs.x - lhs.z * rhs.y + lhs.y * rhs.z,
@@ -348,6 +430,23 @@ constexpr auto operator/(float lhs, Quaternion rhs) noexcept -> Quaternion {
     return lhs.w * rhs.w + lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
 }
 
+/// @brief
+///   Rotate a 3D vector with the specified quaternion. This is the same as transforming the vector
+///   with @p quat.toMatrix() but much cheaper.
+///
+/// @param quat
+///   The unit quaternion that represents the rotation.
+/// @param vec
+///   The vector to be rotated.
+///
+/// @return
+///   The rotated vector.
+[[nodiscard]] constexpr auto rotate(Quaternion quat, Vector3 vec) noexcept -> Vector3 {
+    const Vector3 u(quat.x, quat.y, quat.z);
+    const Vector3 t = cross(u, vec) * 2.0f;
+    return vec + t * quat.w + cross(u, t);
+}
+
 /// @brief
 ///   Perform normalized linear interpolation between the 2 quaternions.
 ///
@@ -387,7 +486,7 @@ constexpr auto operator/(float lhs, Quaternion rhs) noexcept -> Quaternion {
         end = -end;
     }
 
-    const float s = std::sqrt(1 - c * c);
+    const float s = std::sqrt(std::max(1 - c * c, 0.0f));
 
     if (s < FLT_EPSILON)
         return nlerp(start, end, t);
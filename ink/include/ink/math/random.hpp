@@ -0,0 +1,453 @@
+#pragma once
+
+#include "wide.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace ink {
+namespace detail {
+
+/// @brief
+///   SplitMix64 generator. This is used to expand a single seed into states of other generators.
+constexpr auto splitMix64(std::uint64_t &state) noexcept -> std::uint64_t {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z               = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+constexpr auto rotl64(std::uint64_t x, int k) noexcept -> std::uint64_t {
+    return (x << k) | (x >> (64 - k));
+}
+
+} // namespace detail
+
+/// @brief
+///   PCG32 random number generator (PCG-XSH-RR with 64-bit state). Each generator is only 16 bytes,
+///   which makes it suitable for per-particle or per-thread random streams. Generators with
+///   different streams produce independent sequences even if they share the same seed.
+/// @note
+///   This type satisfies the C++ UniformRandomBitGenerator requirements, so it could also be used
+///   with distributions in `<random>`.
+class PCG32 {
+public:
+    using result_type = std::uint32_t;
+
+    /// @brief
+    ///   Create a PCG32 generator with the specified seed and stream.
+    ///
+    /// @param seed
+    ///   Initial state of the generator.
+    /// @param stream
+    ///   Stream index of the generator. Only the lower 63 bits are used.
+    explicit constexpr PCG32(std::uint64_t seed   = 0x853C49E6748FEA9BULL,
+                             std::uint64_t stream = 0xDA3E39CB94B95BDBULL) noexcept
+        : m_state(0), m_increment((stream << 1) | 1) {
+        next();
+        m_state += seed;
+        next();
+    }
+
+    /// @brief
+    ///   Generate a 32-bit random integer.
+    ///
+    /// @return
+    ///   A uniformly distributed 32-bit integer.
+    constexpr auto next() noexcept -> std::uint32_t {
+        const std::uint64_t old = m_state;
+        m_state                 = old * Multiplier + m_increment;
+
+        const auto xorShifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+        const auto rotation   = static_cast<std::uint32_t>(old >> 59);
+        return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+    }
+
+    /// @brief
+    ///   Generate a random integer in [0, bound) without modulo bias.
+    ///
+    /// @param bound
+    ///   Exclusive upper bound of the result. Must not be 0.
+    ///
+    /// @return
+    ///   A uniformly distributed integer in [0, bound).
+    constexpr auto nextUint(std::uint32_t bound) noexcept -> std::uint32_t {
+        // Lemire's nearly divisionless method.
+        std::uint64_t m = std::uint64_t(next()) * bound;
+        if (static_cast<std::uint32_t>(m) < bound) {
+            const std::uint32_t threshold = (0u - bound) % bound;
+            while (static_cast<std::uint32_t>(m) < threshold)
+                m = std::uint64_t(next()) * bound;
+        }
+        return static_cast<std::uint32_t>(m >> 32);
+    }
+
+    /// @brief
+    ///   Generate a random floating point value in [0, 1).
+    ///
+    /// @return
+    ///   A uniformly distributed floating point value in [0, 1).
+    constexpr auto nextFloat() noexcept -> float {
+        return static_cast<float>(next() >> 8) * 0x1p-24f;
+    }
+
+    /// @brief
+    ///   Advance the generator by @p delta steps in O(log(delta)) time. This is the same as calling
+    ///   @p next() @p delta times.
+    ///
+    /// @param delta
+    ///   Number of steps to advance.
+    constexpr auto advance(std::uint64_t delta) noexcept -> void {
+        std::uint64_t multiplier    = Multiplier;
+        std::uint64_t increment     = m_increment;
+        std::uint64_t accMultiplier = 1;
+        std::uint64_t accIncrement  = 0;
+
+        while (delta > 0) {
+            if (delta & 1) {
+                accMultiplier *= multiplier;
+                accIncrement = accIncrement * multiplier + increment;
+            }
+            increment = (multiplier + 1) * increment;
+            multiplier *= multiplier;
+            delta >>= 1;
+        }
+
+        m_state = accMultiplier * m_state + accIncrement;
+    }
+
+    /// @brief
+    ///   Minimum value that could be generated.
+    static constexpr auto min() noexcept -> std::uint32_t { return 0; }
+
+    /// @brief
+    ///   Maximum value that could be generated.
+    static constexpr auto max() noexcept -> std::uint32_t {
+        return std::numeric_limits<std::uint32_t>::max();
+    }
+
+    /// @brief
+    ///   Generate a 32-bit random integer. This is the same as @p next().
+    constexpr auto operator()() noexcept -> std::uint32_t { return next(); }
+
+    constexpr auto operator==(const PCG32 &rhs) const noexcept -> bool {
+        return m_state == rhs.m_state && m_increment == rhs.m_increment;
+    }
+
+    constexpr auto operator!=(const PCG32 &rhs) const noexcept -> bool { return !(*this == rhs); }
+
+private:
+    static constexpr std::uint64_t Multiplier = 6364136223846793005ULL;
+
+    std::uint64_t m_state;
+    std::uint64_t m_increment;
+};
+
+/// @brief
+///   xoshiro256** random number generator. This generator has a period of 2^256 - 1 and supports
+///   jumping ahead by 2^128 steps, which splits a single seed into non-overlapping streams.
+/// @note
+///   This type satisfies the C++ UniformRandomBitGenerator requirements, so it could also be used
+///   with distributions in `<random>`.
+class Xoshiro256 {
+public:
+    using result_type = std::uint64_t;
+
+    /// @brief
+    ///   Create a xoshiro256** generator. State of the generator is expanded from @p seed with
+    ///   SplitMix64.
+    ///
+    /// @param seed
+    ///   Seed of the generator.
+    explicit constexpr Xoshiro256(std::uint64_t seed = 0) noexcept : m_state() {
+        for (auto &s : m_state)
+            s = detail::splitMix64(seed);
+    }
+
+    /// @brief
+    ///   Generate a 64-bit random integer.
+    ///
+    /// @return
+    ///   A uniformly distributed 64-bit integer.
+    constexpr auto next() noexcept -> std::uint64_t {
+        const std::uint64_t result = detail::rotl64(m_state[1] * 5, 7) * 9;
+        const std::uint64_t t      = m_state[1] << 17;
+
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = detail::rotl64(m_state[3], 45);
+
+        return result;
+    }
+
+    /// @brief
+    ///   Generate a random floating point value in [0, 1).
+    ///
+    /// @return
+    ///   A uniformly distributed floating point value in [0, 1).
+    constexpr auto nextFloat() noexcept -> float {
+        return static_cast<float>(next() >> 40) * 0x1p-24f;
+    }
+
+    /// @brief
+    ///   Advance the generator by 2^128 steps. Calling this function on copies of a generator
+    ///   generates 2^128 non-overlapping streams.
+    constexpr auto jump() noexcept -> void {
+        constexpr std::uint64_t Jump[] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                          0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+
+        std::uint64_t state[4]{};
+        for (const std::uint64_t bits : Jump) {
+            for (int b = 0; b < 64; ++b) {
+                if (bits & (std::uint64_t(1) << b)) {
+                    for (std::size_t i = 0; i < 4; ++i)
+                        state[i] ^= m_state[i];
+                }
+                next();
+            }
+        }
+
+        for (std::size_t i = 0; i < 4; ++i)
+            m_state[i] = state[i];
+    }
+
+    /// @brief
+    ///   Minimum value that could be generated.
+    static constexpr auto min() noexcept -> std::uint64_t { return 0; }
+
+    /// @brief
+    ///   Maximum value that could be generated.
+    static constexpr auto max() noexcept -> std::uint64_t {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+
+    /// @brief
+    ///   Generate a 64-bit random integer. This is the same as @p next().
+    constexpr auto operator()() noexcept -> std::uint64_t { return next(); }
+
+    /// @brief
+    ///   Get state of this generator.
+    ///
+    /// @param i
+    ///   Index of the state word. Must be less than 4.
+    [[nodiscard]] constexpr auto state(std::size_t i) const noexcept -> std::uint64_t {
+        return m_state[i];
+    }
+
+private:
+    std::uint64_t m_state[4];
+};
+
+namespace detail {
+
+#if defined(INK_SIMD_AVX2)
+using U64Lanes                            = __m256i;
+inline constexpr std::size_t U64LaneCount = 4;
+
+inline auto add64(__m256i a, __m256i b) noexcept -> __m256i { return _mm256_add_epi64(a, b); }
+inline auto xor64(__m256i a, __m256i b) noexcept -> __m256i { return _mm256_xor_si256(a, b); }
+
+template <int N>
+inline auto shl64(__m256i a) noexcept -> __m256i {
+    return _mm256_slli_epi64(a, N);
+}
+
+template <int N>
+inline auto shr64(__m256i a) noexcept -> __m256i {
+    return _mm256_srli_epi64(a, N);
+}
+
+inline auto loadU64(const std::uint64_t *p) noexcept -> __m256i {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+}
+
+inline auto storeU64(std::uint64_t *p, __m256i a) noexcept -> void {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), a);
+}
+#elif defined(INK_SIMD_SSE)
+using U64Lanes                            = __m128i;
+inline constexpr std::size_t U64LaneCount = 2;
+
+inline auto add64(__m128i a, __m128i b) noexcept -> __m128i { return _mm_add_epi64(a, b); }
+inline auto xor64(__m128i a, __m128i b) noexcept -> __m128i { return _mm_xor_si128(a, b); }
+
+template <int N>
+inline auto shl64(__m128i a) noexcept -> __m128i {
+    return _mm_slli_epi64(a, N);
+}
+
+template <int N>
+inline auto shr64(__m128i a) noexcept -> __m128i {
+    return _mm_srli_epi64(a, N);
+}
+
+inline auto loadU64(const std::uint64_t *p) noexcept -> __m128i {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+inline auto storeU64(std::uint64_t *p, __m128i a) noexcept -> void {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), a);
+}
+#elif defined(INK_SIMD_NEON)
+using U64Lanes                            = uint64x2_t;
+inline constexpr std::size_t U64LaneCount = 2;
+
+inline auto add64(uint64x2_t a, uint64x2_t b) noexcept -> uint64x2_t { return vaddq_u64(a, b); }
+inline auto xor64(uint64x2_t a, uint64x2_t b) noexcept -> uint64x2_t { return veorq_u64(a, b); }
+
+template <int N>
+inline auto shl64(uint64x2_t a) noexcept -> uint64x2_t {
+    return vshlq_n_u64(a, N);
+}
+
+template <int N>
+inline auto shr64(uint64x2_t a) noexcept -> uint64x2_t {
+    return vshrq_n_u64(a, N);
+}
+
+inline auto loadU64(const std::uint64_t *p) noexcept -> uint64x2_t { return vld1q_u64(p); }
+inline auto storeU64(std::uint64_t *p, uint64x2_t a) noexcept -> void { vst1q_u64(p, a); }
+#else
+using U64Lanes                            = std::uint64_t;
+inline constexpr std::size_t U64LaneCount = 1;
+
+inline auto add64(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t { return a + b; }
+inline auto xor64(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t { return a ^ b; }
+
+template <int N>
+inline auto shl64(std::uint64_t a) noexcept -> std::uint64_t {
+    return a << N;
+}
+
+template <int N>
+inline auto shr64(std::uint64_t a) noexcept -> std::uint64_t {
+    return a >> N;
+}
+
+inline auto loadU64(const std::uint64_t *p) noexcept -> std::uint64_t { return *p; }
+inline auto storeU64(std::uint64_t *p, std::uint64_t a) noexcept -> void { *p = a; }
+#endif
+
+template <int N>
+inline auto rotl64Lanes(U64Lanes a) noexcept -> U64Lanes {
+    return xor64(shl64<N>(a), shr64<64 - N>(a));
+}
+
+} // namespace detail
+
+/// @brief
+///   8 independent xoshiro256** generators in SoA layout. Lane i generates the same sequence as a
+///   @p Xoshiro256 generator with the same seed after jumping i times, so the lanes never overlap.
+/// @note
+///   64-bit multiplications of the ** scrambler are performed with shifts and additions, since
+///   SSE and NEON do not support 64-bit multiplication.
+class Xoshiro256x8 {
+public:
+    /// @brief
+    ///   Create 8 xoshiro256** generators from a single seed.
+    ///
+    /// @param seed
+    ///   Seed of the generators. See @p Xoshiro256 for details.
+    explicit Xoshiro256x8(std::uint64_t seed = 0) noexcept : m_state() {
+        Xoshiro256    generator(seed);
+        std::uint64_t state[4][8];
+        for (std::size_t lane = 0; lane < 8; ++lane) {
+            for (std::size_t i = 0; i < 4; ++i)
+                state[i][lane] = generator.state(i);
+            generator.jump();
+        }
+
+        for (std::size_t i = 0; i < 4; ++i) {
+            for (std::size_t j = 0; j < RegisterCount; ++j)
+                m_state[i][j] = detail::loadU64(state[i] + j * detail::U64LaneCount);
+        }
+    }
+
+    /// @brief
+    ///   Generate a 64-bit random integer for each lane.
+    ///
+    /// @param[out] values
+    ///   Array to store the 8 random integers.
+    auto next(std::uint64_t values[8]) noexcept -> void {
+        for (std::size_t j = 0; j < RegisterCount; ++j)
+            detail::storeU64(values + j * detail::U64LaneCount, step(j));
+    }
+
+    /// @brief
+    ///   Generate a random floating point value in [0, 1) for each lane.
+    ///
+    /// @return
+    ///   8 uniformly distributed floating point values in [0, 1).
+    auto nextFloat() noexcept -> Float8 {
+        // Only the upper 24 bits are used. They are moved to the lower half of each 64-bit lane and
+        // then packed into 32-bit lanes.
+        detail::U64Lanes bits[RegisterCount];
+        for (std::size_t j = 0; j < RegisterCount; ++j)
+            bits[j] = detail::shr64<40>(step(j));
+
+#if defined(INK_SIMD_AVX2)
+        const __m256  low     = _mm256_castsi256_ps(bits[0]);
+        const __m256  high    = _mm256_castsi256_ps(bits[1]);
+        const __m256  packed  = _mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256i ordered = _mm256_permute4x64_epi64(_mm256_castps_si256(packed),
+                                                         _MM_SHUFFLE(3, 1, 2, 0));
+
+        Float8 result;
+        result.value = _mm256_mul_ps(_mm256_cvtepi32_ps(ordered), _mm256_set1_ps(0x1p-24f));
+        return result;
+#elif defined(INK_SIMD_SSE)
+        const __m128 scale = _mm_set1_ps(0x1p-24f);
+        const __m128 low   = _mm_shuffle_ps(_mm_castsi128_ps(bits[0]), _mm_castsi128_ps(bits[1]),
+                                            _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 high  = _mm_shuffle_ps(_mm_castsi128_ps(bits[2]), _mm_castsi128_ps(bits[3]),
+                                            _MM_SHUFFLE(2, 0, 2, 0));
+        return {_mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(low)), scale),
+                _mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(high)), scale)};
+#elif defined(INK_SIMD_NEON)
+        const uint32x4_t low  = vcombine_u32(vmovn_u64(bits[0]), vmovn_u64(bits[1]));
+        const uint32x4_t high = vcombine_u32(vmovn_u64(bits[2]), vmovn_u64(bits[3]));
+        return {vmulq_n_f32(vcvtq_f32_u32(low), 0x1p-24f),
+                vmulq_n_f32(vcvtq_f32_u32(high), 0x1p-24f)};
+#else
+        float values[8];
+        for (std::size_t i = 0; i < 8; ++i)
+            values[i] = static_cast<float>(bits[i]) * 0x1p-24f;
+        return Float8(values);
+#endif
+    }
+
+private:
+    /// @brief
+    ///   Advance generators in the specified register and return the scrambled outputs.
+    auto step(std::size_t j) noexcept -> detail::U64Lanes {
+        detail::U64Lanes &s0 = m_state[0][j];
+        detail::U64Lanes &s1 = m_state[1][j];
+        detail::U64Lanes &s2 = m_state[2][j];
+        detail::U64Lanes &s3 = m_state[3][j];
+
+        // rotl(s1 * 5, 7) * 9
+        const detail::U64Lanes times5  = detail::add64(detail::shl64<2>(s1), s1);
+        const detail::U64Lanes rotated = detail::rotl64Lanes<7>(times5);
+        const detail::U64Lanes result  = detail::add64(detail::shl64<3>(rotated), rotated);
+
+        const detail::U64Lanes t = detail::shl64<17>(s1);
+        s2                       = detail::xor64(s2, s0);
+        s3                       = detail::xor64(s3, s1);
+        s1                       = detail::xor64(s1, s2);
+        s0                       = detail::xor64(s0, s3);
+        s2                       = detail::xor64(s2, t);
+        s3                       = detail::rotl64Lanes<45>(s3);
+
+        return result;
+    }
+
+private:
+    static constexpr std::size_t RegisterCount = 8 / detail::U64LaneCount;
+
+    detail::U64Lanes m_state[4][RegisterCount];
+};
+
+} // namespace ink
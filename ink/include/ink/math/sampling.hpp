@@ -0,0 +1,247 @@
+#pragma once
+
+#include "vector.hpp"
+
+#include <cstdint>
+
+namespace ink {
+namespace detail {
+
+/// @brief
+///   Largest float that is less than 1.
+inline constexpr float OneMinusEpsilon = 0x1.fffffep-1f;
+
+/// @brief
+///   Reverse bits of a 32-bit integer.
+constexpr auto reverseBits(std::uint32_t bits) noexcept -> std::uint32_t {
+    bits = (bits << 16) | (bits >> 16);
+    bits = ((bits & 0x00FF00FFu) << 8) | ((bits & 0xFF00FF00u) >> 8);
+    bits = ((bits & 0x0F0F0F0Fu) << 4) | ((bits & 0xF0F0F0F0u) >> 4);
+    bits = ((bits & 0x33333333u) << 2) | ((bits & 0xCCCCCCCCu) >> 2);
+    bits = ((bits & 0x55555555u) << 1) | ((bits & 0xAAAAAAAAu) >> 1);
+    return bits;
+}
+
+/// @brief
+///   Convert a 32-bit fixed point fraction to float in [0, 1).
+constexpr auto fractionToFloat(std::uint32_t bits) noexcept -> float {
+    return static_cast<float>(bits >> 8) * 0x1p-24f;
+}
+
+} // namespace detail
+
+/// @brief
+///   Calculate radical inverse of the specified index, which mirrors digits of @p index in base
+///   @p base around the radix point.
+///
+/// @param index
+///   Index of the sample.
+/// @param base
+///   Base of the radical inverse. Must be greater than 1.
+///
+/// @return
+///   Radical inverse of @p index in [0, 1).
+[[nodiscard]] constexpr auto radicalInverse(std::uint32_t index, std::uint32_t base) noexcept
+    -> float {
+    if (base == 2)
+        return detail::fractionToFloat(detail::reverseBits(index));
+
+    const double invBase = 1.0 / base;
+    double       scale   = 1.0;
+    double       result  = 0.0;
+    while (index > 0) {
+        const std::uint32_t next = index / base;
+        scale *= invBase;
+        result += static_cast<double>(index - next * base) * scale;
+        index = next;
+    }
+
+    const auto value = static_cast<float>(result);
+    return value < detail::OneMinusEpsilon ? value : detail::OneMinusEpsilon;
+}
+
+/// @brief
+///   Get the specified element of 2D Halton sequence with bases 2 and 3.
+///
+/// @param index
+///   Index of the element.
+///
+/// @return
+///   The Halton point in [0, 1)^2.
+[[nodiscard]] constexpr auto halton2(std::uint32_t index) noexcept -> Vector2 {
+    return {radicalInverse(index, 2), radicalInverse(index, 3)};
+}
+
+/// @brief
+///   Get the specified element of 3D Halton sequence with bases 2, 3 and 5.
+///
+/// @param index
+///   Index of the element.
+///
+/// @return
+///   The Halton point in [0, 1)^3.
+[[nodiscard]] constexpr auto halton3(std::uint32_t index) noexcept -> Vector3 {
+    return {radicalInverse(index, 2), radicalInverse(index, 3), radicalInverse(index, 5)};
+}
+
+/// @brief
+///   Get the specified element of the first 2 dimensions of Sobol sequence. Each power-of-2 sized
+///   prefix of this sequence is stratified in every elementary interval, i.e. this is a (0, 2)
+///   sequence in base 2.
+///
+/// @param index
+///   Index of the element.
+/// @param scramble
+///   Random bits that are XORed to both dimensions. Different scrambles generate decorrelated
+///   sequences with the same stratification, which is useful for per-pixel sampling.
+///
+/// @return
+///   The Sobol point in [0, 1)^2.
+[[nodiscard]] constexpr auto sobol2(std::uint32_t index, std::uint32_t scramble = 0) noexcept
+    -> Vector2 {
+    // The first dimension is van der Corput sequence. Generator matrix of the second dimension is
+    // Pascal's triangle modulo 2.
+    std::uint32_t y = 0;
+    for (std::uint32_t i = index, v = 1u << 31; i != 0; i >>= 1, v ^= v >> 1) {
+        if (i & 1)
+            y ^= v;
+    }
+
+    return {detail::fractionToFloat(detail::reverseBits(index) ^ scramble),
+            detail::fractionToFloat(y ^ scramble)};
+}
+
+/// @brief
+///   Get the specified element of R2 sequence, which is an additive recurrence based on the
+///   plastic number. R2 sequence has better uniformity than Halton and Sobol sequences for
+///   arbitrary number of samples.
+/// @note
+///   The recurrence is evaluated in 32-bit fixed point so that precision does not degrade for
+///   large indices.
+///
+/// @param index
+///   Index of the element.
+///
+/// @return
+///   The R2 point in [0, 1)^2.
+[[nodiscard]] constexpr auto r2(std::uint32_t index) noexcept -> Vector2 {
+    // 2^32 / g and 2^32 / g^2, where g is the plastic number 1.32471795724474602596.
+    constexpr std::uint32_t Alpha1 = 3242174889u;
+    constexpr std::uint32_t Alpha2 = 2447445414u;
+    constexpr std::uint32_t Half   = 1u << 31;
+
+    return {detail::fractionToFloat(Half + index * Alpha1),
+            detail::fractionToFloat(Half + index * Alpha2)};
+}
+
+/// @brief
+///   Map a point in unit square to unit disk uniformly with Shirley-Chiu concentric mapping, which
+///   preserves stratification of the input.
+///
+/// @param u
+///   A point in [0, 1)^2.
+///
+/// @return
+///   A point in unit disk.
+[[nodiscard]] constexpr auto sampleUniformDisk(Vector2 u) noexcept -> Vector2 {
+    const float a = 2.0f * u.x - 1.0f;
+    const float b = 2.0f * u.y - 1.0f;
+    if (a == 0 && b == 0)
+        return {0.0f, 0.0f};
+
+    const float aa = a < 0 ? -a : a;
+    const float ab = b < 0 ? -b : b;
+    if (aa > ab) {
+        const float theta = (Pi<float> / 4.0f) * (b / a);
+        return {a * cos(theta), a * sin(theta)};
+    }
+
+    const float theta = (Pi<float> / 2.0f) - (Pi<float> / 4.0f) * (a / b);
+    return {b * cos(theta), b * sin(theta)};
+}
+
+/// @brief
+///   Map a point in unit square to unit sphere uniformly.
+///
+/// @param u
+///   A point in [0, 1)^2.
+///
+/// @return
+///   A unit vector. The PDF with respect to solid angle is 1 / 4pi.
+[[nodiscard]] constexpr auto sampleUniformSphere(Vector2 u) noexcept -> Vector3 {
+    const float z   = 1.0f - 2.0f * u.x;
+    const float rr  = 1.0f - z * z;
+    const float r   = rr > 0 ? ink::sqrt(rr) : 0.0f;
+    const float phi = 2.0f * Pi<float> * u.y;
+    return {r * cos(phi), r * sin(phi), z};
+}
+
+/// @brief
+///   Map a point in unit square to unit hemisphere around +Z axis with cosine-weighted
+///   distribution.
+///
+/// @param u
+///   A point in [0, 1)^2.
+///
+/// @return
+///   A unit vector whose Z element is not negative. The PDF with respect to solid angle is
+///   `z / pi`. See @p cosineHemispherePdf().
+[[nodiscard]] constexpr auto sampleCosineHemisphere(Vector2 u) noexcept -> Vector3 {
+    const Vector2 d  = sampleUniformDisk(u);
+    const float   z2 = 1.0f - d.x * d.x - d.y * d.y;
+    return {d.x, d.y, z2 > 0 ? ink::sqrt(z2) : 0.0f};
+}
+
+/// @brief
+///   Get PDF of @p sampleCosineHemisphere() with respect to solid angle.
+///
+/// @param cosTheta
+///   Cosine of the angle between the sampled direction and +Z axis.
+///
+/// @return
+///   PDF of the sampled direction.
+[[nodiscard]] constexpr auto cosineHemispherePdf(float cosTheta) noexcept -> float {
+    return cosTheta * InvPi<float>;
+}
+
+/// @brief
+///   Importance sample GGX/Trowbridge-Reitz normal distribution function around +Z axis. This is
+///   usually used to prefilter environment maps for specular image based lighting.
+///
+/// @param u
+///   A point in [0, 1)^2.
+/// @param roughness
+///   Roughness of the surface, which is the alpha parameter of the distribution. This is the same
+///   as the roughness of the GGX function in the CookTorrance example.
+///
+/// @return
+///   A unit microfacet normal (half vector) whose Z element is not negative. See @p ggxPdf() for
+///   PDF of the sampled direction.
+[[nodiscard]] constexpr auto sampleGGX(Vector2 u, float roughness) noexcept -> Vector3 {
+    const float a2        = roughness * roughness;
+    const float cosTheta2 = (1.0f - u.x) / (1.0f + (a2 - 1.0f) * u.x);
+    const float cosTheta  = ink::sqrt(cosTheta2);
+    const float sinTheta2 = 1.0f - cosTheta2;
+    const float sinTheta  = sinTheta2 > 0 ? ink::sqrt(sinTheta2) : 0.0f;
+    const float phi       = 2.0f * Pi<float> * u.y;
+    return {sinTheta * cos(phi), sinTheta * sin(phi), cosTheta};
+}
+
+/// @brief
+///   Get PDF of @p sampleGGX() with respect to solid angle of the microfacet normal, which is
+///   `D(h) * cos(theta_h)`.
+///
+/// @param cosTheta
+///   Cosine of the angle between the microfacet normal and +Z axis.
+/// @param roughness
+///   Roughness of the surface, which is the alpha parameter of the distribution.
+///
+/// @return
+///   PDF of the microfacet normal.
+[[nodiscard]] constexpr auto ggxPdf(float cosTheta, float roughness) noexcept -> float {
+    const float a2 = roughness * roughness;
+    const float t  = 1.0f + (a2 - 1.0f) * cosTheta * cosTheta;
+    return a2 * cosTheta / (Pi<float> * t * t);
+}
+
+} // namespace ink
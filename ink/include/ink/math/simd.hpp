@@ -0,0 +1,667 @@
+#pragma once
+
+// SIMD backend selection. The backend is chosen at compile time according to the target instruction
+// set. Define INK_NO_SIMD to force the scalar implementation.
+#if !defined(INK_NO_SIMD)
+#    if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) ||                             \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define INK_SIMD_SSE 1
+#        if defined(__AVX2__)
+#            define INK_SIMD_AVX2 1
+#        endif
+#    elif defined(__aarch64__) || defined(_M_ARM64)
+#        define INK_SIMD_NEON 1
+#    endif
+#endif
+
+// SIMD code paths cannot be used in constant evaluation. Compilers that cannot tell constant
+// evaluation from runtime evaluation always use the scalar implementation.
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9) ||                                \
+    (defined(_MSC_VER) && _MSC_VER >= 1925)
+#    define INK_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#    undef INK_SIMD_SSE
+#    undef INK_SIMD_AVX2
+#    undef INK_SIMD_NEON
+#endif
+
+#if defined(INK_SIMD_SSE) || defined(INK_SIMD_NEON)
+#    define INK_SIMD 1
+#endif
+
+#if defined(INK_SIMD_SSE)
+#    include <immintrin.h>
+#elif defined(INK_SIMD_NEON)
+#    include <arm_neon.h>
+#endif
+
+#include <cstdint>
+
+#if defined(INK_SIMD)
+
+namespace ink::simd {
+
+#    if defined(INK_SIMD_SSE)
+
+/// @brief
+///   4 packed single precision floating point values.
+using Float4 = __m128;
+
+/// @brief
+///   Load 4 floating point values from 16-byte aligned memory.
+[[nodiscard]] inline auto load(const float *ptr) noexcept -> Float4 { return _mm_load_ps(ptr); }
+
+/// @brief
+///   Store 4 floating point values to 16-byte aligned memory.
+inline auto store(float *ptr, Float4 value) noexcept -> void { _mm_store_ps(ptr, value); }
+
+/// @brief
+///   Load 4 floating point values from memory without alignment requirement.
+[[nodiscard]] inline auto loadUnaligned(const float *ptr) noexcept -> Float4 {
+    return _mm_loadu_ps(ptr);
+}
+
+/// @brief
+///   Store 4 floating point values to memory without alignment requirement.
+inline auto storeUnaligned(float *ptr, Float4 value) noexcept -> void { _mm_storeu_ps(ptr, value); }
+
+/// @brief
+///   Fill all 4 elements with the specified value.
+[[nodiscard]] inline auto splat(float value) noexcept -> Float4 { return _mm_set1_ps(value); }
+
+/// @brief
+///   Create a packed value from 4 floating point values.
+[[nodiscard]] inline auto set(float x, float y, float z, float w) noexcept -> Float4 {
+    return _mm_setr_ps(x, y, z, w);
+}
+
+/// @brief
+///   Get the first element of the packed value.
+[[nodiscard]] inline auto first(Float4 value) noexcept -> float { return _mm_cvtss_f32(value); }
+
+[[nodiscard]] inline auto add(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return _mm_add_ps(lhs, rhs);
+}
+
+[[nodiscard]] inline auto sub(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return _mm_sub_ps(lhs, rhs);
+}
+
+[[nodiscard]] inline auto mul(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return _mm_mul_ps(lhs, rhs);
+}
+
+[[nodiscard]] inline auto div(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return _mm_div_ps(lhs, rhs);
+}
+
+[[nodiscard]] inline auto sqrt(Float4 value) noexcept -> Float4 { return _mm_sqrt_ps(value); }
+
+/// @brief
+///   Approximate reciprocal square root. The 12-bit hardware estimate is refined with one
+///   Newton-Raphson step, which gives about 22 bits of precision.
+[[nodiscard]] inline auto rsqrt(Float4 value) noexcept -> Float4 {
+    const Float4 y  = _mm_rsqrt_ps(value);
+    const Float4 hx = _mm_mul_ps(_mm_set1_ps(0.5f), value);
+    return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(hx, _mm_mul_ps(y, y))));
+}
+
+[[nodiscard]] inline auto min(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return _mm_min_ps(lhs, rhs);
+}
+
+[[nodiscard]] inline auto max(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return _mm_max_ps(lhs, rhs);
+}
+
+[[nodiscard]] inline auto abs(Float4 value) noexcept -> Float4 {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+}
+
+/// @brief
+///   Element-wise less than comparison. Each element of the result is either all 0 or all 1 bits.
+[[nodiscard]] inline auto lessThan(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return _mm_cmplt_ps(lhs, rhs);
+}
+
+/// @brief
+///   Element-wise less equal comparison. Each element of the result is either all 0 or all 1 bits.
+[[nodiscard]] inline auto lessEqual(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return _mm_cmple_ps(lhs, rhs);
+}
+
+/// @brief
+///   Select elements from @p a where @p mask is set and from @p b otherwise.
+[[nodiscard]] inline auto select(Float4 mask, Float4 a, Float4 b) noexcept -> Float4 {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/// @brief
+///   Bitwise and of 2 lane masks.
+[[nodiscard]] inline auto maskAnd(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return _mm_and_ps(lhs, rhs);
+}
+
+/// @brief
+///   Bitwise or of 2 lane masks.
+[[nodiscard]] inline auto maskOr(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return _mm_or_ps(lhs, rhs);
+}
+
+/// @brief
+///   Gather the sign bit of each lane into an integer. Bit i is set if lane i is set.
+[[nodiscard]] inline auto maskBits(Float4 mask) noexcept -> std::uint32_t {
+    return static_cast<std::uint32_t>(_mm_movemask_ps(mask));
+}
+
+/// @brief
+///   Shuffle elements of 2 packed values. The first 2 elements of the result are selected from @p
+///   a by @p I0 and @p I1, and the last 2 elements are selected from @p b by @p I2 and @p I3.
+template <int I0, int I1, int I2, int I3>
+[[nodiscard]] inline auto shuffle(Float4 a, Float4 b) noexcept -> Float4 {
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(I3, I2, I1, I0));
+}
+
+#    elif defined(INK_SIMD_NEON)
+
+/// @brief
+///   4 packed single precision floating point values.
+using Float4 = float32x4_t;
+
+/// @brief
+///   Load 4 floating point values from 16-byte aligned memory.
+[[nodiscard]] inline auto load(const float *ptr) noexcept -> Float4 { return vld1q_f32(ptr); }
+
+/// @brief
+///   Store 4 floating point values to 16-byte aligned memory.
+inline auto store(float *ptr, Float4 value) noexcept -> void { vst1q_f32(ptr, value); }
+
+/// @brief
+///   Load 4 floating point values from memory without alignment requirement.
+[[nodiscard]] inline auto loadUnaligned(const float *ptr) noexcept -> Float4 {
+    return vld1q_f32(ptr);
+}
+
+/// @brief
+///   Store 4 floating point values to memory without alignment requirement.
+inline auto storeUnaligned(float *ptr, Float4 value) noexcept -> void { vst1q_f32(ptr, value); }
+
+/// @brief
+///   Fill all 4 elements with the specified value.
+[[nodiscard]] inline auto splat(float value) noexcept -> Float4 { return vdupq_n_f32(value); }
+
+/// @brief
+///   Create a packed value from 4 floating point values.
+[[nodiscard]] inline auto set(float x, float y, float z, float w) noexcept -> Float4 {
+    const float values[4] = {x, y, z, w};
+    return vld1q_f32(values);
+}
+
+/// @brief
+///   Get the first element of the packed value.
+[[nodiscard]] inline auto first(Float4 value) noexcept -> float { return vgetq_lane_f32(value, 0); }
+
+[[nodiscard]] inline auto add(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return vaddq_f32(lhs, rhs);
+}
+
+[[nodiscard]] inline auto sub(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return vsubq_f32(lhs, rhs);
+}
+
+[[nodiscard]] inline auto mul(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return vmulq_f32(lhs, rhs);
+}
+
+[[nodiscard]] inline auto div(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return vdivq_f32(lhs, rhs);
+}
+
+[[nodiscard]] inline auto sqrt(Float4 value) noexcept -> Float4 { return vsqrtq_f32(value); }
+
+/// @brief
+///   Approximate reciprocal square root. The NEON estimate only has 8 bits of precision, so it is
+///   refined with 2 Newton-Raphson steps to match precision of the SSE implementation.
+[[nodiscard]] inline auto rsqrt(Float4 value) noexcept -> Float4 {
+    float32x4_t y = vrsqrteq_f32(value);
+    y             = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(value, y), y));
+    y             = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(value, y), y));
+    return y;
+}
+
+[[nodiscard]] inline auto min(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return vminq_f32(lhs, rhs);
+}
+
+[[nodiscard]] inline auto max(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return vmaxq_f32(lhs, rhs);
+}
+
+[[nodiscard]] inline auto abs(Float4 value) noexcept -> Float4 { return vabsq_f32(value); }
+
+/// @brief
+///   Element-wise less than comparison. Each element of the result is either all 0 or all 1 bits.
+[[nodiscard]] inline auto lessThan(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return vreinterpretq_f32_u32(vcltq_f32(lhs, rhs));
+}
+
+/// @brief
+///   Element-wise less equal comparison. Each element of the result is either all 0 or all 1 bits.
+[[nodiscard]] inline auto lessEqual(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return vreinterpretq_f32_u32(vcleq_f32(lhs, rhs));
+}
+
+/// @brief
+///   Select elements from @p a where @p mask is set and from @p b otherwise.
+[[nodiscard]] inline auto select(Float4 mask, Float4 a, Float4 b) noexcept -> Float4 {
+    return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+}
+
+/// @brief
+///   Bitwise and of 2 lane masks.
+[[nodiscard]] inline auto maskAnd(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(lhs), vreinterpretq_u32_f32(rhs)));
+}
+
+/// @brief
+///   Bitwise or of 2 lane masks.
+[[nodiscard]] inline auto maskOr(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(lhs), vreinterpretq_u32_f32(rhs)));
+}
+
+/// @brief
+///   Gather the sign bit of each lane into an integer. Bit i is set if lane i is set.
+[[nodiscard]] inline auto maskBits(Float4 mask) noexcept -> std::uint32_t {
+    const uint32_t   weights[4] = {1, 2, 4, 8};
+    const uint32x4_t bits       = vshrq_n_u32(vreinterpretq_u32_f32(mask), 31);
+    return vaddvq_u32(vmulq_u32(bits, vld1q_u32(weights)));
+}
+
+/// @brief
+///   Shuffle elements of 2 packed values. The first 2 elements of the result are selected from @p
+///   a by @p I0 and @p I1, and the last 2 elements are selected from @p b by @p I2 and @p I3.
+template <int I0, int I1, int I2, int I3>
+[[nodiscard]] inline auto shuffle(Float4 a, Float4 b) noexcept -> Float4 {
+    Float4 result = vdupq_n_f32(vgetq_lane_f32(a, I0));
+    result        = vsetq_lane_f32(vgetq_lane_f32(a, I1), result, 1);
+    result        = vsetq_lane_f32(vgetq_lane_f32(b, I2), result, 2);
+    result        = vsetq_lane_f32(vgetq_lane_f32(b, I3), result, 3);
+    return result;
+}
+
+#    endif
+
+/// @brief
+///   Broadcast the specified element to all elements.
+template <int I>
+[[nodiscard]] inline auto broadcast(Float4 value) noexcept -> Float4 {
+    return shuffle<I, I, I, I>(value, value);
+}
+
+/// @brief
+///   Transpose 4 packed values as a 4x4 matrix in place.
+inline auto transpose(Float4 &a, Float4 &b, Float4 &c, Float4 &d) noexcept -> void {
+    const Float4 t0 = shuffle<0, 1, 0, 1>(a, b);
+    const Float4 t1 = shuffle<2, 3, 2, 3>(a, b);
+    const Float4 t2 = shuffle<0, 1, 0, 1>(c, d);
+    const Float4 t3 = shuffle<2, 3, 2, 3>(c, d);
+
+    a = shuffle<0, 2, 0, 2>(t0, t2);
+    b = shuffle<1, 3, 1, 3>(t0, t2);
+    c = shuffle<0, 2, 0, 2>(t1, t3);
+    d = shuffle<1, 3, 1, 3>(t1, t3);
+}
+
+/// @brief
+///   Calculate dot production of 2 packed values. The result is broadcasted to all elements.
+/// @note
+///   Elements are summed up in the same order as the scalar implementation so that SIMD and scalar
+///   code paths produce exactly the same result.
+[[nodiscard]] inline auto dot(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    const Float4 m = mul(lhs, rhs);
+    Float4       s = add(m, broadcast<1>(m));
+    s              = add(s, broadcast<2>(m));
+    s              = add(s, broadcast<3>(m));
+    return broadcast<0>(s);
+}
+
+/// @brief
+///   Normalize the specified packed value as a 4D vector.
+[[nodiscard]] inline auto normalize(Float4 value) noexcept -> Float4 {
+    const Float4 len = sqrt(dot(value, value));
+    return mul(value, div(splat(1.0f), len));
+}
+
+/// @brief
+///   Normalize the specified packed value as a 4D vector with approximate reciprocal square root.
+[[nodiscard]] inline auto normalizeFast(Float4 value) noexcept -> Float4 {
+    return mul(value, rsqrt(dot(value, value)));
+}
+
+/// @brief
+///   Approximate reciprocal square root of a scalar value.
+[[nodiscard]] inline auto rsqrt(float value) noexcept -> float { return first(rsqrt(splat(value))); }
+
+/// @brief
+///   Calculate linear combination of the 4 columns of a column major 4x4 matrix.
+///
+/// @param m
+///   Pointer to the 16-byte aligned column major 4x4 matrix.
+/// @param v
+///   Weights of each column.
+///
+/// @return
+///   c0 * v.x + c1 * v.y + c2 * v.z + c3 * v.w
+[[nodiscard]] inline auto combine(const float *m, Float4 v) noexcept -> Float4 {
+    Float4 result = mul(load(m), broadcast<0>(v));
+    result        = add(result, mul(load(m + 4), broadcast<1>(v)));
+    result        = add(result, mul(load(m + 8), broadcast<2>(v)));
+    result        = add(result, mul(load(m + 12), broadcast<3>(v)));
+    return result;
+}
+
+/// @brief
+///   Multiply 2 column major 4x4 matrices.
+/// @note
+///   @p out is allowed to be the same as @p lhs or @p rhs.
+///
+/// @param lhs
+///   Pointer to the 16-byte aligned left hand side matrix.
+/// @param rhs
+///   Pointer to the 16-byte aligned right hand side matrix.
+/// @param[out] out
+///   Pointer to the 16-byte aligned matrix to store the result.
+inline auto multiplyMatrix4(const float *lhs, const float *rhs, float *out) noexcept -> void {
+#    if defined(INK_SIMD_AVX2)
+    // Calculate 2 columns at a time. Matrices are only required to be 16-byte aligned.
+    const __m256 l0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(lhs));
+    const __m256 l1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(lhs + 4));
+    const __m256 l2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(lhs + 8));
+    const __m256 l3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(lhs + 12));
+
+    for (int i = 0; i < 16; i += 8) {
+        const __m256 r = _mm256_loadu_ps(rhs + i);
+
+        __m256 c = _mm256_mul_ps(l0, _mm256_permute_ps(r, 0x00));
+        c        = _mm256_add_ps(c, _mm256_mul_ps(l1, _mm256_permute_ps(r, 0x55)));
+        c        = _mm256_add_ps(c, _mm256_mul_ps(l2, _mm256_permute_ps(r, 0xAA)));
+        c        = _mm256_add_ps(c, _mm256_mul_ps(l3, _mm256_permute_ps(r, 0xFF)));
+
+        _mm256_storeu_ps(out + i, c);
+    }
+#    else
+    const Float4 r0 = load(rhs);
+    const Float4 r1 = load(rhs + 4);
+    const Float4 r2 = load(rhs + 8);
+    const Float4 r3 = load(rhs + 12);
+
+    const Float4 c0 = combine(lhs, r0);
+    const Float4 c1 = combine(lhs, r1);
+    const Float4 c2 = combine(lhs, r2);
+    const Float4 c3 = combine(lhs, r3);
+
+    store(out, c0);
+    store(out + 4, c1);
+    store(out + 8, c2);
+    store(out + 12, c3);
+#    endif
+}
+
+/// @brief
+///   Transpose a column major 4x4 matrix.
+/// @note
+///   @p out is allowed to be the same as @p m.
+inline auto transposeMatrix4(const float *m, float *out) noexcept -> void {
+    Float4 c0 = load(m);
+    Float4 c1 = load(m + 4);
+    Float4 c2 = load(m + 8);
+    Float4 c3 = load(m + 12);
+
+    transpose(c0, c1, c2, c3);
+
+    store(out, c0);
+    store(out + 4, c1);
+    store(out + 8, c2);
+    store(out + 12, c3);
+}
+
+/// @brief
+///   Multiply a row vector with a column major 4x4 matrix.
+[[nodiscard]] inline auto multiplyVector4Matrix4(Float4 v, const float *m) noexcept -> Float4 {
+    alignas(16) float transposed[16];
+    transposeMatrix4(m, transposed);
+    return combine(transposed, v);
+}
+
+namespace detail {
+
+/// @brief
+///   Calculate 2x2 sub-determinants used by 4x4 matrix inverse. This is the vectorized version of
+///   (c2[P], c2[P], c1[P], c1[P]) * (c3[Q], c3[Q], c3[Q], c2[Q]) -
+///   (c3[P], c3[P], c3[P], c2[P]) * (c2[Q], c2[Q], c1[Q], c1[Q]).
+template <int P, int Q>
+[[nodiscard]] inline auto inverseFactor(Float4 c1, Float4 c2, Float4 c3) noexcept -> Float4 {
+    const Float4 s21p = shuffle<P, P, P, P>(c2, c1);
+    const Float4 s21q = shuffle<Q, Q, Q, Q>(c2, c1);
+    const Float4 s32p = shuffle<P, P, P, P>(c3, c2);
+    const Float4 s32q = shuffle<Q, Q, Q, Q>(c3, c2);
+    const Float4 t32p = shuffle<0, 0, 0, 2>(s32p, s32p);
+    const Float4 t32q = shuffle<0, 0, 0, 2>(s32q, s32q);
+    return sub(mul(s21p, t32q), mul(t32p, s21q));
+}
+
+/// @brief
+///   Vectorized version of (c1[R], c0[R], c0[R], c0[R]).
+template <int R>
+[[nodiscard]] inline auto inverseRow(Float4 c0, Float4 c1) noexcept -> Float4 {
+    const Float4 s = shuffle<R, R, R, R>(c1, c0);
+    return shuffle<0, 2, 2, 2>(s, s);
+}
+
+} // namespace detail
+
+/// @brief
+///   Inverse a column major 4x4 matrix.
+/// @note
+///   This is the vectorized version of the scalar cofactor inverse and produces exactly the same
+///   result. @p out is allowed to be the same as @p m.
+///
+/// @param m
+///   Pointer to the 16-byte aligned matrix to be inversed.
+/// @param[out] out
+///   Pointer to the 16-byte aligned matrix to store the result.
+inline auto inverseMatrix4(const float *m, float *out) noexcept -> void {
+    const Float4 c0 = load(m);
+    const Float4 c1 = load(m + 4);
+    const Float4 c2 = load(m + 8);
+    const Float4 c3 = load(m + 12);
+
+    const Float4 fac0 = detail::inverseFactor<2, 3>(c1, c2, c3);
+    const Float4 fac1 = detail::inverseFactor<1, 3>(c1, c2, c3);
+    const Float4 fac2 = detail::inverseFactor<1, 2>(c1, c2, c3);
+    const Float4 fac3 = detail::inverseFactor<0, 3>(c1, c2, c3);
+    const Float4 fac4 = detail::inverseFactor<0, 2>(c1, c2, c3);
+    const Float4 fac5 = detail::inverseFactor<0, 1>(c1, c2, c3);
+
+    const Float4 v0 = detail::inverseRow<0>(c0, c1);
+    const Float4 v1 = detail::inverseRow<1>(c0, c1);
+    const Float4 v2 = detail::inverseRow<2>(c0, c1);
+    const Float4 v3 = detail::inverseRow<3>(c0, c1);
+
+    const Float4 sgn0 = set(1.0f, -1.0f, 1.0f, -1.0f);
+    const Float4 sgn1 = set(-1.0f, 1.0f, -1.0f, 1.0f);
+
+    const Float4 inv0 = mul(add(sub(mul(v1, fac0), mul(v2, fac1)), mul(v3, fac2)), sgn0);
+    const Float4 inv1 = mul(add(sub(mul(v0, fac0), mul(v2, fac3)), mul(v3, fac4)), sgn1);
+    const Float4 inv2 = mul(add(sub(mul(v0, fac1), mul(v1, fac3)), mul(v3, fac5)), sgn0);
+    const Float4 inv3 = mul(add(sub(mul(v0, fac2), mul(v1, fac4)), mul(v2, fac5)), sgn1);
+
+    // (inv0[0], inv1[0], inv2[0], inv3[0]) dot c0 with the same summation order as scalar code.
+    const Float4 r0   = shuffle<0, 2, 0, 2>(shuffle<0, 0, 0, 0>(inv0, inv1),
+                                            shuffle<0, 0, 0, 0>(inv2, inv3));
+    const Float4 dot0 = mul(c0, r0);
+    const Float4 dot1 = add(dot0, shuffle<1, 0, 3, 2>(dot0, dot0));
+    const Float4 det  = add(dot1, shuffle<2, 3, 0, 1>(dot1, dot1));
+
+    const Float4 invDet = div(splat(1.0f), broadcast<0>(det));
+
+    store(out, mul(inv0, invDet));
+    store(out + 4, mul(inv1, invDet));
+    store(out + 8, mul(inv2, invDet));
+    store(out + 12, mul(inv3, invDet));
+}
+
+/// @brief
+///   Calculate cross production of 2 packed values as 3D vectors. W element of the result is 0 if W
+///   elements of the inputs are finite.
+[[nodiscard]] inline auto cross(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    const Float4 l1 = shuffle<1, 2, 0, 3>(lhs, lhs);
+    const Float4 l2 = shuffle<2, 0, 1, 3>(lhs, lhs);
+    const Float4 r1 = shuffle<1, 2, 0, 3>(rhs, rhs);
+    const Float4 r2 = shuffle<2, 0, 1, 3>(rhs, rhs);
+    return sub(mul(l1, r2), mul(l2, r1));
+}
+
+/// @brief
+///   Inverse a column major 4x4 affine transform matrix. The last column of the matrix is assumed
+///   to be (0, 0, 0, 1).
+/// @note
+///   @p out is allowed to be the same as @p m.
+///
+/// @param m
+///   Pointer to the 16-byte aligned matrix to be inversed.
+/// @param[out] out
+///   Pointer to the 16-byte aligned matrix to store the result.
+inline auto inverseAffineMatrix4(const float *m, float *out) noexcept -> void {
+    const Float4 c0 = load(m);
+    const Float4 c1 = load(m + 4);
+    const Float4 c2 = load(m + 8);
+
+    // Columns of the inversed 3x3 linear part. W elements are 0.
+    Float4       x0     = cross(c1, c2);
+    Float4       x1     = cross(c2, c0);
+    Float4       x2     = cross(c0, c1);
+    const Float4 invDet = div(splat(1.0f), dot(c0, x0));
+
+    x0 = mul(x0, invDet);
+    x1 = mul(x1, invDet);
+    x2 = mul(x2, invDet);
+
+    // Inversed linear part applied to the translation.
+    Float4 t = mul(x0, broadcast<3>(c0));
+    t        = add(t, mul(x1, broadcast<3>(c1)));
+    t        = add(t, mul(x2, broadcast<3>(c2)));
+    t        = sub(splat(0.0f), t);
+
+    transpose(x0, x1, x2, t);
+
+    store(out, x0);
+    store(out + 4, x1);
+    store(out + 8, x2);
+    store(out + 12, set(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+/// @brief
+///   Inverse a column major 4x4 rigid transform matrix. The upper left 3x3 part of the matrix is
+///   assumed to be orthonormal and the last column is assumed to be (0, 0, 0, 1).
+/// @note
+///   @p out is allowed to be the same as @p m.
+///
+/// @param m
+///   Pointer to the 16-byte aligned matrix to be inversed.
+/// @param[out] out
+///   Pointer to the 16-byte aligned matrix to store the result.
+inline auto inverseRigidMatrix4(const float *m, float *out) noexcept -> void {
+    Float4 c0 = load(m);
+    Float4 c1 = load(m + 4);
+    Float4 c2 = load(m + 8);
+
+    // Transposed rotation applied to the translation.
+    Float4 t = mul(c0, broadcast<3>(c0));
+    t        = add(t, mul(c1, broadcast<3>(c1)));
+    t        = add(t, mul(c2, broadcast<3>(c2)));
+    t        = sub(splat(0.0f), t);
+
+    transpose(c0, c1, c2, t);
+
+    store(out, c0);
+    store(out + 4, c1);
+    store(out + 8, c2);
+    store(out + 12, set(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+/// @brief
+///   Calculate inverse transpose of the upper left 3x3 part of a column major 4x4 matrix. The rest
+///   elements of the result are filled with identity.
+/// @note
+///   @p out is allowed to be the same as @p m.
+///
+/// @param m
+///   Pointer to the 16-byte aligned matrix.
+/// @param[out] out
+///   Pointer to the 16-byte aligned matrix to store the result.
+inline auto inverseTransposed3x3Matrix4(const float *m, float *out) noexcept -> void {
+    const Float4 c0 = load(m);
+    const Float4 c1 = load(m + 4);
+    const Float4 c2 = load(m + 8);
+
+    const Float4 x0     = cross(c1, c2);
+    const Float4 x1     = cross(c2, c0);
+    const Float4 x2     = cross(c0, c1);
+    const Float4 invDet = div(splat(1.0f), dot(c0, x0));
+
+    store(out, mul(x0, invDet));
+    store(out + 4, mul(x1, invDet));
+    store(out + 8, mul(x2, invDet));
+    store(out + 12, set(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+/// @brief
+///   Multiply 2 row major 3x4 affine matrices. The missing 4th row of the matrices is considered
+///   as (0, 0, 0, 1).
+/// @note
+///   @p out is allowed to be the same as @p lhs or @p rhs.
+///
+/// @param lhs
+///   Pointer to the 16-byte aligned left hand side matrix.
+/// @param rhs
+///   Pointer to the 16-byte aligned right hand side matrix.
+/// @param[out] out
+///   Pointer to the 16-byte aligned matrix to store the result.
+inline auto multiplyMatrix3x4(const float *lhs, const float *rhs, float *out) noexcept -> void {
+    const Float4 l0 = load(lhs);
+    const Float4 l1 = load(lhs + 4);
+    const Float4 l2 = load(lhs + 8);
+    const Float4 w  = set(0.0f, 0.0f, 0.0f, 1.0f);
+
+    for (int i = 0; i < 12; i += 4) {
+        const Float4 r = load(rhs + i);
+
+        Float4 c = mul(l0, broadcast<0>(r));
+        c        = add(c, mul(l1, broadcast<1>(r)));
+        c        = add(c, mul(l2, broadcast<2>(r)));
+        c        = add(c, mul(r, w));
+
+        store(out + i, c);
+    }
+}
+
+/// @brief
+///   Multiply 2 quaternions stored in (w, x, y, z) order.
+/// @note
+///   This produces exactly the same result as the scalar implementation.
+[[nodiscard]] inline auto multiplyQuaternion(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+    const Float4 t1 = mul(shuffle<1, 0, 3, 2>(lhs, lhs), set(-1.0f, 1.0f, 1.0f, -1.0f));
+    const Float4 t2 = mul(shuffle<2, 3, 0, 1>(lhs, lhs), set(-1.0f, -1.0f, 1.0f, 1.0f));
+    const Float4 t3 = mul(shuffle<3, 2, 1, 0>(lhs, lhs), set(-1.0f, 1.0f, -1.0f, 1.0f));
+
+    Float4 result = mul(lhs, broadcast<0>(rhs));
+    result        = add(result, mul(t1, broadcast<1>(rhs)));
+    result        = add(result, mul(t2, broadcast<2>(rhs)));
+    result        = add(result, mul(t3, broadcast<3>(rhs)));
+    return result;
+}
+
+} // namespace ink::simd
+
+#endif
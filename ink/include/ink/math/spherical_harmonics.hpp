@@ -0,0 +1,803 @@
+#pragma once
+
+#include "batch.hpp"
+
+#include <mutex>
+
+namespace ink {
+
+/// @brief
+///   Spherical harmonics coefficients of the first 2 or 3 bands. Real SH basis without the
+///   Condon-Shortley phase is used, and coefficients are ordered by band: `Y00, Y1-1 (y),
+///   Y10 (z), Y11 (x), Y2-2 (xy), Y2-1 (yz), Y20 (3z^2 - 1), Y21 (xz), Y22 (x^2 - y^2)`.
+/// @note
+///   3 bands represent irradiance of any distant lighting environment with an average error
+///   less than 3%, which makes them a cheap diffuse ambient term for irradiance probes.
+///
+/// @tparam T
+///   Type of the coefficients. This could be @p float for scalar functions or @p Vector3 for RGB
+///   colors.
+/// @tparam N
+///   Number of coefficients. Must be 4 (2 bands) or 9 (3 bands).
+template <typename T, std::size_t N>
+struct SphericalHarmonics {
+    static_assert(N == 4 || N == 9, "Only 2 or 3 bands of spherical harmonics are supported.");
+
+    /// @brief
+    ///   Number of coefficients.
+    static constexpr std::size_t Size = N;
+
+    T coefficients[N];
+
+    /// @brief
+    ///   Create spherical harmonics and initialize all coefficients to 0.
+    constexpr SphericalHarmonics() noexcept : coefficients{} {}
+
+    /// @brief
+    ///   Evaluate SH basis functions at the specified direction.
+    ///
+    /// @param direction
+    ///   The direction to evaluate basis functions at. This should be a unit vector.
+    ///
+    /// @return
+    ///   Values of the basis functions.
+    [[nodiscard]] static constexpr auto basis(Vector3 direction) noexcept
+        -> SphericalHarmonics<float, N> {
+        const float x = direction.x;
+        const float y = direction.y;
+        const float z = direction.z;
+
+        SphericalHarmonics<float, N> result;
+        result[0] = 0.282094791773878143f;
+        result[1] = 0.488602511902919922f * y;
+        result[2] = 0.488602511902919922f * z;
+        result[3] = 0.488602511902919922f * x;
+        if constexpr (N == 9) {
+            result[4] = 1.09254843059207907f * x * y;
+            result[5] = 1.09254843059207907f * y * z;
+            result[6] = 0.315391565252520006f * (3.0f * z * z - 1.0f);
+            result[7] = 1.09254843059207907f * x * z;
+            result[8] = 0.546274215296039535f * (x * x - y * y);
+        }
+        return result;
+    }
+
+    /// @brief
+    ///   Project a single sample into spherical harmonics.
+    ///
+    /// @param direction
+    ///   Direction of the sample. This should be a unit vector.
+    /// @param value
+    ///   Value of the function at @p direction, such as radiance from @p direction.
+    /// @param weight
+    ///   Weight of the sample, usually solid angle that this sample covers.
+    ///
+    /// @return
+    ///   Spherical harmonics that contain only the projected sample.
+    [[nodiscard]] static constexpr auto fromSample(Vector3 direction, T value, float weight = 1.0f)
+        -> SphericalHarmonics {
+        SphericalHarmonics result;
+        result.addSample(direction, value, weight);
+        return result;
+    }
+
+    /// @brief
+    ///   Project a sample and accumulate it into this spherical harmonics.
+    ///
+    /// @param direction
+    ///   Direction of the sample. This should be a unit vector.
+    /// @param value
+    ///   Value of the function at @p direction, such as radiance from @p direction.
+    /// @param weight
+    ///   Weight of the sample, usually solid angle that this sample covers.
+    ///
+    /// @return
+    ///   Reference to this spherical harmonics.
+    constexpr auto addSample(Vector3 direction, T value, float weight = 1.0f) noexcept
+        -> SphericalHarmonics & {
+        const auto b = basis(direction);
+        for (std::size_t i = 0; i < N; ++i)
+            coefficients[i] += value * (b[i] * weight);
+        return *this;
+    }
+
+    /// @brief
+    ///   Evaluate the function represented by this spherical harmonics at the specified direction.
+    ///
+    /// @param direction
+    ///   The direction to evaluate at. This should be a unit vector.
+    ///
+    /// @return
+    ///   Value of the function at @p direction.
+    [[nodiscard]] constexpr auto evaluate(Vector3 direction) const noexcept -> T {
+        const auto b      = basis(direction);
+        T          result = coefficients[0] * b[0];
+        for (std::size_t i = 1; i < N; ++i)
+            result += coefficients[i] * b[i];
+        return result;
+    }
+
+    /// @brief
+    ///   Convolve this spherical harmonics with the clamped cosine lobe, which turns radiance into
+    ///   irradiance.
+    /// @remark
+    ///   To get convolved spherical harmonics without modifying this one, use @p convolved()
+    ///   instead.
+    ///
+    /// @return
+    ///   Reference to this spherical harmonics.
+    constexpr auto convolve() noexcept -> SphericalHarmonics & {
+        // Zonal harmonics coefficients of the clamped cosine lobe, scaled by sqrt(4pi / (2l + 1)).
+        constexpr float Band0 = Pi<float>;
+        constexpr float Band1 = Pi<float> * 2.0f / 3.0f;
+        constexpr float Band2 = Pi<float> / 4.0f;
+
+        coefficients[0] *= Band0;
+        for (std::size_t i = 1; i < 4; ++i)
+            coefficients[i] *= Band1;
+        for (std::size_t i = 4; i < N; ++i)
+            coefficients[i] *= Band2;
+        return *this;
+    }
+
+    /// @brief
+    ///   Get a copy of this spherical harmonics that is convolved with the clamped cosine lobe.
+    /// @remark
+    ///   To convolve this spherical harmonics, use @p convolve() instead.
+    ///
+    /// @return
+    ///   Irradiance spherical harmonics of this radiance spherical harmonics.
+    [[nodiscard]] constexpr auto convolved() const noexcept -> SphericalHarmonics {
+        SphericalHarmonics result = *this;
+        result.convolve();
+        return result;
+    }
+
+    /// @brief
+    ///   Calculate irradiance of the specified surface normal, treating this spherical harmonics as
+    ///   distant radiance. This is the same as `convolved().evaluate(normal)`.
+    /// @note
+    ///   Divide irradiance by pi to get outgoing radiance of a white Lambertian surface.
+    ///
+    /// @param normal
+    ///   Normal of the surface. This should be a unit vector.
+    ///
+    /// @return
+    ///   Irradiance of the surface.
+    [[nodiscard]] constexpr auto irradiance(Vector3 normal) const noexcept -> T {
+        return convolved().evaluate(normal);
+    }
+
+    /// @brief
+    ///   Rotate the function represented by this spherical harmonics. The result @p g satisfies
+    ///   `g(rotate(rotation, d)) == f(d)`.
+    /// @remark
+    ///   To get rotated spherical harmonics without modifying this one, use @p rotated() instead.
+    ///
+    /// @param rotation
+    ///   The rotation quaternion. This should be a unit quaternion.
+    ///
+    /// @return
+    ///   Reference to this spherical harmonics.
+    constexpr auto rotate(Quaternion rotation) noexcept -> SphericalHarmonics & {
+        return rotateBasis(ink::rotate(rotation, Vector3(1.0f, 0.0f, 0.0f)),
+                           ink::rotate(rotation, Vector3(0.0f, 1.0f, 0.0f)),
+                           ink::rotate(rotation, Vector3(0.0f, 0.0f, 1.0f)));
+    }
+
+    /// @brief
+    ///   Rotate the function represented by this spherical harmonics. The result @p g satisfies
+    ///   `g(d * rotation) == f(d)`.
+    /// @remark
+    ///   To get rotated spherical harmonics without modifying this one, use @p rotated() instead.
+    ///
+    /// @param rotation
+    ///   The rotation matrix. This should be an orthonormal matrix.
+    ///
+    /// @return
+    ///   Reference to this spherical harmonics.
+    constexpr auto rotate(const Matrix3 &rotation) noexcept -> SphericalHarmonics & {
+        return rotateBasis(Vector3(rotation[0][0], rotation[1][0], rotation[2][0]),
+                           Vector3(rotation[0][1], rotation[1][1], rotation[2][1]),
+                           Vector3(rotation[0][2], rotation[1][2], rotation[2][2]));
+    }
+
+    /// @brief
+    ///   Get rotated spherical harmonics of this one.
+    /// @remark
+    ///   To rotate this spherical harmonics, use @p rotate() instead.
+    ///
+    /// @param rotation
+    ///   The rotation quaternion. This should be a unit quaternion.
+    ///
+    /// @return
+    ///   The rotated spherical harmonics.
+    [[nodiscard]] constexpr auto rotated(Quaternion rotation) const noexcept
+        -> SphericalHarmonics {
+        SphericalHarmonics result = *this;
+        result.rotate(rotation);
+        return result;
+    }
+
+    /// @brief
+    ///   Get rotated spherical harmonics of this one.
+    /// @remark
+    ///   To rotate this spherical harmonics, use @p rotate() instead.
+    ///
+    /// @param rotation
+    ///   The rotation matrix. This should be an orthonormal matrix.
+    ///
+    /// @return
+    ///   The rotated spherical harmonics.
+    [[nodiscard]] constexpr auto rotated(const Matrix3 &rotation) const noexcept
+        -> SphericalHarmonics {
+        SphericalHarmonics result = *this;
+        result.rotate(rotation);
+        return result;
+    }
+
+    /// @brief
+    ///   Random access coefficients of this spherical harmonics.
+    /// @note
+    ///   No boundary check performed.
+    ///
+    /// @param i
+    ///   Index of the coefficient to be accessed.
+    ///
+    /// @return
+    ///   Reference to the coefficient.
+    constexpr auto operator[](std::size_t i) noexcept -> T & { return coefficients[i]; }
+
+    /// @brief
+    ///   Random access coefficients of this spherical harmonics.
+    /// @note
+    ///   No boundary check performed.
+    ///
+    /// @param i
+    ///   Index of the coefficient to be accessed.
+    ///
+    /// @return
+    ///   Reference to the coefficient.
+    constexpr auto operator[](std::size_t i) const noexcept -> const T & {
+        return coefficients[i];
+    }
+
+    constexpr auto operator+=(const SphericalHarmonics &rhs) noexcept -> SphericalHarmonics & {
+        for (std::size_t i = 0; i < N; ++i)
+            coefficients[i] += rhs.coefficients[i];
+        return *this;
+    }
+
+    constexpr auto operator-=(const SphericalHarmonics &rhs) noexcept -> SphericalHarmonics & {
+        for (std::size_t i = 0; i < N; ++i)
+            coefficients[i] -= rhs.coefficients[i];
+        return *this;
+    }
+
+    constexpr auto operator*=(float rhs) noexcept -> SphericalHarmonics & {
+        for (auto &c : coefficients)
+            c *= rhs;
+        return *this;
+    }
+
+    constexpr auto operator/=(float rhs) noexcept -> SphericalHarmonics & {
+        return (*this *= (1.0f / rhs));
+    }
+
+private:
+    /// @brief
+    ///   Rotate this spherical harmonics with a rotation whose images of the X, Y and Z axes are
+    ///   @p rx, @p ry and @p rz.
+    constexpr auto rotateBasis(Vector3 rx, Vector3 ry, Vector3 rz) noexcept
+        -> SphericalHarmonics &;
+};
+
+/// @brief
+///   Scalar spherical harmonics of 2 bands.
+using SH4 = SphericalHarmonics<float, 4>;
+
+/// @brief
+///   Scalar spherical harmonics of 3 bands.
+using SH9 = SphericalHarmonics<float, 9>;
+
+/// @brief
+///   RGB spherical harmonics of 2 bands.
+using SH4RGB = SphericalHarmonics<Vector3, 4>;
+
+/// @brief
+///   RGB spherical harmonics of 3 bands.
+using SH9RGB = SphericalHarmonics<Vector3, 9>;
+
+namespace detail {
+
+/// @brief
+///   Band 2 rotation helper. Band 2 is rotated by evaluating the rotated function at 5 fixed
+///   directions and solving the coefficients from the 5 values, so that no Wigner matrix is
+///   needed.
+struct SHBand2RotationTable {
+    Vector3 directions[5];
+    float   inverse[5][5];
+
+    constexpr SHBand2RotationTable() noexcept : directions(), inverse() {
+        const float k = 1.0f / ink::sqrt(2.0f);
+        directions[0] = Vector3(1.0f, 0.0f, 0.0f);
+        directions[1] = Vector3(0.0f, 0.0f, 1.0f);
+        directions[2] = Vector3(k, k, 0.0f);
+        directions[3] = Vector3(k, 0.0f, k);
+        directions[4] = Vector3(0.0f, k, k);
+
+        // Invert the matrix of band 2 basis values at the directions with Gauss-Jordan elimination.
+        double m[5][10]{};
+        for (std::size_t i = 0; i < 5; ++i) {
+            const auto b = SH9::basis(directions[i]);
+            for (std::size_t j = 0; j < 5; ++j)
+                m[i][j] = b[j + 4];
+            m[i][i + 5] = 1.0;
+        }
+
+        for (std::size_t col = 0; col < 5; ++col) {
+            std::size_t pivot = col;
+            for (std::size_t row = col + 1; row < 5; ++row) {
+                const double a = m[row][col] < 0 ? -m[row][col] : m[row][col];
+                const double b = m[pivot][col] < 0 ? -m[pivot][col] : m[pivot][col];
+                if (a > b)
+                    pivot = row;
+            }
+
+            for (std::size_t j = 0; j < 10; ++j) {
+                const double t = m[col][j];
+                m[col][j]      = m[pivot][j];
+                m[pivot][j]    = t;
+            }
+
+            const double invPivot = 1.0 / m[col][col];
+            for (std::size_t j = 0; j < 10; ++j)
+                m[col][j] *= invPivot;
+
+            for (std::size_t row = 0; row < 5; ++row) {
+                const double factor = m[row][col];
+                if (row == col || factor == 0)
+                    continue;
+                for (std::size_t j = 0; j < 10; ++j)
+                    m[row][j] -= factor * m[col][j];
+            }
+        }
+
+        for (std::size_t i = 0; i < 5; ++i) {
+            for (std::size_t j = 0; j < 5; ++j)
+                inverse[i][j] = static_cast<float>(m[i][j + 5]);
+        }
+    }
+};
+
+inline constexpr SHBand2RotationTable SHBand2Rotation{};
+
+} // namespace detail
+
+template <typename T, std::size_t N>
+constexpr auto SphericalHarmonics<T, N>::rotateBasis(Vector3 rx, Vector3 ry, Vector3 rz) noexcept
+    -> SphericalHarmonics & {
+    // Band 1 is a linear function dot(v, d) with v = (c3, c1, c2), which is rotated as v.
+    const T c1 = coefficients[1];
+    const T c2 = coefficients[2];
+    const T c3 = coefficients[3];
+
+    coefficients[1] = c3 * rx.y + c1 * ry.y + c2 * rz.y;
+    coefficients[2] = c3 * rx.z + c1 * ry.z + c2 * rz.z;
+    coefficients[3] = c3 * rx.x + c1 * ry.x + c2 * rz.x;
+
+    if constexpr (N == 9) {
+        constexpr const auto &band2 = detail::SHBand2Rotation;
+
+        // Evaluate the original band 2 function at inverse rotated directions.
+        T values[5]{};
+        for (std::size_t i = 0; i < 5; ++i) {
+            const Vector3 d = band2.directions[i];
+            const auto    b = SH9::basis(Vector3(dot(rx, d), dot(ry, d), dot(rz, d)));
+            for (std::size_t j = 0; j < 5; ++j)
+                values[i] += coefficients[j + 4] * b[j + 4];
+        }
+
+        for (std::size_t i = 0; i < 5; ++i) {
+            T c = values[0] * band2.inverse[i][0];
+            for (std::size_t j = 1; j < 5; ++j)
+                c += values[j] * band2.inverse[i][j];
+            coefficients[i + 4] = c;
+        }
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator+(const SphericalHarmonics<T, N> &lhs,
+                         const SphericalHarmonics<T, N> &rhs) noexcept
+    -> SphericalHarmonics<T, N> {
+    SphericalHarmonics<T, N> result = lhs;
+    result += rhs;
+    return result;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator-(const SphericalHarmonics<T, N> &lhs,
+                         const SphericalHarmonics<T, N> &rhs) noexcept
+    -> SphericalHarmonics<T, N> {
+    SphericalHarmonics<T, N> result = lhs;
+    result -= rhs;
+    return result;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator*(const SphericalHarmonics<T, N> &lhs, float rhs) noexcept
+    -> SphericalHarmonics<T, N> {
+    SphericalHarmonics<T, N> result = lhs;
+    result *= rhs;
+    return result;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator*(float lhs, const SphericalHarmonics<T, N> &rhs) noexcept
+    -> SphericalHarmonics<T, N> {
+    return rhs * lhs;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator/(const SphericalHarmonics<T, N> &lhs, float rhs) noexcept
+    -> SphericalHarmonics<T, N> {
+    SphericalHarmonics<T, N> result = lhs;
+    result /= rhs;
+    return result;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator==(const SphericalHarmonics<T, N> &lhs,
+                          const SphericalHarmonics<T, N> &rhs) noexcept -> bool {
+    for (std::size_t i = 0; i < N; ++i) {
+        if (lhs[i] != rhs[i])
+            return false;
+    }
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr auto operator!=(const SphericalHarmonics<T, N> &lhs,
+                          const SphericalHarmonics<T, N> &rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+namespace detail {
+
+/// @brief
+///   Wide lane type of spherical harmonics coefficients.
+template <typename T>
+struct SHLane;
+
+template <>
+struct SHLane<float> {
+    using Type = Float8;
+
+    static auto load(const float *values, std::size_t count) noexcept -> Float8 {
+        if (count == 8)
+            return Float8(values);
+
+        float lanes[8] = {};
+        for (std::size_t i = 0; i < count; ++i)
+            lanes[i] = values[i];
+        return Float8(lanes);
+    }
+
+    static auto store(Float8 lanes, float *values, std::size_t count) noexcept -> void {
+        if (count == 8)
+            return lanes.store(values);
+
+        float arr[8];
+        lanes.store(arr);
+        for (std::size_t i = 0; i < count; ++i)
+            values[i] = arr[i];
+    }
+
+    static auto sum(Float8 lanes) noexcept -> float {
+        float arr[8];
+        lanes.store(arr);
+        return ((arr[0] + arr[1]) + (arr[2] + arr[3])) + ((arr[4] + arr[5]) + (arr[6] + arr[7]));
+    }
+};
+
+template <>
+struct SHLane<Vector3> {
+    using Type = Vector3x8;
+
+    static auto load(const Vector3 *values, std::size_t count) noexcept -> Vector3x8 {
+        return Vector3x8(values, count);
+    }
+
+    static auto store(Vector3x8 lanes, Vector3 *values, std::size_t count) noexcept -> void {
+        lanes.store(values, count);
+    }
+
+    static auto sum(Vector3x8 lanes) noexcept -> Vector3 {
+        return {SHLane<float>::sum(lanes.x), SHLane<float>::sum(lanes.y),
+                SHLane<float>::sum(lanes.z)};
+    }
+};
+
+/// @brief
+///   Evaluate SH basis functions of 8 directions.
+template <std::size_t N>
+inline auto shBasis(const Vector3x8 &direction, Float8 (&basis)[N]) noexcept -> void {
+    const Float8 &x = direction.x;
+    const Float8 &y = direction.y;
+    const Float8 &z = direction.z;
+
+    basis[0] = Float8(0.282094791773878143f);
+    basis[1] = 0.488602511902919922f * y;
+    basis[2] = 0.488602511902919922f * z;
+    basis[3] = 0.488602511902919922f * x;
+    if constexpr (N == 9) {
+        basis[4] = 1.09254843059207907f * x * y;
+        basis[5] = 1.09254843059207907f * y * z;
+        basis[6] = 0.315391565252520006f * (3.0f * z * z - 1.0f);
+        basis[7] = 1.09254843059207907f * x * z;
+        basis[8] = 0.546274215296039535f * (x * x - y * y);
+    }
+}
+
+/// @brief
+///   Sum partial results of @p func over [0, count), possibly in parallel. Partial results are
+///   summed in order of their ranges so that the result does not depend on thread scheduling.
+template <typename Result, typename Func>
+inline auto parallelSum(std::size_t count, Func &&func) -> Result {
+    if (count < ParallelBatchThreshold)
+        return func(std::size_t(0), count);
+
+    std::mutex                                  mutex;
+    std::vector<std::pair<std::size_t, Result>> partials;
+    partials.reserve(std::thread::hardware_concurrency() + 1);
+
+    parallelBatch(count, [&](std::size_t first, std::size_t last) {
+        const Result partial = func(first, last);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        partials.emplace_back(first, partial);
+    });
+
+    std::sort(partials.begin(), partials.end(),
+              [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+    Result result;
+    for (const auto &partial : partials)
+        result += partial.second;
+    return result;
+}
+
+/// @brief
+///   Project samples in [first, last) into spherical harmonics.
+template <std::size_t N, typename T>
+inline auto projectSamplesRange(const Vector3 *directions,
+                                const T       *values,
+                                std::size_t    first,
+                                std::size_t    last) noexcept -> SphericalHarmonics<T, N> {
+    using Lane = SHLane<T>;
+
+    typename Lane::Type sum[N];
+    Float8              basis[N];
+
+    for (std::size_t i = first; i < last; i += 8) {
+        const std::size_t         count = std::min<std::size_t>(8, last - i);
+        const typename Lane::Type value = Lane::load(values + i, count);
+
+        shBasis(Vector3x8(directions + i, count), basis);
+        for (std::size_t j = 0; j < N; ++j)
+            sum[j] += value * basis[j];
+    }
+
+    SphericalHarmonics<T, N> result;
+    for (std::size_t j = 0; j < N; ++j)
+        result[j] = Lane::sum(sum[j]);
+    return result;
+}
+
+/// @brief
+///   Direction of the cubemap texel center. Faces are ordered as +X, -X, +Y, -Y, +Z, -Z and texels
+///   of each face are stored row by row from top to bottom, which is the same as Direct3D.
+inline auto cubemapDirection(std::size_t face, float u, float v) noexcept -> Vector3 {
+    switch (face) {
+    case 0:
+        return {1.0f, -v, -u};
+    case 1:
+        return {-1.0f, -v, u};
+    case 2:
+        return {u, 1.0f, v};
+    case 3:
+        return {u, -1.0f, -v};
+    case 4:
+        return {u, -v, 1.0f};
+    default:
+        return {-u, -v, -1.0f};
+    }
+}
+
+/// @brief
+///   Partial result of cubemap projection.
+template <typename T, std::size_t N>
+struct CubemapProjection {
+    SphericalHarmonics<T, N> sh;
+    float                    weight = 0;
+
+    auto operator+=(const CubemapProjection &rhs) noexcept -> CubemapProjection & {
+        sh += rhs.sh;
+        weight += rhs.weight;
+        return *this;
+    }
+};
+
+/// @brief
+///   Project cubemap texels in [first, last) into spherical harmonics. Texels are indexed as if all
+///   faces were stored contiguously.
+template <std::size_t N, typename T>
+inline auto projectCubemapRange(const T *const faces[6],
+                                std::size_t    size,
+                                std::size_t    first,
+                                std::size_t    last) noexcept -> CubemapProjection<T, N> {
+    using Lane = SHLane<T>;
+
+    const std::size_t faceSize = size * size;
+    const float       invSize  = 2.0f / static_cast<float>(size);
+
+    typename Lane::Type sum[N];
+    Float8              weightSum;
+    Float8              basis[N];
+
+    for (std::size_t i = first; i < last; i += 8) {
+        const std::size_t count = std::min<std::size_t>(8, last - i);
+
+        Vector3 directions[8]{};
+        T       texels[8]{};
+        for (std::size_t lane = 0; lane < count; ++lane) {
+            const std::size_t face  = (i + lane) / faceSize;
+            const std::size_t texel = (i + lane) % faceSize;
+            const float       u = (static_cast<float>(texel % size) + 0.5f) * invSize - 1.0f;
+            const float       v = (static_cast<float>(texel / size) + 0.5f) * invSize - 1.0f;
+
+            directions[lane] = cubemapDirection(face, u, v);
+            texels[lane]     = faces[face][texel];
+        }
+
+        // Solid angle of a texel is proportional to 1 / length^3 of the unnormalized direction.
+        // Padded lanes have zero directions and are masked out.
+        Vector3x8    direction(directions, count);
+        const Float8 lengthSquared = dot(direction, direction);
+        const Float8 invLength     = 1.0f / sqrt(max(lengthSquared, Float8(1.0f)));
+        const Float8 invLength3    = invLength * invLength * invLength;
+        const Float8 weight        = select(lengthSquared > Float8(0.0f), invLength3, Float8(0.0f));
+
+        direction = direction * invLength;
+        shBasis(direction, basis);
+
+        const typename Lane::Type value = Lane::load(texels, count) * weight;
+        for (std::size_t j = 0; j < N; ++j)
+            sum[j] += value * basis[j];
+        weightSum += weight;
+    }
+
+    CubemapProjection<T, N> result;
+    for (std::size_t j = 0; j < N; ++j)
+        result.sh[j] = Lane::sum(sum[j]);
+    result.weight = SHLane<float>::sum(weightSum);
+    return result;
+}
+
+/// @brief
+///   Evaluate spherical harmonics at directions in [first, last).
+template <typename T, std::size_t N>
+inline auto evaluateRange(const SphericalHarmonics<T, N> &sh,
+                          const Vector3                  *directions,
+                          T                              *out,
+                          std::size_t                     first,
+                          std::size_t                     last) noexcept -> void {
+    using Lane = SHLane<T>;
+
+    typename Lane::Type coefficients[N];
+    for (std::size_t j = 0; j < N; ++j)
+        coefficients[j] = typename Lane::Type(sh[j]);
+
+    Float8 basis[N];
+    for (std::size_t i = first; i < last; i += 8) {
+        const std::size_t count = std::min<std::size_t>(8, last - i);
+        shBasis(Vector3x8(directions + i, count), basis);
+
+        typename Lane::Type result = coefficients[0] * basis[0];
+        for (std::size_t j = 1; j < N; ++j)
+            result += coefficients[j] * basis[j];
+        Lane::store(result, out + i, count);
+    }
+}
+
+} // namespace detail
+
+/// @brief
+///   Project an array of samples into spherical harmonics. Samples are considered uniformly
+///   distributed over the sphere, so each sample is weighted by `4pi / count`.
+/// @note
+///   Samples are processed 8 at a time in SoA layout. Large arrays are split across threads.
+///
+/// @tparam N
+///   Number of spherical harmonics coefficients. Must be 4 or 9.
+/// @param[in] directions
+///   Directions of the samples. These should be unit vectors.
+/// @param[in] values
+///   Values of the samples, such as radiance from each direction.
+/// @param count
+///   Number of samples.
+///
+/// @return
+///   The projected spherical harmonics.
+template <std::size_t N, typename T>
+[[nodiscard]] auto projectSamples(const Vector3 *directions, const T *values, std::size_t count)
+    -> SphericalHarmonics<T, N> {
+    if (count == 0)
+        return {};
+
+    auto result = detail::parallelSum<SphericalHarmonics<T, N>>(
+        count, [&](std::size_t first, std::size_t last) {
+            return detail::projectSamplesRange<N>(directions, values, first, last);
+        });
+
+    result *= 4.0f * Pi<float> / static_cast<float>(count);
+    return result;
+}
+
+/// @brief
+///   Project a cubemap into spherical harmonics. Each texel is weighted by the solid angle it
+///   covers, and the total weight is normalized to 4pi.
+/// @note
+///   Texels are processed 8 at a time in SoA layout. Large cubemaps are split across threads.
+///
+/// @tparam N
+///   Number of spherical harmonics coefficients. Must be 4 or 9.
+/// @param[in] faces
+///   Texels of the 6 faces, ordered as +X, -X, +Y, -Y, +Z, -Z. Texels of each face are stored row
+///   by row from top to bottom, which is the same as Direct3D cubemaps.
+/// @param size
+///   Width and height in texels of each face.
+///
+/// @return
+///   The projected spherical harmonics.
+template <std::size_t N, typename T>
+[[nodiscard]] auto projectCubemap(const T *const faces[6], std::size_t size)
+    -> SphericalHarmonics<T, N> {
+    if (size == 0)
+        return {};
+
+    const auto projection = detail::parallelSum<detail::CubemapProjection<T, N>>(
+        6 * size * size, [&](std::size_t first, std::size_t last) {
+            return detail::projectCubemapRange<N>(faces, size, first, last);
+        });
+
+    return projection.sh * (4.0f * Pi<float> / projection.weight);
+}
+
+/// @brief
+///   Evaluate spherical harmonics at an array of directions.
+/// @note
+///   Directions are processed 8 at a time in SoA layout. Large arrays are split across threads.
+///
+/// @param sh
+///   The spherical harmonics to be evaluated.
+/// @param[in] directions
+///   Directions to evaluate at. These should be unit vectors.
+/// @param[out] out
+///   Pointer to the array to store the results.
+/// @param count
+///   Number of directions.
+template <typename T, std::size_t N>
+auto evaluate(const SphericalHarmonics<T, N> &sh,
+              const Vector3                  *directions,
+              T                              *out,
+              std::size_t                     count) noexcept -> void {
+    detail::parallelBatch(count, [&](std::size_t first, std::size_t last) {
+        detail::evaluateRange(sh, directions, out, first, last);
+    });
+}
+
+} // namespace ink
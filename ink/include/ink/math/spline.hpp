@@ -0,0 +1,692 @@
+#pragma once
+
+#include "quaternion.hpp"
+#include "wide.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace ink {
+namespace detail {
+
+/// @brief
+///   Cubic Hermite basis. Control points are start point, start tangent, end point and end
+///   tangent.
+struct HermiteBasis {
+    template <typename T>
+    static constexpr auto weights(T t, T (&w)[4]) noexcept -> void {
+        const T t2 = t * t;
+        const T t3 = t2 * t;
+        w[0]       = 2.0f * t3 - 3.0f * t2 + 1.0f;
+        w[1]       = t3 - 2.0f * t2 + t;
+        w[2]       = 3.0f * t2 - 2.0f * t3;
+        w[3]       = t3 - t2;
+    }
+};
+
+/// @brief
+///   Cubic Bezier basis in Bernstein form.
+struct BezierBasis {
+    template <typename T>
+    static constexpr auto weights(T t, T (&w)[4]) noexcept -> void {
+        const T s = 1.0f - t;
+        w[0]      = s * s * s;
+        w[1]      = 3.0f * s * s * t;
+        w[2]      = 3.0f * s * t * t;
+        w[3]      = t * t * t;
+    }
+};
+
+/// @brief
+///   Uniform Catmull-Rom basis. The curve goes from the second point to the third point.
+struct CatmullRomBasis {
+    template <typename T>
+    static constexpr auto weights(T t, T (&w)[4]) noexcept -> void {
+        const T t2 = t * t;
+        const T t3 = t2 * t;
+        w[0]       = 0.5f * (2.0f * t2 - t3 - t);
+        w[1]       = 0.5f * (3.0f * t3 - 5.0f * t2 + 2.0f);
+        w[2]       = 0.5f * (4.0f * t2 + t - 3.0f * t3);
+        w[3]       = 0.5f * (t3 - t2);
+    }
+};
+
+/// @brief
+///   Uniform cubic B-spline basis. The curve does not pass through the control points.
+struct BSplineBasis {
+    template <typename T>
+    static constexpr auto weights(T t, T (&w)[4]) noexcept -> void {
+        const T s  = 1.0f - t;
+        const T t2 = t * t;
+        const T t3 = t2 * t;
+        w[0]       = s * s * s * (1.0f / 6.0f);
+        w[1]       = (3.0f * t3 - 6.0f * t2 + 4.0f) * (1.0f / 6.0f);
+        w[2]       = (3.0f * (t2 + t - t3) + 1.0f) * (1.0f / 6.0f);
+        w[3]       = t3 * (1.0f / 6.0f);
+    }
+};
+
+/// @brief
+///   Evaluate a cubic segment with the specified basis.
+template <typename Basis, typename T>
+constexpr auto evaluateCubic(T p0, T p1, T p2, T p3, float t) noexcept -> T {
+    float w[4]{};
+    Basis::weights(t, w);
+    return p0 * w[0] + p1 * w[1] + p2 * w[2] + p3 * w[3];
+}
+
+/// @brief
+///   Load up to 8 floats. Lanes that are not loaded are set to 0.
+inline auto loadLanes(const float *values, std::size_t count) noexcept -> Float8 {
+    if (count == 8)
+        return Float8(values);
+
+    float lanes[8]{};
+    std::copy(values, values + count, lanes);
+    return Float8(lanes);
+}
+
+/// @brief
+///   Evaluate a cubic segment at each parameter with the specified basis, 8 parameters at a time.
+template <typename Basis>
+inline auto evaluateCubic(Vector3      p0,
+                          Vector3      p1,
+                          Vector3      p2,
+                          Vector3      p3,
+                          const float *t,
+                          Vector3     *out,
+                          std::size_t  count) noexcept -> void {
+    const Vector3x8 v0(p0), v1(p1), v2(p2), v3(p3);
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(8, count - i);
+
+        Float8 w[4];
+        Basis::weights(loadLanes(t + i, n), w);
+        (v0 * w[0] + v1 * w[1] + v2 * w[2] + v3 * w[3]).store(out + i, n);
+    }
+}
+
+/// @brief
+///   Map a path parameter to a segment index and a local parameter. Segment i goes from point i
+///   to point i + 1.
+inline auto pathSegment(std::size_t pointCount, float t, std::size_t &segment) noexcept -> float {
+    // NaN is mapped to 0.
+    const auto  segmentCount = static_cast<float>(pointCount - 1);
+    const float x            = (t > 0.0f ? std::min(t, 1.0f) : 0.0f) * segmentCount;
+    const float index        = std::min(std::floor(x), segmentCount - 1.0f);
+
+    segment = static_cast<std::size_t>(index);
+    return x - index;
+}
+
+/// @brief
+///   Get control point of a path. Points out of range are clamped to the end points.
+inline auto pathPoint(const Vector3 *points, std::size_t pointCount, std::ptrdiff_t index) noexcept
+    -> Vector3 {
+    const auto last = static_cast<std::ptrdiff_t>(pointCount) - 1;
+    return points[std::clamp<std::ptrdiff_t>(index, 0, last)];
+}
+
+/// @brief
+///   Evaluate a path of cubic segments at the specified parameter.
+template <typename Basis>
+inline auto evaluatePath(const Vector3 *points, std::size_t pointCount, float t) noexcept
+    -> Vector3 {
+    if (pointCount == 1)
+        return points[0];
+
+    std::size_t segment;
+    const float local = pathSegment(pointCount, t, segment);
+    const auto  i     = static_cast<std::ptrdiff_t>(segment);
+    return evaluateCubic<Basis>(pathPoint(points, pointCount, i - 1),
+                                pathPoint(points, pointCount, i),
+                                pathPoint(points, pointCount, i + 1),
+                                pathPoint(points, pointCount, i + 2), local);
+}
+
+/// @brief
+///   Map 8 path parameters to local parameters and load control points of the segment of each
+///   lane. Lanes may fall on different segments, so control points are gathered per lane.
+inline auto pathLanes(const Vector3 *points,
+                      std::size_t    pointCount,
+                      Float8         t,
+                      Float8        &local,
+                      Vector3x8 (&p)[4]) noexcept -> void {
+#if defined(INK_SIMD_AVX2)
+    static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be 3 packed floats.");
+
+    // maxps returns the second operand for NaN, so NaN is mapped to 0 like the scalar version.
+    const __m256 clamped =
+        _mm256_min_ps(_mm256_max_ps(t.value, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+    const __m256 x = _mm256_mul_ps(clamped, _mm256_set1_ps(static_cast<float>(pointCount - 1)));
+
+    const __m256i last    = _mm256_set1_epi32(static_cast<int>(pointCount - 1));
+    const __m256i one     = _mm256_set1_epi32(1);
+    const __m256i segment = _mm256_min_epi32(_mm256_cvttps_epi32(x), _mm256_sub_epi32(last, one));
+    local.value           = _mm256_sub_ps(x, _mm256_cvtepi32_ps(segment));
+
+    const float *base  = &points[0].x;
+    __m256i      index = _mm256_sub_epi32(segment, one);
+    for (std::size_t j = 0; j < 4; ++j) {
+        const __m256i clampedIndex =
+            _mm256_min_epi32(_mm256_max_epi32(index, _mm256_setzero_si256()), last);
+        const __m256i offset = _mm256_add_epi32(clampedIndex, _mm256_slli_epi32(clampedIndex, 1));
+
+        p[j].x.value = _mm256_i32gather_ps(base, offset, 4);
+        p[j].y.value = _mm256_i32gather_ps(base + 1, offset, 4);
+        p[j].z.value = _mm256_i32gather_ps(base + 2, offset, 4);
+        index        = _mm256_add_epi32(index, one);
+    }
+#else
+    float ts[8];
+    t.store(ts);
+
+    float locals[8];
+    float x[4][8], y[4][8], z[4][8];
+    for (std::size_t k = 0; k < 8; ++k) {
+        std::size_t segment;
+        locals[k] = pathSegment(pointCount, ts[k], segment);
+        for (std::size_t j = 0; j < 4; ++j) {
+            const auto    index = static_cast<std::ptrdiff_t>(segment + j) - 1;
+            const Vector3 point = pathPoint(points, pointCount, index);
+            x[j][k]             = point.x;
+            y[j][k]             = point.y;
+            z[j][k]             = point.z;
+        }
+    }
+
+    local = Float8(locals);
+    for (std::size_t j = 0; j < 4; ++j)
+        p[j] = Vector3x8{Float8(x[j]), Float8(y[j]), Float8(z[j])};
+#endif
+}
+
+/// @brief
+///   Evaluate a path of cubic segments at each parameter, 8 parameters at a time. Control points
+///   of each lane are loaded separately since lanes may fall on different segments.
+template <typename Basis>
+inline auto evaluatePath(const Vector3 *points,
+                         std::size_t    pointCount,
+                         const float   *t,
+                         Vector3       *out,
+                         std::size_t    count) noexcept -> void {
+    if (pointCount == 1) {
+        std::fill(out, out + count, points[0]);
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        const std::size_t n = std::min<std::size_t>(8, count - i);
+
+        Float8    local;
+        Vector3x8 p[4];
+        pathLanes(points, pointCount, loadLanes(t + i, n), local, p);
+
+        Float8 w[4];
+        Basis::weights(local, w);
+        (p[0] * w[0] + p[1] * w[1] + p[2] * w[2] + p[3] * w[3]).store(out + i, n);
+    }
+}
+
+/// @brief
+///   Calculate logarithm of a unit quaternion. The result is a pure quaternion.
+inline auto logarithm(Quaternion q) noexcept -> Quaternion {
+    const float s = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+    if (s < 1e-6f)
+        return {0.0f, q.x, q.y, q.z};
+
+    const float scale = std::atan2(s, q.w) / s;
+    return {0.0f, q.x * scale, q.y * scale, q.z * scale};
+}
+
+/// @brief
+///   Calculate exponential of a pure quaternion. The result is a unit quaternion.
+inline auto exponential(Quaternion q) noexcept -> Quaternion {
+    const float theta = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+    if (theta < 1e-6f)
+        return Quaternion(1.0f, q.x, q.y, q.z).normalized();
+
+    const float scale = std::sin(theta) / theta;
+    return {std::cos(theta), q.x * scale, q.y * scale, q.z * scale};
+}
+
+} // namespace detail
+
+/// @brief
+///   Evaluate a cubic Hermite curve.
+///
+/// @tparam T
+///   Type of the control points, e.g. @p float, @p Vector2 or @p Vector3.
+/// @param p0
+///   Start point of the curve.
+/// @param m0
+///   Tangent at the start point.
+/// @param p1
+///   End point of the curve.
+/// @param m1
+///   Tangent at the end point.
+/// @param t
+///   Curve parameter. 0 returns @p p0 and 1 returns @p p1.
+///
+/// @return
+///   Point on the curve.
+template <typename T>
+[[nodiscard]] constexpr auto hermite(T p0, T m0, T p1, T m1, float t) noexcept -> T {
+    return detail::evaluateCubic<detail::HermiteBasis>(p0, m0, p1, m1, t);
+}
+
+/// @brief
+///   Evaluate a cubic Bezier curve.
+///
+/// @tparam T
+///   Type of the control points, e.g. @p float, @p Vector2 or @p Vector3.
+/// @param p0
+///   Start point of the curve.
+/// @param p1
+///   The first control point.
+/// @param p2
+///   The second control point.
+/// @param p3
+///   End point of the curve.
+/// @param t
+///   Curve parameter. 0 returns @p p0 and 1 returns @p p3.
+///
+/// @return
+///   Point on the curve.
+template <typename T>
+[[nodiscard]] constexpr auto bezier(T p0, T p1, T p2, T p3, float t) noexcept -> T {
+    return detail::evaluateCubic<detail::BezierBasis>(p0, p1, p2, p3, t);
+}
+
+/// @brief
+///   Evaluate a uniform Catmull-Rom segment. The segment goes through @p p1 and @p p2, and the
+///   tangents are derived from the neighbor points.
+///
+/// @tparam T
+///   Type of the control points, e.g. @p float, @p Vector2 or @p Vector3.
+/// @param p0
+///   The point before the segment.
+/// @param p1
+///   Start point of the segment.
+/// @param p2
+///   End point of the segment.
+/// @param p3
+///   The point after the segment.
+/// @param t
+///   Segment parameter. 0 returns @p p1 and 1 returns @p p2.
+///
+/// @return
+///   Point on the segment.
+template <typename T>
+[[nodiscard]] constexpr auto catmullRom(T p0, T p1, T p2, T p3, float t) noexcept -> T {
+    return detail::evaluateCubic<detail::CatmullRomBasis>(p0, p1, p2, p3, t);
+}
+
+/// @brief
+///   Evaluate a uniform cubic B-spline segment. B-splines are C2 continuous but do not pass
+///   through the control points.
+///
+/// @tparam T
+///   Type of the control points, e.g. @p float, @p Vector2 or @p Vector3.
+/// @param p0
+///   The first control point.
+/// @param p1
+///   The second control point.
+/// @param p2
+///   The third control point.
+/// @param p3
+///   The fourth control point.
+/// @param t
+///   Segment parameter between 0 and 1.
+///
+/// @return
+///   Point on the segment.
+template <typename T>
+[[nodiscard]] constexpr auto bspline(T p0, T p1, T p2, T p3, float t) noexcept -> T {
+    return detail::evaluateCubic<detail::BSplineBasis>(p0, p1, p2, p3, t);
+}
+
+/// @brief
+///   Evaluate a cubic Hermite curve at each parameter. Parameters are processed 8 at a time.
+/// @note
+///   See the scalar overload for details of the control points.
+///
+/// @param[in] t
+///   Pointer to the curve parameters.
+/// @param[out] out
+///   Pointer to the array to store the points on the curve.
+/// @param count
+///   Number of parameters.
+inline auto hermite(Vector3      p0,
+                    Vector3      m0,
+                    Vector3      p1,
+                    Vector3      m1,
+                    const float *t,
+                    Vector3     *out,
+                    std::size_t  count) noexcept -> void {
+    detail::evaluateCubic<detail::HermiteBasis>(p0, m0, p1, m1, t, out, count);
+}
+
+/// @brief
+///   Evaluate a cubic Bezier curve at each parameter. Parameters are processed 8 at a time.
+/// @note
+///   See the scalar overload for details of the control points.
+///
+/// @param[in] t
+///   Pointer to the curve parameters.
+/// @param[out] out
+///   Pointer to the array to store the points on the curve.
+/// @param count
+///   Number of parameters.
+inline auto bezier(Vector3      p0,
+                   Vector3      p1,
+                   Vector3      p2,
+                   Vector3      p3,
+                   const float *t,
+                   Vector3     *out,
+                   std::size_t  count) noexcept -> void {
+    detail::evaluateCubic<detail::BezierBasis>(p0, p1, p2, p3, t, out, count);
+}
+
+/// @brief
+///   Evaluate a uniform Catmull-Rom segment at each parameter. Parameters are processed 8 at a
+///   time.
+/// @note
+///   See the scalar overload for details of the control points.
+///
+/// @param[in] t
+///   Pointer to the segment parameters.
+/// @param[out] out
+///   Pointer to the array to store the points on the segment.
+/// @param count
+///   Number of parameters.
+inline auto catmullRom(Vector3      p0,
+                       Vector3      p1,
+                       Vector3      p2,
+                       Vector3      p3,
+                       const float *t,
+                       Vector3     *out,
+                       std::size_t  count) noexcept -> void {
+    detail::evaluateCubic<detail::CatmullRomBasis>(p0, p1, p2, p3, t, out, count);
+}
+
+/// @brief
+///   Evaluate a uniform cubic B-spline segment at each parameter. Parameters are processed 8 at a
+///   time.
+/// @note
+///   See the scalar overload for details of the control points.
+///
+/// @param[in] t
+///   Pointer to the segment parameters.
+/// @param[out] out
+///   Pointer to the array to store the points on the segment.
+/// @param count
+///   Number of parameters.
+inline auto bspline(Vector3      p0,
+                    Vector3      p1,
+                    Vector3      p2,
+                    Vector3      p3,
+                    const float *t,
+                    Vector3     *out,
+                    std::size_t  count) noexcept -> void {
+    detail::evaluateCubic<detail::BSplineBasis>(p0, p1, p2, p3, t, out, count);
+}
+
+/// @brief
+///   Evaluate a Catmull-Rom path that goes through all of the points. Each pair of adjacent
+///   points is a segment of equal parameter length, and end points are repeated to get the end
+///   tangents.
+///
+/// @param points
+///   Points of the path. Must contain at least 1 point.
+/// @param pointCount
+///   Number of points.
+/// @param t
+///   Path parameter. 0 returns the first point and 1 returns the last point. Out of range values
+///   are clamped.
+///
+/// @return
+///   Point on the path.
+[[nodiscard]] inline auto catmullRomPath(const Vector3 *points, std::size_t pointCount, float t)
+    noexcept -> Vector3 {
+    return detail::evaluatePath<detail::CatmullRomBasis>(points, pointCount, t);
+}
+
+/// @brief
+///   Evaluate a Catmull-Rom path at each parameter. Parameters are processed 8 at a time.
+/// @note
+///   See the scalar overload for details of the path.
+///
+/// @param points
+///   Points of the path. Must contain at least 1 point.
+/// @param pointCount
+///   Number of points.
+/// @param[in] t
+///   Pointer to the path parameters.
+/// @param[out] out
+///   Pointer to the array to store the points on the path.
+/// @param count
+///   Number of parameters.
+inline auto catmullRomPath(const Vector3 *points,
+                           std::size_t    pointCount,
+                           const float   *t,
+                           Vector3       *out,
+                           std::size_t    count) noexcept -> void {
+    detail::evaluatePath<detail::CatmullRomBasis>(points, pointCount, t, out, count);
+}
+
+/// @brief
+///   Evaluate a uniform cubic B-spline path over the control points. End points are repeated so
+///   that the path is defined on the whole range of the control points.
+///
+/// @param points
+///   Control points of the path. Must contain at least 1 point.
+/// @param pointCount
+///   Number of points.
+/// @param t
+///   Path parameter between 0 and 1. Out of range values are clamped.
+///
+/// @return
+///   Point on the path.
+[[nodiscard]] inline auto bsplinePath(const Vector3 *points, std::size_t pointCount, float t)
+    noexcept -> Vector3 {
+    return detail::evaluatePath<detail::BSplineBasis>(points, pointCount, t);
+}
+
+/// @brief
+///   Evaluate a uniform cubic B-spline path at each parameter. Parameters are processed 8 at a
+///   time.
+/// @note
+///   See the scalar overload for details of the path.
+///
+/// @param points
+///   Control points of the path. Must contain at least 1 point.
+/// @param pointCount
+///   Number of points.
+/// @param[in] t
+///   Pointer to the path parameters.
+/// @param[out] out
+///   Pointer to the array to store the points on the path.
+/// @param count
+///   Number of parameters.
+inline auto bsplinePath(const Vector3 *points,
+                        std::size_t    pointCount,
+                        const float   *t,
+                        Vector3       *out,
+                        std::size_t    count) noexcept -> void {
+    detail::evaluatePath<detail::BSplineBasis>(points, pointCount, t, out, count);
+}
+
+/// @brief
+///   Calculate the inner control point of @p current for @p squad(). The rotation curve is C1
+///   continuous at @p current if the same control point is used by both adjacent segments.
+///
+/// @param prev
+///   The previous rotation. Must be normalized.
+/// @param current
+///   The rotation to calculate control point for. Must be normalized.
+/// @param next
+///   The next rotation. Must be normalized.
+///
+/// @return
+///   The control point of @p current.
+[[nodiscard]] inline auto squadControlPoint(Quaternion prev, Quaternion current, Quaternion next)
+    noexcept -> Quaternion {
+    // Use the shortest path between adjacent rotations.
+    if (dot(prev, current) < 0.0f)
+        prev = -prev;
+    if (dot(next, current) < 0.0f)
+        next = -next;
+
+    const Quaternion inverse = current.conjugated();
+    const Quaternion sum =
+        detail::logarithm(inverse * next) + detail::logarithm(inverse * prev);
+    return current * detail::exponential(sum * -0.25f);
+}
+
+/// @brief
+///   Perform spherical quadrangle interpolation between 2 rotations. This is a smooth cubic
+///   interpolation for rotation keyframes.
+///
+/// @param start
+///   The start rotation. Must be normalized.
+/// @param startControl
+///   Control point of @p start. See @p squadControlPoint().
+/// @param endControl
+///   Control point of @p end. See @p squadControlPoint().
+/// @param end
+///   The end rotation. Must be normalized.
+/// @param t
+///   Interpolation factor between 0 and 1. 0 returns @p start and 1 returns @p end.
+///
+/// @return
+///   The interpolated rotation.
+[[nodiscard]] inline auto squad(Quaternion start,
+                                Quaternion startControl,
+                                Quaternion endControl,
+                                Quaternion end,
+                                float      t) noexcept -> Quaternion {
+    return slerp(slerp(start, end, t), slerp(startControl, endControl, t), 2.0f * t * (1.0f - t));
+}
+
+/// @brief
+///   Arc length lookup table of a curve. The curve is sampled at uniform parameters when the table
+///   is built, and distances along the curve are mapped back to parameters by linear
+///   interpolation between the samples. This is used to move along a curve at constant speed.
+class ArcLengthTable {
+public:
+    /// @brief
+    ///   Create an empty table.
+    ArcLengthTable() noexcept = default;
+
+    /// @brief
+    ///   Build arc length table of the specified curve.
+    ///
+    /// @tparam Curve
+    ///   Type of the curve. Should accept a float parameter between 0 and 1 and return a
+    ///   @p Vector3.
+    /// @param curve
+    ///   The curve to be measured.
+    /// @param sampleCount
+    ///   Number of segments to approximate the curve. Must be at least 1. More samples give more
+    ///   accurate length and parameters.
+    ///
+    /// @throw std::bad_alloc
+    ///   Thrown if failed to allocate memory.
+    template <typename Curve,
+              typename = std::enable_if_t<std::is_invocable_r_v<Vector3, Curve, float>>>
+    ArcLengthTable(Curve &&curve, std::size_t sampleCount = 64) : m_lengths(sampleCount + 1) {
+        const float step = 1.0f / static_cast<float>(sampleCount);
+
+        Vector3 last = curve(0.0f);
+        m_lengths[0] = 0.0f;
+        for (std::size_t i = 1; i <= sampleCount; ++i) {
+            const Vector3 point = curve(static_cast<float>(i) * step);
+            m_lengths[i]        = m_lengths[i - 1] + (point - last).length();
+            last                = point;
+        }
+    }
+
+    /// @brief
+    ///   Get approximate length of the curve.
+    [[nodiscard]] auto length() const noexcept -> float {
+        return m_lengths.empty() ? 0.0f : m_lengths.back();
+    }
+
+    /// @brief
+    ///   Get curve parameter at the specified distance along the curve.
+    ///
+    /// @param distance
+    ///   Distance from the start of the curve. Out of range values are clamped.
+    ///
+    /// @return
+    ///   Curve parameter between 0 and 1.
+    [[nodiscard]] auto parameter(float distance) const noexcept -> float {
+        if (m_lengths.size() < 2)
+            return 0.0f;
+        return interpolate(findSample(distance), distance);
+    }
+
+    /// @brief
+    ///   Get curve parameters at the specified distances along the curve.
+    /// @note
+    ///   Samples are searched forward from the previous distance if distances are in ascending
+    ///   order, which is the usual case for moving along the curve.
+    ///
+    /// @param[in] distances
+    ///   Pointer to the distances from the start of the curve. Out of range values are clamped.
+    /// @param[out] out
+    ///   Pointer to the array to store the curve parameters. This could be the same as
+    ///   @p distances.
+    /// @param count
+    ///   Number of distances.
+    auto parameters(const float *distances, float *out, std::size_t count) const noexcept
+        -> void {
+        if (m_lengths.size() < 2) {
+            std::fill(out, out + count, 0.0f);
+            return;
+        }
+
+        const std::size_t last     = m_lengths.size() - 2;
+        std::size_t       sample   = 0;
+        float             previous = 0.0f;
+        for (std::size_t i = 0; i < count; ++i) {
+            const float distance = distances[i];
+            if (distance < previous) {
+                sample = findSample(distance);
+            } else {
+                while (sample < last && m_lengths[sample + 1] <= distance)
+                    ++sample;
+            }
+
+            previous = distance;
+            out[i]   = interpolate(sample, distance);
+        }
+    }
+
+private:
+    /// @brief
+    ///   Find the sample segment that contains the specified distance.
+    [[nodiscard]] auto findSample(float distance) const noexcept -> std::size_t {
+        const auto next = std::upper_bound(m_lengths.begin() + 1, m_lengths.end() - 1, distance);
+        return static_cast<std::size_t>(next - m_lengths.begin()) - 1;
+    }
+
+    /// @brief
+    ///   Interpolate parameter in the specified sample segment.
+    [[nodiscard]] auto interpolate(std::size_t sample, float distance) const noexcept -> float {
+        const float start = m_lengths[sample];
+        const float size  = m_lengths[sample + 1] - start;
+        const float local = (size > 0.0f) ? std::clamp((distance - start) / size, 0.0f, 1.0f)
+                                          : 0.0f;
+        return (static_cast<float>(sample) + local) / static_cast<float>(m_lengths.size() - 1);
+    }
+
+private:
+    /// @brief
+    ///   Accumulated length at each sample.
+    std::vector<float> m_lengths;
+};
+
+} // namespace ink
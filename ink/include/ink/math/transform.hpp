@@ -0,0 +1,241 @@
+#pragma once
+
+#include "affine.hpp"
+#include "quaternion.hpp"
+
+namespace ink {
+
+/// @brief
+///   Decompose an affine matrix into translation, rotation and scale, so that the matrix is the
+///   same as `Matrix4(1.0f).scaled(scale).rotated(rotation).translated(translation)`.
+/// @note
+///   Shear cannot be represented and is lost. Mirroring is represented as negative scale along
+///   X axis. Scale along each axis must not be zero.
+///
+/// @param matrix
+///   The affine matrix to be decomposed.
+/// @param[out] translation
+///   Translation of the matrix.
+/// @param[out] rotation
+///   Rotation of the matrix. This is always a unit quaternion.
+/// @param[out] scale
+///   Scale of the matrix.
+constexpr auto decompose(const Matrix4 &matrix,
+                         Vector3       &translation,
+                         Quaternion    &rotation,
+                         Vector3       &scale) noexcept -> void {
+    // Basis vector j of the transform is element j of each column.
+    const Vector3 x(matrix[0][0], matrix[1][0], matrix[2][0]);
+    const Vector3 y(matrix[0][1], matrix[1][1], matrix[2][1]);
+    const Vector3 z(matrix[0][2], matrix[1][2], matrix[2][2]);
+
+    scale = Vector3(x.length(), y.length(), z.length());
+    if (dot(cross(x, y), z) < 0)
+        scale.x = -scale.x;
+
+    const Vector3 invScale = 1.0f / scale;
+    const Matrix4 r{
+        Vector4(x.x * invScale.x, y.x * invScale.y, z.x * invScale.z, 0.0f),
+        Vector4(x.y * invScale.x, y.y * invScale.y, z.y * invScale.z, 0.0f),
+        Vector4(x.z * invScale.x, y.z * invScale.y, z.z * invScale.z, 0.0f),
+        Vector4(0.0f, 0.0f, 0.0f, 1.0f),
+    };
+
+    translation = Vector3(matrix[0][3], matrix[1][3], matrix[2][3]);
+    rotation    = Quaternion::fromMatrix(r).normalized();
+}
+
+/// @brief
+///   3D transform that is decomposed into scale, rotation and translation. The transform applies
+///   scale first, then rotation and translation last, which is the same as
+///   `Matrix4(1.0f).scaled(scale).rotated(rotation).translated(translation)`.
+/// @note
+///   Composing, blending and converting this type is much cheaper than doing the same with
+///   matrices. Composition and inverse are exact only if scales are uniform, since non-uniform
+///   scale followed by rotation cannot be represented as a TRS transform.
+struct Transform {
+    Vector3    translation;
+    Quaternion rotation;
+    Vector3    scale;
+
+    /// @brief
+    ///   Create an identity transform.
+    constexpr Transform() noexcept : translation(), rotation(1.0f), scale(1.0f) {}
+
+    /// @brief
+    ///   Create a transform with the specified components.
+    ///
+    /// @param translation
+    ///   Translation of this transform.
+    /// @param rotation
+    ///   Rotation of this transform. This should be a unit quaternion.
+    /// @param scale
+    ///   Scale of this transform.
+    constexpr Transform(Vector3 translation, Quaternion rotation, Vector3 scale) noexcept
+        : translation(translation), rotation(rotation), scale(scale) {}
+
+    /// @brief
+    ///   Create a transform by decomposing an affine matrix.
+    /// @note
+    ///   Shear of the matrix is lost. See @p decompose() for details.
+    ///
+    /// @param matrix
+    ///   The affine matrix to be decomposed.
+    explicit constexpr Transform(const Matrix4 &matrix) noexcept
+        : translation(), rotation(), scale() {
+        decompose(matrix, translation, rotation, scale);
+    }
+
+    /// @brief
+    ///   Convert this transform to a 4x4 matrix. The matrix is built directly without any matrix
+    ///   multiplication.
+    ///
+    /// @return
+    ///   A @p Matrix4 that represents this transform.
+    [[nodiscard]] constexpr auto toMatrix4() const noexcept -> Matrix4 {
+        const Matrix3x4 m = toMatrix3x4();
+        return m.toMatrix4();
+    }
+
+    /// @brief
+    ///   Convert this transform to a compact 3x4 affine matrix. The matrix is built directly
+    ///   without any matrix multiplication.
+    ///
+    /// @return
+    ///   A @p Matrix3x4 that represents this transform.
+    [[nodiscard]] constexpr auto toMatrix3x4() const noexcept -> Matrix3x4 {
+        const Matrix4 r = rotation.toMatrix();
+        return {
+            Vector4(r[0][0] * scale[0], r[0][1] * scale[1], r[0][2] * scale[2], translation[0]),
+            Vector4(r[1][0] * scale[0], r[1][1] * scale[1], r[1][2] * scale[2], translation[1]),
+            Vector4(r[2][0] * scale[0], r[2][1] * scale[1], r[2][2] * scale[2], translation[2]),
+        };
+    }
+
+    /// @brief
+    ///   Transform a point with this transform.
+    ///
+    /// @param point
+    ///   The point to be transformed.
+    ///
+    /// @return
+    ///   The transformed point.
+    [[nodiscard]] constexpr auto transformPoint(Vector3 point) const noexcept -> Vector3 {
+        return rotate(rotation, point * scale) + translation;
+    }
+
+    /// @brief
+    ///   Transform a direction with this transform. Translation is not applied.
+    ///
+    /// @param direction
+    ///   The direction to be transformed.
+    ///
+    /// @return
+    ///   The transformed direction. The result is not normalized.
+    [[nodiscard]] constexpr auto transformDirection(Vector3 direction) const noexcept -> Vector3 {
+        return rotate(rotation, direction * scale);
+    }
+
+    /// @brief
+    ///   Inverse this transform.
+    /// @remark
+    ///   To get inversed transform without modifying this one, use @p inversed() instead.
+    ///
+    /// @return
+    ///   Reference to this transform.
+    constexpr auto inverse() noexcept -> Transform & {
+        *this = inversed();
+        return *this;
+    }
+
+    /// @brief
+    ///   Get inversed transform of this one.
+    /// @remark
+    ///   To inverse this transform, use @p inverse() instead.
+    /// @note
+    ///   The result is exact only if scale of this transform is uniform.
+    ///
+    /// @return
+    ///   A new transform that represents the inversed transform.
+    [[nodiscard]] constexpr auto inversed() const noexcept -> Transform {
+        const Quaternion invRotation = rotation.conjugated();
+        const Vector3    invScale    = 1.0f / scale;
+        return {-rotate(invRotation, translation * invScale), invRotation, invScale};
+    }
+
+    constexpr auto operator*=(const Transform &rhs) noexcept -> Transform &;
+};
+
+/// @brief
+///   Compose 2 transforms. Just like @p Matrix4, @p lhs is applied first.
+/// @note
+///   The result is exact only if scale of @p rhs is uniform.
+constexpr auto operator*(const Transform &lhs, const Transform &rhs) noexcept -> Transform {
+    return {
+        rhs.transformPoint(lhs.translation),
+        rhs.rotation * lhs.rotation,
+        lhs.scale * rhs.scale,
+    };
+}
+
+constexpr auto Transform::operator*=(const Transform &rhs) noexcept -> Transform & {
+    *this = (*this * rhs);
+    return *this;
+}
+
+constexpr auto operator==(const Transform &lhs, const Transform &rhs) noexcept -> bool {
+    return lhs.translation == rhs.translation && lhs.rotation == rhs.rotation &&
+           lhs.scale == rhs.scale;
+}
+
+constexpr auto operator!=(const Transform &lhs, const Transform &rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+/// @brief
+///   Perform linear interpolation between the 2 transforms. Rotations are interpolated with
+///   @p nlerp() along the shortest path.
+///
+/// @param start
+///   The first transform to be interpolated.
+/// @param end
+///   The second transform to be interpolated.
+/// @param t
+///   Interpolation factor, must between 0 and 1.
+///
+/// @return
+///   The interpolation result transform.
+[[nodiscard]] inline auto lerp(const Transform &start, const Transform &end, float t) noexcept
+    -> Transform {
+    const Quaternion endRotation = dot(start.rotation, end.rotation) < 0 ? -end.rotation
+                                                                         : end.rotation;
+    return {
+        lerp(start.translation, end.translation, t),
+        nlerp(start.rotation, endRotation, t),
+        lerp(start.scale, end.scale, t),
+    };
+}
+
+/// @brief
+///   Perform interpolation between the 2 transforms. Rotations are interpolated with @p slerp()
+///   and the other components are interpolated linearly.
+///
+/// @param start
+///   The first transform to be interpolated.
+/// @param end
+///   The second transform to be interpolated.
+/// @param t
+///   Interpolation factor, must between 0 and 1.
+///
+/// @return
+///   The interpolation result transform.
+[[nodiscard]] inline auto slerp(const Transform &start, const Transform &end, float t) noexcept
+    -> Transform {
+    return {
+        lerp(start.translation, end.translation, t),
+        slerp(start.rotation, end.rotation, t),
+        lerp(start.scale, end.scale, t),
+    };
+}
+
+} // namespace ink
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "functions.hpp"
+
 #include <cmath>
 
 namespace ink {
@@ -37,14 +39,14 @@ struct Vector2 {
 
     /// @brief
     ///   Create a 2D vector and initialize all elements to 0.
-    constexpr Vector2() noexcept : m_arr{0, 0} {}
+    constexpr Vector2() noexcept : x(0), y(0) {}
 
     /// @brief
     ///   Create a 2D vector and initialize all elements to the specified value.
     ///
     /// @param v
     ///   Value to be set to elements of this vector.
-    explicit constexpr Vector2(float v) noexcept : m_arr{v, v} {}
+    explicit constexpr Vector2(float v) noexcept : x(v), y(v) {}
 
     /// @brief
     ///   Create a 2D vector and initialize elements.
@@ -53,14 +55,14 @@ struct Vector2 {
     ///   Value of the first element of this vector.
     /// @param y
     ///   Value of the second element of this vector.
-    constexpr Vector2(float x, float y) noexcept : m_arr{x, y} {}
+    constexpr Vector2(float x, float y) noexcept : x(x), y(y) {}
 
     /// @brief
     ///   Create a 2D vector and initialize elements.
     ///
     /// @param arr
     ///   A float array that contains at least 2 elements.
-    explicit constexpr Vector2(const float arr[2]) noexcept : m_arr{arr[0], arr[1]} {}
+    explicit constexpr Vector2(const float arr[2]) noexcept : x(arr[0]), y(arr[1]) {}
 
     /// @brief
     ///   Random access elements in this vector by index.
@@ -72,7 +74,13 @@ struct Vector2 {
     ///
     /// @return
     ///   Reference to the specified element.
-    constexpr auto operator[](std::size_t i) noexcept -> float & { return m_arr[i]; }
+    constexpr auto operator[](std::size_t i) noexcept -> float & {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+        if (INK_IS_CONSTANT_EVALUATED())
+            return i == 0 ? x : y;
+#endif
+        return m_arr[i];
+    }
 
     /// @brief
     ///   Random access elements in this vector by index.
@@ -84,7 +92,13 @@ struct Vector2 {
     ///
     /// @return
     ///   Reference to the specified element.
-    constexpr auto operator[](std::size_t i) const noexcept -> const float & { return m_arr[i]; }
+    constexpr auto operator[](std::size_t i) const noexcept -> const float & {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+        if (INK_IS_CONSTANT_EVALUATED())
+            return i == 0 ? x : y;
+#endif
+        return m_arr[i];
+    }
 
     /// @brief
     ///   Calculate of this 2D vector.
@@ -93,7 +107,7 @@ struct Vector2 {
     ///
     /// @return
     ///   Length of this 2D vector.
-    [[nodiscard]] auto length() const noexcept -> float { return std::sqrt(x * x + y * y); }
+    [[nodiscard]] constexpr auto length() const noexcept -> float { return sqrt(x * x + y * y); }
 
     /// @brief
     ///   Normalize this vector.
@@ -103,7 +117,7 @@ struct Vector2 {
     ///
     /// @return
     ///   Reference to this vector.
-    auto normalize() noexcept -> Vector2 & {
+    constexpr auto normalize() noexcept -> Vector2 & {
         const float len    = length();
         const float invLen = 1.0f / len;
 
@@ -121,13 +135,30 @@ struct Vector2 {
     ///
     /// @return
     ///   Normalized version of this vector.
-    [[nodiscard]] auto normalized() const noexcept -> Vector2 {
+    [[nodiscard]] constexpr auto normalized() const noexcept -> Vector2 {
         const float len    = length();
         const float invLen = 1.0f / len;
 
         return {x * invLen, y * invLen};
     }
 
+    /// @brief
+    ///   Get normalized vector of this one with approximate reciprocal square root. This is faster
+    ///   than @p Vector2::normalized() but relative error of the result is up to about 1e-6.
+    /// @note
+    ///   The exact @p Vector2::normalized() is used if SIMD is disabled.
+    ///
+    /// @return
+    ///   Approximately normalized version of this vector.
+    [[nodiscard]] auto normalizedFast() const noexcept -> Vector2 {
+#if defined(INK_SIMD)
+        const float invLen = simd::rsqrt(x * x + y * y);
+        return {x * invLen, y * invLen};
+#else
+        return normalized();
+#endif
+    }
+
     constexpr auto operator+=(float rhs) noexcept -> Vector2 & {
         x += rhs;
         y += rhs;
@@ -363,14 +394,14 @@ struct Vector3 {
 
     /// @brief
     ///   Create a 3D vector and initialize all elements to 0.
-    constexpr Vector3() noexcept : m_arr{0, 0, 0} {}
+    constexpr Vector3() noexcept : x(0), y(0), z(0) {}
 
     /// @brief
     ///   Create a 3D vector and initialize all elements to the specified value.
     ///
     /// @param v
     ///   Value to be set to elements of this vector.
-    explicit constexpr Vector3(float v) noexcept : m_arr{v, v, v} {}
+    explicit constexpr Vector3(float v) noexcept : x(v), y(v), z(v) {}
 
     /// @brief
     ///   Create a 3D vector and initialize elements.
@@ -379,7 +410,7 @@ struct Vector3 {
     ///   Value of the first element of this vector.
     /// @param yz
     ///   A 2D vector that contains values of the second and third element of this vector.
-    constexpr Vector3(float x, Vector2 yz) noexcept : m_arr{x, yz.x, yz.y} {}
+    constexpr Vector3(float x, Vector2 yz) noexcept : x(x), y(yz.x), z(yz.y) {}
 
     /// @brief
     ///   Create a 3D vector and initialize elements.
@@ -388,7 +419,7 @@ struct Vector3 {
     ///   A 2D vector that contains values of the first and second element of this vector.
     /// @param z
     ///   Value of the third element of this vector.
-    constexpr Vector3(Vector2 xy, float z) noexcept : m_arr{xy.x, xy.y, z} {}
+    constexpr Vector3(Vector2 xy, float z) noexcept : x(xy.x), y(xy.y), z(z) {}
 
     /// @brief
     ///   Create a 3D vector and initialize elements.
@@ -399,14 +430,14 @@ struct Vector3 {
     ///   Value of the second element of this vector.
     /// @param z
     ///   Value of the third element of this vector.
-    constexpr Vector3(float x, float y, float z) noexcept : m_arr{x, y, z} {}
+    constexpr Vector3(float x, float y, float z) noexcept : x(x), y(y), z(z) {}
 
     /// @brief
     ///   Create a 3D vector and initialize elements.
     ///
     /// @param arr
     ///   A float array that contains at least 3 elements.
-    explicit constexpr Vector3(const float arr[3]) noexcept : m_arr{arr[0], arr[1], arr[2]} {}
+    explicit constexpr Vector3(const float arr[3]) noexcept : x(arr[0]), y(arr[1]), z(arr[2]) {}
 
     /// @brief
     ///   Random access elements in this vector by index.
@@ -418,7 +449,13 @@ struct Vector3 {
     ///
     /// @return
     ///   Reference to the specified element.
-    constexpr auto operator[](std::size_t i) noexcept -> float & { return m_arr[i]; }
+    constexpr auto operator[](std::size_t i) noexcept -> float & {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+        if (INK_IS_CONSTANT_EVALUATED())
+            return i == 0 ? x : (i == 1 ? y : z);
+#endif
+        return m_arr[i];
+    }
 
     /// @brief
     ///   Random access elements in this vector by index.
@@ -430,7 +467,13 @@ struct Vector3 {
     ///
     /// @return
     ///   Reference to the specified element.
-    constexpr auto operator[](std::size_t i) const noexcept -> const float & { return m_arr[i]; }
+    constexpr auto operator[](std::size_t i) const noexcept -> const float & {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+        if (INK_IS_CONSTANT_EVALUATED())
+            return i == 0 ? x : (i == 1 ? y : z);
+#endif
+        return m_arr[i];
+    }
 
     /// @brief
     ///   Calculate of this 3D vector.
@@ -439,7 +482,9 @@ struct Vector3 {
     ///
     /// @return
     ///   Length of this 3D vector.
-    [[nodiscard]] auto length() const noexcept -> float { return std::sqrt(x * x + y * y + z * z); }
+    [[nodiscard]] constexpr auto length() const noexcept -> float {
+        return sqrt(x * x + y * y + z * z);
+    }
 
     /// @brief
     ///   Normalize this vector.
@@ -449,7 +494,7 @@ struct Vector3 {
     ///
     /// @return
     ///   Reference to this vector.
-    auto normalize() noexcept -> Vector3 & {
+    constexpr auto normalize() noexcept -> Vector3 & {
         const float len    = length();
         const float invLen = 1.0f / len;
 
@@ -468,13 +513,30 @@ struct Vector3 {
     ///
     /// @return
     ///   Normalized version of this vector.
-    [[nodiscard]] auto normalized() const noexcept -> Vector3 {
+    [[nodiscard]] constexpr auto normalized() const noexcept -> Vector3 {
         const float len    = length();
         const float invLen = 1.0f / len;
 
         return {x * invLen, y * invLen, z * invLen};
     }
 
+    /// @brief
+    ///   Get normalized vector of this one with approximate reciprocal square root. This is faster
+    ///   than @p Vector3::normalized() but relative error of the result is up to about 1e-6.
+    /// @note
+    ///   The exact @p Vector3::normalized() is used if SIMD is disabled.
+    ///
+    /// @return
+    ///   Approximately normalized version of this vector.
+    [[nodiscard]] auto normalizedFast() const noexcept -> Vector3 {
+#if defined(INK_SIMD)
+        const float invLen = simd::rsqrt(x * x + y * y + z * z);
+        return {x * invLen, y * invLen, z * invLen};
+#else
+        return normalized();
+#endif
+    }
+
     constexpr auto operator+=(float rhs) noexcept -> Vector3 & {
         x += rhs;
         y += rhs;
@@ -740,14 +802,14 @@ struct alignas(16) Vector4 {
 
     /// @brief
     ///   Create a 4D vector and initialize all elements to 0.
-    constexpr Vector4() noexcept : m_arr{0, 0, 0, 0} {}
+    constexpr Vector4() noexcept : x(0), y(0), z(0), w(0) {}
 
     /// @brief
     ///   Create a 4D vector and initialize all elements to the specified value.
     ///
     /// @param v
     ///   Value to be set to elements of this vector.
-    explicit constexpr Vector4(float v) noexcept : m_arr{v, v, v, v} {}
+    explicit constexpr Vector4(float v) noexcept : x(v), y(v), z(v), w(v) {}
 
     /// @brief
     ///   Create a 4D vector and initialize elements.
@@ -756,7 +818,7 @@ struct alignas(16) Vector4 {
     ///   Value of the first element of this vector.
     /// @param yzw
     ///   A 3D vector that contains values of the second, third and forth element of this vector.
-    constexpr Vector4(float x, Vector3 yzw) noexcept : m_arr{x, yzw.x, yzw.y, yzw.z} {}
+    constexpr Vector4(float x, Vector3 yzw) noexcept : x(x), y(yzw.x), z(yzw.y), w(yzw.z) {}
 
     /// @brief
     ///   Create a 4D vector and initialize elements.
@@ -765,7 +827,7 @@ struct alignas(16) Vector4 {
     ///   A 3D vector that contains values of the first, second and third element of this vector.
     /// @param w
     ///   Value of the forth element of this vector.
-    constexpr Vector4(Vector3 xyz, float w) noexcept : m_arr{xyz.x, xyz.y, xyz.z, w} {}
+    constexpr Vector4(Vector3 xyz, float w) noexcept : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
 
     /// @brief
     ///   Create a 4D vector and initialize elements.
@@ -776,7 +838,7 @@ struct alignas(16) Vector4 {
     ///   Value of the second element of this vector.
     /// @param zw
     ///   A 2D vector that contains values of the third and forth element of this vector.
-    constexpr Vector4(float x, float y, Vector2 zw) noexcept : m_arr{x, y, zw.x, zw.y} {}
+    constexpr Vector4(float x, float y, Vector2 zw) noexcept : x(x), y(y), z(zw.x), w(zw.y) {}
 
     /// @brief
     ///   Create a 4D vector and initialize elements.
@@ -787,7 +849,7 @@ struct alignas(16) Vector4 {
     ///   A 2D vector that contains values of the second and third element of this vector.
     /// @param w
     ///   Value of the forth element of this vector.
-    constexpr Vector4(float x, Vector2 yz, float w) noexcept : m_arr{x, yz.x, yz.y, w} {}
+    constexpr Vector4(float x, Vector2 yz, float w) noexcept : x(x), y(yz.x), z(yz.y), w(w) {}
 
     /// @brief
     ///   Create a 4D vector and initialize elements.
@@ -798,7 +860,7 @@ struct alignas(16) Vector4 {
     ///   Value of the third element of this vector.
     /// @param w
     ///   Value of the forth element of this vector.
-    constexpr Vector4(Vector2 xy, float z, float w) noexcept : m_arr{xy.x, xy.y, z, w} {}
+    constexpr Vector4(Vector2 xy, float z, float w) noexcept : x(xy.x), y(xy.y), z(z), w(w) {}
 
     /// @brief
     ///   Create a 4D vector and initialize elements.
@@ -807,7 +869,7 @@ struct alignas(16) Vector4 {
     ///   A 2D vector that contains values of the first and second element of this vector.
     /// @param zw
     ///   A 2D vector that contains values of the third and forth element of this vector.
-    constexpr Vector4(Vector2 xy, Vector2 zw) noexcept : m_arr{xy.x, xy.y, zw.x, zw.y} {}
+    constexpr Vector4(Vector2 xy, Vector2 zw) noexcept : x(xy.x), y(xy.y), z(zw.x), w(zw.y) {}
 
     /// @brief
     ///   Create a 4D vector and initialize elements.
@@ -820,7 +882,7 @@ struct alignas(16) Vector4 {
     ///   Value of the third element of this vector.
     /// @param w
     ///   Value of the forth element of this vector.
-    constexpr Vector4(float x, float y, float z, float w) noexcept : m_arr{x, y, z, w} {}
+    constexpr Vector4(float x, float y, float z, float w) noexcept : x(x), y(y), z(z), w(w) {}
 
     /// @brief
     ///   Create a 4D vector and initialize elements.
@@ -828,7 +890,7 @@ struct alignas(16) Vector4 {
     /// @param arr
     ///   A float array that contains at least 4 elements.
     explicit constexpr Vector4(const float arr[4]) noexcept
-        : m_arr{arr[0], arr[1], arr[2], arr[3]} {}
+        : x(arr[0]), y(arr[1]), z(arr[2]), w(arr[3]) {}
 
     /// @brief
     ///   Random access elements in this vector by index.
@@ -840,7 +902,13 @@ struct alignas(16) Vector4 {
     ///
     /// @return
     ///   Reference to the specified element.
-    constexpr auto operator[](std::size_t i) noexcept -> float & { return m_arr[i]; }
+    constexpr auto operator[](std::size_t i) noexcept -> float & {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+        if (INK_IS_CONSTANT_EVALUATED())
+            return i == 0 ? x : (i == 1 ? y : (i == 2 ? z : w));
+#endif
+        return m_arr[i];
+    }
 
     /// @brief
     ///   Random access elements in this vector by index.
@@ -852,7 +920,13 @@ struct alignas(16) Vector4 {
     ///
     /// @return
     ///   Reference to the specified element.
-    constexpr auto operator[](std::size_t i) const noexcept -> const float & { return m_arr[i]; }
+    constexpr auto operator[](std::size_t i) const noexcept -> const float & {
+#if defined(INK_IS_CONSTANT_EVALUATED)
+        if (INK_IS_CONSTANT_EVALUATED())
+            return i == 0 ? x : (i == 1 ? y : (i == 2 ? z : w));
+#endif
+        return m_arr[i];
+    }
 
     /// @brief
     ///   Calculate of this 4D vector.
@@ -861,8 +935,8 @@ struct alignas(16) Vector4 {
     ///
     /// @return
     ///   Length of this 4D vector.
-    [[nodiscard]] auto length() const noexcept -> float {
-        return std::sqrt(x * x + y * y + z * z + w * w);
+    [[nodiscard]] constexpr auto length() const noexcept -> float {
+        return sqrt(x * x + y * y + z * z + w * w);
     }
 
     /// @brief
@@ -873,7 +947,13 @@ struct alignas(16) Vector4 {
     ///
     /// @return
     ///   Reference to this vector.
-    auto normalize() noexcept -> Vector4 & {
+    constexpr auto normalize() noexcept -> Vector4 & {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            simd::store(m_arr, simd::normalize(simd::load(m_arr)));
+            return *this;
+        }
+#endif
         const float len    = length();
         const float invLen = 1.0f / len;
 
@@ -893,13 +973,38 @@ struct alignas(16) Vector4 {
     ///
     /// @return
     ///   Normalized version of this vector.
-    [[nodiscard]] auto normalized() const noexcept -> Vector4 {
+    [[nodiscard]] constexpr auto normalized() const noexcept -> Vector4 {
+#if defined(INK_SIMD)
+        if (!INK_IS_CONSTANT_EVALUATED()) {
+            Vector4 result;
+            simd::store(result.m_arr, simd::normalize(simd::load(m_arr)));
+            return result;
+        }
+#endif
         const float len    = length();
         const float invLen = 1.0f / len;
 
         return {x * invLen, y * invLen, z * invLen, w * invLen};
     }
 
+    /// @brief
+    ///   Get normalized vector of this one with approximate reciprocal square root. This is faster
+    ///   than @p Vector4::normalized() but relative error of the result is up to about 1e-6.
+    /// @note
+    ///   The exact @p Vector4::normalized() is used if SIMD is disabled.
+    ///
+    /// @return
+    ///   Approximately normalized version of this vector.
+    [[nodiscard]] auto normalizedFast() const noexcept -> Vector4 {
+#if defined(INK_SIMD)
+        Vector4 result;
+        simd::store(result.m_arr, simd::normalizeFast(simd::load(m_arr)));
+        return result;
+#else
+        return normalized();
+#endif
+    }
+
     constexpr auto operator+=(float rhs) noexcept -> Vector4 & {
         x += rhs;
         y += rhs;
@@ -909,10 +1014,10 @@ struct alignas(16) Vector4 {
     }
 
     constexpr auto operator+=(Vector4 rhs) noexcept -> Vector4 & {
-        x += rhs.x;
-        y += rhs.y;
-        z += rhs.z;
-        w += rhs.w;
+        x += rhs[0];
+        y += rhs[1];
+        z += rhs[2];
+        w += rhs[3];
         return *this;
     }
 
@@ -925,10 +1030,10 @@ struct alignas(16) Vector4 {
     }
 
     constexpr auto operator-=(Vector4 rhs) noexcept -> Vector4 & {
-        x -= rhs.x;
-        y -= rhs.y;
-        z -= rhs.z;
-        w -= rhs.w;
+        x -= rhs[0];
+        y -= rhs[1];
+        z -= rhs[2];
+        w -= rhs[3];
         return *this;
     }
 
@@ -941,10 +1046,10 @@ struct alignas(16) Vector4 {
     }
 
     constexpr auto operator*=(Vector4 rhs) noexcept -> Vector4 & {
-        x *= rhs.x;
-        y *= rhs.y;
-        z *= rhs.z;
-        w *= rhs.w;
+        x *= rhs[0];
+        y *= rhs[1];
+        z *= rhs[2];
+        w *= rhs[3];
         return *this;
     }
 
@@ -957,10 +1062,10 @@ struct alignas(16) Vector4 {
     }
 
     constexpr auto operator/=(Vector4 rhs) noexcept -> Vector4 & {
-        x /= rhs.x;
-        y /= rhs.y;
-        z /= rhs.z;
-        w /= rhs.w;
+        x /= rhs[0];
+        y /= rhs[1];
+        z /= rhs[2];
+        w /= rhs[3];
         return *this;
     }
 };
@@ -968,63 +1073,63 @@ struct alignas(16) Vector4 {
 constexpr auto operator+(Vector4 vec) noexcept -> Vector4 { return vec; }
 
 constexpr auto operator-(Vector4 vec) noexcept -> Vector4 {
-    return {-vec.x, -vec.y, -vec.z, -vec.w};
+    return {-vec[0], -vec[1], -vec[2], -vec[3]};
 }
 
 constexpr auto operator==(Vector4 lhs, Vector4 rhs) noexcept -> bool {
-    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z && lhs.w == rhs.w;
+    return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3];
 }
 
 constexpr auto operator!=(Vector4 lhs, Vector4 rhs) noexcept -> bool {
-    return lhs.x != rhs.x || lhs.y != rhs.y || lhs.z != rhs.z || lhs.w != rhs.w;
+    return lhs[0] != rhs[0] || lhs[1] != rhs[1] || lhs[2] != rhs[2] || lhs[3] != rhs[3];
 }
 
 constexpr auto operator+(Vector4 lhs, Vector4 rhs) noexcept -> Vector4 {
-    return {lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w};
+    return {lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2], lhs[3] + rhs[3]};
 }
 
 constexpr auto operator+(Vector4 lhs, float rhs) noexcept -> Vector4 {
-    return {lhs.x + rhs, lhs.y + rhs, lhs.z + rhs, lhs.w + rhs};
+    return {lhs[0] + rhs, lhs[1] + rhs, lhs[2] + rhs, lhs[3] + rhs};
 }
 
 constexpr auto operator+(float lhs, Vector4 rhs) noexcept -> Vector4 {
-    return {lhs + rhs.x, lhs + rhs.y, lhs + rhs.z, lhs + rhs.w};
+    return {lhs + rhs[0], lhs + rhs[1], lhs + rhs[2], lhs + rhs[3]};
 }
 
 constexpr auto operator-(Vector4 lhs, Vector4 rhs) noexcept -> Vector4 {
-    return {lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w};
+    return {lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], lhs[3] - rhs[3]};
 }
 
 constexpr auto operator-(Vector4 lhs, float rhs) noexcept -> Vector4 {
-    return {lhs.x - rhs, lhs.y - rhs, lhs.z - rhs, lhs.w - rhs};
+    return {lhs[0] - rhs, lhs[1] - rhs, lhs[2] - rhs, lhs[3] - rhs};
 }
 
 constexpr auto operator-(float lhs, Vector4 rhs) noexcept -> Vector4 {
-    return {lhs - rhs.x, lhs - rhs.y, lhs - rhs.z, lhs - rhs.w};
+    return {lhs - rhs[0], lhs - rhs[1], lhs - rhs[2], lhs - rhs[3]};
 }
 
 constexpr auto operator*(Vector4 lhs, Vector4 rhs) noexcept -> Vector4 {
-    return {lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z, lhs.w * rhs.w};
+    return {lhs[0] * rhs[0], lhs[1] * rhs[1], lhs[2] * rhs[2], lhs[3] * rhs[3]};
 }
 
 constexpr auto operator*(Vector4 lhs, float rhs) noexcept -> Vector4 {
-    return {lhs.x * rhs, lhs.y * rhs, lhs.z * rhs, lhs.w * rhs};
+    return {lhs[0] * rhs, lhs[1] * rhs, lhs[2] * rhs, lhs[3] * rhs};
 }
 
 constexpr auto operator*(float lhs, Vector4 rhs) noexcept -> Vector4 {
-    return {lhs * rhs.x, lhs * rhs.y, lhs * rhs.z, lhs * rhs.w};
+    return {lhs * rhs[0], lhs * rhs[1], lhs * rhs[2], lhs * rhs[3]};
 }
 
 constexpr auto operator/(Vector4 lhs, Vector4 rhs) noexcept -> Vector4 {
-    return {lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z, lhs.w / rhs.w};
+    return {lhs[0] / rhs[0], lhs[1] / rhs[1], lhs[2] / rhs[2], lhs[3] / rhs[3]};
 }
 
 constexpr auto operator/(Vector4 lhs, float rhs) noexcept -> Vector4 {
-    return {lhs.x / rhs, lhs.y / rhs, lhs.z / rhs, lhs.w / rhs};
+    return {lhs[0] / rhs, lhs[1] / rhs, lhs[2] / rhs, lhs[3] / rhs};
 }
 
 constexpr auto operator/(float lhs, Vector4 rhs) noexcept -> Vector4 {
-    return {lhs / rhs.x, lhs / rhs.y, lhs / rhs.z, lhs / rhs.w};
+    return {lhs / rhs[0], lhs / rhs[1], lhs / rhs[2], lhs / rhs[3]};
 }
 
 /// @brief
@@ -1038,7 +1143,7 @@ constexpr auto operator/(float lhs, Vector4 rhs) noexcept -> Vector4 {
 /// @return
 ///   A floating value that represents the dot production.
 [[nodiscard]] constexpr auto dot(Vector4 lhs, Vector4 rhs) noexcept -> float {
-    return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w;
+    return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2] + lhs[3] * rhs[3];
 }
 
 /// @brief
@@ -1053,9 +1158,9 @@ constexpr auto operator/(float lhs, Vector4 rhs) noexcept -> Vector4 {
 ///   A 3D homogeneous coordinate vector that represents result of the cross production.
 [[nodiscard]] constexpr auto cross(Vector4 lhs, Vector4 rhs) noexcept -> Vector4 {
     return Vector4{
-        lhs.y * rhs.z - lhs.z * rhs.y,
-        lhs.z * rhs.x - lhs.x * rhs.z,
-        lhs.x * rhs.y - lhs.y * rhs.x,
+        lhs[1] * rhs[2] - lhs[2] * rhs[1],
+        lhs[2] * rhs[0] - lhs[0] * rhs[2],
+        lhs[0] * rhs[1] - lhs[1] * rhs[0],
         0,
     };
 }
@@ -1087,10 +1192,10 @@ constexpr auto operator/(float lhs, Vector4 rhs) noexcept -> Vector4 {
 ///   A new vector that contains element-wise absolute values of the original vector.
 [[nodiscard]] constexpr auto abs(Vector4 vec) noexcept -> Vector4 {
     return Vector4{
-        vec.x < 0 ? -vec.x : vec.x,
-        vec.y < 0 ? -vec.y : vec.y,
-        vec.z < 0 ? -vec.z : vec.z,
-        vec.w < 0 ? -vec.w : vec.w,
+        vec[0] < 0 ? -vec[0] : vec[0],
+        vec[1] < 0 ? -vec[1] : vec[1],
+        vec[2] < 0 ? -vec[2] : vec[2],
+        vec[3] < 0 ? -vec[3] : vec[3],
     };
 }
 
@@ -1106,10 +1211,10 @@ constexpr auto operator/(float lhs, Vector4 rhs) noexcept -> Vector4 {
 ///   A new vector that contains element-wise minimum values of the 2 vectors.
 [[nodiscard]] constexpr auto min(Vector4 lhs, Vector4 rhs) noexcept -> Vector4 {
     return Vector4{
-        lhs.x < rhs.x ? lhs.x : rhs.x,
-        lhs.y < rhs.y ? lhs.y : rhs.y,
-        lhs.z < rhs.z ? lhs.z : rhs.z,
-        lhs.w < rhs.w ? lhs.w : rhs.w,
+        lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+        lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+        lhs[2] < rhs[2] ? lhs[2] : rhs[2],
+        lhs[3] < rhs[3] ? lhs[3] : rhs[3],
     };
 }
 
@@ -1125,10 +1230,10 @@ constexpr auto operator/(float lhs, Vector4 rhs) noexcept -> Vector4 {
 ///   A new vector that contains element-wise maximum values of the 2 vectors.
 [[nodiscard]] constexpr auto max(Vector4 lhs, Vector4 rhs) noexcept -> Vector4 {
     return Vector4{
-        lhs.x < rhs.x ? rhs.x : lhs.x,
-        lhs.y < rhs.y ? rhs.y : lhs.y,
-        lhs.z < rhs.z ? rhs.z : lhs.z,
-        lhs.w < rhs.w ? rhs.w : lhs.w,
+        lhs[0] < rhs[0] ? rhs[0] : lhs[0],
+        lhs[1] < rhs[1] ? rhs[1] : lhs[1],
+        lhs[2] < rhs[2] ? rhs[2] : lhs[2],
+        lhs[3] < rhs[3] ? rhs[3] : lhs[3],
     };
 }
 
@@ -0,0 +1,1575 @@
+#pragma once
+
+#include "quaternion.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace ink {
+
+/// @brief
+///   8 packed single precision floating point values. This is the element type of the SoA
+///   (structure of arrays) wide math types. Each lane of a wide type holds one independent value.
+/// @note
+///   AVX2 builds keep the 8 lanes in a single 256-bit register, SSE and NEON builds use 2 128-bit
+///   registers. The memory layout is always 8 contiguous floats, so data could be shared between
+///   builds.
+struct alignas(32) Float8 {
+#if defined(INK_SIMD_AVX2)
+    __m256 value;
+#elif defined(INK_SIMD)
+    simd::Float4 value[2];
+#else
+    float value[8];
+#endif
+
+    /// @brief
+    ///   Create a packed value and initialize all lanes to 0.
+    Float8() noexcept : Float8(0.0f) {}
+
+    /// @brief
+    ///   Create a packed value and initialize all lanes to the specified value.
+    /// @note
+    ///   This constructor is implicit so that scalars could be used in wide expressions directly.
+    ///
+    /// @param v
+    ///   Value to be set to all lanes.
+    Float8(float v) noexcept {
+#if defined(INK_SIMD_AVX2)
+        value = _mm256_set1_ps(v);
+#elif defined(INK_SIMD)
+        value[0] = simd::splat(v);
+        value[1] = value[0];
+#else
+        for (auto &lane : value)
+            lane = v;
+#endif
+    }
+
+    /// @brief
+    ///   Create a packed value from 8 floating point values.
+    ///
+    /// @param arr
+    ///   A float array that contains at least 8 elements. There is no alignment requirement.
+    explicit Float8(const float arr[8]) noexcept {
+#if defined(INK_SIMD_AVX2)
+        value = _mm256_loadu_ps(arr);
+#elif defined(INK_SIMD)
+        value[0] = simd::loadUnaligned(arr);
+        value[1] = simd::loadUnaligned(arr + 4);
+#else
+        for (std::size_t i = 0; i < 8; ++i)
+            value[i] = arr[i];
+#endif
+    }
+
+#if defined(INK_SIMD)
+    /// @brief
+    ///   Create a packed value from 2 halves.
+    ///
+    /// @param low
+    ///   Values of lane 0 to 3.
+    /// @param high
+    ///   Values of lane 4 to 7.
+    Float8(simd::Float4 low, simd::Float4 high) noexcept {
+#    if defined(INK_SIMD_AVX2)
+        value = _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+#    else
+        value[0] = low;
+        value[1] = high;
+#    endif
+    }
+
+    /// @brief
+    ///   Get values of lane 0 to 3.
+    [[nodiscard]] auto low() const noexcept -> simd::Float4 {
+#    if defined(INK_SIMD_AVX2)
+        return _mm256_castps256_ps128(value);
+#    else
+        return value[0];
+#    endif
+    }
+
+    /// @brief
+    ///   Get values of lane 4 to 7.
+    [[nodiscard]] auto high() const noexcept -> simd::Float4 {
+#    if defined(INK_SIMD_AVX2)
+        return _mm256_extractf128_ps(value, 1);
+#    else
+        return value[1];
+#    endif
+    }
+#endif
+
+    /// @brief
+    ///   Store all lanes to the specified array.
+    ///
+    /// @param[out] arr
+    ///   A float array that contains at least 8 elements. There is no alignment requirement.
+    auto store(float arr[8]) const noexcept -> void {
+#if defined(INK_SIMD_AVX2)
+        _mm256_storeu_ps(arr, value);
+#elif defined(INK_SIMD)
+        simd::storeUnaligned(arr, value[0]);
+        simd::storeUnaligned(arr + 4, value[1]);
+#else
+        for (std::size_t i = 0; i < 8; ++i)
+            arr[i] = value[i];
+#endif
+    }
+
+    /// @brief
+    ///   Get value of the specified lane.
+    /// @note
+    ///   No boundary check performed. This is slow and should not be used in hot loops.
+    ///
+    /// @param i
+    ///   Index of the lane to be accessed.
+    ///
+    /// @return
+    ///   Value of the specified lane.
+    [[nodiscard]] auto operator[](std::size_t i) const noexcept -> float {
+        alignas(32) float arr[8];
+        store(arr);
+        return arr[i];
+    }
+
+    auto operator+=(Float8 rhs) noexcept -> Float8 &;
+    auto operator-=(Float8 rhs) noexcept -> Float8 &;
+    auto operator*=(Float8 rhs) noexcept -> Float8 &;
+    auto operator/=(Float8 rhs) noexcept -> Float8 &;
+};
+
+namespace detail {
+
+/// @brief
+///   Apply a binary operation to each half of the packed values.
+template <typename Func>
+[[nodiscard]] inline auto mapHalves(Float8 lhs, Float8 rhs, Func &&func) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2) || !defined(INK_SIMD)
+    (void)lhs;
+    (void)rhs;
+    (void)func;
+    return {};
+#else
+    Float8 result;
+    result.value[0] = func(lhs.value[0], rhs.value[0]);
+    result.value[1] = func(lhs.value[1], rhs.value[1]);
+    return result;
+#endif
+}
+
+/// @brief
+///   Apply a scalar function to each lane. This is used for functions that have no vectorized
+///   implementation.
+template <typename Func>
+[[nodiscard]] inline auto mapLanes(Float8 v, Func &&func) noexcept -> Float8 {
+    alignas(32) float arr[8];
+    v.store(arr);
+    for (auto &lane : arr)
+        lane = func(lane);
+    return Float8(arr);
+}
+
+/// @brief
+///   Apply a binary scalar function to each lane. This is used for functions that have no
+///   vectorized implementation.
+template <typename Func>
+[[nodiscard]] inline auto mapLanes(Float8 lhs, Float8 rhs, Func &&func) noexcept -> Float8 {
+    alignas(32) float a[8];
+    alignas(32) float b[8];
+    lhs.store(a);
+    rhs.store(b);
+    for (std::size_t i = 0; i < 8; ++i)
+        a[i] = func(a[i], b[i]);
+    return Float8(a);
+}
+
+/// @brief
+///   Scalar lane mask value. All bits are set.
+[[nodiscard]] inline auto laneMask(bool set) noexcept -> float {
+    const std::uint32_t bits = set ? 0xFFFFFFFFu : 0u;
+    float               result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/// @brief
+///   Check if the specified scalar lane mask is set.
+[[nodiscard]] inline auto isLaneSet(float mask) noexcept -> bool {
+    std::uint32_t bits;
+    std::memcpy(&bits, &mask, sizeof(bits));
+    return bits != 0;
+}
+
+} // namespace detail
+
+inline auto operator+(Float8 vec) noexcept -> Float8 { return vec; }
+
+inline auto operator-(Float8 vec) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    vec.value = _mm256_xor_ps(vec.value, _mm256_set1_ps(-0.0f));
+#elif defined(INK_SIMD)
+    vec.value[0] = simd::sub(simd::splat(0.0f), vec.value[0]);
+    vec.value[1] = simd::sub(simd::splat(0.0f), vec.value[1]);
+#else
+    for (auto &lane : vec.value)
+        lane = -lane;
+#endif
+    return vec;
+}
+
+inline auto operator+(Float8 lhs, Float8 rhs) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    lhs.value = _mm256_add_ps(lhs.value, rhs.value);
+    return lhs;
+#elif defined(INK_SIMD)
+    return detail::mapHalves(lhs, rhs,
+                             [](simd::Float4 a, simd::Float4 b) { return simd::add(a, b); });
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        lhs.value[i] += rhs.value[i];
+    return lhs;
+#endif
+}
+
+inline auto operator-(Float8 lhs, Float8 rhs) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    lhs.value = _mm256_sub_ps(lhs.value, rhs.value);
+    return lhs;
+#elif defined(INK_SIMD)
+    return detail::mapHalves(lhs, rhs,
+                             [](simd::Float4 a, simd::Float4 b) { return simd::sub(a, b); });
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        lhs.value[i] -= rhs.value[i];
+    return lhs;
+#endif
+}
+
+inline auto operator*(Float8 lhs, Float8 rhs) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    lhs.value = _mm256_mul_ps(lhs.value, rhs.value);
+    return lhs;
+#elif defined(INK_SIMD)
+    return detail::mapHalves(lhs, rhs,
+                             [](simd::Float4 a, simd::Float4 b) { return simd::mul(a, b); });
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        lhs.value[i] *= rhs.value[i];
+    return lhs;
+#endif
+}
+
+inline auto operator/(Float8 lhs, Float8 rhs) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    lhs.value = _mm256_div_ps(lhs.value, rhs.value);
+    return lhs;
+#elif defined(INK_SIMD)
+    return detail::mapHalves(lhs, rhs,
+                             [](simd::Float4 a, simd::Float4 b) { return simd::div(a, b); });
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        lhs.value[i] /= rhs.value[i];
+    return lhs;
+#endif
+}
+
+inline auto Float8::operator+=(Float8 rhs) noexcept -> Float8 & {
+    *this = *this + rhs;
+    return *this;
+}
+
+inline auto Float8::operator-=(Float8 rhs) noexcept -> Float8 & {
+    *this = *this - rhs;
+    return *this;
+}
+
+inline auto Float8::operator*=(Float8 rhs) noexcept -> Float8 & {
+    *this = *this * rhs;
+    return *this;
+}
+
+inline auto Float8::operator/=(Float8 rhs) noexcept -> Float8 & {
+    *this = *this / rhs;
+    return *this;
+}
+
+/// @brief
+///   Lane-wise less than comparison.
+///
+/// @return
+///   A lane mask. Each lane is either all 0 or all 1 bits. Use @p select() to consume the mask.
+inline auto operator<(Float8 lhs, Float8 rhs) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    lhs.value = _mm256_cmp_ps(lhs.value, rhs.value, _CMP_LT_OQ);
+    return lhs;
+#elif defined(INK_SIMD)
+    return detail::mapHalves(lhs, rhs,
+                             [](simd::Float4 a, simd::Float4 b) { return simd::lessThan(a, b); });
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        lhs.value[i] = detail::laneMask(lhs.value[i] < rhs.value[i]);
+    return lhs;
+#endif
+}
+
+/// @brief
+///   Lane-wise less equal comparison.
+///
+/// @return
+///   A lane mask. Each lane is either all 0 or all 1 bits. Use @p select() to consume the mask.
+inline auto operator<=(Float8 lhs, Float8 rhs) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    lhs.value = _mm256_cmp_ps(lhs.value, rhs.value, _CMP_LE_OQ);
+    return lhs;
+#elif defined(INK_SIMD)
+    return detail::mapHalves(lhs, rhs,
+                             [](simd::Float4 a, simd::Float4 b) { return simd::lessEqual(a, b); });
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        lhs.value[i] = detail::laneMask(lhs.value[i] <= rhs.value[i]);
+    return lhs;
+#endif
+}
+
+/// @brief
+///   Lane-wise greater than comparison.
+///
+/// @return
+///   A lane mask. Each lane is either all 0 or all 1 bits. Use @p select() to consume the mask.
+inline auto operator>(Float8 lhs, Float8 rhs) noexcept -> Float8 { return rhs < lhs; }
+
+/// @brief
+///   Lane-wise greater equal comparison.
+///
+/// @return
+///   A lane mask. Each lane is either all 0 or all 1 bits. Use @p select() to consume the mask.
+inline auto operator>=(Float8 lhs, Float8 rhs) noexcept -> Float8 { return rhs <= lhs; }
+
+/// @brief
+///   Select lanes from @p a where @p mask is set and from @p b otherwise.
+///
+/// @param mask
+///   Lane mask produced by comparison operators.
+/// @param a
+///   Values to be selected where @p mask is set.
+/// @param b
+///   Values to be selected where @p mask is not set.
+///
+/// @return
+///   The selected values.
+[[nodiscard]] inline auto select(Float8 mask, Float8 a, Float8 b) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    a.value = _mm256_blendv_ps(b.value, a.value, mask.value);
+    return a;
+#elif defined(INK_SIMD)
+    a.value[0] = simd::select(mask.value[0], a.value[0], b.value[0]);
+    a.value[1] = simd::select(mask.value[1], a.value[1], b.value[1]);
+    return a;
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        a.value[i] = detail::isLaneSet(mask.value[i]) ? a.value[i] : b.value[i];
+    return a;
+#endif
+}
+
+/// @brief
+///   Lane-wise and of 2 lane masks.
+inline auto operator&(Float8 lhs, Float8 rhs) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    lhs.value = _mm256_and_ps(lhs.value, rhs.value);
+    return lhs;
+#elif defined(INK_SIMD)
+    return detail::mapHalves(lhs, rhs,
+                             [](simd::Float4 a, simd::Float4 b) { return simd::maskAnd(a, b); });
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        lhs.value[i] = detail::laneMask(detail::isLaneSet(lhs.value[i]) &&
+                                        detail::isLaneSet(rhs.value[i]));
+    return lhs;
+#endif
+}
+
+/// @brief
+///   Lane-wise or of 2 lane masks.
+inline auto operator|(Float8 lhs, Float8 rhs) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    lhs.value = _mm256_or_ps(lhs.value, rhs.value);
+    return lhs;
+#elif defined(INK_SIMD)
+    return detail::mapHalves(lhs, rhs,
+                             [](simd::Float4 a, simd::Float4 b) { return simd::maskOr(a, b); });
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        lhs.value[i] = detail::laneMask(detail::isLaneSet(lhs.value[i]) ||
+                                        detail::isLaneSet(rhs.value[i]));
+    return lhs;
+#endif
+}
+
+/// @brief
+///   Gather a lane mask into an integer.
+///
+/// @param mask
+///   Lane mask produced by comparison operators.
+///
+/// @return
+///   An integer whose bit i is set if lane i of @p mask is set.
+[[nodiscard]] inline auto maskBits(Float8 mask) noexcept -> std::uint32_t {
+#if defined(INK_SIMD_AVX2)
+    return static_cast<std::uint32_t>(_mm256_movemask_ps(mask.value));
+#elif defined(INK_SIMD)
+    return simd::maskBits(mask.value[0]) | (simd::maskBits(mask.value[1]) << 4);
+#else
+    std::uint32_t bits = 0;
+    for (std::size_t i = 0; i < 8; ++i)
+        bits |= (detail::isLaneSet(mask.value[i]) ? 1U : 0U) << i;
+    return bits;
+#endif
+}
+
+/// @brief
+///   Calculate lane-wise square root.
+[[nodiscard]] inline auto sqrt(Float8 v) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    v.value = _mm256_sqrt_ps(v.value);
+#elif defined(INK_SIMD)
+    v.value[0] = simd::sqrt(v.value[0]);
+    v.value[1] = simd::sqrt(v.value[1]);
+#else
+    for (auto &lane : v.value)
+        lane = std::sqrt(lane);
+#endif
+    return v;
+}
+
+/// @brief
+///   Get lane-wise absolute values.
+[[nodiscard]] inline auto abs(Float8 v) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    v.value = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v.value);
+#elif defined(INK_SIMD)
+    v.value[0] = simd::abs(v.value[0]);
+    v.value[1] = simd::abs(v.value[1]);
+#else
+    for (auto &lane : v.value)
+        lane = std::abs(lane);
+#endif
+    return v;
+}
+
+/// @brief
+///   Get lane-wise minimum values.
+[[nodiscard]] inline auto min(Float8 lhs, Float8 rhs) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    lhs.value = _mm256_min_ps(lhs.value, rhs.value);
+    return lhs;
+#elif defined(INK_SIMD)
+    return detail::mapHalves(lhs, rhs,
+                             [](simd::Float4 a, simd::Float4 b) { return simd::min(a, b); });
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        lhs.value[i] = lhs.value[i] < rhs.value[i] ? lhs.value[i] : rhs.value[i];
+    return lhs;
+#endif
+}
+
+/// @brief
+///   Get lane-wise maximum values.
+[[nodiscard]] inline auto max(Float8 lhs, Float8 rhs) noexcept -> Float8 {
+#if defined(INK_SIMD_AVX2)
+    lhs.value = _mm256_max_ps(lhs.value, rhs.value);
+    return lhs;
+#elif defined(INK_SIMD)
+    return detail::mapHalves(lhs, rhs,
+                             [](simd::Float4 a, simd::Float4 b) { return simd::max(a, b); });
+#else
+    for (std::size_t i = 0; i < 8; ++i)
+        lhs.value[i] = lhs.value[i] < rhs.value[i] ? rhs.value[i] : lhs.value[i];
+    return lhs;
+#endif
+}
+
+/// @brief
+///   Clamp each lane into the specified range.
+[[nodiscard]] inline auto clamp(Float8 v, Float8 floor, Float8 ceil) noexcept -> Float8 {
+    return max(floor, min(v, ceil));
+}
+
+/// @brief
+///   8 3D vectors in SoA layout.
+struct Vector3x8 {
+    Float8 x;
+    Float8 y;
+    Float8 z;
+
+    /// @brief
+    ///   Create 8 3D vectors and initialize all elements to 0.
+    Vector3x8() noexcept = default;
+
+    /// @brief
+    ///   Create 8 3D vectors with the specified lane values.
+    ///
+    /// @param x
+    ///   X elements of the 8 vectors.
+    /// @param y
+    ///   Y elements of the 8 vectors.
+    /// @param z
+    ///   Z elements of the 8 vectors.
+    Vector3x8(Float8 x, Float8 y, Float8 z) noexcept : x(x), y(y), z(z) {}
+
+    /// @brief
+    ///   Fill all lanes with the specified vector.
+    ///
+    /// @param vec
+    ///   The vector to be broadcasted.
+    explicit Vector3x8(Vector3 vec) noexcept : x(vec.x), y(vec.y), z(vec.z) {}
+
+    /// @brief
+    ///   Load vectors from an AoS array.
+    ///
+    /// @param vectors
+    ///   Pointer to the vectors to be loaded.
+    /// @param count
+    ///   Number of vectors to be loaded. Must not be greater than 8. Lanes that are not loaded are
+    ///   set to 0.
+    explicit Vector3x8(const Vector3 *vectors, std::size_t count = 8) noexcept {
+        alignas(32) float xs[8] = {};
+        alignas(32) float ys[8] = {};
+        alignas(32) float zs[8] = {};
+        for (std::size_t i = 0; i < count; ++i) {
+            xs[i] = vectors[i].x;
+            ys[i] = vectors[i].y;
+            zs[i] = vectors[i].z;
+        }
+
+        x = Float8(xs);
+        y = Float8(ys);
+        z = Float8(zs);
+    }
+
+    /// @brief
+    ///   Store vectors to an AoS array.
+    ///
+    /// @param[out] vectors
+    ///   Pointer to the array to store the vectors.
+    /// @param count
+    ///   Number of vectors to be stored. Must not be greater than 8.
+    auto store(Vector3 *vectors, std::size_t count = 8) const noexcept -> void {
+        alignas(32) float xs[8];
+        alignas(32) float ys[8];
+        alignas(32) float zs[8];
+        x.store(xs);
+        y.store(ys);
+        z.store(zs);
+        for (std::size_t i = 0; i < count; ++i)
+            vectors[i] = Vector3(xs[i], ys[i], zs[i]);
+    }
+
+    /// @brief
+    ///   Calculate length of the 8 vectors.
+    [[nodiscard]] auto length() const noexcept -> Float8 { return sqrt(x * x + y * y + z * z); }
+
+    /// @brief
+    ///   Normalize the 8 vectors.
+    ///
+    /// @return
+    ///   Reference to this object.
+    auto normalize() noexcept -> Vector3x8 & {
+        const Float8 invLen = 1.0f / length();
+        x *= invLen;
+        y *= invLen;
+        z *= invLen;
+        return *this;
+    }
+
+    /// @brief
+    ///   Get normalized vectors of the 8 vectors.
+    [[nodiscard]] auto normalized() const noexcept -> Vector3x8 {
+        const Float8 invLen = 1.0f / length();
+        return {x * invLen, y * invLen, z * invLen};
+    }
+
+    auto operator+=(Vector3x8 rhs) noexcept -> Vector3x8 & {
+        x += rhs.x;
+        y += rhs.y;
+        z += rhs.z;
+        return *this;
+    }
+
+    auto operator+=(Float8 rhs) noexcept -> Vector3x8 & {
+        x += rhs;
+        y += rhs;
+        z += rhs;
+        return *this;
+    }
+
+    auto operator-=(Vector3x8 rhs) noexcept -> Vector3x8 & {
+        x -= rhs.x;
+        y -= rhs.y;
+        z -= rhs.z;
+        return *this;
+    }
+
+    auto operator-=(Float8 rhs) noexcept -> Vector3x8 & {
+        x -= rhs;
+        y -= rhs;
+        z -= rhs;
+        return *this;
+    }
+
+    auto operator*=(Vector3x8 rhs) noexcept -> Vector3x8 & {
+        x *= rhs.x;
+        y *= rhs.y;
+        z *= rhs.z;
+        return *this;
+    }
+
+    auto operator*=(Float8 rhs) noexcept -> Vector3x8 & {
+        x *= rhs;
+        y *= rhs;
+        z *= rhs;
+        return *this;
+    }
+
+    auto operator/=(Vector3x8 rhs) noexcept -> Vector3x8 & {
+        x /= rhs.x;
+        y /= rhs.y;
+        z /= rhs.z;
+        return *this;
+    }
+
+    auto operator/=(Float8 rhs) noexcept -> Vector3x8 & {
+        x /= rhs;
+        y /= rhs;
+        z /= rhs;
+        return *this;
+    }
+};
+
+inline auto operator+(Vector3x8 vec) noexcept -> Vector3x8 { return vec; }
+
+inline auto operator-(Vector3x8 vec) noexcept -> Vector3x8 { return {-vec.x, -vec.y, -vec.z}; }
+
+inline auto operator+(Vector3x8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z};
+}
+
+inline auto operator+(Vector3x8 lhs, Float8 rhs) noexcept -> Vector3x8 {
+    return {lhs.x + rhs, lhs.y + rhs, lhs.z + rhs};
+}
+
+inline auto operator+(Float8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {lhs + rhs.x, lhs + rhs.y, lhs + rhs.z};
+}
+
+inline auto operator-(Vector3x8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z};
+}
+
+inline auto operator-(Vector3x8 lhs, Float8 rhs) noexcept -> Vector3x8 {
+    return {lhs.x - rhs, lhs.y - rhs, lhs.z - rhs};
+}
+
+inline auto operator-(Float8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {lhs - rhs.x, lhs - rhs.y, lhs - rhs.z};
+}
+
+inline auto operator*(Vector3x8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z};
+}
+
+inline auto operator*(Vector3x8 lhs, Float8 rhs) noexcept -> Vector3x8 {
+    return {lhs.x * rhs, lhs.y * rhs, lhs.z * rhs};
+}
+
+inline auto operator*(Float8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {lhs * rhs.x, lhs * rhs.y, lhs * rhs.z};
+}
+
+inline auto operator/(Vector3x8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z};
+}
+
+inline auto operator/(Vector3x8 lhs, Float8 rhs) noexcept -> Vector3x8 {
+    return {lhs.x / rhs, lhs.y / rhs, lhs.z / rhs};
+}
+
+inline auto operator/(Float8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {lhs / rhs.x, lhs / rhs.y, lhs / rhs.z};
+}
+
+/// @brief
+///   Calculate lane-wise dot production of the specified vectors.
+[[nodiscard]] inline auto dot(Vector3x8 lhs, Vector3x8 rhs) noexcept -> Float8 {
+    return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+}
+
+/// @brief
+///   Calculate lane-wise cross production of the specified vectors.
+[[nodiscard]] inline auto cross(Vector3x8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {
+        lhs.y * rhs.z - lhs.z * rhs.y,
+        lhs.z * rhs.x - lhs.x * rhs.z,
+        lhs.x * rhs.y - lhs.y * rhs.x,
+    };
+}
+
+/// @brief
+///   Perform lane-wise linear interpolation between the vectors.
+///
+/// @param start
+///   The first vectors to be interpolated.
+/// @param end
+///   The second vectors to be interpolated.
+/// @param t
+///   Interpolation factors of each lane, must between 0 and 1.
+///
+/// @return
+///   The interpolation result vectors.
+[[nodiscard]] inline auto lerp(Vector3x8 start, Vector3x8 end, Float8 t) noexcept -> Vector3x8 {
+    return start + (end - start) * t;
+}
+
+[[nodiscard]] inline auto abs(Vector3x8 vec) noexcept -> Vector3x8 {
+    return {abs(vec.x), abs(vec.y), abs(vec.z)};
+}
+
+[[nodiscard]] inline auto min(Vector3x8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {min(lhs.x, rhs.x), min(lhs.y, rhs.y), min(lhs.z, rhs.z)};
+}
+
+[[nodiscard]] inline auto max(Vector3x8 lhs, Vector3x8 rhs) noexcept -> Vector3x8 {
+    return {max(lhs.x, rhs.x), max(lhs.y, rhs.y), max(lhs.z, rhs.z)};
+}
+
+[[nodiscard]] inline auto clamp(Vector3x8 vec, Vector3x8 floor, Vector3x8 ceil) noexcept
+    -> Vector3x8 {
+    return max(floor, min(vec, ceil));
+}
+
+[[nodiscard]] inline auto select(Float8 mask, Vector3x8 a, Vector3x8 b) noexcept -> Vector3x8 {
+    return {select(mask, a.x, b.x), select(mask, a.y, b.y), select(mask, a.z, b.z)};
+}
+
+/// @brief
+///   8 4D vectors in SoA layout.
+struct Vector4x8 {
+    Float8 x;
+    Float8 y;
+    Float8 z;
+    Float8 w;
+
+    /// @brief
+    ///   Create 8 4D vectors and initialize all elements to 0.
+    Vector4x8() noexcept = default;
+
+    /// @brief
+    ///   Create 8 4D vectors with the specified lane values.
+    ///
+    /// @param x
+    ///   X elements of the 8 vectors.
+    /// @param y
+    ///   Y elements of the 8 vectors.
+    /// @param z
+    ///   Z elements of the 8 vectors.
+    /// @param w
+    ///   W elements of the 8 vectors.
+    Vector4x8(Float8 x, Float8 y, Float8 z, Float8 w) noexcept : x(x), y(y), z(z), w(w) {}
+
+    /// @brief
+    ///   Create 8 4D vectors from 3D vectors and w elements.
+    ///
+    /// @param xyz
+    ///   X, Y and Z elements of the 8 vectors.
+    /// @param w
+    ///   W elements of the 8 vectors.
+    Vector4x8(Vector3x8 xyz, Float8 w) noexcept : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+
+    /// @brief
+    ///   Fill all lanes with the specified vector.
+    ///
+    /// @param vec
+    ///   The vector to be broadcasted.
+    explicit Vector4x8(Vector4 vec) noexcept : x(vec.x), y(vec.y), z(vec.z), w(vec.w) {}
+
+    /// @brief
+    ///   Load vectors from an AoS array.
+    ///
+    /// @param vectors
+    ///   Pointer to the vectors to be loaded.
+    /// @param count
+    ///   Number of vectors to be loaded. Must not be greater than 8. Lanes that are not loaded are
+    ///   set to 0.
+    explicit Vector4x8(const Vector4 *vectors, std::size_t count = 8) noexcept {
+#if defined(INK_SIMD)
+        if (count == 8) {
+            simd::Float4 lo[4], hi[4];
+            for (std::size_t i = 0; i < 4; ++i) {
+                lo[i] = simd::load(vectors[i].m_arr);
+                hi[i] = simd::load(vectors[i + 4].m_arr);
+            }
+
+            simd::transpose(lo[0], lo[1], lo[2], lo[3]);
+            simd::transpose(hi[0], hi[1], hi[2], hi[3]);
+
+            x = Float8(lo[0], hi[0]);
+            y = Float8(lo[1], hi[1]);
+            z = Float8(lo[2], hi[2]);
+            w = Float8(lo[3], hi[3]);
+            return;
+        }
+#endif
+        alignas(32) float xs[8] = {};
+        alignas(32) float ys[8] = {};
+        alignas(32) float zs[8] = {};
+        alignas(32) float ws[8] = {};
+        for (std::size_t i = 0; i < count; ++i) {
+            xs[i] = vectors[i][0];
+            ys[i] = vectors[i][1];
+            zs[i] = vectors[i][2];
+            ws[i] = vectors[i][3];
+        }
+
+        x = Float8(xs);
+        y = Float8(ys);
+        z = Float8(zs);
+        w = Float8(ws);
+    }
+
+    /// @brief
+    ///   Store vectors to an AoS array.
+    ///
+    /// @param[out] vectors
+    ///   Pointer to the array to store the vectors.
+    /// @param count
+    ///   Number of vectors to be stored. Must not be greater than 8.
+    auto store(Vector4 *vectors, std::size_t count = 8) const noexcept -> void {
+#if defined(INK_SIMD)
+        if (count == 8) {
+            simd::Float4 lo[4] = {x.low(), y.low(), z.low(), w.low()};
+            simd::Float4 hi[4] = {x.high(), y.high(), z.high(), w.high()};
+
+            simd::transpose(lo[0], lo[1], lo[2], lo[3]);
+            simd::transpose(hi[0], hi[1], hi[2], hi[3]);
+
+            for (std::size_t i = 0; i < 4; ++i) {
+                simd::store(vectors[i].m_arr, lo[i]);
+                simd::store(vectors[i + 4].m_arr, hi[i]);
+            }
+            return;
+        }
+#endif
+        alignas(32) float xs[8];
+        alignas(32) float ys[8];
+        alignas(32) float zs[8];
+        alignas(32) float ws[8];
+        x.store(xs);
+        y.store(ys);
+        z.store(zs);
+        w.store(ws);
+        for (std::size_t i = 0; i < count; ++i)
+            vectors[i] = Vector4(xs[i], ys[i], zs[i], ws[i]);
+    }
+
+    /// @brief
+    ///   Get X, Y and Z elements of the 8 vectors.
+    [[nodiscard]] auto xyz() const noexcept -> Vector3x8 { return {x, y, z}; }
+
+    /// @brief
+    ///   Calculate length of the 8 vectors.
+    [[nodiscard]] auto length() const noexcept -> Float8 {
+        return sqrt(x * x + y * y + z * z + w * w);
+    }
+
+    /// @brief
+    ///   Normalize the 8 vectors.
+    ///
+    /// @return
+    ///   Reference to this object.
+    auto normalize() noexcept -> Vector4x8 & {
+        const Float8 invLen = 1.0f / length();
+        x *= invLen;
+        y *= invLen;
+        z *= invLen;
+        w *= invLen;
+        return *this;
+    }
+
+    /// @brief
+    ///   Get normalized vectors of the 8 vectors.
+    [[nodiscard]] auto normalized() const noexcept -> Vector4x8 {
+        const Float8 invLen = 1.0f / length();
+        return {x * invLen, y * invLen, z * invLen, w * invLen};
+    }
+
+    auto operator+=(Vector4x8 rhs) noexcept -> Vector4x8 & {
+        x += rhs.x;
+        y += rhs.y;
+        z += rhs.z;
+        w += rhs.w;
+        return *this;
+    }
+
+    auto operator+=(Float8 rhs) noexcept -> Vector4x8 & {
+        x += rhs;
+        y += rhs;
+        z += rhs;
+        w += rhs;
+        return *this;
+    }
+
+    auto operator-=(Vector4x8 rhs) noexcept -> Vector4x8 & {
+        x -= rhs.x;
+        y -= rhs.y;
+        z -= rhs.z;
+        w -= rhs.w;
+        return *this;
+    }
+
+    auto operator-=(Float8 rhs) noexcept -> Vector4x8 & {
+        x -= rhs;
+        y -= rhs;
+        z -= rhs;
+        w -= rhs;
+        return *this;
+    }
+
+    auto operator*=(Vector4x8 rhs) noexcept -> Vector4x8 & {
+        x *= rhs.x;
+        y *= rhs.y;
+        z *= rhs.z;
+        w *= rhs.w;
+        return *this;
+    }
+
+    auto operator*=(Float8 rhs) noexcept -> Vector4x8 & {
+        x *= rhs;
+        y *= rhs;
+        z *= rhs;
+        w *= rhs;
+        return *this;
+    }
+
+    auto operator/=(Vector4x8 rhs) noexcept -> Vector4x8 & {
+        x /= rhs.x;
+        y /= rhs.y;
+        z /= rhs.z;
+        w /= rhs.w;
+        return *this;
+    }
+
+    auto operator/=(Float8 rhs) noexcept -> Vector4x8 & {
+        x /= rhs;
+        y /= rhs;
+        z /= rhs;
+        w /= rhs;
+        return *this;
+    }
+};
+
+inline auto operator+(Vector4x8 vec) noexcept -> Vector4x8 { return vec; }
+
+inline auto operator-(Vector4x8 vec) noexcept -> Vector4x8 {
+    return {-vec.x, -vec.y, -vec.z, -vec.w};
+}
+
+inline auto operator+(Vector4x8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w};
+}
+
+inline auto operator+(Vector4x8 lhs, Float8 rhs) noexcept -> Vector4x8 {
+    return {lhs.x + rhs, lhs.y + rhs, lhs.z + rhs, lhs.w + rhs};
+}
+
+inline auto operator+(Float8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {lhs + rhs.x, lhs + rhs.y, lhs + rhs.z, lhs + rhs.w};
+}
+
+inline auto operator-(Vector4x8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w};
+}
+
+inline auto operator-(Vector4x8 lhs, Float8 rhs) noexcept -> Vector4x8 {
+    return {lhs.x - rhs, lhs.y - rhs, lhs.z - rhs, lhs.w - rhs};
+}
+
+inline auto operator-(Float8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {lhs - rhs.x, lhs - rhs.y, lhs - rhs.z, lhs - rhs.w};
+}
+
+inline auto operator*(Vector4x8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z, lhs.w * rhs.w};
+}
+
+inline auto operator*(Vector4x8 lhs, Float8 rhs) noexcept -> Vector4x8 {
+    return {lhs.x * rhs, lhs.y * rhs, lhs.z * rhs, lhs.w * rhs};
+}
+
+inline auto operator*(Float8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {lhs * rhs.x, lhs * rhs.y, lhs * rhs.z, lhs * rhs.w};
+}
+
+inline auto operator/(Vector4x8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z, lhs.w / rhs.w};
+}
+
+inline auto operator/(Vector4x8 lhs, Float8 rhs) noexcept -> Vector4x8 {
+    return {lhs.x / rhs, lhs.y / rhs, lhs.z / rhs, lhs.w / rhs};
+}
+
+inline auto operator/(Float8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {lhs / rhs.x, lhs / rhs.y, lhs / rhs.z, lhs / rhs.w};
+}
+
+/// @brief
+///   Calculate lane-wise dot production of the specified vectors.
+[[nodiscard]] inline auto dot(Vector4x8 lhs, Vector4x8 rhs) noexcept -> Float8 {
+    return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w;
+}
+
+/// @brief
+///   Calculate lane-wise cross production of the specified 3D homogeneous coordinate vectors. W
+///   elements of the result are set to 0.
+[[nodiscard]] inline auto cross(Vector4x8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {cross(lhs.xyz(), rhs.xyz()), 0.0f};
+}
+
+/// @brief
+///   Perform lane-wise linear interpolation between the vectors.
+///
+/// @param start
+///   The first vectors to be interpolated.
+/// @param end
+///   The second vectors to be interpolated.
+/// @param t
+///   Interpolation factors of each lane, must between 0 and 1.
+///
+/// @return
+///   The interpolation result vectors.
+[[nodiscard]] inline auto lerp(Vector4x8 start, Vector4x8 end, Float8 t) noexcept -> Vector4x8 {
+    return start + (end - start) * t;
+}
+
+[[nodiscard]] inline auto abs(Vector4x8 vec) noexcept -> Vector4x8 {
+    return {abs(vec.x), abs(vec.y), abs(vec.z), abs(vec.w)};
+}
+
+[[nodiscard]] inline auto min(Vector4x8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {min(lhs.x, rhs.x), min(lhs.y, rhs.y), min(lhs.z, rhs.z), min(lhs.w, rhs.w)};
+}
+
+[[nodiscard]] inline auto max(Vector4x8 lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return {max(lhs.x, rhs.x), max(lhs.y, rhs.y), max(lhs.z, rhs.z), max(lhs.w, rhs.w)};
+}
+
+[[nodiscard]] inline auto clamp(Vector4x8 vec, Vector4x8 floor, Vector4x8 ceil) noexcept
+    -> Vector4x8 {
+    return max(floor, min(vec, ceil));
+}
+
+[[nodiscard]] inline auto select(Float8 mask, Vector4x8 a, Vector4x8 b) noexcept -> Vector4x8 {
+    return {
+        select(mask, a.x, b.x),
+        select(mask, a.y, b.y),
+        select(mask, a.z, b.z),
+        select(mask, a.w, b.w),
+    };
+}
+
+/// @brief
+///   8 quaternions in SoA layout.
+struct Quaternionx8 {
+    Float8 w; // Real part of the quaternions.
+    Float8 x; // Imaginary X
+    Float8 y; // Imaginary Y
+    Float8 z; // Imaginary Z
+
+    /// @brief
+    ///   Create 8 zero quaternions.
+    Quaternionx8() noexcept = default;
+
+    /// @brief
+    ///   Create 8 quaternions with the specified lane values.
+    ///
+    /// @param real
+    ///   Real part of the 8 quaternions.
+    /// @param imgX
+    ///   Imaginary X of the 8 quaternions.
+    /// @param imgY
+    ///   Imaginary Y of the 8 quaternions.
+    /// @param imgZ
+    ///   Imaginary Z of the 8 quaternions.
+    Quaternionx8(Float8 real, Float8 imgX, Float8 imgY, Float8 imgZ) noexcept
+        : w(real), x(imgX), y(imgY), z(imgZ) {}
+
+    /// @brief
+    ///   Fill all lanes with the specified quaternion.
+    ///
+    /// @param quat
+    ///   The quaternion to be broadcasted.
+    explicit Quaternionx8(Quaternion quat) noexcept : w(quat.w), x(quat.x), y(quat.y), z(quat.z) {}
+
+    /// @brief
+    ///   Load quaternions from an AoS array.
+    ///
+    /// @param quats
+    ///   Pointer to the quaternions to be loaded.
+    /// @param count
+    ///   Number of quaternions to be loaded. Must not be greater than 8. Lanes that are not loaded
+    ///   are set to 0.
+    explicit Quaternionx8(const Quaternion *quats, std::size_t count = 8) noexcept {
+#if defined(INK_SIMD)
+        if (count == 8) {
+            simd::Float4 lo[4], hi[4];
+            for (std::size_t i = 0; i < 4; ++i) {
+                lo[i] = simd::load(&quats[i].w);
+                hi[i] = simd::load(&quats[i + 4].w);
+            }
+
+            simd::transpose(lo[0], lo[1], lo[2], lo[3]);
+            simd::transpose(hi[0], hi[1], hi[2], hi[3]);
+
+            w = Float8(lo[0], hi[0]);
+            x = Float8(lo[1], hi[1]);
+            y = Float8(lo[2], hi[2]);
+            z = Float8(lo[3], hi[3]);
+            return;
+        }
+#endif
+        alignas(32) float ws[8] = {};
+        alignas(32) float xs[8] = {};
+        alignas(32) float ys[8] = {};
+        alignas(32) float zs[8] = {};
+        for (std::size_t i = 0; i < count; ++i) {
+            ws[i] = quats[i].w;
+            xs[i] = quats[i].x;
+            ys[i] = quats[i].y;
+            zs[i] = quats[i].z;
+        }
+
+        w = Float8(ws);
+        x = Float8(xs);
+        y = Float8(ys);
+        z = Float8(zs);
+    }
+
+    /// @brief
+    ///   Store quaternions to an AoS array.
+    ///
+    /// @param[out] quats
+    ///   Pointer to the array to store the quaternions.
+    /// @param count
+    ///   Number of quaternions to be stored. Must not be greater than 8.
+    auto store(Quaternion *quats, std::size_t count = 8) const noexcept -> void {
+#if defined(INK_SIMD)
+        if (count == 8) {
+            simd::Float4 lo[4] = {w.low(), x.low(), y.low(), z.low()};
+            simd::Float4 hi[4] = {w.high(), x.high(), y.high(), z.high()};
+
+            simd::transpose(lo[0], lo[1], lo[2], lo[3]);
+            simd::transpose(hi[0], hi[1], hi[2], hi[3]);
+
+            for (std::size_t i = 0; i < 4; ++i) {
+                simd::store(&quats[i].w, lo[i]);
+                simd::store(&quats[i + 4].w, hi[i]);
+            }
+            return;
+        }
+#endif
+        alignas(32) float ws[8];
+        alignas(32) float xs[8];
+        alignas(32) float ys[8];
+        alignas(32) float zs[8];
+        w.store(ws);
+        x.store(xs);
+        y.store(ys);
+        z.store(zs);
+        for (std::size_t i = 0; i < count; ++i)
+            quats[i] = Quaternion(ws[i], xs[i], ys[i], zs[i]);
+    }
+
+    /// @brief
+    ///   Calculate length of the 8 quaternions.
+    [[nodiscard]] auto length() const noexcept -> Float8 {
+        return sqrt(w * w + x * x + y * y + z * z);
+    }
+
+    /// @brief
+    ///   Normalize the 8 quaternions.
+    ///
+    /// @return
+    ///   Reference to this object.
+    auto normalize() noexcept -> Quaternionx8 & {
+        const Float8 invLen = 1.0f / length();
+        w *= invLen;
+        x *= invLen;
+        y *= invLen;
+        z *= invLen;
+        return *this;
+    }
+
+    /// @brief
+    ///   Get normalized quaternions of the 8 quaternions.
+    [[nodiscard]] auto normalized() const noexcept -> Quaternionx8 {
+        const Float8 invLen = 1.0f / length();
+        return {w * invLen, x * invLen, y * invLen, z * invLen};
+    }
+
+    /// @brief
+    ///   Get conjugate quaternions of the 8 quaternions.
+    [[nodiscard]] auto conjugated() const noexcept -> Quaternionx8 { return {w, -x, -y, -z}; }
+
+    /// @brief
+    ///   Get inversed quaternions of the 8 quaternions.
+    [[nodiscard]] auto inversed() const noexcept -> Quaternionx8 {
+        const Float8 invLen2 = 1.0f / (w * w + x * x + y * y + z * z);
+        return {w * invLen2, -x * invLen2, -y * invLen2, -z * invLen2};
+    }
+
+    auto operator+=(Quaternionx8 rhs) noexcept -> Quaternionx8 & {
+        w += rhs.w;
+        x += rhs.x;
+        y += rhs.y;
+        z += rhs.z;
+        return *this;
+    }
+
+    auto operator-=(Quaternionx8 rhs) noexcept -> Quaternionx8 & {
+        w -= rhs.w;
+        x -= rhs.x;
+        y -= rhs.y;
+        z -= rhs.z;
+        return *this;
+    }
+
+    auto operator*=(Float8 rhs) noexcept -> Quaternionx8 & {
+        w *= rhs;
+        x *= rhs;
+        y *= rhs;
+        z *= rhs;
+        return *this;
+    }
+
+    auto operator*=(Quaternionx8 rhs) noexcept -> Quaternionx8 &;
+
+    auto operator/=(Float8 rhs) noexcept -> Quaternionx8 & {
+        w /= rhs;
+        x /= rhs;
+        y /= rhs;
+        z /= rhs;
+        return *this;
+    }
+};
+
+inline auto operator+(Quaternionx8 quat) noexcept -> Quaternionx8 { return quat; }
+
+inline auto operator-(Quaternionx8 quat) noexcept -> Quaternionx8 {
+    return {-quat.w, -quat.x, -quat.y, -quat.z};
+}
+
+inline auto operator+(Quaternionx8 lhs, Quaternionx8 rhs) noexcept -> Quaternionx8 {
+    return {lhs.w + rhs.w, lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z};
+}
+
+inline auto operator-(Quaternionx8 lhs, Quaternionx8 rhs) noexcept -> Quaternionx8 {
+    return {lhs.w - rhs.w, lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z};
+}
+
+inline auto operator*(Quaternionx8 lhs, Quaternionx8 rhs) noexcept -> Quaternionx8 {
+    return {
+        lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z,
+        lhs.x * rhs.w + lhs.w * rhs.x - lhs.z * rhs.y + lhs.y * rhs.z,
+        lhs.y * rhs.w + lhs.z * rhs.x + lhs.w * rhs.y - lhs.x * rhs.z,
+        lhs.z * rhs.w - lhs.y * rhs.x + lhs.x * rhs.y + lhs.w * rhs.z,
+    };
+}
+
+inline auto operator*(Quaternionx8 lhs, Float8 rhs) noexcept -> Quaternionx8 {
+    return {lhs.w * rhs, lhs.x * rhs, lhs.y * rhs, lhs.z * rhs};
+}
+
+inline auto operator*(Float8 lhs, Quaternionx8 rhs) noexcept -> Quaternionx8 {
+    return {lhs * rhs.w, lhs * rhs.x, lhs * rhs.y, lhs * rhs.z};
+}
+
+inline auto operator/(Quaternionx8 lhs, Quaternionx8 rhs) noexcept -> Quaternionx8 {
+    return lhs * rhs.inversed();
+}
+
+inline auto operator/(Quaternionx8 lhs, Float8 rhs) noexcept -> Quaternionx8 {
+    return {lhs.w / rhs, lhs.x / rhs, lhs.y / rhs, lhs.z / rhs};
+}
+
+inline auto Quaternionx8::operator*=(Quaternionx8 rhs) noexcept -> Quaternionx8 & {
+    *this = *this * rhs;
+    return *this;
+}
+
+[[nodiscard]] inline auto select(Float8 mask, Quaternionx8 a, Quaternionx8 b) noexcept
+    -> Quaternionx8 {
+    return {
+        select(mask, a.w, b.w),
+        select(mask, a.x, b.x),
+        select(mask, a.y, b.y),
+        select(mask, a.z, b.z),
+    };
+}
+
+/// @brief
+///   Calculate lane-wise dot production of the specified quaternions.
+[[nodiscard]] inline auto dot(Quaternionx8 lhs, Quaternionx8 rhs) noexcept -> Float8 {
+    return lhs.w * rhs.w + lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+}
+
+/// @brief
+///   Perform lane-wise normalized linear interpolation between the quaternions.
+///
+/// @param start
+///   The first quaternions to be interpolated.
+/// @param end
+///   The second quaternions to be interpolated.
+/// @param t
+///   Interpolation factors of each lane, must between 0 and 1.
+///
+/// @return
+///   The interpolation result quaternions.
+[[nodiscard]] inline auto nlerp(Quaternionx8 start, Quaternionx8 end, Float8 t) noexcept
+    -> Quaternionx8 {
+    return (start + (end - start) * t).normalized();
+}
+
+/// @brief
+///   Perform lane-wise spherical linear interpolation between the quaternions.
+/// @note
+///   Trigonometric functions are evaluated per lane.
+///
+/// @param start
+///   The first quaternions to be interpolated.
+/// @param end
+///   The second quaternions to be interpolated.
+/// @param t
+///   Interpolation factors of each lane, must between 0 and 1.
+///
+/// @return
+///   The interpolation result quaternions.
+[[nodiscard]] inline auto slerp(Quaternionx8 start, Quaternionx8 end, Float8 t) noexcept
+    -> Quaternionx8 {
+    Float8 c = dot(start, end);
+
+    // Interpolate the shortest path.
+    const Float8 negative = c < 0.0f;
+    c                     = select(negative, -c, c);
+    end                   = select(negative, -end, end);
+
+    const Float8 s     = sqrt(max(1.0f - c * c, 0.0f));
+    const Float8 theta = detail::mapLanes(s, c, [](float a, float b) { return std::atan2(a, b); });
+
+    const Float8 invSin = 1.0f / s;
+    const Float8 t0 =
+        detail::mapLanes((1.0f - t) * theta, [](float v) { return std::sin(v); }) * invSin;
+    const Float8 t1 = detail::mapLanes(t * theta, [](float v) { return std::sin(v); }) * invSin;
+
+    return select(s < FLT_EPSILON, nlerp(start, end, t), t0 * start + t1 * end);
+}
+
+/// @brief
+///   8 column major 4x4 matrices in SoA layout.
+struct Matrix4x8 {
+    Vector4x8 column[4];
+
+    /// @brief
+    ///   Create 8 zero matrices.
+    Matrix4x8() noexcept = default;
+
+    /// @brief
+    ///   Create 8 matrices with the specified columns.
+    ///
+    /// @param c0
+    ///   Values at column 0 of the 8 matrices.
+    /// @param c1
+    ///   Values at column 1 of the 8 matrices.
+    /// @param c2
+    ///   Values at column 2 of the 8 matrices.
+    /// @param c3
+    ///   Values at column 3 of the 8 matrices.
+    Matrix4x8(Vector4x8 c0, Vector4x8 c1, Vector4x8 c2, Vector4x8 c3) noexcept
+        : column{c0, c1, c2, c3} {}
+
+    /// @brief
+    ///   Fill all lanes with the specified matrix.
+    ///
+    /// @param m
+    ///   The matrix to be broadcasted.
+    explicit Matrix4x8(const Matrix4 &m) noexcept
+        : column{Vector4x8(m[0]), Vector4x8(m[1]), Vector4x8(m[2]), Vector4x8(m[3])} {}
+
+    /// @brief
+    ///   Load matrices from an AoS array.
+    ///
+    /// @param matrices
+    ///   Pointer to the matrices to be loaded.
+    /// @param count
+    ///   Number of matrices to be loaded. Must not be greater than 8. Lanes that are not loaded are
+    ///   set to 0.
+    explicit Matrix4x8(const Matrix4 *matrices, std::size_t count = 8) noexcept {
+#if defined(INK_SIMD)
+        if (count == 8) {
+            for (std::size_t c = 0; c < 4; ++c) {
+                simd::Float4 lo[4], hi[4];
+                for (std::size_t i = 0; i < 4; ++i) {
+                    lo[i] = simd::load(&matrices[i][c][0]);
+                    hi[i] = simd::load(&matrices[i + 4][c][0]);
+                }
+
+                simd::transpose(lo[0], lo[1], lo[2], lo[3]);
+                simd::transpose(hi[0], hi[1], hi[2], hi[3]);
+
+                column[c] = Vector4x8(Float8(lo[0], hi[0]), Float8(lo[1], hi[1]),
+                                      Float8(lo[2], hi[2]), Float8(lo[3], hi[3]));
+            }
+            return;
+        }
+#endif
+        for (std::size_t c = 0; c < 4; ++c) {
+            Vector4 columns[8];
+            for (std::size_t i = 0; i < count; ++i)
+                columns[i] = matrices[i][c];
+            column[c] = Vector4x8(columns, count);
+        }
+    }
+
+    /// @brief
+    ///   Store matrices to an AoS array.
+    ///
+    /// @param[out] matrices
+    ///   Pointer to the array to store the matrices.
+    /// @param count
+    ///   Number of matrices to be stored. Must not be greater than 8.
+    auto store(Matrix4 *matrices, std::size_t count = 8) const noexcept -> void {
+        for (std::size_t c = 0; c < 4; ++c) {
+            Vector4 columns[8];
+            column[c].store(columns, count);
+            for (std::size_t i = 0; i < count; ++i)
+                matrices[i][c] = columns[i];
+        }
+    }
+
+    /// @brief
+    ///   Random access columns of the matrices.
+    auto operator[](std::size_t i) noexcept -> Vector4x8 & { return column[i]; }
+
+    /// @brief
+    ///   Random access columns of the matrices.
+    auto operator[](std::size_t i) const noexcept -> const Vector4x8 & { return column[i]; }
+
+    /// @brief
+    ///   Get transposed matrices of the 8 matrices.
+    [[nodiscard]] auto transposed() const noexcept -> Matrix4x8 {
+        return {
+            {column[0].x, column[1].x, column[2].x, column[3].x},
+            {column[0].y, column[1].y, column[2].y, column[3].y},
+            {column[0].z, column[1].z, column[2].z, column[3].z},
+            {column[0].w, column[1].w, column[2].w, column[3].w},
+        };
+    }
+};
+
+inline auto operator+(const Matrix4x8 &lhs, const Matrix4x8 &rhs) noexcept -> Matrix4x8 {
+    return {lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2], lhs[3] + rhs[3]};
+}
+
+inline auto operator-(const Matrix4x8 &lhs, const Matrix4x8 &rhs) noexcept -> Matrix4x8 {
+    return {lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], lhs[3] - rhs[3]};
+}
+
+inline auto operator*(const Matrix4x8 &lhs, Float8 rhs) noexcept -> Matrix4x8 {
+    return {lhs[0] * rhs, lhs[1] * rhs, lhs[2] * rhs, lhs[3] * rhs};
+}
+
+inline auto operator*(const Matrix4x8 &lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return lhs[0] * rhs.x + lhs[1] * rhs.y + lhs[2] * rhs.z + lhs[3] * rhs.w;
+}
+
+inline auto operator*(Vector4x8 lhs, const Matrix4x8 &rhs) noexcept -> Vector4x8 {
+    return {dot(lhs, rhs[0]), dot(lhs, rhs[1]), dot(lhs, rhs[2]), dot(lhs, rhs[3])};
+}
+
+inline auto operator*(const Matrix4x8 &lhs, const Matrix4x8 &rhs) noexcept -> Matrix4x8 {
+    return {lhs * rhs[0], lhs * rhs[1], lhs * rhs[2], lhs * rhs[3]};
+}
+
+/// @brief
+///   Multiply the same matrix with 8 column vectors.
+inline auto operator*(const Matrix4 &lhs, Vector4x8 rhs) noexcept -> Vector4x8 {
+    return Vector4x8(lhs[0]) * rhs.x + Vector4x8(lhs[1]) * rhs.y + Vector4x8(lhs[2]) * rhs.z +
+           Vector4x8(lhs[3]) * rhs.w;
+}
+
+/// @brief
+///   Multiply 8 row vectors with the same matrix.
+inline auto operator*(Vector4x8 lhs, const Matrix4 &rhs) noexcept -> Vector4x8 {
+    return {
+        lhs.x * rhs[0][0] + lhs.y * rhs[0][1] + lhs.z * rhs[0][2] + lhs.w * rhs[0][3],
+        lhs.x * rhs[1][0] + lhs.y * rhs[1][1] + lhs.z * rhs[1][2] + lhs.w * rhs[1][3],
+        lhs.x * rhs[2][0] + lhs.y * rhs[2][1] + lhs.z * rhs[2][2] + lhs.w * rhs[2][3],
+        lhs.x * rhs[3][0] + lhs.y * rhs[3][1] + lhs.z * rhs[3][2] + lhs.w * rhs[3][3],
+    };
+}
+
+/// @brief
+///   Decompose 8 affine matrices into translations, rotations and scales. This is the lane-wise
+///   version of @p decompose() for @p Matrix4.
+/// @note
+///   Shepperd's method is evaluated without branches: the largest quaternion component of each
+///   lane is selected with masks and only 1 square root is calculated.
+///
+/// @param matrix
+///   The affine matrices to be decomposed.
+/// @param[out] translation
+///   Translations of the matrices.
+/// @param[out] rotation
+///   Rotations of the matrices. These are always unit quaternions.
+/// @param[out] scale
+///   Scales of the matrices. Mirroring is represented as negative scale along X axis.
+inline auto decompose(const Matrix4x8 &matrix,
+                      Vector3x8       &translation,
+                      Quaternionx8    &rotation,
+                      Vector3x8       &scale) noexcept -> void {
+    const Vector3x8 x(matrix[0].x, matrix[1].x, matrix[2].x);
+    const Vector3x8 y(matrix[0].y, matrix[1].y, matrix[2].y);
+    const Vector3x8 z(matrix[0].z, matrix[1].z, matrix[2].z);
+
+    scale       = Vector3x8(x.length(), y.length(), z.length());
+    scale.x     = select(dot(cross(x, y), z) < 0.0f, -scale.x, scale.x);
+    translation = Vector3x8(matrix[0].w, matrix[1].w, matrix[2].w);
+
+    // Element (i, j) of the rotation matrix is element i of basis vector j.
+    const Vector3x8 r0 = x * (1.0f / scale.x);
+    const Vector3x8 r1 = y * (1.0f / scale.y);
+    const Vector3x8 r2 = z * (1.0f / scale.z);
+
+    const Float8 tw = 1.0f + r0.x + r1.y + r2.z;
+    const Float8 tx = 1.0f + r0.x - r1.y - r2.z;
+    const Float8 ty = 1.0f - r0.x + r1.y - r2.z;
+    const Float8 tz = 1.0f - r0.x - r1.y + r2.z;
+    const Float8 t  = max(max(tw, tx), max(ty, tz));
+
+    const Float8 a = r1.z - r2.y; // m21 - m12
+    const Float8 b = r2.x - r0.z; // m02 - m20
+    const Float8 c = r0.y - r1.x; // m10 - m01
+    const Float8 d = r1.x + r0.y; // m01 + m10
+    const Float8 e = r2.x + r0.z; // m02 + m20
+    const Float8 f = r2.y + r1.z; // m12 + m21
+
+    // Select components of the largest case. Earlier cases take priority on ties.
+    Quaternionx8 q(c, e, f, t);
+    q = select(ty >= t, Quaternionx8(b, d, t, f), q);
+    q = select(tx >= t, Quaternionx8(a, t, d, e), q);
+    q = select(tw >= t, Quaternionx8(t, a, b, c), q);
+
+    rotation = (q * (0.5f / sqrt(t))).normalized();
+}
+
+} // namespace ink
@@ -1,50 +1,12 @@
 #pragma once
 
+#include "../math/color_type.hpp"
 #include "descriptor.hpp"
 
 #include <wrl/client.h>
 
 namespace ink {
 
-struct Color {
-    float red   = 0;
-    float green = 0;
-    float blue  = 0;
-    float alpha = 0;
-
-    /// @brief
-    ///   Create a transparent black color. All elements are initialized to 0.
-    constexpr Color() noexcept = default;
-
-    /// @brief
-    ///   Create a color with the given color values.
-    ///
-    /// @param r
-    ///   Red intensity of this color. For non-HDR images, this value should be less than or equal
-    ///   to 1.
-    /// @param g
-    ///   Green intensity of this color. For non-HDR images, this value should be less than or equal
-    ///   to 1.
-    /// @param b
-    ///   Blue intensity of this color. For non-HDR images, this value should be less than or equal
-    ///   to 1.
-    /// @param a
-    ///   Opacity of this color.
-    constexpr Color(float r, float g, float b, float a) noexcept
-        : red(r), green(g), blue(b), alpha(a) {}
-};
-
-namespace colors {
-
-inline constexpr Color Transparent{0.0f, 0.0f, 0.0f, 0.0f};
-inline constexpr Color Black{0.0f, 0.0f, 0.0f, 1.0f};
-inline constexpr Color White{1.0f, 1.0f, 1.0f, 1.0f};
-inline constexpr Color Red{1.0f, 0.0f, 0.0f, 1.0f};
-inline constexpr Color Green{0.0f, 1.0f, 0.0f, 1.0f};
-inline constexpr Color Blue{0.0f, 0.0f, 1.0f, 1.0f};
-
-} // namespace colors
-
 class GpuResource {
 public:
     /// @brief
@@ -0,0 +1,62 @@
+#include <ink/core/parallel.hpp>
+
+#include <atomic>
+#include <vector>
+
+using namespace ink;
+
+TEST_CASE("Parallel tasks", "[Parallel]") {
+    SECTION("Single task runs on the calling thread") {
+        const std::thread::id caller = std::this_thread::get_id();
+
+        std::size_t calls = 0;
+        detail::parallelTasks(1, [&](std::size_t task, std::size_t taskCount) {
+            REQUIRE(task == 0);
+            REQUIRE(taskCount == 1);
+            REQUIRE(std::this_thread::get_id() == caller);
+            ++calls;
+        });
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("Every task runs once") {
+        constexpr std::size_t MaxTasks = 8;
+
+        std::atomic<std::size_t> calls[MaxTasks] = {};
+        std::atomic<std::size_t> reportedCount(0);
+        detail::parallelTasks(MaxTasks, [&](std::size_t task, std::size_t taskCount) {
+            calls[task].fetch_add(1);
+            reportedCount.store(taskCount);
+        });
+
+        const std::size_t taskCount = reportedCount.load();
+        REQUIRE(taskCount >= 1);
+        REQUIRE(taskCount <= MaxTasks);
+        for (std::size_t task = 0; task < MaxTasks; ++task)
+            REQUIRE(calls[task].load() == (task < taskCount ? 1 : 0));
+    }
+
+    SECTION("Barrier separates phases") {
+        constexpr std::size_t MaxTasks = 4;
+        constexpr std::size_t Phases   = 100;
+
+        // Each task writes its own slot in a phase and reads all slots after the barrier.
+        std::vector<std::size_t> slots(MaxTasks);
+        std::atomic<std::size_t> mismatches(0);
+        detail::Barrier          barrier;
+        detail::parallelTasks(MaxTasks, [&](std::size_t task, std::size_t taskCount) {
+            for (std::size_t phase = 0; phase < Phases; ++phase) {
+                slots[task] = phase;
+                barrier.wait(taskCount);
+                for (std::size_t other = 0; other < taskCount; ++other)
+                    mismatches.fetch_add(slots[other] == phase ? 0 : 1);
+                barrier.wait(taskCount);
+            }
+        });
+        REQUIRE(mismatches.load() == 0);
+    }
+
+    REQUIRE(detail::parallelTaskCount(10, 100) == 1);
+    REQUIRE(detail::parallelTaskCount(1000, 100, 1) == 1);
+    REQUIRE(detail::parallelTaskCount(1000, 100) >= 1);
+}
@@ -0,0 +1,91 @@
+#include <ink/core/radix_sort.hpp>
+
+#include <numeric>
+#include <random>
+
+using namespace ink;
+
+template <typename Key>
+static auto checkRadixSort(std::vector<Key> keys) -> void {
+    std::vector<std::uint32_t> indices(keys.size());
+    std::iota(indices.begin(), indices.end(), 0U);
+
+    std::vector<std::uint32_t> expected = indices;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&keys](std::uint32_t a, std::uint32_t b) { return keys[a] < keys[b]; });
+
+    std::vector<Key> sorted = keys;
+    radixSort(sorted.data(), indices.data(), sorted.size());
+
+    // Radix sort is stable, so the permutation is the same as std::stable_sort.
+    REQUIRE(indices == expected);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        REQUIRE(sorted[i] == keys[indices[i]]);
+
+    std::vector<Key> keysOnly = keys;
+    radixSort(keysOnly.data(), keysOnly.size());
+    REQUIRE(keysOnly == sorted);
+}
+
+TEST_CASE("Radix sort", "[RadixSort]") {
+    std::mt19937_64 random(42);
+
+    SECTION("Small arrays") {
+        checkRadixSort(std::vector<std::uint32_t>{});
+        checkRadixSort(std::vector<std::uint32_t>{7});
+        checkRadixSort(std::vector<std::uint32_t>{3, 1, 2, 1, 0xFFFFFFFFU, 0});
+        checkRadixSort(std::vector<std::uint64_t>{~0ULL, 1ULL << 40, 5, 1ULL << 40, 0});
+    }
+
+    SECTION("32-bit keys") {
+        // Large enough to be split across threads. Few distinct keys check stability.
+        std::vector<std::uint32_t> keys(100003);
+        for (auto &key : keys)
+            key = static_cast<std::uint32_t>(random());
+        checkRadixSort(keys);
+
+        for (auto &key : keys)
+            key = static_cast<std::uint32_t>(random() % 16) << 20;
+        checkRadixSort(keys);
+    }
+
+    SECTION("64-bit keys") {
+        std::vector<std::uint64_t> keys(70001);
+        for (auto &key : keys)
+            key = random();
+        checkRadixSort(keys);
+
+        for (auto &key : keys)
+            key = random() >> 40;
+        checkRadixSort(keys);
+    }
+
+    SECTION("Sorted and equal keys") {
+        std::vector<std::uint32_t> keys(1000);
+        std::iota(keys.begin(), keys.end(), 0U);
+        checkRadixSort(keys);
+
+        std::reverse(keys.begin(), keys.end());
+        checkRadixSort(keys);
+
+        std::fill(keys.begin(), keys.end(), 0x12345678U);
+        checkRadixSort(keys);
+    }
+
+    SECTION("Scratch buffers") {
+        std::vector<std::uint32_t> keys(5000);
+        std::vector<std::uint32_t> values(5000);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            keys[i]   = static_cast<std::uint32_t>(random());
+            values[i] = keys[i] ^ 0xA5A5A5A5U;
+        }
+
+        std::vector<std::uint32_t> keyScratch(keys.size());
+        std::vector<std::uint32_t> valueScratch(keys.size());
+        radixSort(keys.data(), values.data(), keys.size(), keyScratch.data(), valueScratch.data());
+
+        REQUIRE(std::is_sorted(keys.begin(), keys.end()));
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            REQUIRE(values[i] == (keys[i] ^ 0xA5A5A5A5U));
+    }
+}
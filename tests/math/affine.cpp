@@ -0,0 +1,85 @@
+#include <ink/math/affine.hpp>
+#include <ink/math/numbers.hpp>
+
+using namespace ink;
+
+static auto near(float a, float b, float eps = 1e-5f) noexcept -> bool {
+    return std::abs(a - b) <= eps;
+}
+
+static auto near(Vector3 a, Vector3 b) noexcept -> bool {
+    return near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z);
+}
+
+static auto near(Vector4 a, Vector4 b) noexcept -> bool {
+    return near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z) && near(a.w, b.w);
+}
+
+static auto near(const Matrix3x4 &a, const Matrix3x4 &b) noexcept -> bool {
+    return near(a[0], b[0]) && near(a[1], b[1]) && near(a[2], b[2]);
+}
+
+static auto makeTransform(float angle, Vector3 offset) noexcept -> Matrix4 {
+    Matrix4 m(1.0f);
+    m.scale(2.0f, 0.5f, 1.5f)
+        .rotate(Vector3(1.0f, 2.0f, 3.0f).normalized(), angle)
+        .translate(offset);
+    return m;
+}
+
+TEST_CASE("Matrix3x4 layout", "[Matrix3x4]") {
+    static_assert(sizeof(Matrix3x4) == sizeof(float) * 12);
+    static_assert(alignof(Matrix3x4) == 16);
+
+    constexpr Matrix3x4 identity(1.0f);
+    static_assert(identity.toMatrix4() == Matrix4(1.0f));
+    static_assert(Matrix3x4(Matrix4(1.0f)) == identity);
+
+    const Matrix4   m = makeTransform(Pi<float> * 0.3f, Vector3(1.0f, -2.0f, 3.0f));
+    const Matrix3x4 a(m);
+    REQUIRE(a.toMatrix4() == m);
+    REQUIRE(a.translation() == Vector3(m[0][3], m[1][3], m[2][3]));
+}
+
+TEST_CASE("Matrix3x4 compose", "[Matrix3x4]") {
+    const Matrix4 m0 = makeTransform(Pi<float> * 0.3f, Vector3(1.0f, -2.0f, 3.0f));
+    const Matrix4 m1 = makeTransform(Pi<float> * -0.7f, Vector3(-4.0f, 5.0f, 0.5f));
+
+    const Matrix3x4 a(m0);
+    const Matrix3x4 b(m1);
+    REQUIRE(near(a * b, Matrix3x4(m0 * m1)));
+
+    Matrix3x4 c = a;
+    c *= b;
+    REQUIRE(c == a * b);
+
+    // Point transform order is the same as Matrix4.
+    const Vector3 p(0.25f, -1.0f, 2.0f);
+    REQUIRE(near((a * b).transformPoint(p), b.transformPoint(a.transformPoint(p))));
+}
+
+TEST_CASE("Matrix3x4 transform", "[Matrix3x4]") {
+    const Matrix4   m = makeTransform(Pi<float> * 0.3f, Vector3(1.0f, -2.0f, 3.0f));
+    const Matrix3x4 a(m);
+
+    const Vector3 p(0.25f, -1.0f, 2.0f);
+    const Vector4 p4 = Vector4(p, 1.0f) * m;
+    const Vector4 d4 = Vector4(p, 0.0f) * m;
+
+    REQUIRE(near(a.transformPoint(p), Vector3(p4.x, p4.y, p4.z)));
+    REQUIRE(near(a.transformDirection(p), Vector3(d4.x, d4.y, d4.z)));
+    REQUIRE(near(Vector4(p, 1.0f) * a, p4));
+}
+
+TEST_CASE("Matrix3x4 inverse", "[Matrix3x4]") {
+    const Matrix4 m = makeTransform(Pi<float> * 0.3f, Vector3(1.0f, -2.0f, 3.0f));
+    Matrix3x4     a(m);
+
+    const Matrix3x4 inversed = a.inversed();
+    REQUIRE(near(inversed, Matrix3x4(m.inversed())));
+    REQUIRE(near(a * inversed, Matrix3x4(1.0f)));
+    REQUIRE(near(a.inverseTransposed3x3(), Matrix3x4(m.inverseTransposed3x3())));
+
+    a.inverse();
+    REQUIRE(a == inversed);
+}
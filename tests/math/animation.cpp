@@ -0,0 +1,225 @@
+#include <ink/math/animation.hpp>
+
+#include <vector>
+
+using namespace ink;
+
+static auto near(float a, float b) noexcept -> bool {
+    return std::abs(a - b) <= 1e-4f * std::max(1.0f, std::abs(a));
+}
+
+static auto near(Vector3 a, Vector3 b) noexcept -> bool {
+    return near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z);
+}
+
+static auto near(Quaternion a, Quaternion b) noexcept -> bool {
+    return near(a.w, b.w) && near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z);
+}
+
+static auto near(const Transform &a, const Transform &b) noexcept -> bool {
+    return near(a.translation, b.translation) && near(a.rotation, b.rotation) &&
+           near(a.scale, b.scale);
+}
+
+/// @brief
+///   Keyframes of a single joint. Joints have different number of keyframes.
+struct Track {
+    std::vector<float>      times;
+    std::vector<Vector3>    translations;
+    std::vector<Quaternion> rotations;
+    std::vector<Vector3>    scales;
+};
+
+static auto makeTrack(std::size_t joint) -> Track {
+    Track track;
+    for (std::size_t i = 0; i < joint % 5 + 2; ++i) {
+        const float f = static_cast<float>(i + joint);
+        track.times.push_back(static_cast<float>(i) * 0.4f + static_cast<float>(joint % 3) * 0.1f);
+        track.translations.emplace_back(std::sin(f), std::cos(f), f * 0.1f);
+        track.scales.emplace_back(1.0f + 0.1f * std::sin(f));
+
+        // Negated quaternions cover the shortest path.
+        const Quaternion q(Vector3(0.0f, 1.0f, 0.0f).normalized(), f * 0.9f);
+        track.rotations.push_back(i % 2 == 0 ? q : -q);
+    }
+    return track;
+}
+
+/// @brief
+///   Sample a track with scalar math.
+static auto sampleTrack(const Track &track, float time, bool step) noexcept -> Transform {
+    std::size_t key = 0;
+    while (key + 1 < track.times.size() && track.times[key + 1] <= time)
+        ++key;
+
+    const std::size_t next = std::min(key + 1, track.times.size() - 1);
+    const float       t0   = track.times[key];
+    const float       t1   = track.times[next];
+
+    float t = 0.0f;
+    if (!step && t1 > t0)
+        t = std::clamp((time - t0) / (t1 - t0), 0.0f, 1.0f);
+
+    Quaternion end = track.rotations[next];
+    if (dot(track.rotations[key], end) < 0.0f)
+        end = -end;
+
+    return {lerp(track.translations[key], track.translations[next], t),
+            nlerp(track.rotations[key], end, t),
+            lerp(track.scales[key], track.scales[next], t)};
+}
+
+TEST_CASE("Animation clip sampling", "[Animation]") {
+    constexpr std::size_t JointCount = 19;
+
+    const Transform rest(Vector3(9.0f), Quaternion(1.0f), Vector3(2.0f));
+
+    AnimationClip      clip(JointCount);
+    std::vector<Track> tracks;
+    for (std::uint32_t joint = 0; joint < JointCount; ++joint) {
+        tracks.push_back(makeTrack(joint));
+        const Track      &track = tracks.back();
+        const std::size_t count = track.times.size();
+
+        // Joint 3 is not animated. Joint 4 only animates rotation.
+        if (joint == 3)
+            continue;
+        clip.setRotation(joint, track.times.data(), track.rotations.data(), count);
+        if (joint == 4)
+            continue;
+
+        const auto mode = (joint % 4 == 1) ? AnimationInterpolation::Step
+                                           : AnimationInterpolation::Linear;
+        clip.setTranslation(joint, track.times.data(), track.translations.data(), count, mode);
+        clip.setScale(joint, track.times.data(), track.scales.data(), count, mode);
+    }
+
+    REQUIRE(clip.jointCount() == JointCount);
+    REQUIRE(near(clip.duration(), 5 * 0.4f + 0.2f));
+
+    const auto check = [&](const std::vector<Transform> &pose, float time) {
+        for (std::size_t joint = 0; joint < JointCount; ++joint) {
+            Transform expected = sampleTrack(tracks[joint], time, joint % 4 == 1);
+            if (joint % 4 == 1) {
+                // Rotations are always interpolated linearly in this test.
+                expected.rotation = sampleTrack(tracks[joint], time, false).rotation;
+            }
+
+            if (joint == 3) {
+                REQUIRE(near(pose[joint], rest));
+            } else if (joint == 4) {
+                REQUIRE(near(pose[joint].rotation, expected.rotation));
+                REQUIRE(near(pose[joint].translation, rest.translation));
+            } else {
+                REQUIRE(near(pose[joint], expected));
+            }
+        }
+    };
+
+    AnimationCursor        cursor(clip);
+    std::vector<Transform> pose(JointCount, rest);
+    std::vector<Transform> cursorPose(JointCount, rest);
+
+    // Play forward with small steps, then loop back and jump forward.
+    std::vector<float> times;
+    for (float time = -0.5f; time < clip.duration() + 0.5f; time += 0.013f)
+        times.push_back(time);
+    times.push_back(0.3f);
+    times.push_back(2.5f);
+    times.push_back(0.0f);
+
+    for (const float time : times) {
+        clip.sample(time, pose.data());
+        check(pose, time);
+
+        clip.sample(time, cursor, cursorPose.data());
+        REQUIRE(cursor.time() == time);
+        check(cursorPose, time);
+    }
+
+    cursor.reset();
+    clip.sample(1.0f, cursor, cursorPose.data());
+    check(cursorPose, 1.0f);
+
+    // Empty clips do nothing.
+    AnimationClip empty(2);
+    empty.sample(0.0f, pose.data());
+    REQUIRE(near(pose[3], rest));
+}
+
+TEST_CASE("Animation clip channel replacement", "[Animation]") {
+    const Transform rest(Vector3(0.0f), Quaternion(1.0f), Vector3(1.0f));
+
+    AnimationClip clip(2);
+    const Track   first  = makeTrack(4);
+    const Track   second = makeTrack(1);
+    clip.setTranslation(0, first.times.data(), first.translations.data(), first.times.size());
+    clip.setScale(1, second.times.data(), second.scales.data(), second.times.size());
+    REQUIRE(near(clip.duration(), first.times.back()));
+
+    // Replacing the longest channel shortens the clip. Keys of other channels are kept.
+    const Track shorter = makeTrack(0);
+    clip.setTranslation(0, shorter.times.data(), shorter.translations.data(),
+                        shorter.times.size());
+    REQUIRE(near(clip.duration(), std::max(shorter.times.back(), second.times.back())));
+
+    std::vector<Transform> pose(2, rest);
+    for (float time = 0.0f; time < 1.0f; time += 0.1f) {
+        clip.sample(time, pose.data());
+        REQUIRE(near(pose[0].translation, sampleTrack(shorter, time, false).translation));
+        REQUIRE(near(pose[1].scale, sampleTrack(second, time, false).scale));
+    }
+
+    // Removing a channel leaves the joint at its pose.
+    clip.setTranslation(0, nullptr, nullptr, 0);
+    REQUIRE(near(clip.duration(), second.times.back()));
+
+    pose.assign(2, rest);
+    clip.sample(0.5f, pose.data());
+    REQUIRE(near(pose[0], rest));
+    REQUIRE(near(pose[1].scale, sampleTrack(second, 0.5f, false).scale));
+
+    clip.setScale(1, nullptr, nullptr, 0);
+    REQUIRE(clip.duration() == 0.0f);
+}
+
+TEST_CASE("Animation pose blending", "[Animation]") {
+    constexpr std::size_t JointCount = 13;
+
+    std::vector<Transform> a(JointCount);
+    std::vector<Transform> b(JointCount);
+    std::vector<Transform> c(JointCount);
+    for (std::size_t i = 0; i < JointCount; ++i) {
+        const float f = static_cast<float>(i);
+        const auto  q = Quaternion(Vector3(1.0f, 0.0f, 0.0f), f * 0.2f);
+        a[i]          = Transform(Vector3(f, 0.0f, 1.0f), q, Vector3(1.0f));
+        b[i]          = Transform(Vector3(0.0f, f, 3.0f), -q * Quaternion(Vector3(0, 0, 1), 0.5f),
+                                  Vector3(2.0f));
+        c[i]          = Transform(Vector3(-f), Quaternion(Vector3(0, 1, 0), f), Vector3(0.5f));
+    }
+
+    // Weights are normalized.
+    const Transform *poses[]   = {a.data(), b.data(), c.data()};
+    const float      weights[] = {1.0f, 3.0f, 0.0f};
+
+    std::vector<Transform> out(JointCount);
+    blendPoses(poses, weights, 3, out.data(), JointCount);
+    for (std::size_t i = 0; i < JointCount; ++i) {
+        Quaternion rotation = b[i].rotation;
+        if (dot(rotation, a[i].rotation) < 0.0f)
+            rotation = -rotation;
+
+        REQUIRE(near(out[i].translation, lerp(a[i].translation, b[i].translation, 0.75f)));
+        REQUIRE(near(out[i].rotation, nlerp(a[i].rotation, rotation, 0.75f)));
+        REQUIRE(near(out[i].scale, Vector3(1.75f)));
+    }
+
+    // A single pose is copied. Output could be the same as the input.
+    const float single = 2.0f;
+    blendPoses(poses + 2, &single, 1, c.data(), JointCount);
+    for (std::size_t i = 0; i < JointCount; ++i) {
+        const float f = static_cast<float>(i);
+        REQUIRE(near(c[i].translation, Vector3(-f)));
+        REQUIRE(near(c[i].rotation, Quaternion(Vector3(0, 1, 0), f)));
+    }
+}
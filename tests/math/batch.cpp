@@ -0,0 +1,116 @@
+#include <ink/math/batch.hpp>
+#include <ink/math/transform.hpp>
+
+#include <vector>
+
+using namespace ink;
+
+static auto near(float a, float b) noexcept -> bool {
+    return std::abs(a - b) <= 1e-4f * std::max(1.0f, std::abs(a));
+}
+
+static auto near(Vector3 a, Vector3 b) noexcept -> bool {
+    return near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z);
+}
+
+static auto near(Vector4 a, Vector4 b) noexcept -> bool {
+    return near(a[0], b[0]) && near(a[1], b[1]) && near(a[2], b[2]) && near(a[3], b[3]);
+}
+
+static auto xyz(Vector4 v) noexcept -> Vector3 { return {v[0], v[1], v[2]}; }
+
+static auto makeTransform() noexcept -> Matrix4 {
+    Matrix4 m(1.0f);
+    m.scale(2.0f, 0.5f, 3.0f);
+    m.rotate(Vector3(1.0f, 2.0f, 3.0f).normalized(), 0.75f);
+    m.translate(4.0f, -5.0f, 6.0f);
+    return m;
+}
+
+static auto sample(std::size_t i, std::size_t k) noexcept -> float {
+    return static_cast<float>((i * 7 + k * 13) % 23) * 0.5f - 5.0f;
+}
+
+TEST_CASE("Batch transform points and directions", "[Batch]") {
+    const Matrix4 m = makeTransform();
+
+    // Sizes that are not multiples of 8 cover the partial tail.
+    for (std::size_t count : {std::size_t(0), std::size_t(5), std::size_t(37)}) {
+        std::vector<Vector3> in(count);
+        for (std::size_t i = 0; i < count; ++i)
+            in[i] = Vector3(sample(i, 0), sample(i, 1), sample(i, 2));
+
+        std::vector<Vector3> points(count);
+        std::vector<Vector3> directions(count);
+        transformPoints(m, in.data(), points.data(), count);
+        transformDirections(m, in.data(), directions.data(), count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            REQUIRE(near(points[i], xyz(Vector4(in[i], 1.0f) * m)));
+            REQUIRE(near(directions[i], xyz(Vector4(in[i], 0.0f) * m)));
+        }
+    }
+}
+
+TEST_CASE("Batch transform vectors", "[Batch]") {
+    const Matrix4 m = makeTransform();
+
+    std::vector<Vector4> in(29);
+    for (std::size_t i = 0; i < in.size(); ++i)
+        in[i] = Vector4(sample(i, 0), sample(i, 1), sample(i, 2), sample(i, 3));
+
+    std::vector<Vector4> out(in.size());
+    transformVectors(m, in.data(), out.data(), in.size());
+    for (std::size_t i = 0; i < in.size(); ++i)
+        REQUIRE(near(out[i], in[i] * m));
+
+    // Transform in place.
+    std::vector<Vector4> inplace = in;
+    transformVectors(m, inplace.data(), inplace.data(), inplace.size());
+    for (std::size_t i = 0; i < in.size(); ++i)
+        REQUIRE(inplace[i] == out[i]);
+}
+
+TEST_CASE("Batch decompose", "[Batch]") {
+    std::vector<Matrix4> matrices(37);
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        const Vector3    axis(sample(i, 0), sample(i, 1), sample(i, 2) + 0.1f);
+        const Quaternion rotation(axis.normalized(), sample(i, 3) * 0.6f);
+        const Vector3    scale(sample(i, 4) + 5.5f, 0.5f, (i % 3 == 0) ? -1.0f : 2.0f);
+        matrices[i] = Matrix4(1.0f).scaled(scale).rotated(rotation).translated(axis);
+    }
+
+    std::vector<Vector3>    translations(matrices.size());
+    std::vector<Quaternion> rotations(matrices.size());
+    std::vector<Vector3>    scales(matrices.size());
+    decompose(matrices.data(), translations.data(), rotations.data(), scales.data(),
+              matrices.size());
+
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        Vector3    t;
+        Quaternion r;
+        Vector3    s;
+        decompose(matrices[i], t, r, s);
+
+        REQUIRE(near(translations[i], t));
+        REQUIRE(near(scales[i], s));
+        REQUIRE(near(std::abs(dot(rotations[i], r)), 1.0f));
+    }
+}
+
+TEST_CASE("Batch transform large arrays", "[Batch]") {
+    const Matrix4     m     = makeTransform();
+    const std::size_t count = detail::ParallelBatchThreshold * 2 + 3;
+
+    std::vector<Vector3> in(count);
+    for (std::size_t i = 0; i < count; ++i)
+        in[i] = Vector3(sample(i, 0), sample(i, 1), sample(i, 2));
+
+    std::vector<Vector3> out(count);
+    transformPoints(m, in.data(), out.data(), count);
+
+    bool allNear = true;
+    for (std::size_t i = 0; i < count; ++i)
+        allNear = allNear && near(out[i], xyz(Vector4(in[i], 1.0f) * m));
+    REQUIRE(allNear);
+}
@@ -0,0 +1,202 @@
+#include <ink/math/bounds.hpp>
+#include <ink/math/numbers.hpp>
+
+#include <vector>
+
+using namespace ink;
+
+static auto near(float a, float b, float eps = 1e-4f) noexcept -> bool {
+    return std::abs(a - b) <= eps;
+}
+
+static auto near(Vector3 a, Vector3 b) noexcept -> bool {
+    return near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z);
+}
+
+static auto near(const AABB &a, const AABB &b) noexcept -> bool {
+    return near(a.min, b.min) && near(a.max, b.max);
+}
+
+static auto makeTransform() noexcept -> Matrix4 {
+    return Matrix4(1.0f)
+        .scaled(Vector3(2.0f, 0.5f, 1.5f))
+        .rotated(Quaternion(Vector3(1.0f, 2.0f, 3.0f).normalized(), Pi<float> * 0.3f))
+        .translated(Vector3(1.0f, -2.0f, 3.0f));
+}
+
+static auto transformPoint(const Matrix4 &m, Vector3 p) noexcept -> Vector3 {
+    const Vector4 v = Vector4(p, 1.0f) * m;
+    return {v.x, v.y, v.z};
+}
+
+TEST_CASE("Plane", "[Bounds]") {
+    const Plane plane(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f),
+                      Vector3(0.0f, 1.0f, 0.0f));
+    REQUIRE(plane == Plane(Vector3(0.0f, 0.0f, 1.0f), 0.0f));
+    REQUIRE(plane.signedDistance(Vector3(3.0f, 4.0f, 5.0f)) == 5.0f);
+    REQUIRE(plane.classify(Vector3(0.0f, 0.0f, -1.0f)) == PlaneSide::Back);
+
+    const Plane offset(Vector3(0.0f, 2.0f, 0.0f), Vector3(1.0f, 1.0f, 1.0f));
+    REQUIRE(offset.distance == -2.0f);
+    REQUIRE(near(offset.normalized().normal.length(), 1.0f));
+    REQUIRE(near(offset.normalized().signedDistance(Vector3(5.0f)), 4.0f));
+
+    // Points on the plane stay on the transformed plane.
+    const Matrix4 m           = makeTransform();
+    const Plane   transformed = offset.transformed(m).normalized();
+    REQUIRE(near(transformed.signedDistance(transformPoint(m, Vector3(0.0f, 1.0f, 0.0f))), 0.0f));
+    REQUIRE(near(transformed.signedDistance(transformPoint(m, Vector3(3.0f, 1.0f, -2.0f))), 0.0f));
+    REQUIRE(transformed.signedDistance(transformPoint(m, Vector3(2.0f))) > 0);
+}
+
+TEST_CASE("AABB", "[Bounds]") {
+    AABB empty;
+    REQUIRE(empty.isEmpty());
+    REQUIRE_FALSE(empty.contains(Vector3(0.0f)));
+    REQUIRE(empty.transformed(makeTransform()).isEmpty());
+
+    const Vector3 points[] = {Vector3(1.0f, 2.0f, 3.0f), Vector3(-1.0f, 5.0f, 0.0f),
+                              Vector3(0.0f, -2.0f, 4.0f)};
+    const AABB    box(points, 3);
+    REQUIRE(box == AABB(Vector3(-1.0f, -2.0f, 0.0f), Vector3(1.0f, 5.0f, 4.0f)));
+    REQUIRE(box.center() == Vector3(0.0f, 1.5f, 2.0f));
+    REQUIRE(box.extent() == Vector3(1.0f, 3.5f, 2.0f));
+    REQUIRE(AABB(box).merge(empty) == box);
+
+    REQUIRE(box.contains(Vector3(1.0f, 5.0f, 4.0f)));
+    REQUIRE_FALSE(box.contains(Vector3(1.0f, 5.0f, 4.1f)));
+    REQUIRE(box.contains(AABB(Vector3(0.0f), Vector3(1.0f))));
+    REQUIRE_FALSE(box.contains(AABB(Vector3(0.0f), Vector3(2.0f))));
+    REQUIRE(box.intersects(AABB(Vector3(1.0f), Vector3(2.0f))));
+    REQUIRE_FALSE(box.intersects(AABB(Vector3(1.1f), Vector3(2.0f))));
+    REQUIRE_FALSE(box.intersects(empty));
+
+    // Arvo's method is the same as bounding the 8 transformed corners.
+    const Matrix4 m = makeTransform();
+    AABB          expected;
+    for (std::size_t i = 0; i < 8; ++i) {
+        const Vector3 corner((i & 1) ? box.max.x : box.min.x, (i & 2) ? box.max.y : box.min.y,
+                             (i & 4) ? box.max.z : box.min.z);
+        expected.merge(transformPoint(m, corner));
+    }
+    REQUIRE(near(box.transformed(m), expected));
+}
+
+TEST_CASE("BoundingSphere", "[Bounds]") {
+    REQUIRE(BoundingSphere().isEmpty());
+
+    std::vector<Vector3> points;
+    for (int i = 0; i < 100; ++i) {
+        const float f = static_cast<float>(i);
+        points.emplace_back(std::sin(f) * 3.0f, std::cos(f * 0.7f) * 2.0f, f * 0.05f - 2.0f);
+    }
+
+    const BoundingSphere sphere(points.data(), points.size());
+    for (const Vector3 &p : points)
+        REQUIRE((p - sphere.center).length() <= sphere.radius * 1.0001f);
+
+    const AABB box(points.data(), points.size());
+    REQUIRE(sphere.radius <= BoundingSphere(box).radius * 1.1f);
+
+    BoundingSphere merged(Vector3(0.0f), 1.0f);
+    merged.merge(BoundingSphere(Vector3(4.0f, 0.0f, 0.0f), 1.0f));
+    REQUIRE(near(merged.center, Vector3(2.0f, 0.0f, 0.0f)));
+    REQUIRE(near(merged.radius, 3.0f));
+    REQUIRE(merged.contains(BoundingSphere(Vector3(4.0f, 0.0f, 0.0f), 1.0f)));
+    REQUIRE(BoundingSphere().merge(merged) == merged);
+
+    REQUIRE(merged.intersects(BoundingSphere(Vector3(0.0f, 5.0f, 0.0f), 2.5f)));
+    REQUIRE_FALSE(merged.intersects(BoundingSphere(Vector3(0.0f, 5.0f, 0.0f), 2.0f)));
+    REQUIRE(merged.intersects(AABB(Vector3(4.0f, 0.0f, 0.0f), Vector3(5.0f))));
+    REQUIRE_FALSE(merged.intersects(AABB(Vector3(4.0f), Vector3(5.0f))));
+
+    // The transformed sphere contains all of the transformed points.
+    const Matrix4        m           = makeTransform();
+    const BoundingSphere transformed = sphere.transformed(m);
+    for (const Vector3 &p : points) {
+        const Vector3 d = transformPoint(m, p) - transformed.center;
+        REQUIRE(d.length() <= transformed.radius * 1.0001f);
+    }
+}
+
+TEST_CASE("OBB", "[Bounds]") {
+    const Quaternion rotation(Vector3(0.0f, 0.0f, 1.0f), Pi<float> * 0.25f);
+    const OBB        box(Vector3(0.0f), Vector3(1.0f, 1.0f, 1.0f), rotation);
+
+    const float s = std::sqrt(2.0f);
+    REQUIRE(box.contains(Vector3(s - 0.01f, 0.0f, 0.0f)));
+    REQUIRE_FALSE(box.contains(Vector3(1.0f, 1.0f, 0.0f)));
+    REQUIRE(near(box.toAABB(), AABB(Vector3(-s, -s, -1.0f), Vector3(s, s, 1.0f))));
+
+    REQUIRE(box.intersects(AABB(Vector3(1.3f, -0.1f, -0.1f), Vector3(2.0f, 0.1f, 0.1f))));
+    REQUIRE_FALSE(box.intersects(AABB(Vector3(1.1f, 1.1f, -0.1f), Vector3(2.0f, 2.0f, 0.1f))));
+    REQUIRE(box.intersects(BoundingSphere(Vector3(2.0f, 0.0f, 0.0f), 0.6f)));
+    REQUIRE_FALSE(box.intersects(BoundingSphere(Vector3(1.5f, 1.5f, 0.0f), 0.6f)));
+
+    const OBB other(Vector3(2.3f, 0.0f, 0.0f), Vector3(1.0f), Quaternion(1.0f));
+    REQUIRE(box.intersects(other));
+    REQUIRE(other.intersects(box));
+    REQUIRE_FALSE(box.intersects(OBB(Vector3(2.9f, 0.0f, 0.0f), Vector3(1.0f), rotation)));
+
+    // Transforming an OBB matches transforming its AABB for axis aligned boxes.
+    const AABB    aabb(Vector3(-1.0f, 0.0f, 2.0f), Vector3(3.0f, 1.0f, 2.5f));
+    const Matrix4 m = Matrix4(1.0f).rotated(rotation).translated(Vector3(1.0f, 2.0f, 3.0f));
+    REQUIRE(near(OBB(aabb).transformed(m).toAABB(), aabb.transformed(m)));
+
+    const Plane plane(Vector3(1.0f, 0.0f, 0.0f), -1.5f);
+    REQUIRE(plane.classify(box) == PlaneSide::Back);
+    REQUIRE(plane.classify(other) == PlaneSide::Intersecting);
+}
+
+TEST_CASE("Bounds batch queries", "[Bounds]") {
+    constexpr std::size_t Count = 1003;
+
+    std::vector<AABB>           boxes;
+    std::vector<BoundingSphere> spheres;
+    for (std::size_t i = 0; i < Count; ++i) {
+        const float   f = static_cast<float>(i);
+        const Vector3 center(std::sin(f) * 10.0f, std::cos(f * 1.3f) * 10.0f, f * 0.02f - 10.0f);
+        const Vector3 extent(0.5f + std::abs(std::sin(f * 0.1f)) * 2.0f);
+        boxes.emplace_back(center - extent, center + extent);
+        spheres.emplace_back(center, extent.x);
+    }
+    boxes[5]   = AABB();
+    spheres[7] = BoundingSphere();
+
+    const AABB           queryBox(Vector3(-3.0f, -4.0f, -5.0f), Vector3(4.0f, 2.0f, 3.0f));
+    const BoundingSphere querySphere(Vector3(1.0f, -1.0f, 0.0f), 5.0f);
+    const Plane          plane = Plane(Vector3(1.0f, 1.0f, 0.5f), 1.0f).normalized();
+
+    bool                   results[Count];
+    std::vector<PlaneSide> sides(Count);
+
+    intersects(queryBox, boxes.data(), Count, results);
+    for (std::size_t i = 0; i < Count; ++i)
+        REQUIRE(results[i] == queryBox.intersects(boxes[i]));
+
+    intersects(querySphere, spheres.data(), Count, results);
+    for (std::size_t i = 0; i < Count; ++i)
+        REQUIRE(results[i] == querySphere.intersects(spheres[i]));
+
+    intersects(querySphere, boxes.data(), Count, results);
+    for (std::size_t i = 0; i < Count; ++i)
+        REQUIRE(results[i] == querySphere.intersects(boxes[i]));
+
+    classify(plane, boxes.data() + 6, Count - 6, sides.data());
+    for (std::size_t i = 6; i < Count; ++i)
+        REQUIRE(sides[i - 6] == plane.classify(boxes[i]));
+
+    classify(plane, spheres.data() + 8, Count - 8, sides.data());
+    for (std::size_t i = 8; i < Count; ++i)
+        REQUIRE(sides[i - 8] == plane.classify(spheres[i]));
+
+    std::vector<AABB> transformed(Count);
+    const Matrix4     m = makeTransform();
+    transform(m, boxes.data(), transformed.data(), Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        if (boxes[i].isEmpty())
+            REQUIRE(transformed[i].isEmpty());
+        else
+            REQUIRE(near(transformed[i], boxes[i].transformed(m)));
+    }
+}
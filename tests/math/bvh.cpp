@@ -0,0 +1,207 @@
+#include <ink/math/bvh.hpp>
+
+#include <vector>
+
+using namespace ink;
+
+namespace {
+
+struct TriangleSoup {
+    std::vector<Vector3>       positions;
+    std::vector<std::uint32_t> indices;
+};
+
+auto makeTriangleSoup(std::size_t triangleCount) -> TriangleSoup {
+    TriangleSoup soup;
+    for (std::size_t i = 0; i < triangleCount; ++i) {
+        const float   f = static_cast<float>(i);
+        const Vector3 center(std::sin(f * 0.37f) * 10.0f, std::cos(f * 0.91f) * 10.0f,
+                             std::sin(f * 1.73f + 1.0f) * 10.0f);
+        const auto    base = static_cast<std::uint32_t>(soup.positions.size());
+
+        soup.positions.push_back(center + Vector3(std::sin(f), 0.3f, -0.2f));
+        soup.positions.push_back(center + Vector3(-0.4f, std::cos(f * 2.0f), 0.5f));
+        soup.positions.push_back(center + Vector3(0.2f, -0.6f, std::sin(f * 3.0f)));
+
+        soup.indices.push_back(base);
+        soup.indices.push_back(base + 1);
+        soup.indices.push_back(base + 2);
+    }
+    return soup;
+}
+
+auto makeRays(std::size_t count, float radius) -> std::vector<Ray> {
+    std::vector<Ray> rays;
+    for (std::size_t i = 0; i < count; ++i) {
+        const float   f = static_cast<float>(i);
+        const Vector3 origin(std::sin(f * 0.13f) * radius, std::cos(f * 0.29f) * radius,
+                             std::sin(f * 0.71f + 2.0f) * radius);
+        const Vector3 target(std::sin(f * 1.1f) * radius * 0.3f, std::cos(f * 1.7f) * radius * 0.3f,
+                             std::sin(f * 2.3f) * radius * 0.3f);
+        rays.emplace_back(origin, (target - origin).normalized());
+    }
+    return rays;
+}
+
+/// Brute force Moller-Trumbore reference.
+auto intersectTriangle(const Ray &ray, Vector3 a, Vector3 b, Vector3 c, float &t) -> bool {
+    const Vector3 edge1 = b - a;
+    const Vector3 edge2 = c - a;
+    const Vector3 p     = cross(ray.direction, edge2);
+    const float   det   = dot(edge1, p);
+    if (det == 0)
+        return false;
+
+    const float   invDet = 1.0f / det;
+    const Vector3 s      = ray.origin - a;
+    const float   u      = dot(s, p) * invDet;
+    const Vector3 q      = cross(s, edge1);
+    const float   v      = dot(ray.direction, q) * invDet;
+
+    t = dot(edge2, q) * invDet;
+    return u >= 0 && v >= 0 && u + v <= 1 && t >= 0;
+}
+
+auto intersectBruteForce(const TriangleSoup &soup, const Ray &ray, float &distance) -> bool {
+    bool found = false;
+    for (std::size_t i = 0; i < soup.indices.size(); i += 3) {
+        float t;
+        if (intersectTriangle(ray, soup.positions[soup.indices[i]],
+                              soup.positions[soup.indices[i + 1]],
+                              soup.positions[soup.indices[i + 2]], t) &&
+            (!found || t < distance)) {
+            distance = t;
+            found    = true;
+        }
+    }
+    return found;
+}
+
+auto checkTree(const Bvh &bvh, const std::vector<AABB> &bounds) -> bool {
+    std::vector<std::uint32_t> seen(bounds.size(), 0);
+    for (std::size_t i = 0; i < bvh.nodes().size(); ++i) {
+        const BvhNode &node = bvh.nodes()[i];
+        if (node.isLeaf()) {
+            for (std::uint32_t k = 0; k < node.count; ++k) {
+                const std::uint32_t primitive = bvh.indices()[node.offset + k];
+                seen[primitive] += 1;
+                if (!node.bounds().contains(bounds[primitive]))
+                    return false;
+            }
+        } else {
+            if (node.offset <= i + 1 || node.offset >= bvh.nodes().size())
+                return false;
+            if (!node.bounds().contains(bvh.nodes()[i + 1].bounds()) ||
+                !node.bounds().contains(bvh.nodes()[node.offset].bounds()))
+                return false;
+        }
+    }
+
+    for (std::uint32_t count : seen) {
+        if (count != 1)
+            return false;
+    }
+    return true;
+}
+
+auto triangleBounds(const TriangleSoup &soup) -> std::vector<AABB> {
+    std::vector<AABB> bounds(soup.indices.size() / 3);
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+        for (std::size_t k = 0; k < 3; ++k)
+            bounds[i].merge(soup.positions[soup.indices[3 * i + k]]);
+    }
+    return bounds;
+}
+
+} // namespace
+
+TEST_CASE("Bvh build", "[Bvh]") {
+    REQUIRE(Bvh().empty());
+    REQUIRE(Bvh(nullptr, 0).bounds().isEmpty());
+
+    const TriangleSoup      soup   = makeTriangleSoup(10000);
+    const std::vector<AABB> bounds = triangleBounds(soup);
+
+    const Bvh bvh(bounds.data(), bounds.size());
+    REQUIRE(checkTree(bvh, bounds));
+    REQUIRE(bvh.nodes().size() < 2 * bounds.size());
+
+    for (const BvhNode &node : bvh.nodes())
+        REQUIRE(node.count <= Bvh::MaxLeafSize);
+
+    // Parallel build produces the same tree.
+    const Bvh serial(bounds.data(), bounds.size(), 1);
+    REQUIRE(serial.nodes().size() == bvh.nodes().size());
+    REQUIRE(std::memcmp(serial.nodes().data(), bvh.nodes().data(),
+                        bvh.nodes().size() * sizeof(BvhNode)) == 0);
+    REQUIRE(serial.indices() == bvh.indices());
+
+    // Identical primitives are still split.
+    const std::vector<AABB> same(100, AABB(Vector3(0.0f), Vector3(1.0f)));
+    const Bvh               sameBvh(same.data(), same.size());
+    REQUIRE(checkTree(sameBvh, same));
+
+    // Query returns a superset of overlapping primitives.
+    const AABB                 box(Vector3(-3.0f, -2.0f, -1.0f), Vector3(2.0f, 3.0f, 4.0f));
+    std::vector<std::uint32_t> found(bounds.size(), 0);
+    bvh.query(box, [&found](std::uint32_t primitive) { found[primitive] += 1; });
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+        REQUIRE(found[i] <= 1);
+        if (bounds[i].intersects(box))
+            REQUIRE(found[i] == 1);
+    }
+}
+
+TEST_CASE("Bvh ray queries", "[Bvh]") {
+    TriangleSoup  soup = makeTriangleSoup(5000);
+    const MeshBvh mesh(soup.positions.data(), soup.indices.data(), soup.indices.size() / 3);
+    REQUIRE(mesh.triangleCount() == 5000);
+
+    const std::vector<Ray> rays = makeRays(500, 20.0f);
+
+    auto check = [&soup, &rays](const MeshBvh &bvh) {
+        std::size_t hitCount = 0;
+        for (const Ray &ray : rays) {
+            float      expected = 0;
+            const bool hit      = intersectBruteForce(soup, ray, expected);
+
+            RayHit result;
+            REQUIRE(bvh.intersect(ray, result) == hit);
+            REQUIRE(bvh.occluded(ray, 1000.0f) == hit);
+            if (!hit)
+                continue;
+
+            ++hitCount;
+            REQUIRE(std::abs(result.distance - expected) <= 1e-4f * expected);
+            REQUIRE(result.u >= 0);
+            REQUIRE(result.v >= 0);
+            REQUIRE(result.u + result.v <= 1.0f);
+
+            // Hit point matches barycentric coordinates of the reported triangle.
+            const Vector3 a = soup.positions[soup.indices[3 * result.triangle]];
+            const Vector3 b = soup.positions[soup.indices[3 * result.triangle + 1]];
+            const Vector3 c = soup.positions[soup.indices[3 * result.triangle + 2]];
+            const Vector3 p = a + (b - a) * result.u + (c - a) * result.v;
+            REQUIRE((p - ray.at(result.distance)).length() <= 1e-3f);
+
+            REQUIRE_FALSE(bvh.occluded(ray, expected * 0.99f));
+            REQUIRE_FALSE(bvh.intersect(ray, result, expected * 0.99f));
+        }
+        REQUIRE(hitCount > 0);
+        REQUIRE(hitCount < rays.size());
+    };
+
+    check(mesh);
+
+    // Move vertices and refit.
+    for (std::size_t i = 0; i < soup.positions.size(); ++i) {
+        const float f = static_cast<float>(i);
+        soup.positions[i] =
+            soup.positions[i] * 0.8f + Vector3(std::sin(f * 0.01f), 1.0f, -0.5f) * 2.0f;
+    }
+
+    MeshBvh refitted = mesh;
+    refitted.refit(soup.positions.data());
+    REQUIRE(checkTree(refitted.bvh(), triangleBounds(soup)));
+    check(refitted);
+}
@@ -0,0 +1,175 @@
+#include <ink/math/color.hpp>
+
+#include <vector>
+
+using namespace ink;
+
+static auto near(float a, float b, float eps = 1e-5f) noexcept -> bool {
+    return std::abs(a - b) <= eps;
+}
+
+static auto near(const Color &a, const Color &b, float eps = 1e-5f) noexcept -> bool {
+    return near(a.red, b.red, eps) && near(a.green, b.green, eps) && near(a.blue, b.blue, eps) &&
+           near(a.alpha, b.alpha, eps);
+}
+
+TEST_CASE("Color arithmetic", "[Color]") {
+    constexpr Color a(0.5f, 0.25f, 1.0f, 0.5f);
+    constexpr Color b(0.25f, 0.5f, 0.0f, 1.0f);
+
+    STATIC_REQUIRE(a + b == Color(0.75f, 0.75f, 1.0f, 1.5f));
+    STATIC_REQUIRE(a - b == Color(0.25f, -0.25f, 1.0f, -0.5f));
+    STATIC_REQUIRE(a * b == Color(0.125f, 0.125f, 0.0f, 0.5f));
+    STATIC_REQUIRE(a * 2.0f == 2.0f * a);
+    STATIC_REQUIRE(a != b);
+    STATIC_REQUIRE(lerp(a, b, 0.5f) == Color(0.375f, 0.375f, 0.5f, 0.75f));
+    STATIC_REQUIRE(a.premultiplied() == Color(0.25f, 0.125f, 0.5f, 0.5f));
+    STATIC_REQUIRE(Color(a.toVector4()) == a);
+    STATIC_REQUIRE(colors::White.premultiplied() == colors::White);
+
+    STATIC_REQUIRE(luminance(colors::White) == 1.0f);
+    STATIC_REQUIRE(luminance(Vector3(0.0f, 1.0f, 0.0f)) == 0.7152f);
+}
+
+TEST_CASE("sRGB conversion", "[Color]") {
+    REQUIRE(srgbToLinear(0.0f) == 0.0f);
+    REQUIRE(near(srgbToLinear(1.0f), 1.0f));
+    REQUIRE(near(linearToSrgb(1.0f), 1.0f));
+    REQUIRE(near(srgbToLinear(0.5f), 0.214041f));
+    REQUIRE(near(linearToSrgb(0.214041f), 0.5f));
+
+    float maxToLinear = 0;
+    float maxToSrgb   = 0;
+    for (int i = 0; i <= 1000; ++i) {
+        const float x = static_cast<float>(i) / 1000.0f;
+        REQUIRE(near(linearToSrgb(srgbToLinear(x)), x));
+
+        maxToLinear = std::max(maxToLinear, std::abs(srgbToLinearFast(x) - srgbToLinear(x)));
+        maxToSrgb   = std::max(maxToSrgb, std::abs(linearToSrgbFast(x) - linearToSrgb(x)));
+    }
+
+    // Fast approximations are close to exact conversions.
+    REQUIRE(maxToLinear < 2e-3f);
+    REQUIRE(maxToSrgb < 2e-3f);
+
+    const Color c(0.5f, 0.25f, 0.75f, 0.5f);
+    REQUIRE(srgbToLinear(c).alpha == 0.5f);
+    REQUIRE(linearToSrgb(c).alpha == 0.5f);
+    REQUIRE(near(linearToSrgb(srgbToLinear(c)), c));
+    REQUIRE(near(srgbToLinearFast(c), srgbToLinear(c), 2e-3f));
+    REQUIRE(near(linearToSrgbFast(c), linearToSrgb(c), 2e-3f));
+    REQUIRE(srgbToLinear(c.toVector4()) == srgbToLinear(c).toVector4());
+    REQUIRE(linearToSrgbFast(c.toVector4()) == linearToSrgbFast(c).toVector4());
+
+    constexpr float half = srgbToLinearFast(0.5f);
+    STATIC_REQUIRE(half > 0.21f);
+    STATIC_REQUIRE(half < 0.22f);
+}
+
+TEST_CASE("8-bit sRGB conversion", "[Color]") {
+    // Lookup table conversion differs from the rounded exact conversion by at most 1.
+    int mismatches = 0;
+    for (int i = 0; i <= 100000; ++i) {
+        const float x     = static_cast<float>(i) / 100000.0f;
+        const auto  exact = static_cast<int>(linearToSrgb(x) * 255.0f + 0.5f);
+        const int   fast  = linearToSrgb8(x);
+        REQUIRE(std::abs(exact - fast) <= 1);
+        mismatches += (exact != fast) ? 1 : 0;
+    }
+    REQUIRE(mismatches < 2000);
+
+    // Every 8-bit value survives the round trip.
+    for (int i = 0; i < 256; ++i)
+        REQUIRE(linearToSrgb8(srgbToLinear(static_cast<float>(i) / 255.0f)) == i);
+
+    REQUIRE(linearToSrgb8(-1.0f) == 0);
+    REQUIRE(linearToSrgb8(2.0f) == 255);
+    REQUIRE(linearToSrgb8(std::numeric_limits<float>::quiet_NaN()) == 0);
+    REQUIRE(linearToSrgb8(std::numeric_limits<float>::infinity()) == 255);
+}
+
+TEST_CASE("Bulk color conversion", "[Color]") {
+    // Large enough to be split across threads.
+    constexpr std::size_t Count = 100003;
+
+    std::vector<UNorm8x4> srgb8(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+        srgb8[i].bits = static_cast<std::uint32_t>(i * 2654435761u);
+
+    std::vector<Color> linear(Count);
+    srgbToLinear(srgb8.data(), linear.data(), Count);
+    for (std::size_t i = 0; i < Count; i += 97) {
+        const Vector4 v = srgb8[i].toVector4();
+        const Color   expected(srgbToLinear(v[0]), srgbToLinear(v[1]), srgbToLinear(v[2]), v[3]);
+        REQUIRE(near(linear[i], expected));
+    }
+
+    // Converting back gives the original values.
+    std::vector<UNorm8x4> back(Count);
+    linearToSrgb(linear.data(), back.data(), Count);
+    for (std::size_t i = 0; i < Count; ++i)
+        REQUIRE(back[i].bits == srgb8[i].bits);
+
+    // Out of range and NaN values are clamped.
+    const Color special[] = {
+        Color(-1.0f, 2.0f, std::numeric_limits<float>::quiet_NaN(), 1.5f),
+        Color(1e-10f, 1.0f, 0.5f, -0.5f),
+    };
+    UNorm8x4 specialOut[2];
+    linearToSrgb(special, specialOut, 2);
+    REQUIRE(specialOut[0].bits == UNorm8x4(0, 255, 0, 255).bits);
+    REQUIRE(specialOut[1].bits == UNorm8x4(0, 255, linearToSrgb8(0.5f), 0).bits);
+
+    std::vector<Color> fast(Count);
+    srgbToLinearFast(linear.data(), fast.data(), Count);
+    for (std::size_t i = 0; i < Count; i += 89)
+        REQUIRE(near(fast[i], srgbToLinearFast(linear[i])));
+
+    linearToSrgbFast(linear.data(), fast.data(), Count);
+    for (std::size_t i = 0; i < Count; i += 89)
+        REQUIRE(near(fast[i], linearToSrgbFast(linear[i])));
+
+    // In place conversion is allowed.
+    linearToSrgbFast(fast.data(), fast.data(), 1);
+    REQUIRE(near(fast[0], linearToSrgbFast(linearToSrgbFast(linear[0]))));
+
+    std::vector<float> lum(Count);
+    luminance(linear.data(), lum.data(), Count);
+    for (std::size_t i = 0; i < Count; ++i)
+        REQUIRE(near(lum[i], luminance(linear[i])));
+}
+
+TEST_CASE("Premultiply alpha", "[Color]") {
+    std::vector<Color> colors(1001);
+    for (std::size_t i = 0; i < colors.size(); ++i) {
+        const float t = static_cast<float>(i) / 1000.0f;
+        colors[i]     = Color(t, 1.0f - t, 0.5f, t * t);
+    }
+
+    std::vector<Color> premultiplied = colors;
+    premultiplyAlpha(premultiplied.data(), premultiplied.size());
+    for (std::size_t i = 0; i < colors.size(); ++i)
+        REQUIRE(premultiplied[i] == colors[i].premultiplied());
+
+    // 8-bit premultiplication is correctly rounded for all channel and alpha values.
+    std::vector<UNorm8x4> packed(256 * 256);
+    for (std::uint32_t a = 0; a < 256; ++a) {
+        for (std::uint32_t c = 0; c < 256; ++c) {
+            const auto x = static_cast<std::uint8_t>(c);
+            const auto y = static_cast<std::uint8_t>(255 - c);
+
+            packed[a * 256 + c] = UNorm8x4(x, y, x, static_cast<std::uint8_t>(a));
+        }
+    }
+
+    premultiplyAlpha(packed.data(), packed.size());
+    for (std::uint32_t a = 0; a < 256; ++a) {
+        for (std::uint32_t c = 0; c < 256; ++c) {
+            const UNorm8x4 p = packed[a * 256 + c];
+            REQUIRE(p.get(0) == (c * a * 2 + 255) / 510);
+            REQUIRE(p.get(1) == ((255 - c) * a * 2 + 255) / 510);
+            REQUIRE(p.get(2) == p.get(0));
+            REQUIRE(p.get(3) == a);
+        }
+    }
+}
@@ -0,0 +1,130 @@
+#include <ink/math/dual_quaternion.hpp>
+#include <ink/math/numbers.hpp>
+#include <ink/math/transform.hpp>
+
+using namespace ink;
+
+static auto near(float a, float b, float eps = 1e-5f) noexcept -> bool {
+    return std::abs(a - b) <= eps;
+}
+
+static auto near(Vector3 a, Vector3 b) noexcept -> bool {
+    return near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z);
+}
+
+static auto near(Quaternion a, Quaternion b) noexcept -> bool {
+    return near(a.w, b.w) && near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z);
+}
+
+static auto near(const DualQuaternion &a, const DualQuaternion &b) noexcept -> bool {
+    return near(a.real, b.real) && near(a.dual, b.dual);
+}
+
+static auto near(const Matrix4 &a, const Matrix4 &b) noexcept -> bool {
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            if (!near(a[i][j], b[i][j]))
+                return false;
+        }
+    }
+    return true;
+}
+
+static auto makeDualQuaternion(std::size_t i) noexcept -> DualQuaternion {
+    const float      f = static_cast<float>(i);
+    const Quaternion rotation(Vector3(1.0f, f, 2.0f - f).normalized(), 0.3f * f - 1.0f);
+    return {rotation, Vector3(f, -0.5f * f, 2.0f)};
+}
+
+TEST_CASE("DualQuaternion construct", "[DualQuaternion]") {
+    const DualQuaternion identity;
+    REQUIRE(identity.translation() == Vector3(0.0f));
+    REQUIRE(identity.toMatrix4() == Matrix4(1.0f));
+
+    const Quaternion     rotation(Vector3(1.0f, 2.0f, 3.0f).normalized(), Pi<float> * 0.3f);
+    const Vector3        translation(1.0f, -2.0f, 3.0f);
+    const DualQuaternion dq(rotation, translation);
+    const Transform      transform(translation, rotation, Vector3(1.0f));
+
+    REQUIRE(near(dq.translation(), translation));
+    REQUIRE(dq.rotation() == rotation);
+    REQUIRE(near(dq.toMatrix4(), transform.toMatrix4()));
+
+    const Vector3 p(0.5f, -1.0f, 2.0f);
+    REQUIRE(near(dq.transformPoint(p), transform.transformPoint(p)));
+    REQUIRE(near(dq.transformDirection(p), transform.transformDirection(p)));
+}
+
+TEST_CASE("DualQuaternion multiply", "[DualQuaternion]") {
+    const DualQuaternion a = makeDualQuaternion(1);
+    const DualQuaternion b = makeDualQuaternion(2);
+
+    REQUIRE(near((a * b).toMatrix4(), a.toMatrix4() * b.toMatrix4()));
+    REQUIRE(near(a * a.conjugated(), DualQuaternion()));
+
+    DualQuaternion c = a;
+    c *= b;
+    REQUIRE(c == a * b);
+}
+
+TEST_CASE("DualQuaternion normalize and blend", "[DualQuaternion]") {
+    const DualQuaternion a = makeDualQuaternion(3);
+
+    DualQuaternion scaled(a.real * 3.0f, a.dual * 3.0f);
+    scaled.normalize();
+    REQUIRE(near(scaled, a));
+
+    // Blending the same transform with any weights is the transform itself.
+    const DualQuaternion same[]    = {a, DualQuaternion(-a.real, -a.dual), a};
+    const float          weights[] = {0.2f, 0.5f, 0.3f};
+    REQUIRE(near(blend(same, weights, 3), a));
+
+    // Blending rotations around the same axis.
+    const Quaternion     r0(Vector3(0.0f, 1.0f, 0.0f), 0.2f);
+    const Quaternion     r1(Vector3(0.0f, 1.0f, 0.0f), 0.8f);
+    const DualQuaternion pair[]     = {DualQuaternion(r0, Vector3(0.0f)),
+                                       DualQuaternion(r1, Vector3(0.0f))};
+    const float          halfHalf[] = {0.5f, 0.5f};
+    const DualQuaternion blended    = blend(pair, halfHalf, 2);
+    REQUIRE(near(blended.real, Quaternion(Vector3(0.0f, 1.0f, 0.0f), 0.5f)));
+    REQUIRE(near(blended.translation(), Vector3(0.0f)));
+}
+
+TEST_CASE("DualQuaternion skinning palette", "[DualQuaternion]") {
+    constexpr std::size_t JointCount = 13;
+
+    DualQuaternion inverseBindPoses[JointCount];
+    DualQuaternion jointTransforms[JointCount];
+    for (std::size_t i = 0; i < JointCount; ++i) {
+        inverseBindPoses[i] = makeDualQuaternion(i).conjugated();
+        jointTransforms[i]  = makeDualQuaternion(i + 5);
+    }
+
+    DualQuaternion palette[JointCount];
+    computeSkinningPalette(inverseBindPoses, jointTransforms, palette, JointCount);
+    for (std::size_t i = 0; i < JointCount; ++i)
+        REQUIRE(near(palette[i], inverseBindPoses[i] * jointTransforms[i]));
+
+    constexpr std::size_t VertexCount = 11;
+
+    std::uint16_t joints[VertexCount * 4];
+    float         weights[VertexCount * 4];
+    for (std::size_t v = 0; v < VertexCount; ++v) {
+        for (std::size_t k = 0; k < 4; ++k) {
+            joints[v * 4 + k]  = static_cast<std::uint16_t>((v * 3 + k * 5) % JointCount);
+            weights[v * 4 + k] = static_cast<float>(k + 1) * 0.1f;
+        }
+    }
+
+    DualQuaternion blended[VertexCount];
+    blendSkinningPalette(palette, joints, weights, blended, VertexCount);
+    for (std::size_t v = 0; v < VertexCount; ++v) {
+        const DualQuaternion influences[] = {
+            palette[joints[v * 4]],
+            palette[joints[v * 4 + 1]],
+            palette[joints[v * 4 + 2]],
+            palette[joints[v * 4 + 3]],
+        };
+        REQUIRE(near(blended[v], blend(influences, weights + v * 4, 4)));
+    }
+}
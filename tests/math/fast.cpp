@@ -0,0 +1,154 @@
+#include <ink/math/fast.hpp>
+#include <ink/math/numbers.hpp>
+
+#include <limits>
+
+using namespace ink;
+
+namespace {
+
+/// @brief
+///   Accuracy of an approximate function against its exact version.
+struct Accuracy {
+    const char *function;
+    double      maxError;
+    double      bound;
+};
+
+/// @brief
+///   Simple deterministic generator of floating point values in [-1, 1).
+class Sequence {
+public:
+    auto next() noexcept -> float {
+        m_state = m_state * 1664525u + 1013904223u;
+        return static_cast<float>(m_state >> 8) / 8388608.0f - 1.0f;
+    }
+
+private:
+    std::uint32_t m_state = 12345u;
+};
+
+auto angleBetween(Quaternion a, Quaternion b) noexcept -> double {
+    const double c = std::abs(static_cast<double>(dot(a, b)));
+    return 2.0 * std::acos(std::min(c, 1.0));
+}
+
+auto measureNormalizedFast() noexcept -> Accuracy {
+    Sequence sequence;
+    double   maxError = 0;
+    for (int i = 0; i < 10000; ++i) {
+        const float   scale = std::exp2(static_cast<float>(i % 40 - 20));
+        const Vector4 v(sequence.next() * scale, sequence.next() * scale,
+                        sequence.next() * scale, sequence.next() * scale);
+        if (v.length() == 0)
+            continue;
+
+        const Vector4 fast  = v.normalizedFast();
+        const Vector4 exact = v.normalized();
+        for (std::size_t j = 0; j < 4; ++j)
+            maxError = std::max(maxError, static_cast<double>(std::abs(fast[j] - exact[j])));
+
+        const Vector3 v3(v.x, v.y, v.z);
+        const Vector3 fast3  = v3.normalizedFast();
+        const Vector3 exact3 = v3.normalized();
+        for (std::size_t j = 0; j < 3; ++j)
+            maxError = std::max(maxError, static_cast<double>(std::abs(fast3[j] - exact3[j])));
+    }
+    return {"normalizedFast", maxError, 1e-6};
+}
+
+auto measureSinCos() noexcept -> Accuracy {
+    double maxError = 0;
+    for (int i = -200000; i <= 200000; ++i) {
+        const float radian = static_cast<float>(i) * 0.0409f;
+
+        float s = 0;
+        float c = 0;
+        sincos(radian, s, c);
+
+        const double exactSin = std::sin(static_cast<double>(radian));
+        const double exactCos = std::cos(static_cast<double>(radian));
+        maxError = std::max(maxError, std::abs(static_cast<double>(s) - exactSin));
+        maxError = std::max(maxError, std::abs(static_cast<double>(c) - exactCos));
+    }
+    return {"sincos", maxError, 2e-7};
+}
+
+auto measureSlerpFast() noexcept -> Accuracy {
+    Sequence sequence;
+    double   maxError = 0;
+    for (int i = 0; i < 2000; ++i) {
+        const Quaternion start(Vector3(sequence.next(), sequence.next(), sequence.next() + 2.0f)
+                                   .normalized(),
+                               sequence.next() * Pi<float>);
+        const Quaternion end(Vector3(sequence.next() + 2.0f, sequence.next(), sequence.next())
+                                 .normalized(),
+                             sequence.next() * Pi<float>);
+
+        for (int j = 0; j <= 16; ++j) {
+            const float t = static_cast<float>(j) / 16.0f;
+            maxError      = std::max(maxError,
+                                     angleBetween(slerpFast(start, end, t), slerp(start, end, t)));
+        }
+    }
+    return {"slerpFast", maxError, 2e-3};
+}
+
+} // namespace
+
+TEST_CASE("Fast math accuracy table", "[FastMath]") {
+    const Accuracy table[] = {
+        measureNormalizedFast(),
+        measureSinCos(),
+        measureSlerpFast(),
+    };
+
+    for (const Accuracy &entry : table) {
+        INFO(entry.function << ": max error " << entry.maxError << ", bound " << entry.bound);
+        REQUIRE(entry.maxError <= entry.bound);
+    }
+}
+
+TEST_CASE("Fast math special values", "[FastMath]") {
+    float s = 1.0f;
+    float c = 0.0f;
+    sincos(0.0f, s, c);
+    REQUIRE(s == 0.0f);
+    REQUIRE(c == 1.0f);
+
+    constexpr auto sinHalfPi = [] {
+        float sine   = 0;
+        float cosine = 0;
+        sincos(Pi<float> * 0.5f, sine, cosine);
+        return sine;
+    }();
+    static_assert(sinHalfPi == 1.0f);
+
+    // Out of range angles produce NaN instead of overflowing the quadrant index.
+    const float outOfRange[] = {
+        std::numeric_limits<float>::quiet_NaN(),
+        std::numeric_limits<float>::infinity(),
+        -std::numeric_limits<float>::infinity(),
+        1e10f,
+        -1e30f,
+    };
+
+    for (float radian : outOfRange) {
+        sincos(radian, s, c);
+        REQUIRE(std::isnan(s));
+        REQUIRE(std::isnan(c));
+    }
+
+    const Quaternion start(Vector3(0.0f, 1.0f, 0.0f), 0.3f);
+    const Quaternion end(Vector3(1.0f, 0.0f, 0.0f), 1.2f);
+    REQUIRE(angleBetween(slerpFast(start, end, 0.0f), start) < 1e-3);
+    REQUIRE(angleBetween(slerpFast(start, end, 1.0f), end) < 1e-3);
+
+    // Interpolate along the shortest path.
+    REQUIRE(angleBetween(slerpFast(start, -end, 0.5f), slerp(start, end, 0.5f)) < 1e-3);
+
+    // Nearly identical quaternions must not produce NaN.
+    const Quaternion q = slerpFast(start, start, 0.5f);
+    REQUIRE(angleBetween(q, start) < 1e-3);
+    REQUIRE(std::abs(q.length() - 1.0f) < 1e-5f);
+}
@@ -0,0 +1,108 @@
+#include <ink/math/frustum.hpp>
+#include <ink/math/numbers.hpp>
+
+#include <vector>
+
+using namespace ink;
+
+static auto near(float a, float b, float eps = 1e-4f) noexcept -> bool {
+    return std::abs(a - b) <= eps;
+}
+
+static auto makeViewProjection() noexcept -> Matrix4 {
+    const Matrix4 view =
+        lookAt(Vector3(0.0f, 0.0f, -10.0f), Vector3(0.0f), Vector3(0.0f, 1.0f, 0.0f));
+    return view * perspective(Pi<float> * 0.5f, 1.0f, 1.0f, 100.0f);
+}
+
+TEST_CASE("Frustum planes", "[Frustum]") {
+    const Frustum frustum(makeViewProjection());
+    for (const Plane &plane : frustum.planes)
+        REQUIRE(near(plane.normal.length(), 1.0f));
+
+    // Eye is at z = -10 looking at +z with 90 degrees field of view. The far plane loses some
+    // precision since w - z of the projection matrix cancels out.
+    REQUIRE(near(frustum.planes[Frustum::Near].signedDistance(Vector3(0.0f, 0.0f, -9.0f)), 0.0f));
+    const Plane &farPlane = frustum.planes[Frustum::Far];
+    REQUIRE(near(farPlane.signedDistance(Vector3(0.0f, 0.0f, 90.0f)), 0.0f, 1e-2f));
+    REQUIRE(near(frustum.planes[Frustum::Left].signedDistance(Vector3(-10.0f, 0.0f, 0.0f)), 0.0f));
+    REQUIRE(near(frustum.planes[Frustum::Top].signedDistance(Vector3(0.0f, 10.0f, 0.0f)), 0.0f));
+
+    REQUIRE(frustum.contains(Vector3(0.0f)));
+    REQUIRE(frustum.contains(Vector3(9.0f, -9.0f, 0.0f)));
+    REQUIRE_FALSE(frustum.contains(Vector3(11.0f, 0.0f, 0.0f)));
+    REQUIRE_FALSE(frustum.contains(Vector3(0.0f, 0.0f, -9.5f)));
+    REQUIRE_FALSE(frustum.contains(Vector3(0.0f, 0.0f, 91.0f)));
+
+    REQUIRE(frustum.intersects(AABB(Vector3(10.5f, -1.0f, -1.0f), Vector3(12.0f, 1.0f, 1.0f))));
+    REQUIRE_FALSE(
+        frustum.intersects(AABB(Vector3(11.5f, -1.0f, 0.0f), Vector3(12.0f, 1.0f, 1.0f))));
+    REQUIRE_FALSE(frustum.intersects(AABB()));
+    REQUIRE(frustum.intersects(BoundingSphere(Vector3(0.0f, 0.0f, 91.0f), 2.0f)));
+    REQUIRE_FALSE(frustum.intersects(BoundingSphere(Vector3(0.0f, 0.0f, -12.0f), 1.0f)));
+    REQUIRE_FALSE(frustum.intersects(BoundingSphere()));
+
+    // The zero frustum rejects nothing.
+    REQUIRE(Frustum().contains(Vector3(1e10f)));
+}
+
+TEST_CASE("Orthographic frustum", "[Frustum]") {
+    const Matrix4 view = lookTo(Vector3(5.0f, 0.0f, 0.0f), Vector3(-1.0f, 0.0f, 0.0f),
+                                Vector3(0.0f, 1.0f, 0.0f));
+    const Frustum frustum(view * orthographic(-2.0f, 2.0f, -1.0f, 1.0f, 0.0f, 10.0f));
+
+    REQUIRE(frustum.contains(Vector3(0.0f, 0.9f, 1.9f)));
+    REQUIRE(frustum.contains(Vector3(-4.9f, 0.0f, 0.0f)));
+    REQUIRE_FALSE(frustum.contains(Vector3(0.0f, 1.1f, 0.0f)));
+    REQUIRE_FALSE(frustum.contains(Vector3(6.0f, 0.0f, 0.0f)));
+    REQUIRE_FALSE(frustum.contains(Vector3(-5.1f, 0.0f, 0.0f)));
+    REQUIRE(near(frustum.planes[Frustum::Bottom].signedDistance(Vector3(0.0f, -1.0f, 0.0f)), 0.0f));
+}
+
+TEST_CASE("Frustum batch culling", "[Frustum]") {
+    constexpr std::size_t Count = 1003;
+
+    std::vector<AABB>           boxes;
+    std::vector<BoundingSphere> spheres;
+    for (std::size_t i = 0; i < Count; ++i) {
+        const float   f = static_cast<float>(i);
+        const Vector3 center(std::sin(f) * 60.0f, std::cos(f * 1.3f) * 60.0f, f * 0.15f - 30.0f);
+        const Vector3 extent(0.5f + std::abs(std::sin(f * 0.1f)) * 4.0f);
+        boxes.emplace_back(center - extent, center + extent);
+        spheres.emplace_back(center, extent.x);
+    }
+    boxes[5]   = AABB();
+    spheres[7] = BoundingSphere();
+
+    const Frustum frustum(makeViewProjection());
+
+    std::vector<std::uint32_t> visibility((Count + 31) / 32, 0xFFFFFFFFU);
+    std::vector<std::uint32_t> indices(Count);
+
+    frustum.cullMask(boxes.data(), Count, visibility.data());
+    std::size_t visibleCount  = frustum.cullIndices(boxes.data(), Count, indices.data());
+    std::size_t expectedCount = 0;
+    for (std::size_t i = 0; i < Count; ++i) {
+        const bool visible = frustum.intersects(boxes[i]);
+        REQUIRE(((visibility[i / 32] >> (i % 32)) & 1U) == (visible ? 1U : 0U));
+        if (visible)
+            REQUIRE(indices[expectedCount++] == i);
+    }
+    REQUIRE(visibleCount == expectedCount);
+    REQUIRE((visibility.back() >> (Count % 32)) == 0);
+    REQUIRE(visibleCount > 0);
+    REQUIRE(visibleCount < Count);
+
+    frustum.cullMask(spheres.data(), Count, visibility.data());
+    visibleCount  = frustum.cullIndices(spheres.data(), Count, indices.data());
+    expectedCount = 0;
+    for (std::size_t i = 0; i < Count; ++i) {
+        const bool visible = frustum.intersects(spheres[i]);
+        REQUIRE(((visibility[i / 32] >> (i % 32)) & 1U) == (visible ? 1U : 0U));
+        if (visible)
+            REQUIRE(indices[expectedCount++] == i);
+    }
+    REQUIRE(visibleCount == expectedCount);
+    REQUIRE(visibleCount > 0);
+    REQUIRE(visibleCount < Count);
+}
@@ -0,0 +1,91 @@
+#include <ink/math/numbers.hpp>
+#include <ink/math/quaternion.hpp>
+
+using namespace ink;
+
+static auto near(double a, double b, double eps) noexcept -> bool {
+    return std::abs(a - b) <= eps;
+}
+
+static auto near(const Matrix4 &a, const Matrix4 &b, float eps = 1e-6f) noexcept -> bool {
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            if (!near(a[i][j], b[i][j], eps))
+                return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Constexpr sqrt", "[Functions]") {
+    constexpr float root2 = ink::sqrt(2.0f);
+    STATIC_REQUIRE(root2 == Sqrt2<float>);
+
+    constexpr double root3 = ink::sqrt(3.0);
+    STATIC_REQUIRE(root3 == Sqrt3<double>);
+
+    // Compile time evaluation is correctly rounded for float in the whole range.
+    for (float x = 1e-30f; x < 1e30f; x *= 1.37f)
+        REQUIRE(detail::constexprSqrt(x) == std::sqrt(x));
+    for (double x = 1e-300; x < 1e300; x *= 1.37)
+        REQUIRE(near(detail::constexprSqrt(x), std::sqrt(x), std::sqrt(x) * 4e-16));
+
+    REQUIRE(detail::constexprSqrt(0.0f) == 0.0f);
+    REQUIRE(std::isinf(detail::constexprSqrt(INFINITY)));
+    REQUIRE(std::isnan(detail::constexprSqrt(-1.0f)));
+    REQUIRE(std::isnan(detail::constexprSqrt(NAN)));
+}
+
+TEST_CASE("Constexpr trigonometric functions", "[Functions]") {
+    constexpr float sin30 = ink::sin(Pi<float> / 6.0f);
+    constexpr float cos60 = ink::cos(Pi<float> / 3.0f);
+    constexpr float tan45 = ink::tan(Pi<float> / 4.0f);
+    STATIC_REQUIRE((sin30 > 0.4999999f && sin30 < 0.5000001f));
+    STATIC_REQUIRE((cos60 > 0.4999999f && cos60 < 0.5000001f));
+    STATIC_REQUIRE((tan45 > 0.9999999f && tan45 < 1.0000001f));
+
+    for (double x = -100.0; x < 100.0; x += 0.01) {
+        double s = 0;
+        double c = 0;
+        detail::constexprSinCos(x, s, c);
+        REQUIRE(near(s, std::sin(x), 1e-15));
+        REQUIRE(near(c, std::cos(x), 1e-15));
+    }
+
+    double s = 0;
+    double c = 0;
+    detail::constexprSinCos(static_cast<double>(INFINITY), s, c);
+    REQUIRE((std::isnan(s) && std::isnan(c)));
+
+    // Quadrant index of these arguments could not be represented exactly.
+    detail::constexprSinCos(1e30, s, c);
+    REQUIRE((std::isnan(s) && std::isnan(c)));
+    detail::constexprSinCos(-0x1p52 * Pi<double> / 2, s, c);
+    REQUIRE((std::isnan(s) && std::isnan(c)));
+
+    constexpr float large = ink::sin(1e30f);
+    STATIC_REQUIRE(large != large);
+}
+
+TEST_CASE("Constexpr transforms", "[Functions]") {
+    constexpr Vector3 eye(3.0f, 4.0f, -5.0f);
+    constexpr Vector3 target(0.0f, 1.0f, 0.0f);
+    constexpr Vector3 up(0.0f, 1.0f, 0.0f);
+    constexpr Vector3 axis(1.0f, 2.0f, 3.0f);
+
+    constexpr Matrix4    view       = lookAt(eye, target, up);
+    constexpr Matrix4    projection = perspective(Pi<float> / 3.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+    constexpr Matrix4    rotation   = Matrix4(1.0f).rotated(axis, 0.7f);
+    constexpr Quaternion euler(0.3f, -0.4f, 1.2f);
+    constexpr Quaternion quat(axis, 0.7f);
+    constexpr Matrix3    rotation2D = Matrix3(1.0f).rotated(Pi<float> / 2.0f);
+    constexpr Vector4    normal     = Vector4(1.0f, 2.0f, 2.0f, 4.0f).normalized();
+
+    STATIC_REQUIRE(normal.x == 0.2f);
+    STATIC_REQUIRE((rotation2D[1][0] > 0.9999999f && rotation2D[1][1] < 1e-7f));
+    REQUIRE(near(view, lookAt(Vector3(3.0f, 4.0f, -5.0f), target, up)));
+    REQUIRE(near(projection, perspective(Pi<float> / 3.0f, 16.0f / 9.0f, 0.1f, 100.0f)));
+    REQUIRE(near(rotation, Matrix4(1.0f).rotated(Vector3(1.0f, 2.0f, 3.0f), 0.7f)));
+    REQUIRE(near(euler.toMatrix(), Quaternion(0.3f, -0.4f, 1.2f).toMatrix()));
+    REQUIRE(near(quat.toMatrix(), rotation));
+}
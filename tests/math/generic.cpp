@@ -0,0 +1,155 @@
+#include <ink/math/generic.hpp>
+
+using namespace ink;
+
+static auto near(double a, double b, double eps = 1e-9) noexcept -> bool {
+    return std::abs(a - b) <= eps;
+}
+
+TEST_CASE("Generic vector type mapping", "[Generic]") {
+    STATIC_REQUIRE(std::is_same_v<Vector<float, 2>, Vector2>);
+    STATIC_REQUIRE(std::is_same_v<Vector<float, 3>, Vector3>);
+    STATIC_REQUIRE(std::is_same_v<Vector<float, 4>, Vector4>);
+    STATIC_REQUIRE(std::is_same_v<Vector<double, 3>, BasicVector<double, 3>>);
+    STATIC_REQUIRE(std::is_same_v<Vector<float, 5>, BasicVector<float, 5>>);
+
+    STATIC_REQUIRE(std::is_same_v<Matrix<float, 2, 2>, Matrix2>);
+    STATIC_REQUIRE(std::is_same_v<Matrix<float, 3, 3>, Matrix3>);
+    STATIC_REQUIRE(std::is_same_v<Matrix<float, 4, 4>, Matrix4>);
+    STATIC_REQUIRE(std::is_same_v<Matrix<float, 3, 4>, BasicMatrix<float, 3, 4>>);
+
+    STATIC_REQUIRE(sizeof(Vector3d) == 3 * sizeof(double));
+    STATIC_REQUIRE(sizeof(Vector2u) == 2 * sizeof(std::uint32_t));
+    STATIC_REQUIRE(sizeof(Matrix4d) == 16 * sizeof(double));
+}
+
+TEST_CASE("Generic vector", "[Generic]") {
+    Vector3i a(1, -2, 3);
+    REQUIRE(a.x == 1);
+    REQUIRE(a.y == -2);
+    REQUIRE(a[2] == 3);
+    REQUIRE(Vector3i() == Vector3i(0));
+
+    constexpr Vector3d e(1.0, 2.0, 3.0);
+    STATIC_REQUIRE(e.x == 1.0);
+    STATIC_REQUIRE(e.y == 2.0);
+    STATIC_REQUIRE((e + e).z == 6.0);
+    STATIC_REQUIRE(Vector2u().y == 0U);
+
+    const Vector3i b(4, 5, 6);
+    REQUIRE(a + b == Vector3i(5, 3, 9));
+    REQUIRE(a - b == Vector3i(-3, -7, -3));
+    REQUIRE(a * b == Vector3i(4, -10, 18));
+    REQUIRE(b / 2 == Vector3i(2, 2, 3));
+    REQUIRE(b % 4 == Vector3i(0, 1, 2));
+    REQUIRE(-a == Vector3i(-1, 2, -3));
+    REQUIRE(dot(a, b) == 12);
+    REQUIRE(cross(a, b) == Vector3i(-27, 6, 13));
+    REQUIRE(min(a, b) == a);
+    REQUIRE(max(a, b) == b);
+    REQUIRE(abs(a) == Vector3i(1, 2, 3));
+    REQUIRE(clamp(Vector3i(-5, 2, 9), Vector3i(0), Vector3i(4)) == Vector3i(0, 2, 4));
+
+    a += b;
+    REQUIRE(a == Vector3i(5, 3, 9));
+
+    // Tile coordinates of a pixel.
+    const Vector2u pixel(1919, 1080);
+    const Vector2u tile = pixel / 16U;
+    REQUIRE(tile == Vector2u(119, 67));
+    REQUIRE(pixel % 16U == Vector2u(15, 8));
+
+    constexpr Vector4d unit = Vector4d(3.0, 0.0, 4.0, 0.0).normalized();
+    STATIC_REQUIRE(Vector4d(3.0, 0.0, 4.0, 0.0).length() == 5.0);
+    STATIC_REQUIRE((unit.z > 0.8 - 1e-15 && unit.z < 0.8 + 1e-15));
+
+    const Vector4d d(3.0, 0.0, 4.0, 0.0);
+    REQUIRE(d.w == 0.0);
+    REQUIRE(d.length() == 5.0);
+    REQUIRE(near(d.normalized().length(), 1.0));
+    REQUIRE(lerp(Vector2d(0.0, 2.0), Vector2d(4.0, 4.0), 0.25) == Vector2d(1.0, 2.5));
+
+    const BasicVector<float, 5> five(1.0f);
+    REQUIRE(dot(five, five) == 5.0f);
+
+    REQUIRE(Vector3i(Vector3d(1.9, -1.9, 2.0)) == Vector3i(1, -1, 2));
+    REQUIRE(vectorCast<Vector3>(Vector3d(1.0, 2.0, 3.0)) == Vector3(1.0f, 2.0f, 3.0f));
+    REQUIRE(vectorCast<Vector4d>(Vector4(1.0f, 2.0f, 3.0f, 4.0f)) == Vector4d(1.0, 2.0, 3.0, 4.0));
+}
+
+TEST_CASE("Generic matrix", "[Generic]") {
+    const Matrix3d identity(1.0);
+    REQUIRE(identity[1] == Vector3d(0.0, 1.0, 0.0));
+
+    const Matrix3d m(Vector3d(2.0, 0.0, 1.0), Vector3d(1.0, 3.0, 0.0), Vector3d(0.0, 1.0, 4.0));
+    REQUIRE(m * identity == m);
+    REQUIRE(identity * m == m);
+    REQUIRE(m.transposed().transposed() == m);
+    REQUIRE(near(m.determinant(), 25.0));
+
+    const Matrix3d product = m * m.inversed();
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j)
+            REQUIRE(near(product[i][j], i == j ? 1.0 : 0.0));
+    }
+
+    // Same convention as Matrix4: (v * m)[i] == dot(v, m[i]).
+    const Vector3d v(1.0, 2.0, 3.0);
+    REQUIRE(v * m == Vector3d(5.0, 7.0, 14.0));
+    REQUIRE(m * v == m.transposed().transposed() * v);
+    REQUIRE(v * m == m.transposed() * v);
+
+    // Non-square matrices.
+    const BasicMatrix<int, 2, 3> a(Vector2i(1, 2), Vector2i(3, 4), Vector2i(5, 6));
+    const BasicMatrix<int, 3, 2> b = a.transposed();
+    const BasicMatrix<int, 2, 2> c = a * b;
+    REQUIRE(c[0] == Vector2i(dot(Vector3i(1, 3, 5), Vector3i(1, 3, 5)),
+                             dot(Vector3i(2, 4, 6), Vector3i(1, 3, 5))));
+    REQUIRE(Vector2i(1, 1) * a == Vector3i(3, 7, 11));
+
+    // Float square matrices are the optimized types and agree with the generic path.
+    const Matrix4  f = Matrix4(1.0f).scaled(Vector3(2.0f, 0.5f, 1.5f)).translated(Vector3(1.0f));
+    const Matrix4d g = matrixCast<Matrix4d>(f);
+    const Matrix4  h = matrixCast<Matrix4>(g * g);
+    const Matrix4  expected = f * f;
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j)
+            REQUIRE(near(h[i][j], expected[i][j], 1e-6));
+    }
+}
+
+TEST_CASE("Camera relative positions", "[Generic]") {
+    // Positions far from the origin lose precision in float.
+    const Vector3d camera(1.0e7, 2.0e6, -3.0e7);
+    const Vector3d position = camera + Vector3d(0.125, -1.0625, 3.3);
+
+    const Vector3 naive  = vectorCast<Vector3>(position) - vectorCast<Vector3>(camera);
+    const Vector3 offset = cameraRelative(position, camera);
+    REQUIRE(near(offset.x, 0.125, 1e-6));
+    REQUIRE(near(offset.y, -1.0625, 1e-6));
+    REQUIRE(near(offset.z, 3.3, 1e-6));
+    REQUIRE_FALSE(near(naive.z, 3.3, 0.1));
+
+    Matrix4d world(1.0);
+    world[0][3] = position.x;
+    world[1][3] = position.y;
+    world[2][3] = position.z;
+
+    const Matrix4 relative = cameraRelative(world, camera);
+    REQUIRE(relative[0][0] == 1.0f);
+    REQUIRE(relative[0][3] == offset.x);
+    REQUIRE(relative[1][3] == offset.y);
+    REQUIRE(relative[2][3] == offset.z);
+
+    Vector3 high;
+    Vector3 low;
+    Vector3 cameraHigh;
+    Vector3 cameraLow;
+    split(position, high, low);
+    split(camera, cameraHigh, cameraLow);
+
+    const Vector3 gpu = (high - cameraHigh) + (low - cameraLow);
+    REQUIRE(near(gpu.x, 0.125, 1e-5));
+    REQUIRE(near(gpu.y, -1.0625, 1e-5));
+    REQUIRE(near(gpu.z, 3.3, 1e-5));
+}
@@ -0,0 +1,112 @@
+#include <ink/math/hierarchy.hpp>
+#include <ink/math/numbers.hpp>
+
+#include <vector>
+
+using namespace ink;
+
+static auto near(float a, float b) noexcept -> bool {
+    return std::abs(a - b) <= 1e-4f * std::max(1.0f, std::abs(a));
+}
+
+static auto near(const Matrix4 &a, const Matrix4 &b) noexcept -> bool {
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            if (!near(a[i][j], b[i][j]))
+                return false;
+        }
+    }
+    return true;
+}
+
+static auto makeTransform(std::size_t i) noexcept -> Transform {
+    const float f = static_cast<float>(i);
+    return {Vector3(std::sin(f), 0.1f, std::cos(f) * 0.5f),
+            Quaternion(Vector3(0.0f, 1.0f, 0.0f), f * 0.3f),
+            Vector3(1.0f + 0.1f * std::sin(f * 0.7f))};
+}
+
+/// @brief
+///   Compute world matrix of a node by walking up to the root.
+static auto worldOf(const TransformHierarchy &hierarchy, std::uint32_t node) noexcept -> Matrix4 {
+    Matrix4 world = hierarchy.local(node).toMatrix4();
+    for (auto p = hierarchy.parent(node); p != TransformHierarchy::NoParent;) {
+        world = world * hierarchy.local(p).toMatrix4();
+        p     = hierarchy.parent(p);
+    }
+    return world;
+}
+
+TEST_CASE("Transform hierarchy", "[Hierarchy]") {
+    TransformHierarchy hierarchy;
+    REQUIRE(hierarchy.size() == 0);
+    REQUIRE_FALSE(hierarchy.dirty());
+    hierarchy.update();
+
+    const Quaternion identity(1.0f);
+    const auto       root  = hierarchy.addNode(TransformHierarchy::NoParent, Transform());
+    const auto       child = hierarchy.addNode(root, {Vector3(1, 0, 0), identity, Vector3(1.0f)});
+    const auto       leaf  = hierarchy.addNode(child, {Vector3(0, 2, 0), identity, Vector3(1.0f)});
+    REQUIRE(hierarchy.dirty());
+
+    hierarchy.update();
+    REQUIRE_FALSE(hierarchy.dirty());
+    REQUIRE(Vector4(0.0f, 0.0f, 0.0f, 1.0f) * hierarchy.world(leaf) == Vector4(1, 2, 0, 1));
+
+    // Local transform is applied before the parent transform.
+    const Quaternion rotation(Vector3(0.0f, 0.0f, 1.0f), Pi<float> / 2);
+    hierarchy.setLocal(root, Transform(Vector3(0.0f), rotation, Vector3(2.0f)));
+    hierarchy.update();
+    const Vector4 p = Vector4(0.0f, 0.0f, 0.0f, 1.0f) * hierarchy.world(leaf);
+    REQUIRE(near(p.x, -4.0f));
+    REQUIRE(near(p.y, 2.0f));
+    REQUIRE(near((Vector4(0.0f, 0.0f, 0.0f, 1.0f) * hierarchy.world(child)).y, 2.0f));
+
+    hierarchy.clear();
+    REQUIRE(hierarchy.size() == 0);
+    REQUIRE_FALSE(hierarchy.dirty());
+}
+
+TEST_CASE("Transform hierarchy dirty propagation", "[Hierarchy]") {
+    // Wide levels cover the parallel path.
+    constexpr std::size_t Count = 70001;
+
+    TransformHierarchy hierarchy;
+    hierarchy.reserve(Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        const auto parent = (i < 4) ? TransformHierarchy::NoParent
+                                    : static_cast<std::uint32_t>((i * 2654435761U) % (i / 2));
+        REQUIRE(hierarchy.addNode(parent, makeTransform(i)) == i);
+    }
+
+    hierarchy.update();
+    for (std::uint32_t i = 0; i < Count; i += 97)
+        REQUIRE(near(hierarchy.world(i), worldOf(hierarchy, i)));
+
+    // Only descendants of modified nodes are recomputed. Other world matrices are kept.
+    const std::vector<Matrix4> before = hierarchy.worlds();
+    hierarchy.setLocal(7, makeTransform(123));
+    hierarchy.setLocal(1000, makeTransform(456));
+    hierarchy.update();
+
+    std::size_t changed = 0;
+    for (std::uint32_t i = 0; i < Count; ++i) {
+        bool descendant = false;
+        for (auto p = i; p != TransformHierarchy::NoParent; p = hierarchy.parent(p))
+            descendant = descendant || p == 7 || p == 1000;
+
+        const bool same = std::equal(&before[i][0][0], &before[i][0][0] + 16,
+                                     &hierarchy.world(i)[0][0]);
+        if (!descendant)
+            REQUIRE(same);
+        else
+            REQUIRE(near(hierarchy.world(i), worldOf(hierarchy, i)));
+        changed += same ? 0 : 1;
+    }
+    REQUIRE(changed > 2);
+
+    // Nodes added later are placed after their parents.
+    const auto added = hierarchy.addNode(5, makeTransform(789));
+    hierarchy.update();
+    REQUIRE(near(hierarchy.world(added), worldOf(hierarchy, added)));
+}
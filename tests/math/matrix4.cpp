@@ -203,6 +203,55 @@ TEST_CASE("Matrix4 inverse", "[Matrix4]") {
     REQUIRE(a[3] == Vector4(1.0f / 2.0f, -3.0f / 16.0f, -5.0f / 16.0f, -1.0f / 16.0f));
 }
 
+TEST_CASE("Matrix4 affine inverse", "[Matrix4]") {
+    Matrix4 affine(1.0f);
+    affine.scale(2.0f, 0.5f, 4.0f)
+        .rotate(Vector3(1.0f, 2.0f, 3.0f).normalized(), Pi<float> * 0.3f)
+        .translate(3.0f, -2.0f, 5.0f);
+
+    const Matrix4 expected = affine.inversed();
+    Matrix4       inversed = affine.inversedAffine();
+    REQUIRE(near(inversed, expected, 1e-5f));
+    REQUIRE(near(affine * inversed, Matrix4(1.0f), 1e-5f));
+
+    affine.inverseAffine();
+    REQUIRE(affine == inversed);
+}
+
+TEST_CASE("Matrix4 rigid inverse", "[Matrix4]") {
+    Matrix4 view =
+        lookAt(Vector3(3.0f, 4.0f, -5.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+
+    const Matrix4 expected = view.inversed();
+    Matrix4       inversed = view.inversedRigid();
+    REQUIRE(near(inversed, expected, 1e-5f));
+    REQUIRE(near(view * inversed, Matrix4(1.0f), 1e-5f));
+
+    view.inverseRigid();
+    REQUIRE(view == inversed);
+}
+
+TEST_CASE("Matrix4 normal matrix", "[Matrix4]") {
+    Matrix4 affine(1.0f);
+    affine.scale(2.0f, 0.5f, 4.0f)
+        .rotate(Vector3(0.0f, 1.0f, 0.0f), Pi<float> * 0.25f)
+        .translate(3.0f, -2.0f, 5.0f);
+
+    Matrix4 linear = affine;
+    linear[0][3]   = 0.0f;
+    linear[1][3]   = 0.0f;
+    linear[2][3]   = 0.0f;
+
+    const Matrix4 normal = affine.inverseTransposed3x3();
+    REQUIRE(near(normal, linear.inversed().transposed(), 1e-5f));
+
+    // Normals stay perpendicular to transformed tangents.
+    const Vector4 tangent(1.0f, 1.0f, 0.0f, 0.0f);
+    const Vector4 n(1.0f, -1.0f, 2.0f, 0.0f);
+    REQUIRE(dot(tangent, n) == 0.0f);
+    REQUIRE(near(dot(tangent * affine, n * normal), 0.0f, 1e-5f));
+}
+
 TEST_CASE("3D point translate", "[Matrix4]") {
     // (1, 0, 0)
     Vector4 a(1.0f, 0.0f, 0.0f, 1.0f);
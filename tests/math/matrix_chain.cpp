@@ -0,0 +1,85 @@
+#include <ink/math/matrix_chain.hpp>
+
+#include <vector>
+
+using namespace ink;
+
+static auto near(float a, float b) noexcept -> bool {
+    return std::abs(a - b) <= 1e-4f * std::max(1.0f, std::abs(a));
+}
+
+static auto near(Vector4 a, Vector4 b) noexcept -> bool {
+    return near(a[0], b[0]) && near(a[1], b[1]) && near(a[2], b[2]) && near(a[3], b[3]);
+}
+
+static auto near(Vector3 a, Vector3 b) noexcept -> bool {
+    return near(a[0], b[0]) && near(a[1], b[1]) && near(a[2], b[2]);
+}
+
+static auto near(const Matrix4 &a, const Matrix4 &b) noexcept -> bool {
+    return near(a[0], b[0]) && near(a[1], b[1]) && near(a[2], b[2]) && near(a[3], b[3]);
+}
+
+TEST_CASE("Matrix4 chain", "[MatrixChain]") {
+    const Vector3 axis       = Vector3(1.0f, 2.0f, 3.0f).normalized();
+    const Matrix4 model      = Matrix4(1.0f).scaled(2.0f, 0.5f, 3.0f).rotated(axis, 0.75f);
+    const Matrix4 view       = lookAt(Vector3(3, 4, -5), Vector3(0.0f), Vector3(0, 1, 0));
+    const Matrix4 projection = perspective(1.0f, 1.5f, 0.1f, 100.0f);
+    const Vector4 v(1.0f, -2.0f, 0.5f, 1.0f);
+
+    const auto chain = lazy(projection) * view * model;
+    STATIC_REQUIRE(decltype(chain)::size() == 3);
+    REQUIRE(near(chain.evaluate(), projection * view * model));
+    REQUIRE(near(chain * v, projection * view * model * v));
+    REQUIRE(near(v * chain, v * (projection * view * model)));
+
+    Vector4 w = v;
+    w *= chain;
+    REQUIRE(near(w, v * chain));
+
+    // Concatenating chains keeps the order of matrices.
+    const auto prepended = model * lazy(view) * (lazy(projection) * model);
+    REQUIRE(near(prepended.evaluate(), model * view * projection * model));
+    REQUIRE(near(prepended * v, model * view * projection * model * v));
+
+    const Matrix4 converted = chain;
+    REQUIRE(near(converted, chain.evaluate()));
+
+    constexpr auto scale = lazy(Matrix4(2.0f)) * Matrix4(3.0f);
+    STATIC_REQUIRE(scale * Vector4(1.0f) == Vector4(6.0f));
+    STATIC_REQUIRE(scale.evaluate()[1][1] == 6.0f);
+}
+
+TEST_CASE("Matrix4 chain batch transform", "[MatrixChain]") {
+    const Matrix4 a = Matrix4(1.0f).rotated(Vector3(0, 1, 0), 0.5f).translated(1.0f, 2.0f, 3.0f);
+    const Matrix4 b = Matrix4(1.0f).scaled(0.5f, 2.0f, 1.0f);
+    const Matrix4 c = perspective(1.2f, 1.0f, 0.5f, 50.0f);
+
+    const auto    chain   = lazy(a) * b * c;
+    const Matrix4 product = a * b * c;
+
+    // Small arrays are transformed per vector, and large arrays evaluate the chain first.
+    for (std::size_t count : {std::size_t(0), std::size_t(3), std::size_t(37)}) {
+        std::vector<Vector4> vectors(count);
+        std::vector<Vector3> points(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const float f = static_cast<float>(i);
+            vectors[i]    = Vector4(f * 0.5f - 3.0f, std::sin(f), 2.0f - f * 0.1f, 1.0f);
+            points[i]     = Vector3(vectors[i].x, vectors[i].y, vectors[i].z);
+        }
+
+        std::vector<Vector4> outVectors(count);
+        std::vector<Vector4> expectedVectors(count);
+        transformVectors(chain, vectors.data(), outVectors.data(), count);
+        transformVectors(product, vectors.data(), expectedVectors.data(), count);
+        for (std::size_t i = 0; i < count; ++i)
+            REQUIRE(near(outVectors[i], expectedVectors[i]));
+
+        std::vector<Vector3> outPoints(count);
+        std::vector<Vector3> expectedPoints(count);
+        transformPoints(chain, points.data(), outPoints.data(), count);
+        transformPoints(product, points.data(), expectedPoints.data(), count);
+        for (std::size_t i = 0; i < count; ++i)
+            REQUIRE(near(outPoints[i], expectedPoints[i]));
+    }
+}
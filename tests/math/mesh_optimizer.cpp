@@ -0,0 +1,269 @@
+#include <ink/math/mesh_optimizer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+using namespace ink;
+
+namespace {
+
+/// @brief
+///   Indexed triangle mesh used by mesh optimizer tests.
+struct TestMesh {
+    std::vector<Vector3>       positions;
+    std::vector<std::uint32_t> indices;
+};
+
+/// @brief
+///   Create a grid of (size + 1) x (size + 1) vertices in the XY plane, with triangles and vertices
+///   shuffled so that the cache efficiency is poor.
+auto makeShuffledGrid(std::uint32_t size) -> TestMesh {
+    TestMesh mesh;
+    for (std::uint32_t y = 0; y <= size; ++y) {
+        for (std::uint32_t x = 0; x <= size; ++x)
+            mesh.positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+    }
+
+    std::vector<std::array<std::uint32_t, 3>> triangles;
+    for (std::uint32_t y = 0; y < size; ++y) {
+        for (std::uint32_t x = 0; x < size; ++x) {
+            const std::uint32_t v = y * (size + 1) + x;
+            triangles.push_back({v, v + 1, v + size + 2});
+            triangles.push_back({v, v + size + 2, v + size + 1});
+        }
+    }
+
+    std::mt19937 random(42);
+    std::shuffle(triangles.begin(), triangles.end(), random);
+
+    // Shuffle vertices too so that vertex fetch order is poor.
+    std::vector<std::uint32_t> permutation(mesh.positions.size());
+    for (std::size_t i = 0; i < permutation.size(); ++i)
+        permutation[i] = static_cast<std::uint32_t>(i);
+    std::shuffle(permutation.begin(), permutation.end(), random);
+
+    std::vector<Vector3> positions(mesh.positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i)
+        positions[permutation[i]] = mesh.positions[i];
+    mesh.positions = std::move(positions);
+
+    for (const auto &triangle : triangles) {
+        for (const std::uint32_t v : triangle)
+            mesh.indices.push_back(permutation[v]);
+    }
+
+    return mesh;
+}
+
+/// @brief
+///   Get triangles of a mesh as sorted position triples so that meshes could be compared after
+///   triangles and vertices are reordered. Each triangle is rotated to start with its smallest
+///   vertex so that winding is kept.
+auto canonicalTriangles(const std::vector<Vector3>       &positions,
+                        const std::vector<std::uint32_t> &indices)
+    -> std::vector<std::array<float, 9>> {
+    std::vector<std::array<float, 9>> result;
+    for (std::size_t t = 0; t < indices.size() / 3; ++t) {
+        std::array<std::array<float, 3>, 3> vertices;
+        for (std::size_t k = 0; k < 3; ++k) {
+            const Vector3 &p = positions[indices[t * 3 + k]];
+            vertices[k]      = {p.x, p.y, p.z};
+        }
+
+        const auto first = std::min_element(vertices.begin(), vertices.end()) - vertices.begin();
+        std::rotate(vertices.begin(), vertices.begin() + first, vertices.end());
+
+        std::array<float, 9> triangle;
+        for (std::size_t k = 0; k < 3; ++k)
+            std::copy(vertices[k].begin(), vertices[k].end(), triangle.begin() + k * 3);
+        result.push_back(triangle);
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Vertex cache statistics", "[MeshOptimizer]") {
+    // A single triangle transforms each vertex once.
+    const std::uint32_t   triangle[] = {0, 1, 2};
+    VertexCacheStatistics stats      = analyzeVertexCache(triangle, 3, 3);
+    REQUIRE(stats.vertexTransforms == 3);
+    REQUIRE(stats.acmr == 3.0f);
+    REQUIRE(stats.atvr == 1.0f);
+
+    // A quad shares 2 vertices.
+    const std::uint32_t quad[] = {0, 1, 2, 2, 1, 3};
+    stats                      = analyzeVertexCache(quad, 6, 4);
+    REQUIRE(stats.vertexTransforms == 4);
+    REQUIRE(stats.acmr == 2.0f);
+    REQUIRE(stats.atvr == 1.0f);
+
+    // Vertex 0 is evicted from a 3 entry cache before it is referenced again.
+    const std::uint32_t evicted[] = {0, 1, 2, 3, 4, 5, 0, 1, 2};
+    stats                         = analyzeVertexCache(evicted, 9, 6, 3);
+    REQUIRE(stats.vertexTransforms == 9);
+    REQUIRE(stats.atvr == 1.5f);
+
+    stats = analyzeVertexCache(evicted, 9, 6, 6);
+    REQUIRE(stats.vertexTransforms == 6);
+
+    stats = analyzeVertexCache(nullptr, 0, 0);
+    REQUIRE(stats.vertexTransforms == 0);
+    REQUIRE(stats.acmr == 0.0f);
+    REQUIRE(stats.atvr == 0.0f);
+}
+
+TEST_CASE("Vertex cache optimization", "[MeshOptimizer]") {
+    const TestMesh mesh     = makeShuffledGrid(64);
+    const auto     expected = canonicalTriangles(mesh.positions, mesh.indices);
+
+    const VertexCacheStatistics before =
+        analyzeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.positions.size());
+
+    std::vector<std::uint32_t> indices = mesh.indices;
+    optimizeVertexCache(indices.data(), indices.size(), mesh.positions.size());
+
+    const VertexCacheStatistics after =
+        analyzeVertexCache(indices.data(), indices.size(), mesh.positions.size());
+
+    // Shuffled grid transforms almost every vertex of each triangle. Tipsify is close to the
+    // optimal 0.5 for large grids with a 16 entry cache.
+    REQUIRE(before.acmr > 2.5f);
+    REQUIRE(after.acmr < 0.8f);
+    REQUIRE(after.atvr < 1.6f);
+    REQUIRE(canonicalTriangles(mesh.positions, indices) == expected);
+
+    // Optimizing an optimized mesh does not make it worse.
+    optimizeVertexCache(indices.data(), indices.size(), mesh.positions.size());
+    REQUIRE(analyzeVertexCache(indices.data(), indices.size(), mesh.positions.size()).acmr <=
+            after.acmr * 1.05f);
+    REQUIRE(canonicalTriangles(mesh.positions, indices) == expected);
+
+    // Unreferenced vertices and empty meshes are allowed.
+    std::vector<std::uint32_t> sparse = {7, 3, 5, 5, 3, 9};
+    optimizeVertexCache(sparse.data(), sparse.size(), 12);
+    REQUIRE(analyzeVertexCache(sparse.data(), sparse.size(), 12).vertexTransforms == 4);
+    optimizeVertexCache(nullptr, 0, 0);
+}
+
+TEST_CASE("Overdraw optimization", "[MeshOptimizer]") {
+    // A UV sphere, which has clusters facing every direction.
+    constexpr std::uint32_t Rings    = 32;
+    constexpr std::uint32_t Segments = 64;
+
+    std::vector<Vector3> positions;
+    for (std::uint32_t r = 0; r <= Rings; ++r) {
+        const float theta = 3.14159265f * static_cast<float>(r) / static_cast<float>(Rings);
+        for (std::uint32_t s = 0; s <= Segments; ++s) {
+            const float phi = 6.28318531f * static_cast<float>(s) / static_cast<float>(Segments);
+            positions.emplace_back(std::sin(theta) * std::cos(phi), std::cos(theta),
+                                   std::sin(theta) * std::sin(phi));
+        }
+    }
+
+    std::vector<std::uint32_t> indices;
+    for (std::uint32_t r = 0; r < Rings; ++r) {
+        for (std::uint32_t s = 0; s < Segments; ++s) {
+            const std::uint32_t v = r * (Segments + 1) + s;
+            indices.insert(indices.end(), {v, v + Segments + 1, v + 1});
+            indices.insert(indices.end(), {v + 1, v + Segments + 1, v + Segments + 2});
+        }
+    }
+
+    const auto expected = canonicalTriangles(positions, indices);
+
+    optimizeVertexCache(indices.data(), indices.size(), positions.size());
+    const auto before = analyzeVertexCache(indices.data(), indices.size(), positions.size());
+
+    optimizeOverdraw(indices.data(), indices.size(), positions.data(), positions.size());
+    REQUIRE(canonicalTriangles(positions, indices) == expected);
+
+    // ACMR of the result is within the default threshold.
+    const auto after = analyzeVertexCache(indices.data(), indices.size(), positions.size());
+    REQUIRE(after.acmr <= before.acmr * 1.05f);
+
+    // Strided positions give the same result.
+    struct Vertex {
+        Vector3 position;
+        float   padding[5];
+    };
+
+    std::vector<std::uint32_t> strided = indices;
+    std::vector<Vertex>        vertices(positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i)
+        vertices[i].position = positions[i];
+
+    optimizeOverdraw(indices.data(), indices.size(), positions.data(), positions.size());
+    optimizeOverdraw(strided.data(), strided.size(), &vertices[0].position, vertices.size(),
+                     sizeof(Vertex));
+    REQUIRE(strided == indices);
+
+    // Too few triangles to reorder.
+    std::vector<std::uint32_t> single = {0, 1, 2};
+    optimizeOverdraw(single.data(), single.size(), positions.data(), positions.size());
+    REQUIRE(single == std::vector<std::uint32_t>{0, 1, 2});
+}
+
+TEST_CASE("Vertex fetch optimization", "[MeshOptimizer]") {
+    std::vector<std::uint32_t> indices = {4, 2, 0, 0, 2, 5};
+    std::uint32_t              remap[7];
+
+    REQUIRE(optimizeVertexFetchRemap(indices.data(), indices.size(), 7, remap) == 4);
+
+    // Referenced vertices in first use order, then unreferenced vertices in original order.
+    const std::uint32_t expected[] = {2, 4, 1, 5, 0, 3, 6};
+    REQUIRE(std::equal(std::begin(remap), std::end(remap), std::begin(expected)));
+
+    remapIndices(indices.data(), indices.size(), remap);
+    REQUIRE(indices == std::vector<std::uint32_t>{0, 1, 2, 2, 1, 3});
+
+    // Interleaved attributes of other streams are not touched.
+    struct Vertex {
+        std::uint16_t attribute;
+        std::uint16_t other;
+    };
+
+    Vertex vertices[7];
+    for (std::uint16_t i = 0; i < 7; ++i)
+        vertices[i] = {i, std::uint16_t(100 + i)};
+
+    remapVertices(&vertices[0].attribute, 7, sizeof(std::uint16_t), sizeof(Vertex), remap);
+    for (std::uint16_t i = 0; i < 7; ++i) {
+        REQUIRE(vertices[remap[i]].attribute == i);
+        REQUIRE(vertices[i].other == 100 + i);
+    }
+}
+
+TEST_CASE("Mesh optimization", "[MeshOptimizer]") {
+    const TestMesh mesh     = makeShuffledGrid(100);
+    const auto     expected = canonicalTriangles(mesh.positions, mesh.indices);
+    const auto     before =
+        analyzeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.positions.size());
+
+    std::vector<std::uint32_t> indices   = mesh.indices;
+    std::vector<Vector3>       positions = mesh.positions;
+    std::vector<std::uint32_t> remap(positions.size());
+
+    const std::size_t referenced = optimizeMesh(indices.data(), indices.size(), positions.data(),
+                                                positions.size(), sizeof(Vector3), remap.data());
+    remapVertices(positions.data(), positions.size(), sizeof(Vector3), sizeof(Vector3),
+                  remap.data());
+
+    REQUIRE(referenced == positions.size());
+    REQUIRE(canonicalTriangles(positions, indices) == expected);
+
+    // Vertices are in first use order.
+    std::uint32_t next = 0;
+    for (const std::uint32_t index : indices) {
+        REQUIRE(index <= next);
+        next = std::max(next, index + 1);
+    }
+
+    const auto after = analyzeVertexCache(indices.data(), indices.size(), positions.size());
+    REQUIRE(after.vertexTransforms < before.vertexTransforms / 3);
+    REQUIRE(after.acmr < before.acmr);
+    REQUIRE(after.atvr < before.atvr);
+}
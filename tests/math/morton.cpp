@@ -0,0 +1,93 @@
+#include <ink/math/morton.hpp>
+
+#include <vector>
+
+using namespace ink;
+
+TEST_CASE("Morton code", "[Morton]") {
+    STATIC_REQUIRE(encodeMorton2(0xFFFFU, 0) == 0x55555555U);
+    STATIC_REQUIRE(encodeMorton2(0, 0xFFFFU) == 0xAAAAAAAAU);
+    STATIC_REQUIRE(encodeMorton2(0b11, 0b01) == 0b0111U);
+    STATIC_REQUIRE(encodeMorton3(0x3FFU, 0, 0) == 0x09249249U);
+    STATIC_REQUIRE(encodeMorton3(1, 1, 1) == 0b111U);
+    STATIC_REQUIRE(encodeMorton3(0, 0, 2) == 0b100000U);
+    STATIC_REQUIRE(encodeMorton64(0x1FFFFFU, 0, 0) == 0x1249249249249249ULL);
+    STATIC_REQUIRE(encodeMorton64(0, 0, 0x1FFFFFU) == 0x4924924924924924ULL);
+
+    // Higher bits are ignored.
+    REQUIRE(encodeMorton2(0x10001U, 0) == 1);
+    REQUIRE(encodeMorton3(0x401U, 0, 0) == 1);
+    REQUIRE(encodeMorton64(0x200001U, 0, 0) == 1);
+
+    std::uint32_t state = 12345;
+    for (int i = 0; i < 10000; ++i) {
+        state = state * 1664525U + 1013904223U;
+
+        // Compare with the bit twiddling version, which is used at compile time.
+        const std::uint32_t x     = state & 0xFFFFU;
+        const std::uint32_t y     = state >> 16;
+        const std::uint32_t code2 = encodeMorton2(x, y);
+        REQUIRE(code2 == (detail::spreadBits2(x) | (detail::spreadBits2(y) << 1)));
+
+        std::uint32_t dx, dy, dz;
+        decodeMorton2(code2, dx, dy);
+        REQUIRE(dx == x);
+        REQUIRE(dy == y);
+
+        const std::uint32_t x3    = x & 0x3FFU;
+        const std::uint32_t y3    = y & 0x3FFU;
+        const std::uint32_t z3    = (state >> 10) & 0x3FFU;
+        const std::uint32_t code3 = encodeMorton3(x3, y3, z3);
+        REQUIRE(code3 < (1U << 30));
+
+        decodeMorton3(code3, dx, dy, dz);
+        REQUIRE(dx == x3);
+        REQUIRE(dy == y3);
+        REQUIRE(dz == z3);
+
+        const std::uint64_t x64    = (std::uint64_t(x) << 5) | (state & 0x1FU);
+        const std::uint64_t y64    = state >> 11;
+        const std::uint64_t z64    = (state ^ 0x155555U) & 0x1FFFFFU;
+        const std::uint64_t code64 = encodeMorton64(x64, y64, z64);
+        REQUIRE(code64 < (1ULL << 63));
+
+        std::uint64_t ex, ey, ez;
+        decodeMorton64(code64, ex, ey, ez);
+        REQUIRE(ex == x64);
+        REQUIRE(ey == y64);
+        REQUIRE(ez == z64);
+
+        // The 30-bit code is the top 30 bits of the 63-bit code if coordinates are scaled.
+        REQUIRE((encodeMorton64(std::uint64_t(x3) << 11, std::uint64_t(y3) << 11,
+                                std::uint64_t(z3) << 11) >>
+                 33) == code3);
+    }
+}
+
+TEST_CASE("Morton code of points", "[Morton]") {
+    const AABB bounds(Vector3(-1.0f, 0.0f, 2.0f), Vector3(3.0f, 1.0f, 2.0f));
+
+    // Corners of the bounding box are mapped to the first and last cells. Degenerated axis is 0.
+    REQUIRE(encodeMorton3(bounds.min, bounds) == 0);
+    REQUIRE(encodeMorton3(bounds.max, bounds) == encodeMorton3(1023, 1023, 0));
+    REQUIRE(encodeMorton3(Vector3(1.0f, 0.5f, 5.0f), bounds) == encodeMorton3(512, 512, 0));
+    REQUIRE(encodeMorton3(Vector3(-9.0f, 9.0f, 2.0f), bounds) == encodeMorton3(0, 1023, 0));
+
+    constexpr std::size_t Count = 70001;
+
+    std::vector<Vector3> points(Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        const float f = static_cast<float>(i);
+        points[i]     = Vector3(std::sin(f) * 2.5f + 1.0f, std::cos(f * 0.3f), f * 1e-4f);
+    }
+    points[5].x = std::numeric_limits<float>::quiet_NaN();
+
+    std::vector<std::uint32_t> codes(Count);
+    encodeMorton3(points.data(), bounds, codes.data(), Count);
+    for (std::size_t i = 0; i < Count; ++i)
+        REQUIRE(codes[i] == encodeMorton3(points[i], bounds));
+
+    std::uint32_t x, y, z;
+    decodeMorton3(codes[5], x, y, z);
+    REQUIRE(x == 0);
+}
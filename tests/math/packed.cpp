@@ -0,0 +1,215 @@
+#include <ink/math/numbers.hpp>
+#include <ink/math/packed.hpp>
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace ink;
+
+static auto near(float a, float b, float eps = 1e-5f) noexcept -> bool {
+    return std::abs(a - b) <= eps;
+}
+
+static auto near(Vector4 a, Vector4 b, float eps) noexcept -> bool {
+    return near(a.x, b.x, eps) && near(a.y, b.y, eps) && near(a.z, b.z, eps) &&
+           near(a.w, b.w, eps);
+}
+
+TEST_CASE("Half conversion", "[Packed]") {
+    REQUIRE(Half(0.0f).bits == 0x0000);
+    REQUIRE(Half(-0.0f).bits == 0x8000);
+    REQUIRE(Half(1.0f).bits == 0x3C00);
+    REQUIRE(Half(-2.0f).bits == 0xC000);
+    REQUIRE(Half(65504.0f).bits == 0x7BFF);
+    REQUIRE(Half(65520.0f).bits == 0x7C00);
+    REQUIRE(Half(std::numeric_limits<float>::infinity()).bits == 0x7C00);
+    REQUIRE(Half(6.103515625e-5f).bits == 0x0400);
+    REQUIRE(Half(5.9604644775390625e-8f).bits == 0x0001);
+    REQUIRE(Half(2.98023223876953125e-8f).bits == 0x0000);
+
+    // Ties are rounded to even.
+    REQUIRE(Half(1.0f + 1.0f / 2048.0f).bits == 0x3C00);
+    REQUIRE(Half(1.0f + 3.0f / 2048.0f).bits == 0x3C02);
+
+    const Half nan(std::numeric_limits<float>::quiet_NaN());
+    REQUIRE(std::isnan(nan.toFloat()));
+
+    // Every finite half value round trips exactly.
+    std::size_t mismatches = 0;
+    for (std::uint32_t bits = 0; bits < 0x10000U; ++bits) {
+        const Half h = Half::fromBits(static_cast<std::uint16_t>(bits));
+        if ((bits & 0x7C00U) != 0x7C00U && Half(h.toFloat()) != h)
+            ++mismatches;
+    }
+    REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("Half bulk conversion", "[Packed]") {
+    constexpr std::size_t Count = 1031;
+
+    std::vector<Vector4> vectors(Count);
+    std::vector<Vector3> positions(Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        const float f = static_cast<float>(i);
+        vectors[i]    = Vector4(f * 0.37f - 100.0f, 1.0f / (f + 1.0f), f * f * 1e-3f, -f * 1e-7f);
+        positions[i]  = Vector3(vectors[i].x, vectors[i].y, vectors[i].z);
+    }
+
+    std::vector<Half4> packed(Count);
+    packHalf(vectors.data(), packed.data(), Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        const Half4 expected(vectors[i]);
+        REQUIRE(packed[i].x == expected.x);
+        REQUIRE(packed[i].y == expected.y);
+        REQUIRE(packed[i].z == expected.z);
+        REQUIRE(packed[i].w == expected.w);
+    }
+
+    std::vector<Vector4> unpacked(Count);
+    unpackHalf(packed.data(), unpacked.data(), Count);
+    for (std::size_t i = 0; i < Count; ++i)
+        REQUIRE(unpacked[i] == packed[i].toVector4());
+
+    packHalf(positions.data(), packed.data(), Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        const Half4 expected(Vector4(positions[i], 1.0f));
+        REQUIRE(packed[i].x == expected.x);
+        REQUIRE(packed[i].y == expected.y);
+        REQUIRE(packed[i].z == expected.z);
+        REQUIRE(packed[i].w == Half(1.0f));
+    }
+
+    // Every half value, including NaN payloads, unpacks bit-identical to the scalar conversion.
+    std::vector<Half4> allHalves(0x4000);
+    for (std::uint32_t i = 0; i < 0x4000U; ++i) {
+        allHalves[i].x = Half::fromBits(static_cast<std::uint16_t>(i * 4));
+        allHalves[i].y = Half::fromBits(static_cast<std::uint16_t>(i * 4 + 1));
+        allHalves[i].z = Half::fromBits(static_cast<std::uint16_t>(i * 4 + 2));
+        allHalves[i].w = Half::fromBits(static_cast<std::uint16_t>(i * 4 + 3));
+    }
+
+    std::vector<Vector4> allFloats(allHalves.size());
+    unpackHalf(allHalves.data(), allFloats.data(), allHalves.size());
+
+    std::size_t mismatches = 0;
+    for (std::uint32_t bits = 0; bits < 0x10000U; ++bits) {
+        const float expected = Half::fromBits(static_cast<std::uint16_t>(bits)).toFloat();
+        const float actual   = allFloats[bits / 4][bits % 4];
+        if (std::memcmp(&expected, &actual, sizeof(float)) != 0)
+            ++mismatches;
+    }
+    REQUIRE(mismatches == 0);
+
+    // Signaling NaN is quieted.
+    const float   snan = Half::fromBits(0x7C01).toFloat();
+    std::uint32_t snanBits;
+    std::memcpy(&snanBits, &snan, sizeof(snanBits));
+    REQUIRE(snanBits == 0x7FC02000U);
+
+    const Half2 h2(Vector2(0.5f, -3.0f));
+    REQUIRE(h2.toVector2() == Vector2(0.5f, -3.0f));
+}
+
+TEST_CASE("Normalized integer formats", "[Packed]") {
+    const SNorm8x4 snorm(Vector4(1.0f, -1.0f, 0.0f, 2.0f));
+    REQUIRE(snorm.bits == 0x7F00817FU);
+    REQUIRE(snorm.toVector4() == Vector4(1.0f, -1.0f, 0.0f, 1.0f));
+    REQUIRE(SNorm8x4(Vector4(-1.0f)).toVector4() == Vector4(-1.0f));
+
+    const UNorm8x4 rgba(Vector4(1.0f, -1.0f, 0.5f, 2.0f));
+    REQUIRE(rgba.bits == 0xFF8000FFU);
+    REQUIRE(rgba.get(2) == 128);
+    REQUIRE(rgba.toVector4() == Vector4(1.0f, 0.0f, 128.0f / 255.0f, 1.0f));
+    STATIC_REQUIRE(UNorm8x4(1, 2, 3, 4).bits == 0x04030201U);
+
+    const UNorm16x2 unorm(Vector2(1.0f, 0.5f));
+    REQUIRE(unorm.bits == 0x8000FFFFU);
+    REQUIRE(unorm.toVector2().x == 1.0f);
+    REQUIRE(near(unorm.toVector2().y, 0.5f, 1.0f / 65535.0f));
+
+    const UInt1010102 packed(Vector4(1.0f, 0.0f, 0.5f, 1.0f));
+    REQUIRE((packed.bits & 0x3FFU) == 0x3FFU);
+    REQUIRE(((packed.bits >> 10) & 0x3FFU) == 0);
+    REQUIRE((packed.bits >> 30) == 3);
+    REQUIRE(near(packed.toVector4(), Vector4(1.0f, 0.0f, 0.5f, 1.0f), 1.0f / 1023.0f));
+
+    constexpr std::size_t Count = 37;
+
+    std::vector<Vector4> tangents(Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        const float f = static_cast<float>(i) * 0.1f;
+        tangents[i]   = Vector4(std::sin(f), std::cos(f), f - 1.5f, i % 2 == 0 ? 1.0f : -1.0f);
+    }
+
+    std::vector<SNorm8x4> snorms(Count);
+    packSNorm8(tangents.data(), snorms.data(), Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        REQUIRE(snorms[i].bits == SNorm8x4(tangents[i]).bits);
+        REQUIRE(near(snorms[i].toVector4(), clamp(tangents[i], Vector4(-1.0f), Vector4(1.0f)),
+                     0.5f / 127.0f + 1e-6f));
+    }
+
+    // NaN is packed as 0.
+    const float    nan = std::numeric_limits<float>::quiet_NaN();
+    const Vector4  nans(nan, 0.5f, nan, 1.0f);
+    const SNorm8x4 snormNaN(nans);
+    REQUIRE(snormNaN.bits == 0x7F004000U);
+    REQUIRE(UNorm8x4(nans).bits == 0xFF008000U);
+    REQUIRE(UNorm16x2(Vector2(nan, 1.0f)).bits == 0xFFFF0000U);
+    REQUIRE(UInt1010102(nans).bits == 0xC0080000U);
+
+    SNorm8x4 snormBulk;
+    packSNorm8(&nans, &snormBulk, 1);
+    REQUIRE(snormBulk.bits == snormNaN.bits);
+
+    UInt1010102 uintBulk;
+    packUInt1010102(&nans, &uintBulk, 1);
+    REQUIRE(uintBulk.bits == 0xC0080000U);
+
+    std::vector<UInt1010102> uints(Count);
+    packUInt1010102(tangents.data(), uints.data(), Count);
+    for (std::size_t i = 0; i < Count; ++i)
+        REQUIRE(uints[i].bits == UInt1010102(tangents[i]).bits);
+}
+
+TEST_CASE("Octahedral normal encoding", "[Packed]") {
+    constexpr std::size_t Count = 1000;
+
+    std::vector<Vector3> normals;
+    normals.reserve(Count + 6);
+    normals.emplace_back(1.0f, 0.0f, 0.0f);
+    normals.emplace_back(-1.0f, 0.0f, 0.0f);
+    normals.emplace_back(0.0f, 1.0f, 0.0f);
+    normals.emplace_back(0.0f, -1.0f, 0.0f);
+    normals.emplace_back(0.0f, 0.0f, 1.0f);
+    normals.emplace_back(0.0f, 0.0f, -1.0f);
+
+    // Fibonacci sphere.
+    for (std::size_t i = 0; i < Count; ++i) {
+        const float f   = static_cast<float>(i);
+        const float z   = 1.0f - (f + 0.5f) * 2.0f / static_cast<float>(Count);
+        const float r   = std::sqrt(1.0f - z * z);
+        const float phi = f * Pi<float> * (3.0f - std::sqrt(5.0f));
+        normals.emplace_back(r * std::cos(phi), r * std::sin(phi), z);
+    }
+
+    for (const Vector3 &n : normals) {
+        const Vector2 e = encodeOctahedral(n);
+        REQUIRE(std::abs(e.x) <= 1.0f);
+        REQUIRE(std::abs(e.y) <= 1.0f);
+
+        const Vector3 d = decodeOctahedral(e);
+        REQUIRE(dot(d, n) >= 1.0f - 1e-6f);
+    }
+
+    std::vector<UNorm16x2> packed(normals.size());
+    std::vector<Vector3>   unpacked(normals.size());
+    packOctahedral(normals.data(), packed.data(), normals.size());
+    unpackOctahedral(packed.data(), unpacked.data(), normals.size());
+    for (std::size_t i = 0; i < normals.size(); ++i) {
+        const float s = cross(unpacked[i], normals[i]).length();
+        REQUIRE(std::asin(std::min(s, 1.0f)) < 1e-4f);
+        REQUIRE(dot(unpacked[i], normals[i]) > 0);
+    }
+}
@@ -133,3 +133,21 @@ TEST_CASE("Quaternion divide operator", "[Quaternion]") {
         REQUIRE(near(c, Quaternion(0.7233789f, -0.3919574f, -0.360332f, -0.4396058f)));
     }
 }
+
+TEST_CASE("Quaternion slerp", "[Quaternion]") {
+    SECTION("Nearly identical quaternions") {
+        // Dot product of this unit quaternion with itself rounds to 1.00000012.
+        const Quaternion a(0.999887526f, 0.00454551633f, 0.00757586025f, 0.0121213766f);
+        const Quaternion b(0.999887526f, 0.00454551633f, 0.00757586025f, 0.0121213775f);
+
+        for (const float t : {0.0f, 0.25f, 0.5f, 1.0f}) {
+            const Quaternion q = slerp(a, b, t);
+            REQUIRE(!std::isnan(q.w));
+            REQUIRE(near(q, a, 1e-6f));
+
+            const Quaternion r = slerp(a, a, t);
+            REQUIRE(!std::isnan(r.w));
+            REQUIRE(near(r, a, 1e-6f));
+        }
+    }
+}
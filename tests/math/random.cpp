@@ -0,0 +1,127 @@
+#include <ink/math/random.hpp>
+
+#include <random>
+
+using namespace ink;
+
+TEST_CASE("PCG32", "[Random]") {
+    // Reference output of the PCG32 demo with seed 42 and stream 54.
+    PCG32 rng(42, 54);
+    REQUIRE(rng.next() == 0xA15C02B7u);
+    REQUIRE(rng.next() == 0x7B47F409u);
+    REQUIRE(rng.next() == 0xBA1D3330u);
+    REQUIRE(rng.next() == 0x83D2F293u);
+    REQUIRE(rng.next() == 0xBFA4784Bu);
+    REQUIRE(rng.next() == 0xCBED606Eu);
+
+    constexpr std::uint32_t first = PCG32(42, 54).next();
+    STATIC_REQUIRE(first == 0xA15C02B7u);
+    STATIC_REQUIRE(sizeof(PCG32) == 16);
+
+    SECTION("Advance") {
+        PCG32 a(7, 3);
+        PCG32 b = a;
+        for (int i = 0; i < 1000; ++i)
+            a.next();
+        b.advance(1000);
+        REQUIRE(a == b);
+        REQUIRE(a.next() == b.next());
+    }
+
+    SECTION("Streams") {
+        PCG32 a(7, 1);
+        PCG32 b(7, 2);
+        REQUIRE(a != b);
+        int same = 0;
+        for (int i = 0; i < 100; ++i)
+            same += (a.next() == b.next()) ? 1 : 0;
+        REQUIRE(same < 2);
+    }
+
+    SECTION("Bounded and float") {
+        PCG32         r(1);
+        std::uint32_t histogram[10]{};
+        float         sum = 0;
+        for (int i = 0; i < 100000; ++i) {
+            const std::uint32_t n = r.nextUint(10);
+            REQUIRE(n < 10);
+            ++histogram[n];
+
+            const float f = r.nextFloat();
+            REQUIRE((f >= 0.0f && f < 1.0f));
+            sum += f;
+        }
+
+        for (const std::uint32_t count : histogram)
+            REQUIRE((count > 9500 && count < 10500));
+        REQUIRE(std::abs(sum / 100000.0f - 0.5f) < 0.01f);
+    }
+
+    SECTION("Standard distributions") {
+        PCG32                              r(5);
+        std::uniform_int_distribution<int> dist(1, 6);
+        for (int i = 0; i < 100; ++i) {
+            const int n = dist(r);
+            REQUIRE((n >= 1 && n <= 6));
+        }
+    }
+}
+
+TEST_CASE("Xoshiro256", "[Random]") {
+    Xoshiro256 a(12345);
+    Xoshiro256 b(12345);
+    Xoshiro256 c(54321);
+    for (int i = 0; i < 100; ++i) {
+        const std::uint64_t v = a.next();
+        REQUIRE(v == b.next());
+        REQUIRE(v != c.next());
+    }
+
+    float sum = 0;
+    for (int i = 0; i < 100000; ++i) {
+        const float f = a.nextFloat();
+        REQUIRE((f >= 0.0f && f < 1.0f));
+        sum += f;
+    }
+    REQUIRE(std::abs(sum / 100000.0f - 0.5f) < 0.01f);
+
+    // Jumped generators do not overlap with the original one.
+    Xoshiro256 jumped = b;
+    jumped.jump();
+    REQUIRE(jumped.next() != b.next());
+
+    constexpr std::uint64_t first = Xoshiro256(1).next();
+    REQUIRE(Xoshiro256(1).next() == first);
+}
+
+TEST_CASE("Xoshiro256x8", "[Random]") {
+    Xoshiro256x8 wide(99);
+
+    Xoshiro256 lanes[8]{Xoshiro256(99), Xoshiro256(99), Xoshiro256(99), Xoshiro256(99),
+                        Xoshiro256(99), Xoshiro256(99), Xoshiro256(99), Xoshiro256(99)};
+    for (std::size_t i = 0; i < 8; ++i) {
+        for (std::size_t j = 0; j < i; ++j)
+            lanes[i].jump();
+    }
+
+    // Each lane is the same as a scalar generator that jumped lane index times.
+    for (int step = 0; step < 100; ++step) {
+        std::uint64_t values[8];
+        wide.next(values);
+        for (std::size_t i = 0; i < 8; ++i)
+            REQUIRE(values[i] == lanes[i].next());
+
+        const Float8 floats = wide.nextFloat();
+        for (std::size_t i = 0; i < 8; ++i)
+            REQUIRE(floats[i] == lanes[i].nextFloat());
+    }
+
+    float sum = 0;
+    for (int i = 0; i < 10000; ++i) {
+        const Float8 f = wide.nextFloat();
+        REQUIRE(maskBits((f >= Float8(0.0f)) & (f < Float8(1.0f))) == 0xFFu);
+        for (std::size_t j = 0; j < 8; ++j)
+            sum += f[j];
+    }
+    REQUIRE(std::abs(sum / 80000.0f - 0.5f) < 0.01f);
+}
@@ -0,0 +1,138 @@
+#include <ink/math/random.hpp>
+#include <ink/math/sampling.hpp>
+
+using namespace ink;
+
+static auto near(float a, float b, float eps = 1e-5f) noexcept -> bool {
+    return std::abs(a - b) <= eps;
+}
+
+TEST_CASE("Radical inverse", "[Sampling]") {
+    STATIC_REQUIRE(radicalInverse(1, 2) == 0.5f);
+    STATIC_REQUIRE(radicalInverse(3, 2) == 0.75f);
+    REQUIRE(near(radicalInverse(1, 3), 1.0f / 3.0f));
+    REQUIRE(near(radicalInverse(5, 3), 7.0f / 9.0f));
+    REQUIRE(near(radicalInverse(7, 5), 11.0f / 25.0f));
+    REQUIRE(radicalInverse(0xFFFFFFFFu, 2) < 1.0f);
+    REQUIRE(radicalInverse(0xFFFFFFFFu, 3) < 1.0f);
+
+    const Vector3 h = halton3(1);
+    REQUIRE(h.x == 0.5f);
+    REQUIRE(near(h.y, 1.0f / 3.0f));
+    REQUIRE(near(h.z, 0.2f));
+    REQUIRE(halton2(1).y == h.y);
+}
+
+TEST_CASE("Low discrepancy sequences", "[Sampling]") {
+    // First 2^m points of Sobol sequence have exactly one point in each elementary interval.
+    constexpr std::uint32_t Count = 256;
+    for (std::uint32_t log2Width = 0; log2Width <= 8; ++log2Width) {
+        const std::uint32_t width  = 1u << log2Width;
+        const std::uint32_t height = Count / width;
+
+        std::uint32_t cells[Count]{};
+        for (std::uint32_t i = 0; i < Count; ++i) {
+            const Vector2 p = sobol2(i, 0x12345678u);
+            REQUIRE((p.x >= 0.0f && p.x < 1.0f && p.y >= 0.0f && p.y < 1.0f));
+
+            const auto x = static_cast<std::uint32_t>(p.x * static_cast<float>(width));
+            const auto y = static_cast<std::uint32_t>(p.y * static_cast<float>(height));
+            ++cells[y * width + x];
+        }
+
+        for (const std::uint32_t count : cells)
+            REQUIRE(count == 1);
+    }
+
+    STATIC_REQUIRE(sobol2(1).x == 0.5f);
+    STATIC_REQUIRE(sobol2(1).y == 0.5f);
+    STATIC_REQUIRE(sobol2(2).y == 0.75f);
+    STATIC_REQUIRE(sobol2(3).y == 0.25f);
+
+    // R2 sequence fills a 16x16 grid with at most 2 points per cell.
+    std::uint32_t cells[256]{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        const Vector2 p = r2(i);
+        REQUIRE((p.x >= 0.0f && p.x < 1.0f && p.y >= 0.0f && p.y < 1.0f));
+        const auto    x = static_cast<std::uint32_t>(p.x * 16.0f);
+        const auto    y = static_cast<std::uint32_t>(p.y * 16.0f);
+        ++cells[y * 16 + x];
+    }
+    for (const std::uint32_t count : cells)
+        REQUIRE(count <= 2);
+
+    REQUIRE(near(r2(0).x, 0.5f));
+    REQUIRE(near(r2(1).x, 0.5f + 1.0f / 1.32471795724474602596f - 1.0f, 1e-6f));
+    REQUIRE(r2(100000000).x < 1.0f);
+}
+
+TEST_CASE("Sample mapping", "[Sampling]") {
+    constexpr std::uint32_t Count = 4096;
+
+    Vector3 sphereSum;
+    Vector3 hemisphereSum;
+    float   cosineZ = 0;
+    float   ggxZ    = 0;
+    float   ggxPdfZ = 0;
+    float   ggxSum  = 0;
+    for (std::uint32_t i = 0; i < Count; ++i) {
+        const Vector2 u = sobol2(i);
+
+        const Vector2 disk = sampleUniformDisk(u);
+        REQUIRE(dot(disk, disk) <= 1.0f + 1e-6f);
+
+        const Vector3 sphere = sampleUniformSphere(u);
+        REQUIRE(near(sphere.length(), 1.0f));
+        sphereSum += sphere;
+
+        const Vector3 hemisphere = sampleCosineHemisphere(u);
+        REQUIRE(near(hemisphere.length(), 1.0f));
+        REQUIRE(hemisphere.z >= 0.0f);
+        hemisphereSum += hemisphere;
+        cosineZ += hemisphere.z / cosineHemispherePdf(hemisphere.z);
+
+        const Vector3 h = sampleGGX(u, 0.5f);
+        REQUIRE(near(h.length(), 1.0f));
+        REQUIRE(h.z >= 0.0f);
+        ggxZ += h.z;
+
+        // Integrate PDF of GGX with uniformly distributed directions.
+        const float pdf = sphere.z > 0.0f ? ggxPdf(sphere.z, 0.5f) : 0.0f;
+        ggxSum += pdf * 4.0f * Pi<float>;
+        ggxPdfZ += sphere.z * pdf * 4.0f * Pi<float>;
+    }
+
+    // Uniform sphere and cosine hemisphere are symmetric around Z axis.
+    REQUIRE(near(sphereSum.x / Count, 0.0f, 1e-2f));
+    REQUIRE(near(sphereSum.y / Count, 0.0f, 1e-2f));
+    REQUIRE(near(sphereSum.z / Count, 0.0f, 1e-2f));
+    REQUIRE(near(hemisphereSum.x / Count, 0.0f, 1e-2f));
+    REQUIRE(near(hemisphereSum.y / Count, 0.0f, 1e-2f));
+
+    // Average of cos(theta) over cosine-weighted hemisphere is 2 / 3.
+    REQUIRE(near(hemisphereSum.z / Count, 2.0f / 3.0f, 1e-2f));
+
+    // Importance sampled estimate of integral of cos(theta) over the hemisphere, which is pi.
+    REQUIRE(near(cosineZ / Count, Pi<float>, 1e-3f));
+
+    // GGX PDF integrates to 1, and the samples follow the PDF.
+    REQUIRE(near(ggxSum / Count, 1.0f, 2e-2f));
+    REQUIRE(near(ggxZ / Count, ggxPdfZ / Count, 2e-2f));
+
+    constexpr Vector3 up = sampleCosineHemisphere(Vector2(0.5f, 0.5f));
+    STATIC_REQUIRE(up.z == 1.0f);
+}
+
+TEST_CASE("Random sampling", "[Sampling]") {
+    // Random points on the sphere from the wide generator have zero mean.
+    Xoshiro256x8 rng(7);
+    Vector3      sum;
+    for (int i = 0; i < 1000; ++i) {
+        const Float8 u = rng.nextFloat();
+        const Float8 v = rng.nextFloat();
+        for (std::size_t j = 0; j < 8; ++j)
+            sum += sampleUniformSphere(Vector2(u[j], v[j]));
+    }
+
+    REQUIRE(sum.length() / 8000.0f < 0.03f);
+}
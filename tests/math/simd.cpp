@@ -0,0 +1,188 @@
+#include <ink/math/affine.hpp>
+#include <ink/math/quaternion.hpp>
+
+#include <array>
+
+using namespace ink;
+
+// Results of constant evaluation always come from the scalar implementation, while the same
+// expressions evaluated at runtime use the SIMD implementation if available. These tests require
+// both implementations to produce exactly the same result.
+
+namespace {
+
+constexpr std::size_t SampleCount = 32;
+
+/// @brief
+///   Linear congruential generator that could be used in constant evaluation.
+struct Random {
+    std::uint32_t state;
+
+    constexpr auto next() noexcept -> float {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / 16777216.0f * 8.0f - 4.0f;
+    }
+};
+
+constexpr auto makeMatrices(std::uint32_t seed) noexcept -> std::array<Matrix4, SampleCount> {
+    Random                           random{seed};
+    std::array<Matrix4, SampleCount> result;
+    for (auto &m : result) {
+        for (std::size_t i = 0; i < 4; ++i)
+            m[i] = Vector4(random.next(), random.next(), random.next(), random.next());
+    }
+    return result;
+}
+
+constexpr auto makeVectors(std::uint32_t seed) noexcept -> std::array<Vector4, SampleCount> {
+    Random                           random{seed};
+    std::array<Vector4, SampleCount> result;
+    for (auto &v : result)
+        v = Vector4(random.next(), random.next(), random.next(), random.next());
+    return result;
+}
+
+constexpr auto makeQuaternions(std::uint32_t seed) noexcept
+    -> std::array<Quaternion, SampleCount> {
+    Random                              random{seed};
+    std::array<Quaternion, SampleCount> result;
+    for (auto &q : result)
+        q = Quaternion(random.next(), random.next(), random.next(), random.next());
+    return result;
+}
+
+constexpr auto Lhs     = makeMatrices(1);
+constexpr auto Rhs     = makeMatrices(2);
+constexpr auto Vectors = makeVectors(3);
+constexpr auto QuatLhs = makeQuaternions(4);
+constexpr auto QuatRhs = makeQuaternions(5);
+
+constexpr auto multiplyAll() noexcept -> std::array<Matrix4, SampleCount> {
+    std::array<Matrix4, SampleCount> result;
+    for (std::size_t i = 0; i < SampleCount; ++i)
+        result[i] = Lhs[i] * Rhs[i];
+    return result;
+}
+
+constexpr auto inverseAll() noexcept -> std::array<Matrix4, SampleCount> {
+    std::array<Matrix4, SampleCount> result;
+    for (std::size_t i = 0; i < SampleCount; ++i)
+        result[i] = Lhs[i].inversed();
+    return result;
+}
+
+constexpr auto inverseAffineAll() noexcept -> std::array<Matrix4, SampleCount * 3> {
+    std::array<Matrix4, SampleCount * 3> result;
+    for (std::size_t i = 0; i < SampleCount; ++i) {
+        result[i * 3]     = Lhs[i].inversedAffine();
+        result[i * 3 + 1] = Lhs[i].inversedRigid();
+        result[i * 3 + 2] = Lhs[i].inverseTransposed3x3();
+    }
+    return result;
+}
+
+constexpr auto multiplyAffineAll() noexcept -> std::array<Matrix3x4, SampleCount> {
+    std::array<Matrix3x4, SampleCount> result;
+    for (std::size_t i = 0; i < SampleCount; ++i)
+        result[i] = Matrix3x4(Lhs[i]) * Matrix3x4(Rhs[i]);
+    return result;
+}
+
+constexpr auto transposeAll() noexcept -> std::array<Matrix4, SampleCount> {
+    std::array<Matrix4, SampleCount> result;
+    for (std::size_t i = 0; i < SampleCount; ++i)
+        result[i] = Lhs[i].transposed();
+    return result;
+}
+
+constexpr auto transformAll() noexcept -> std::array<Vector4, SampleCount * 2> {
+    std::array<Vector4, SampleCount * 2> result;
+    for (std::size_t i = 0; i < SampleCount; ++i) {
+        result[i * 2]     = Lhs[i] * Vectors[i];
+        result[i * 2 + 1] = Vectors[i] * Lhs[i];
+    }
+    return result;
+}
+
+constexpr auto multiplyQuaternions() noexcept -> std::array<Quaternion, SampleCount> {
+    std::array<Quaternion, SampleCount> result;
+    for (std::size_t i = 0; i < SampleCount; ++i)
+        result[i] = QuatLhs[i] * QuatRhs[i];
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("SIMD Matrix4 multiply", "[SIMD]") {
+    constexpr auto expected = multiplyAll();
+    for (std::size_t i = 0; i < SampleCount; ++i) {
+        REQUIRE(Lhs[i] * Rhs[i] == expected[i]);
+
+        Matrix4 m = Lhs[i];
+        m *= Rhs[i];
+        REQUIRE(m == expected[i]);
+    }
+}
+
+TEST_CASE("SIMD Matrix4 inverse", "[SIMD]") {
+    constexpr auto expected = inverseAll();
+    for (std::size_t i = 0; i < SampleCount; ++i) {
+        REQUIRE(Lhs[i].inversed() == expected[i]);
+
+        Matrix4 m = Lhs[i];
+        m.inverse();
+        REQUIRE(m == expected[i]);
+    }
+}
+
+TEST_CASE("SIMD Matrix4 affine inverse", "[SIMD]") {
+    constexpr auto expected = inverseAffineAll();
+    for (std::size_t i = 0; i < SampleCount; ++i) {
+        REQUIRE(Lhs[i].inversedAffine() == expected[i * 3]);
+        REQUIRE(Lhs[i].inversedRigid() == expected[i * 3 + 1]);
+        REQUIRE(Lhs[i].inverseTransposed3x3() == expected[i * 3 + 2]);
+    }
+}
+
+TEST_CASE("SIMD Matrix3x4 multiply", "[SIMD]") {
+    constexpr auto expected = multiplyAffineAll();
+    for (std::size_t i = 0; i < SampleCount; ++i)
+        REQUIRE(Matrix3x4(Lhs[i]) * Matrix3x4(Rhs[i]) == expected[i]);
+}
+
+TEST_CASE("SIMD Matrix4 transpose", "[SIMD]") {
+    constexpr auto expected = transposeAll();
+    for (std::size_t i = 0; i < SampleCount; ++i)
+        REQUIRE(Lhs[i].transposed() == expected[i]);
+}
+
+TEST_CASE("SIMD Matrix4 transform vector", "[SIMD]") {
+    constexpr auto expected = transformAll();
+    for (std::size_t i = 0; i < SampleCount; ++i) {
+        REQUIRE(Lhs[i] * Vectors[i] == expected[i * 2]);
+        REQUIRE(Vectors[i] * Lhs[i] == expected[i * 2 + 1]);
+    }
+}
+
+TEST_CASE("SIMD Quaternion multiply", "[SIMD]") {
+    constexpr auto expected = multiplyQuaternions();
+    for (std::size_t i = 0; i < SampleCount; ++i) {
+        REQUIRE(QuatLhs[i] * QuatRhs[i] == expected[i]);
+
+        Quaternion q = QuatLhs[i];
+        q *= QuatRhs[i];
+        REQUIRE(q == expected[i]);
+    }
+}
+
+TEST_CASE("SIMD normalize", "[SIMD]") {
+    for (std::size_t i = 0; i < SampleCount; ++i) {
+        const Vector4 v      = Vectors[i];
+        const float   invLen = 1.0f / std::sqrt(dot(v, v));
+        REQUIRE(v.normalized() == v * invLen);
+
+        const Quaternion q       = QuatLhs[i];
+        const float      invLenQ = 1.0f / std::sqrt(dot(q, q));
+        REQUIRE(q.normalized() == q * invLenQ);
+    }
+}
@@ -0,0 +1,237 @@
+#include <ink/math/spherical_harmonics.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace ink;
+
+static auto near(float a, float b, float eps = 1e-4f) noexcept -> bool {
+    return std::abs(a - b) <= eps * std::max(1.0f, std::abs(a));
+}
+
+static auto near(Vector3 a, Vector3 b, float eps = 1e-4f) noexcept -> bool {
+    return near(a.x, b.x, eps) && near(a.y, b.y, eps) && near(a.z, b.z, eps);
+}
+
+static auto randomDirections(std::size_t count) -> std::vector<Vector3> {
+    std::mt19937                          random(42);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    std::vector<Vector3> directions;
+    directions.reserve(count);
+    while (directions.size() < count) {
+        const Vector3 d(dist(random), dist(random), dist(random));
+        const float   length = d.length();
+        if (length > 0.1f && length <= 1.0f)
+            directions.push_back(d / length);
+    }
+    return directions;
+}
+
+static auto makeSH9() noexcept -> SH9 {
+    SH9 sh;
+    for (std::size_t i = 0; i < SH9::Size; ++i)
+        sh[i] = 0.5f - 0.13f * static_cast<float>(i);
+    return sh;
+}
+
+TEST_CASE("Spherical harmonics basis", "[SphericalHarmonics]") {
+    constexpr SH9 up = SH9::basis(Vector3(0.0f, 0.0f, 1.0f));
+    STATIC_REQUIRE(up[1] == 0.0f);
+    STATIC_REQUIRE(up[3] == 0.0f);
+    STATIC_REQUIRE(up[8] == 0.0f);
+
+    constexpr float value = SH9::fromSample(Vector3(0.0f, 1.0f, 0.0f), 2.0f).evaluate(
+        Vector3(0.0f, 1.0f, 0.0f));
+    STATIC_REQUIRE(value > 0.0f);
+
+    // Band 0 and 1 are exact for projections of single samples.
+    const Vector3 d = Vector3(1.0f, -2.0f, 3.0f).normalized();
+    const SH4     b = SH4::basis(d);
+    REQUIRE(near(b[0] * b[0] + b[1] * b[1] + b[2] * b[2] + b[3] * b[3],
+                 (1.0f + 3.0f) / (4.0f * Pi<float>)));
+
+    // Addition theorem: sum of squared basis values of a band is (2l + 1) / 4pi.
+    const SH9 b9 = SH9::basis(d);
+    float     sum = 0;
+    for (std::size_t i = 4; i < 9; ++i)
+        sum += b9[i] * b9[i];
+    REQUIRE(near(sum, 5.0f / (4.0f * Pi<float>)));
+}
+
+TEST_CASE("Spherical harmonics arithmetic", "[SphericalHarmonics]") {
+    const SH9 a = makeSH9();
+    const SH9 b = a * 2.0f;
+    const Vector3 d = Vector3(0.3f, 0.4f, -0.5f).normalized();
+
+    REQUIRE(near((a + b).evaluate(d), 3.0f * a.evaluate(d)));
+    REQUIRE(near((b - a).evaluate(d), a.evaluate(d)));
+    REQUIRE(near((b / 2.0f).evaluate(d), a.evaluate(d)));
+    REQUIRE((0.5f * b) == a);
+    REQUIRE(a != b);
+
+    SH9RGB rgb;
+    rgb.addSample(d, Vector3(1.0f, 2.0f, 3.0f));
+    const SH9 scalar = SH9::fromSample(d, 2.0f);
+    REQUIRE(near(rgb.evaluate(d).y, scalar.evaluate(d)));
+}
+
+TEST_CASE("Spherical harmonics rotation", "[SphericalHarmonics]") {
+    const Quaternion q(Vector3(1.0f, -2.0f, 0.5f).normalized(), 1.1f);
+    const Matrix4    m = q.toMatrix();
+    const Matrix3    r(Vector3(m[0][0], m[0][1], m[0][2]), Vector3(m[1][0], m[1][1], m[1][2]),
+                       Vector3(m[2][0], m[2][1], m[2][2]));
+
+    const SH9 sh        = makeSH9();
+    const SH9 rotated   = sh.rotated(q);
+    const SH9 rotatedM  = sh.rotated(r);
+    const SH4 sh4       = SH4::fromSample(Vector3(0.0f, 0.0f, 1.0f), 1.0f);
+    const SH4 rotated4  = sh4.rotated(q);
+    const SH9 identity  = sh.rotated(Quaternion(1.0f));
+    const SH9 roundTrip = rotated.rotated(q.conjugated());
+
+    for (const Vector3 d : randomDirections(64)) {
+        const Vector3 target = rotate(q, d);
+        REQUIRE(near(target, d * r));
+        REQUIRE(near(rotated.evaluate(target), sh.evaluate(d)));
+        REQUIRE(near(rotatedM.evaluate(target), sh.evaluate(d)));
+        REQUIRE(near(rotated4.evaluate(target), sh4.evaluate(d)));
+        REQUIRE(near(identity.evaluate(d), sh.evaluate(d)));
+        REQUIRE(near(roundTrip.evaluate(d), sh.evaluate(d)));
+    }
+
+    SH9RGB rgb;
+    for (std::size_t i = 0; i < SH9::Size; ++i)
+        rgb[i] = Vector3(sh[i], -sh[i], 2.0f * sh[i]);
+
+    const SH9RGB rotatedRGB = rgb.rotated(q);
+    for (std::size_t i = 0; i < SH9::Size; ++i) {
+        REQUIRE(near(rotatedRGB[i].x, rotated[i]));
+        REQUIRE(near(rotatedRGB[i].z, 2.0f * rotated[i]));
+    }
+}
+
+TEST_CASE("Spherical harmonics irradiance", "[SphericalHarmonics]") {
+    // Radiance L(d) = a + dot(b, d) lies in band 0 and 1, so irradiance is exact:
+    // E(n) = pi * a + 2pi / 3 * dot(b, n).
+    const float   a = 2.0f;
+    const Vector3 b(0.3f, -0.5f, 0.7f);
+
+    SH4 radiance;
+    radiance[0] = a * 2.0f * ink::sqrt(Pi<float>);
+    radiance[1] = b.y / 0.488602511902919922f;
+    radiance[2] = b.z / 0.488602511902919922f;
+    radiance[3] = b.x / 0.488602511902919922f;
+
+    for (const Vector3 n : randomDirections(64)) {
+        REQUIRE(near(radiance.evaluate(n), a + dot(b, n)));
+        REQUIRE(near(radiance.irradiance(n), Pi<float> * a + 2.0f * Pi<float> / 3.0f * dot(b, n)));
+        REQUIRE(near(radiance.convolved().evaluate(n), radiance.irradiance(n)));
+    }
+}
+
+TEST_CASE("Spherical harmonics batch projection", "[SphericalHarmonics]") {
+    constexpr std::size_t Count = 100003;
+
+    const std::vector<Vector3> directions = randomDirections(Count);
+    std::vector<float>         values(Count);
+    std::vector<Vector3>       colors(Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        const Vector3 d = directions[i];
+        values[i]       = 1.0f + d.x - 2.0f * d.y * d.z;
+        colors[i]       = Vector3(values[i], 2.0f * values[i], d.z);
+    }
+
+    const SH9    sh  = projectSamples<9>(directions.data(), values.data(), Count);
+    const SH9RGB rgb = projectSamples<9>(directions.data(), colors.data(), Count);
+
+    double reference[9] = {};
+    for (std::size_t i = 0; i < Count; ++i) {
+        const SH9 b = SH9::basis(directions[i]);
+        for (std::size_t j = 0; j < 9; ++j)
+            reference[j] += static_cast<double>(values[i] * b[j]);
+    }
+
+    const float scale = 4.0f * Pi<float> / static_cast<float>(Count);
+    for (std::size_t j = 0; j < 9; ++j) {
+        REQUIRE(near(sh[j], static_cast<float>(reference[j]) * scale, 1e-3f));
+        REQUIRE(near(rgb[j].x, sh[j]));
+        REQUIRE(near(rgb[j].y, 2.0f * sh[j]));
+    }
+
+    // Monte Carlo estimate of the projected function.
+    REQUIRE(near(sh[0], 2.0f * ink::sqrt(Pi<float>), 3e-2f));
+    REQUIRE(near(sh[3], 1.0f / 0.488602511902919922f, 3e-2f));
+    REQUIRE(near(sh[5], -2.0f / 1.09254843059207907f, 3e-2f));
+
+    // Projection is deterministic.
+    REQUIRE(projectSamples<9>(directions.data(), values.data(), Count) == sh);
+    REQUIRE(projectSamples<4>(directions.data(), values.data(), 0) == SH4());
+}
+
+TEST_CASE("Spherical harmonics cubemap projection", "[SphericalHarmonics]") {
+    constexpr std::size_t Size = 67;
+
+    std::vector<float> texels[6];
+    for (auto &face : texels)
+        face.assign(Size * Size, 0.0f);
+
+    // Light only comes from +X face.
+    std::fill(texels[0].begin(), texels[0].end(), 1.0f);
+    const float *faces[6] = {texels[0].data(), texels[1].data(), texels[2].data(),
+                             texels[3].data(), texels[4].data(), texels[5].data()};
+
+    const SH9 sh = projectCubemap<9>(faces, Size);
+    REQUIRE(near(sh[0], 4.0f * Pi<float> / 6.0f * 0.282094791773878143f, 1e-3f));
+    REQUIRE(sh[3] > 0.1f);
+    REQUIRE(std::abs(sh[1]) < 1e-4f);
+    REQUIRE(std::abs(sh[2]) < 1e-4f);
+    REQUIRE(sh.irradiance(Vector3(1.0f, 0.0f, 0.0f)) > sh.irradiance(Vector3(-1.0f, 0.0f, 0.0f)));
+
+    // Projection of a basis function is the corresponding unit coefficient.
+    std::vector<Vector3> rgbTexels[6];
+    const float          invSize = 2.0f / static_cast<float>(Size);
+    for (std::size_t face = 0; face < 6; ++face) {
+        rgbTexels[face].resize(Size * Size);
+        for (std::size_t y = 0; y < Size; ++y) {
+            for (std::size_t x = 0; x < Size; ++x) {
+                const float   u = (static_cast<float>(x) + 0.5f) * invSize - 1.0f;
+                const float   v = (static_cast<float>(y) + 0.5f) * invSize - 1.0f;
+                const Vector3 d = detail::cubemapDirection(face, u, v).normalized();
+                const SH9     b = SH9::basis(d);
+                rgbTexels[face][y * Size + x] = Vector3(b[0], b[4], b[6]);
+            }
+        }
+    }
+
+    const Vector3 *rgbFaces[6] = {rgbTexels[0].data(), rgbTexels[1].data(), rgbTexels[2].data(),
+                                  rgbTexels[3].data(), rgbTexels[4].data(), rgbTexels[5].data()};
+
+    const SH9RGB rgb = projectCubemap<9>(rgbFaces, Size);
+    for (std::size_t i = 0; i < SH9::Size; ++i) {
+        REQUIRE(near(rgb[i].x, i == 0 ? 1.0f : 0.0f, 1e-3f));
+        REQUIRE(near(rgb[i].y, i == 4 ? 1.0f : 0.0f, 1e-3f));
+        REQUIRE(near(rgb[i].z, i == 6 ? 1.0f : 0.0f, 1e-3f));
+    }
+}
+
+TEST_CASE("Spherical harmonics batch evaluation", "[SphericalHarmonics]") {
+    constexpr std::size_t Count = 1003;
+
+    const std::vector<Vector3> directions = randomDirections(Count);
+    const SH9                  sh         = makeSH9();
+
+    SH4RGB rgb;
+    for (std::size_t i = 0; i < SH4RGB::Size; ++i)
+        rgb[i] = Vector3(sh[i], 1.0f, -sh[i]);
+
+    std::vector<float>   values(Count);
+    std::vector<Vector3> colors(Count);
+    evaluate(sh, directions.data(), values.data(), Count);
+    evaluate(rgb, directions.data(), colors.data(), Count);
+
+    for (std::size_t i = 0; i < Count; ++i) {
+        REQUIRE(near(values[i], sh.evaluate(directions[i])));
+        REQUIRE(near(colors[i], rgb.evaluate(directions[i])));
+    }
+}
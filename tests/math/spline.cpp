@@ -0,0 +1,180 @@
+#include <ink/math/numbers.hpp>
+#include <ink/math/spline.hpp>
+
+#include <vector>
+
+using namespace ink;
+
+static auto near(float a, float b, float eps = 1e-4f) noexcept -> bool {
+    return std::abs(a - b) <= eps * std::max(1.0f, std::abs(a));
+}
+
+static auto near(Vector3 a, Vector3 b, float eps = 1e-4f) noexcept -> bool {
+    return near(a.x, b.x, eps) && near(a.y, b.y, eps) && near(a.z, b.z, eps);
+}
+
+static auto near(Quaternion a, Quaternion b) noexcept -> bool {
+    // q and -q are the same rotation.
+    return std::abs(std::abs(dot(a, b)) - 1.0f) <= 1e-4f;
+}
+
+TEST_CASE("Spline segments", "[Spline]") {
+    const Vector3 p0(0.0f, 0.0f, 0.0f);
+    const Vector3 p1(1.0f, 2.0f, 0.0f);
+    const Vector3 p2(3.0f, 2.0f, 1.0f);
+    const Vector3 p3(4.0f, 0.0f, -1.0f);
+
+    STATIC_REQUIRE(bezier(0.0f, 1.0f, 2.0f, 3.0f, 0.5f) == 1.5f);
+    STATIC_REQUIRE(catmullRom(0.0f, 1.0f, 2.0f, 3.0f, 0.25f) == 1.25f);
+    STATIC_REQUIRE(bspline(5.0f, 5.0f, 5.0f, 5.0f, 0.3f) == 5.0f);
+    STATIC_REQUIRE(hermite(0.0f, 1.0f, 1.0f, 1.0f, 0.5f) == 0.5f);
+
+    REQUIRE(near(bezier(p0, p1, p2, p3, 0.0f), p0));
+    REQUIRE(near(bezier(p0, p1, p2, p3, 1.0f), p3));
+    REQUIRE(near(catmullRom(p0, p1, p2, p3, 0.0f), p1));
+    REQUIRE(near(catmullRom(p0, p1, p2, p3, 1.0f), p2));
+    REQUIRE(near(hermite(p0, p1, p3, p2, 0.0f), p0));
+    REQUIRE(near(hermite(p0, p1, p3, p2, 1.0f), p3));
+
+    // B-spline starts at (p0 + 4 * p1 + p2) / 6.
+    REQUIRE(near(bspline(p0, p1, p2, p3, 0.0f), (p0 + 4.0f * p1 + p2) / 6.0f));
+
+    // Catmull-Rom tangent at p1 is (p2 - p0) / 2, which matches Hermite with the same tangents.
+    for (float t = 0.0f; t <= 1.0f; t += 0.125f) {
+        const Vector3 expected = hermite(p1, (p2 - p0) * 0.5f, p2, (p3 - p1) * 0.5f, t);
+        REQUIRE(near(catmullRom(p0, p1, p2, p3, t), expected));
+    }
+
+    // Bezier is the same as de Casteljau's algorithm.
+    for (float t = 0.0f; t <= 1.0f; t += 0.125f) {
+        const Vector3 a = lerp(lerp(p0, p1, t), lerp(p1, p2, t), t);
+        const Vector3 b = lerp(lerp(p1, p2, t), lerp(p2, p3, t), t);
+        REQUIRE(near(bezier(p0, p1, p2, p3, t), lerp(a, b, t)));
+    }
+}
+
+TEST_CASE("Spline batch evaluation", "[Spline]") {
+    const Vector3 p0(0.0f, 1.0f, 0.0f);
+    const Vector3 p1(1.0f, 2.0f, 0.5f);
+    const Vector3 p2(3.0f, -2.0f, 1.0f);
+    const Vector3 p3(4.0f, 0.0f, -1.0f);
+
+    const Vector3 points[] = {p0, p1, p2, p3, Vector3(5.0f), Vector3(6.0f, 0.0f, 1.0f)};
+
+    // Sizes that are not multiples of 8 cover the partial tail.
+    for (std::size_t count : {std::size_t(0), std::size_t(5), std::size_t(37)}) {
+        std::vector<float> t(count);
+        for (std::size_t i = 0; i < count; ++i)
+            t[i] = static_cast<float>(i) / static_cast<float>(count) * 1.2f - 0.1f;
+
+        std::vector<Vector3> out(count);
+
+        hermite(p0, p1, p2, p3, t.data(), out.data(), count);
+        for (std::size_t i = 0; i < count; ++i)
+            REQUIRE(near(out[i], hermite(p0, p1, p2, p3, t[i])));
+
+        bezier(p0, p1, p2, p3, t.data(), out.data(), count);
+        for (std::size_t i = 0; i < count; ++i)
+            REQUIRE(near(out[i], bezier(p0, p1, p2, p3, t[i])));
+
+        catmullRom(p0, p1, p2, p3, t.data(), out.data(), count);
+        for (std::size_t i = 0; i < count; ++i)
+            REQUIRE(near(out[i], catmullRom(p0, p1, p2, p3, t[i])));
+
+        bspline(p0, p1, p2, p3, t.data(), out.data(), count);
+        for (std::size_t i = 0; i < count; ++i)
+            REQUIRE(near(out[i], bspline(p0, p1, p2, p3, t[i])));
+
+        catmullRomPath(points, 6, t.data(), out.data(), count);
+        for (std::size_t i = 0; i < count; ++i)
+            REQUIRE(near(out[i], catmullRomPath(points, 6, t[i])));
+
+        bsplinePath(points, 6, t.data(), out.data(), count);
+        for (std::size_t i = 0; i < count; ++i)
+            REQUIRE(near(out[i], bsplinePath(points, 6, t[i])));
+    }
+}
+
+TEST_CASE("Spline paths", "[Spline]") {
+    const Vector3 points[] = {Vector3(0.0f), Vector3(1.0f, 2.0f, 0.0f), Vector3(3.0f, 2.0f, 1.0f),
+                              Vector3(4.0f, 0.0f, -1.0f), Vector3(6.0f)};
+
+    // Catmull-Rom paths go through all points, and parameters are clamped.
+    for (std::size_t i = 0; i < 5; ++i)
+        REQUIRE(near(catmullRomPath(points, 5, static_cast<float>(i) * 0.25f), points[i]));
+    REQUIRE(near(catmullRomPath(points, 5, -1.0f), points[0]));
+    REQUIRE(near(catmullRomPath(points, 5, 2.0f), points[4]));
+    REQUIRE(near(catmullRomPath(points, 5, 0.375f), catmullRom(points[0], points[1], points[2],
+                                                               points[3], 0.5f)));
+
+    // Paths are continuous at the knots.
+    for (std::size_t i = 1; i < 4; ++i) {
+        const float t = static_cast<float>(i) * 0.25f;
+        REQUIRE(near(catmullRomPath(points, 5, t - 1e-4f), catmullRomPath(points, 5, t), 1e-2f));
+        REQUIRE(near(bsplinePath(points, 5, t - 1e-4f), bsplinePath(points, 5, t), 1e-2f));
+    }
+
+    REQUIRE(catmullRomPath(points, 1, 0.5f) == points[0]);
+}
+
+TEST_CASE("Squad", "[Spline]") {
+    const Vector3    axis = Vector3(1.0f, 2.0f, 3.0f).normalized();
+    const Quaternion q0(axis, 0.0f);
+    const Quaternion q1(axis, 0.5f);
+    const Quaternion q2(axis, 1.0f);
+    const Quaternion q3(axis, 1.5f);
+
+    // Rotations around the same axis at constant speed have no curvature, so the control point
+    // is the rotation itself and squad is the same as slerp.
+    const Quaternion a = squadControlPoint(q0, q1, -q2);
+    const Quaternion b = squadControlPoint(q1, q2, q3);
+    REQUIRE(near(a, q1));
+    REQUIRE(near(b, q2));
+    for (float t = 0.0f; t <= 1.0f; t += 0.125f)
+        REQUIRE(near(squad(q1, a, b, q2, t), slerp(q1, q2, t)));
+
+    // Squad interpolates the end points and keeps unit length.
+    const Quaternion r0(Vector3(0.0f, 1.0f, 0.0f), 0.3f);
+    const Quaternion r1(Vector3(1.0f, 0.0f, 0.0f), 1.2f);
+    const Quaternion r2(Vector3(0.0f, 0.0f, 1.0f), -0.7f);
+    const Quaternion r3(Vector3(0.0f, 1.0f, 0.0f), 2.0f);
+    const Quaternion c = squadControlPoint(r0, r1, r2);
+    const Quaternion d = squadControlPoint(r1, r2, r3);
+    REQUIRE(near(squad(r1, c, d, r2, 0.0f), r1));
+    REQUIRE(near(squad(r1, c, d, r2, 1.0f), r2));
+    for (float t = 0.0f; t <= 1.0f; t += 0.125f)
+        REQUIRE(near(squad(r1, c, d, r2, t).length(), 1.0f));
+}
+
+TEST_CASE("Arc length table", "[Spline]") {
+    // The curve moves along x with non-uniform speed.
+    const ArcLengthTable line([](float u) { return Vector3(u * u * 10.0f, 0.0f, 0.0f); }, 256);
+    REQUIRE(near(line.length(), 10.0f));
+    REQUIRE(line.parameter(-1.0f) == 0.0f);
+    REQUIRE(line.parameter(20.0f) == 1.0f);
+    for (float d = 0.5f; d <= 10.0f; d += 0.5f)
+        REQUIRE(near(line.parameter(d), std::sqrt(d / 10.0f), 2e-3f));
+
+    const auto circleCurve = [](float u) {
+        return Vector3(std::cos(u * 2.0f * Pi<float>), std::sin(u * 2.0f * Pi<float>), 0.0f);
+    };
+    const ArcLengthTable circle(circleCurve, 512);
+    REQUIRE(near(circle.length(), 2.0f * Pi<float>, 1e-4f));
+
+    // Batch lookup walks forward for ascending distances and searches again otherwise.
+    std::vector<float> distances;
+    for (float d = -0.5f; d <= 11.0f; d += 0.05f)
+        distances.push_back(d);
+    distances.push_back(3.0f);
+    distances.push_back(0.0f);
+    distances.push_back(9.0f);
+
+    std::vector<float> parameters(distances.size());
+    line.parameters(distances.data(), parameters.data(), distances.size());
+    for (std::size_t i = 0; i < distances.size(); ++i)
+        REQUIRE(parameters[i] == line.parameter(distances[i]));
+
+    const ArcLengthTable empty;
+    REQUIRE(empty.length() == 0.0f);
+    REQUIRE(empty.parameter(1.0f) == 0.0f);
+}
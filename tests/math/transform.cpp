@@ -0,0 +1,138 @@
+#include <ink/math/numbers.hpp>
+#include <ink/math/transform.hpp>
+
+using namespace ink;
+
+static auto near(float a, float b, float eps = 1e-5f) noexcept -> bool {
+    return std::abs(a - b) <= eps;
+}
+
+static auto near(Vector3 a, Vector3 b) noexcept -> bool {
+    return near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z);
+}
+
+static auto near(Vector4 a, Vector4 b) noexcept -> bool {
+    return near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z) && near(a.w, b.w);
+}
+
+static auto near(const Matrix4 &a, const Matrix4 &b) noexcept -> bool {
+    return near(a[0], b[0]) && near(a[1], b[1]) && near(a[2], b[2]) && near(a[3], b[3]);
+}
+
+static auto near(const Transform &a, const Transform &b) noexcept -> bool {
+    return near(a.toMatrix4(), b.toMatrix4());
+}
+
+TEST_CASE("Quaternion rotate vector", "[Transform]") {
+    const Quaternion q(Vector3(1.0f, 2.0f, 3.0f).normalized(), Pi<float> * 0.3f);
+    const Vector3    v(0.5f, -1.0f, 2.0f);
+    const Vector4    expected = Vector4(v, 0.0f) * q.toMatrix();
+    REQUIRE(near(rotate(q, v), Vector3(expected.x, expected.y, expected.z)));
+}
+
+TEST_CASE("Transform to matrix", "[Transform]") {
+    const Transform identity;
+    REQUIRE(near(identity.toMatrix4(), Matrix4(1.0f)));
+
+    const Transform t(Vector3(1.0f, -2.0f, 3.0f),
+                      Quaternion(Vector3(1.0f, 2.0f, 3.0f).normalized(), Pi<float> * 0.3f),
+                      Vector3(2.0f, 0.5f, 1.5f));
+
+    const Matrix4 expected =
+        Matrix4(1.0f).scaled(t.scale).rotated(t.rotation).translated(t.translation);
+    REQUIRE(near(t.toMatrix4(), expected));
+    REQUIRE(Matrix3x4(t.toMatrix4()) == t.toMatrix3x4());
+
+    const Vector3 p(0.5f, -1.0f, 2.0f);
+    const Vector4 point     = Vector4(p, 1.0f) * expected;
+    const Vector4 direction = Vector4(p, 0.0f) * expected;
+    REQUIRE(near(t.transformPoint(p), Vector3(point.x, point.y, point.z)));
+    REQUIRE(near(t.transformDirection(p), Vector3(direction.x, direction.y, direction.z)));
+}
+
+TEST_CASE("Quaternion from matrix", "[Transform]") {
+    // Small angles take the trace branch of Shepperd's method. Angles close to pi around each axis
+    // take the diagonal branches.
+    const Vector3 axes[] = {Vector3(1.0f, 0.1f, -0.2f), Vector3(0.1f, 1.0f, 0.3f),
+                            Vector3(-0.2f, 0.1f, 1.0f), Vector3(1.0f, 2.0f, 3.0f)};
+    for (const Vector3 &axis : axes) {
+        for (float angle : {0.0f, 0.3f, 2.0f, 3.1f, -3.1f}) {
+            const Quaternion q(axis.normalized(), angle);
+            const Quaternion r = Quaternion::fromMatrix(q.toMatrix());
+            REQUIRE(near(std::abs(dot(q, r)), 1.0f));
+            REQUIRE(near(r.toMatrix(), q.toMatrix()));
+        }
+    }
+
+    constexpr Quaternion identity = Quaternion::fromMatrix(Matrix4(1.0f));
+    STATIC_REQUIRE(identity == Quaternion(1.0f));
+}
+
+TEST_CASE("Matrix decompose", "[Transform]") {
+    const Vector3    translation(1.0f, -2.0f, 3.0f);
+    const Quaternion rotation(Vector3(1.0f, 2.0f, 3.0f).normalized(), Pi<float> * 0.9f);
+    const Vector3    scale(2.0f, 0.5f, 1.5f);
+
+    const Matrix4 m = Matrix4(1.0f).scaled(scale).rotated(rotation).translated(translation);
+
+    Vector3    t;
+    Quaternion r;
+    Vector3    s;
+    decompose(m, t, r, s);
+    REQUIRE(near(t, translation));
+    REQUIRE(near(s, scale));
+    REQUIRE(near(std::abs(dot(r, rotation)), 1.0f));
+    REQUIRE(near(Transform(m).toMatrix4(), m));
+
+    // Mirroring is moved to scale along X axis.
+    const Matrix4 mirrored = Matrix4(1.0f).scaled(Vector3(1.0f, -2.0f, 1.0f)).rotated(rotation);
+    decompose(mirrored, t, r, s);
+    REQUIRE(near(s, Vector3(-1.0f, 2.0f, 1.0f)));
+    REQUIRE(near(r.length(), 1.0f));
+    REQUIRE(near(Transform(mirrored).toMatrix4(), mirrored));
+}
+
+TEST_CASE("Transform compose and inverse", "[Transform]") {
+    const Transform a(Vector3(1.0f, -2.0f, 3.0f),
+                      Quaternion(Vector3(1.0f, 2.0f, 3.0f).normalized(), Pi<float> * 0.3f),
+                      Vector3(2.0f, 0.5f, 1.5f));
+    const Transform b(Vector3(-4.0f, 0.5f, 2.0f),
+                      Quaternion(Vector3(0.0f, 1.0f, 0.0f), Pi<float> * -0.6f), Vector3(3.0f));
+
+    REQUIRE(near((a * b).toMatrix4(), a.toMatrix4() * b.toMatrix4()));
+
+    Transform c = a;
+    c *= b;
+    REQUIRE(c == a * b);
+
+    // Inverse is exact for uniform scale.
+    REQUIRE(near(b.inversed().toMatrix4(), b.toMatrix4().inversed()));
+    REQUIRE(near(b * b.inversed(), Transform()));
+
+    Transform d = b;
+    d.inverse();
+    REQUIRE(d == b.inversed());
+}
+
+TEST_CASE("Transform interpolation", "[Transform]") {
+    const Transform a(Vector3(1.0f, -2.0f, 3.0f),
+                      Quaternion(Vector3(0.0f, 0.0f, 1.0f), Pi<float> * 0.2f), Vector3(1.0f));
+    const Transform b(Vector3(3.0f, 2.0f, -1.0f),
+                      Quaternion(Vector3(0.0f, 0.0f, 1.0f), Pi<float> * 0.6f), Vector3(3.0f));
+
+    REQUIRE(near(lerp(a, b, 0.0f), a));
+    REQUIRE(near(lerp(a, b, 1.0f), b));
+    REQUIRE(near(slerp(a, b, 0.0f), a));
+    REQUIRE(near(slerp(a, b, 1.0f), b));
+
+    const Transform expected(Vector3(2.0f, 0.0f, 1.0f),
+                             Quaternion(Vector3(0.0f, 0.0f, 1.0f), Pi<float> * 0.4f),
+                             Vector3(2.0f));
+    REQUIRE(near(lerp(a, b, 0.5f), expected));
+    REQUIRE(near(slerp(a, b, 0.5f), expected));
+
+    // Interpolate along the shortest path.
+    const Transform flipped(b.translation, -b.rotation, b.scale);
+    REQUIRE(near(lerp(a, flipped, 0.5f), expected));
+    REQUIRE(near(slerp(a, flipped, 0.5f), expected));
+}
@@ -0,0 +1,204 @@
+#include <ink/math/wide.hpp>
+
+using namespace ink;
+
+static auto near(float a, float b) noexcept -> bool {
+    return std::abs(a - b) <= 1e-5f * std::max(1.0f, std::abs(a));
+}
+
+static auto near(Vector3 a, Vector3 b) noexcept -> bool {
+    return near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z);
+}
+
+static auto near(Vector4 a, Vector4 b) noexcept -> bool {
+    return near(a[0], b[0]) && near(a[1], b[1]) && near(a[2], b[2]) && near(a[3], b[3]);
+}
+
+static auto near(Quaternion a, Quaternion b) noexcept -> bool {
+    return near(a.w, b.w) && near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z);
+}
+
+static auto sample(std::size_t i, std::size_t k) noexcept -> float {
+    return static_cast<float>((i * 7 + k * 13) % 17) * 0.25f - 2.0f;
+}
+
+TEST_CASE("Float8 operations", "[Wide]") {
+    float a[8], b[8];
+    for (std::size_t i = 0; i < 8; ++i) {
+        a[i] = sample(i, 0);
+        b[i] = sample(i, 1) + 5.0f;
+    }
+
+    const Float8 wa(a);
+    const Float8 wb(b);
+
+    const Float8 sum  = wa + wb;
+    const Float8 diff = wa - wb;
+    const Float8 prod = wa * wb;
+    const Float8 quot = wa / wb;
+    const Float8 sel  = select(wa < 0.0f, -wa, wa);
+    const Float8 lo   = min(wa, wb);
+    const Float8 hi   = max(wa, wb);
+    const Float8 root = sqrt(wb);
+
+    for (std::size_t i = 0; i < 8; ++i) {
+        REQUIRE(sum[i] == a[i] + b[i]);
+        REQUIRE(diff[i] == a[i] - b[i]);
+        REQUIRE(prod[i] == a[i] * b[i]);
+        REQUIRE(quot[i] == a[i] / b[i]);
+        REQUIRE(sel[i] == std::abs(a[i]));
+        REQUIRE(abs(wa)[i] == std::abs(a[i]));
+        REQUIRE(lo[i] == std::min(a[i], b[i]));
+        REQUIRE(hi[i] == std::max(a[i], b[i]));
+        REQUIRE(root[i] == std::sqrt(b[i]));
+    }
+
+    float stored[8];
+    wa.store(stored);
+    for (std::size_t i = 0; i < 8; ++i)
+        REQUIRE(stored[i] == a[i]);
+
+    const Float8  negative = wa < 0.0f;
+    const Float8  small    = wa < 1.0f;
+    std::uint32_t bitsAnd  = 0;
+    std::uint32_t bitsOr   = 0;
+    for (std::size_t i = 0; i < 8; ++i) {
+        bitsAnd |= (a[i] < 0.0f && a[i] < 1.0f ? 1U : 0U) << i;
+        bitsOr |= (a[i] < 0.0f || a[i] >= 1.0f ? 1U : 0U) << i;
+    }
+    REQUIRE(maskBits(negative & small) == bitsAnd);
+    REQUIRE(maskBits(negative | (wa >= 1.0f)) == bitsOr);
+    REQUIRE(maskBits(small) == (maskBits(negative) | maskBits(small)));
+}
+
+TEST_CASE("Vector3x8 operations", "[Wide]") {
+    Vector3 a[8], b[8];
+    for (std::size_t i = 0; i < 8; ++i) {
+        a[i] = Vector3(sample(i, 0), sample(i, 1), sample(i, 2)) + Vector3(0.5f);
+        b[i] = Vector3(sample(i, 3), sample(i, 4), sample(i, 5));
+    }
+
+    const Vector3x8 wa(a);
+    const Vector3x8 wb(b);
+
+    Vector3 sum[8], crossed[8], normalized[8], lerped[8];
+    (wa + wb).store(sum);
+    cross(wa, wb).store(crossed);
+    wa.normalized().store(normalized);
+    lerp(wa, wb, 0.25f).store(lerped);
+
+    const Float8 dots = dot(wa, wb);
+    for (std::size_t i = 0; i < 8; ++i) {
+        REQUIRE(near(sum[i], a[i] + b[i]));
+        REQUIRE(near(crossed[i], cross(a[i], b[i])));
+        REQUIRE(near(normalized[i], a[i].normalized()));
+        REQUIRE(near(lerped[i], lerp(a[i], b[i], 0.25f)));
+        REQUIRE(near(dots[i], dot(a[i], b[i])));
+    }
+
+    // Partial load and store.
+    Vector3 partial[8] = {};
+    Vector3x8(a, 3).store(partial, 5);
+    for (std::size_t i = 0; i < 3; ++i)
+        REQUIRE(partial[i] == a[i]);
+    for (std::size_t i = 3; i < 5; ++i)
+        REQUIRE(partial[i] == Vector3(0.0f));
+}
+
+TEST_CASE("Vector4x8 operations", "[Wide]") {
+    Vector4 a[8], b[8];
+    for (std::size_t i = 0; i < 8; ++i) {
+        a[i] = Vector4(sample(i, 0), sample(i, 1), sample(i, 2), sample(i, 3)) + Vector4(0.5f);
+        b[i] = Vector4(sample(i, 4), sample(i, 5), sample(i, 6), sample(i, 7));
+    }
+
+    const Vector4x8 wa(a);
+    const Vector4x8 wb(b);
+
+    Vector4 loaded[8], product[8], normalized[8], clamped[8];
+    wa.store(loaded);
+    (wa * wb).store(product);
+    wa.normalized().store(normalized);
+    clamp(wa, Vector4x8(Vector4(-1.0f)), Vector4x8(Vector4(1.0f))).store(clamped);
+
+    for (std::size_t i = 0; i < 8; ++i) {
+        REQUIRE(loaded[i] == a[i]);
+        REQUIRE(near(product[i], a[i] * b[i]));
+        REQUIRE(near(normalized[i], a[i].normalized()));
+        REQUIRE(near(clamped[i], clamp(a[i], Vector4(-1.0f), Vector4(1.0f))));
+    }
+
+    Vector4 partial[8] = {};
+    Vector4x8(a, 6).store(partial, 7);
+    for (std::size_t i = 0; i < 6; ++i)
+        REQUIRE(partial[i] == a[i]);
+    REQUIRE(partial[6] == Vector4(0.0f));
+}
+
+TEST_CASE("Quaternionx8 operations", "[Wide]") {
+    Quaternion a[8], b[8];
+    for (std::size_t i = 0; i < 8; ++i) {
+        a[i] = Quaternion(sample(i, 0) + 0.5f, sample(i, 1), sample(i, 2), sample(i, 3));
+        b[i] = Quaternion(sample(i, 4), sample(i, 5), sample(i, 6) + 0.5f, sample(i, 7));
+        a[i].normalize();
+        b[i].normalize();
+    }
+
+    // Parallel quaternions take the nlerp path.
+    b[7] = a[7];
+
+    const Quaternionx8 wa(a);
+    const Quaternionx8 wb(b);
+
+    Quaternion loaded[8], product[8], nlerped[8], slerped[8];
+    wa.store(loaded);
+    (wa * wb).store(product);
+    nlerp(wa, wb, 0.3f).store(nlerped);
+    slerp(wa, wb, 0.3f).store(slerped);
+
+    for (std::size_t i = 0; i < 8; ++i) {
+        REQUIRE(loaded[i] == a[i]);
+        REQUIRE(near(product[i], a[i] * b[i]));
+        REQUIRE(near(nlerped[i], nlerp(a[i], b[i], 0.3f)));
+        REQUIRE(near(slerped[i], slerp(a[i], b[i], 0.3f)));
+    }
+}
+
+TEST_CASE("Matrix4x8 operations", "[Wide]") {
+    Matrix4 a[8], b[8];
+    Vector4 v[8];
+    for (std::size_t i = 0; i < 8; ++i) {
+        for (std::size_t c = 0; c < 4; ++c) {
+            a[i][c] = Vector4(sample(i, c), sample(i, c + 4), sample(i, c + 8), sample(i, c + 12));
+            b[i][c] = Vector4(sample(i, c + 1), sample(i, c + 3), sample(i, c + 5), sample(i, c));
+        }
+        v[i] = Vector4(sample(i, 2), sample(i, 9), sample(i, 11), 1.0f);
+    }
+
+    const Matrix4x8 wa(a);
+    const Matrix4x8 wb(b);
+    const Vector4x8 wv(v);
+
+    Matrix4 loaded[8], product[8];
+    wa.store(loaded);
+    (wa * wb).store(product);
+
+    Vector4 mv[8], vm[8], uniformMv[8], uniformVm[8];
+    (wa * wv).store(mv);
+    (wv * wa).store(vm);
+    (a[0] * wv).store(uniformMv);
+    (wv * a[0]).store(uniformVm);
+
+    for (std::size_t i = 0; i < 8; ++i) {
+        REQUIRE(loaded[i] == a[i]);
+
+        const Matrix4 expected = a[i] * b[i];
+        for (std::size_t c = 0; c < 4; ++c)
+            REQUIRE(near(product[i][c], expected[c]));
+
+        REQUIRE(near(mv[i], a[i] * v[i]));
+        REQUIRE(near(vm[i], v[i] * a[i]));
+        REQUIRE(near(uniformMv[i], a[0] * v[i]));
+        REQUIRE(near(uniformVm[i], v[i] * a[0]));
+    }
+}